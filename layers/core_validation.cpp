@@ -60,6 +60,10 @@
 #include "vk_layer_data.h"
 #include "vk_layer_extension_utils.h"
 #include "vk_layer_utils.h"
+#include "vk_layer_async_queue.h"
+#include "vk_layer_handle_hash.h"
+#include "vk_layer_worker_pool.h"
+#include "vk_layer_rwlock.h"
 #include "spirv-tools/libspirv.h"
 
 #if defined __ANDROID__
@@ -76,6 +80,34 @@
 using namespace std;
 
 // TODO : CB really needs it's own class and files so this is just temp code until that happens
+GLOBAL_CB_NODE::GLOBAL_CB_NODE(block_pool *pool)
+    : memory(pool), cmds(&memory), framebuffers(&memory), object_bindings(&memory), broken_bindings(&memory),
+      waitedEvents(&memory), writeEventsBeforeWait(&memory), events(&memory), queryToStateMap(&memory), activeQueries(&memory),
+      startedQueries(&memory), imageLayoutMap(&memory), eventToStageMap(&memory), updateImages(&memory), updateBuffers(&memory),
+      validatedDescriptors(&memory), secondaryCommandBuffers(&memory), memObjs(&memory), deferredChecks(&memory) {}
+
+void GLOBAL_CB_NODE::resetRecordedState() {
+    memory.rewind();
+    arena_rebuild(cmds, &memory);
+    arena_rebuild(framebuffers, &memory);
+    arena_rebuild(object_bindings, &memory);
+    arena_rebuild(broken_bindings, &memory);
+    arena_rebuild(waitedEvents, &memory);
+    arena_rebuild(writeEventsBeforeWait, &memory);
+    arena_rebuild(events, &memory);
+    arena_rebuild(queryToStateMap, &memory);
+    arena_rebuild(activeQueries, &memory);
+    arena_rebuild(startedQueries, &memory);
+    arena_rebuild(imageLayoutMap, &memory);
+    arena_rebuild(eventToStageMap, &memory);
+    arena_rebuild(updateImages, &memory);
+    arena_rebuild(updateBuffers, &memory);
+    arena_rebuild(validatedDescriptors, &memory);
+    arena_rebuild(secondaryCommandBuffers, &memory);
+    arena_rebuild(memObjs, &memory);
+    arena_rebuild(deferredChecks, &memory);
+}
+
 GLOBAL_CB_NODE::~GLOBAL_CB_NODE() {
     for (uint32_t i=0; i<VK_PIPELINE_BIND_POINT_RANGE_SIZE; ++i) {
         // Make sure that no sets hold onto deleted CB binding
@@ -103,6 +135,18 @@ struct devExts {
 // fwd decls
 struct shader_module;
 
+// How many commands have been queued for async validation, and how many of those the worker has validated, for the
+//  command buffers that hash to one stripe.  Lets a command that is not queued wait for just its own command buffer's
+//  queued commands, see cbSyncedGlobalLock().
+struct ASYNC_CB_STRIPE {
+    ASYNC_CB_STRIPE() : queued(0), validated(0) {}
+    std::atomic<uint64_t> queued;
+    std::atomic<uint64_t> validated;
+    // Each stripe is written by whichever thread records into its command buffers, keep them off each other's cache line
+    char padding[64 - 2 * sizeof(std::atomic<uint64_t>)];
+};
+static const size_t ASYNC_CB_STRIPE_COUNT = 64;
+
 // TODO : Split this into separate structs for instance and device level data?
 struct layer_data {
     VkInstance instance;
@@ -141,10 +185,9 @@ struct layer_data {
     unordered_map<VkSemaphore, SEMAPHORE_NODE> semaphoreMap;
     unordered_map<VkCommandBuffer, GLOBAL_CB_NODE *> commandBufferMap;
     unordered_map<VkFramebuffer, unique_ptr<FRAMEBUFFER_NODE>> frameBufferMap;
-    unordered_map<VkImage, vector<ImageSubresourcePair>> imageSubresourceMap;
-    unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> imageLayoutMap;
+    unordered_map<VkImage, GLOBAL_IMAGE_LAYOUT_NODE> imageLayoutMap;
     unordered_map<VkRenderPass, RENDER_PASS_NODE *> renderPassMap;
-    unordered_map<VkShaderModule, unique_ptr<shader_module>> shaderModuleMap;
+    unordered_map<VkShaderModule, shared_ptr<shader_module>> shaderModuleMap;
     VkDevice device;
 
     // Device specific data
@@ -152,15 +195,25 @@ struct layer_data {
     VkPhysicalDeviceMemoryProperties phys_dev_mem_props;
     VkPhysicalDeviceFeatures physical_device_features;
     unique_ptr<PHYSICAL_DEVICE_STATE> physical_device_state;
+    // Set when lunarg_core_validation.async_validation is enabled, see replayAsyncCmd()
+    unique_ptr<async_record_queue> async_queue;
+    unique_ptr<ASYNC_CB_STRIPE[]> async_cb_stripes;
+    // Threads for validating vkCreate*Pipelines batches, started on first use, see validatePipelineBatch()
+    unsigned pipeline_worker_count;
+    std::mutex pipeline_workers_lock;
+    unique_ptr<worker_pool> pipeline_workers;
+    // Bumped when a buffer, buffer view, image, memory object or descriptor set goes away, which may make descriptors
+    //  that passed draw time validation before invalid, see validate_and_update_drawtime_descriptor_state()
+    uint64_t descriptor_resource_epoch;
 
     layer_data()
         : instance_state(nullptr), report_data(nullptr), device_dispatch_table(nullptr), instance_dispatch_table(nullptr),
           device_extensions(), device(VK_NULL_HANDLE), phys_dev_properties{}, phys_dev_mem_props{}, physical_device_features{},
-          physical_device_state(nullptr){};
+          physical_device_state(nullptr), pipeline_worker_count(0),
+          descriptor_resource_epoch(0){};
 };
 
-// TODO : Do we need to guard access to layer_data_map w/ lock?
-static unordered_map<void *, layer_data *> layer_data_map;
+static dispatch_key_map<layer_data> layer_data_map;
 
 static const VkLayerProperties global_layer = {
     "VK_LAYER_LUNARG_core_validation", VK_LAYER_API_VERSION, 1, "LunarG Validation Layer",
@@ -183,6 +236,18 @@ template <class TCreateInfo> void ValidateLayerOrdering(const TCreateInfo &creat
 // Code imported from shader_checker
 static void build_def_index(shader_module *);
 
+typedef std::pair<unsigned, unsigned> location_t;
+typedef std::pair<unsigned, unsigned> descriptor_slot_t;
+
+struct interface_var {
+    uint32_t id;
+    uint32_t type_id;
+    uint32_t offset;
+    bool is_patch;
+    bool is_block_member;
+    /* TODO: collect the name, too? Isn't required to be present. */
+};
+
 // A forward iterator over spirv instructions. Provides easy access to len, opcode, and content words
 // without the caller needing to care too much about the physical SPIRV module layout.
 struct spirv_inst_iter {
@@ -228,6 +293,19 @@ struct spirv_inst_iter {
     spirv_inst_iter const &operator*() const { return *this; }
 };
 
+/* What a pipeline needs to know about one entrypoint of a module, built the first time a pipeline uses it */
+struct entrypoint_reflection {
+    /* ids referenced by the static call tree of the entrypoint */
+    std::unordered_set<uint32_t> accessible_ids;
+    /* Uniform and UniformConstant variables among accessible_ids, by descriptor slot */
+    std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
+    /* Input and Output interfaces by location, indexed by [is output][is array of verts], built on demand */
+    std::map<location_t, interface_var> interfaces[2][2];
+    bool interfaces_built[2][2];
+
+    entrypoint_reflection() : interfaces_built() {}
+};
+
 struct shader_module {
     /* the spirv image itself */
     vector<uint32_t> words;
@@ -235,10 +313,37 @@ struct shader_module {
      * trees, constant expressions, etc requires jumping all over the instruction stream.
      */
     unordered_map<unsigned, unsigned> def_index;
+    /* Hash of words, modules with equal content are shared (see acquireShaderModule) */
+    uint64_t content_hash;
+    /* Whether the module passed SPIR-V validation when it was first created */
+    bool spirv_valid;
 
-    shader_module(VkShaderModuleCreateInfo const *pCreateInfo)
+    /* Everything below is filled in by build_def_index in the same pass, so the pipeline checks never
+     * have to walk the whole instruction stream.
+     */
+    /* offsets of OpEntryPoint and OpCapability instructions */
+    vector<unsigned> entrypoints;
+    vector<uint32_t> capabilities;
+    /* OpDecorate values by target id, for the decorations the interface checks care about */
+    unordered_map<unsigned, unsigned> var_locations;
+    unordered_map<unsigned, unsigned> var_builtins;
+    unordered_map<unsigned, unsigned> var_components;
+    unordered_map<unsigned, unsigned> var_sets;
+    unordered_map<unsigned, unsigned> var_bindings;
+    std::unordered_set<unsigned> blocks;
+    std::unordered_set<unsigned> var_patch;
+    /* offsets of OpMemberDecorate instructions by structure type id */
+    unordered_map<unsigned, vector<unsigned>> member_decorations;
+
+    /* Per-entrypoint reflection by OpEntryPoint offset. Modules may be shared by several devices, so this is
+     * the only mutable part of a module and is guarded by reflection_lock.
+     */
+    mutable std::mutex reflection_lock;
+    mutable unordered_map<unsigned, unique_ptr<entrypoint_reflection>> entrypoint_reflections;
+
+    shader_module(VkShaderModuleCreateInfo const *pCreateInfo, uint64_t content_hash, bool spirv_valid)
         : words((uint32_t *)pCreateInfo->pCode, (uint32_t *)pCreateInfo->pCode + pCreateInfo->codeSize / sizeof(uint32_t)),
-          def_index() {
+          def_index(), content_hash(content_hash), spirv_valid(spirv_valid) {
 
         build_def_index(this);
     }
@@ -259,8 +364,54 @@ struct shader_module {
     }
 };
 
-// TODO : This can be much smarter, using separate locks for separate global data
-static std::mutex global_lock;
+// Guards the object maps in layer_data and the nodes they own. Entry points that create, destroy or submit take it
+//  exclusively. Command buffer recording entry points take it shared (see cb_record_lock) so recording into distinct
+//  command buffers proceeds in parallel.
+static rw_lock global_lock;
+
+// In async validation mode, wait until every command queued for dev_data's worker has been validated
+static void flushAsyncValidation(const layer_data *dev_data) {
+    if (dev_data->async_queue)
+        dev_data->async_queue->flush();
+}
+
+// global_lock, once the async validation worker (if any) has caught up.  Every entry point that is not itself queued
+//  to the worker takes global_lock this way, so it sees state tracking for all earlier calls, and errors are reported
+//  in call order across QueueSubmit, DeviceWaitIdle and object destruction.  Must not be called with global_lock held.
+static rw_lock &syncedGlobalLock(const layer_data *dev_data) {
+    flushAsyncValidation(dev_data);
+    return global_lock;
+}
+
+static ASYNC_CB_STRIPE &getAsyncCBStripe(const layer_data *dev_data, VkCommandBuffer cb) {
+    return dev_data->async_cb_stripes[hash_handle(cb) & (ASYNC_CB_STRIPE_COUNT - 1)];
+}
+
+// global_lock, once the async validation worker (if any) has validated every command queued for cb.  Recording
+//  entry points that are not queued take global_lock this way, so they see state tracking for all earlier commands in
+//  cb without waiting on commands other threads queued for other command buffers after them.  Must not be called with
+//  global_lock held.
+static rw_lock &cbSyncedGlobalLock(const layer_data *dev_data, VkCommandBuffer cb) {
+    if (dev_data->async_queue) {
+        const ASYNC_CB_STRIPE &stripe = getAsyncCBStripe(dev_data, cb);
+        // Everything queued ahead of cb's last command was counted before it, so once the worker has validated this
+        //  many of the stripe's commands it has validated all of cb's
+        uint64_t queued = stripe.queued.load();
+        dev_data->async_queue->wait([&] { return stripe.validated.load(std::memory_order_acquire) >= queued; });
+    }
+    return global_lock;
+}
+
+// Object nodes are shared between command buffers, so the back-references that recording adds to them
+//  (cb_bindings, command_buffer_bindings) cannot rely on the shared hold of global_lock.  Inserts made while
+//  recording take one of these striped locks, keyed by the address of the container being modified.  Removal
+//  only happens with global_lock held exclusively.
+static const size_t BINDING_LOCK_COUNT = 64;
+static std::mutex binding_locks[BINDING_LOCK_COUNT];
+
+static std::mutex &getBindingLock(void const *container) {
+    return binding_locks[(reinterpret_cast<uintptr_t>(container) >> 4) % BINDING_LOCK_COUNT];
+}
 
 // Return ImageViewCreateInfo ptr for specified imageView or else NULL
 VkImageViewCreateInfo *getImageViewData(const layer_data *dev_data, VkImageView image_view) {
@@ -390,6 +541,37 @@ static VkDeviceMemory *get_object_mem_binding(layer_data *my_data, uint64_t hand
 // prototype
 static GLOBAL_CB_NODE *getCBNode(layer_data const *, const VkCommandBuffer);
 
+// Lock held by vkCmd* entry points while recording into a single command buffer.  global_lock is held shared,
+//  so device-level maps may be read but not restructured, and the command buffer's own node is held exclusively.
+class cb_record_lock {
+  public:
+    cb_record_lock(layer_data const *dev_data, VkCommandBuffer cb)
+        : global_(cbSyncedGlobalLock(dev_data, cb)), cb_node_(getCBNode(dev_data, cb)), owns_(true) {
+        if (cb_node_)
+            cb_node_->record_lock.lock();
+    }
+    ~cb_record_lock() {
+        if (owns_ && cb_node_)
+            cb_node_->record_lock.unlock();
+    }
+    cb_record_lock(const cb_record_lock &) = delete;
+    cb_record_lock &operator=(const cb_record_lock &) = delete;
+
+    GLOBAL_CB_NODE *cb_node() const { return cb_node_; }
+
+    void unlock() {
+        if (cb_node_)
+            cb_node_->record_lock.unlock();
+        global_.unlock();
+        owns_ = false;
+    }
+
+  private:
+    read_lock_guard global_;
+    GLOBAL_CB_NODE *cb_node_;
+    bool owns_;
+};
+
 // Helper function to validate correct usage bits set for buffers or images
 //  Verify that (actual & desired) flags != 0 or,
 //   if strict is true, verify that (actual & desired) flags == desired
@@ -485,6 +667,69 @@ static void set_memory_valid(layer_data *dev_data, VkDeviceMemory mem, bool vali
     }
 }
 
+// Helpers to append deferred checks to a command buffer, see replayDeferredChecks() for what each one does at submit time
+static void deferMemoryValidation(GLOBAL_CB_NODE *cb_node, VkDeviceMemory mem, const char *caller, VkImage image = VK_NULL_HANDLE) {
+    DEFERRED_CHECK check;
+    check.type = DEFERRED_VALIDATE_MEMORY;
+    check.memory.mem = mem;
+    check.memory.image = image;
+    check.memory.caller = caller;
+    check.memory.valid = true;
+    cb_node->deferredChecks.push_back(check);
+}
+
+static void deferSetMemoryValid(GLOBAL_CB_NODE *cb_node, VkDeviceMemory mem, bool valid, VkImage image = VK_NULL_HANDLE) {
+    DEFERRED_CHECK check;
+    check.type = DEFERRED_SET_MEMORY_VALID;
+    check.memory.mem = mem;
+    check.memory.image = image;
+    check.memory.caller = nullptr;
+    check.memory.valid = valid;
+    cb_node->deferredChecks.push_back(check);
+}
+
+static void deferSetEventStage(GLOBAL_CB_NODE *cb_node, VkEvent event, VkPipelineStageFlags stageMask) {
+    DEFERRED_CHECK check;
+    check.type = DEFERRED_SET_EVENT_STAGE;
+    check.event.event = event;
+    check.event.count = 1;
+    check.event.firstIndex = 0;
+    check.event.stageMask = stageMask;
+    cb_node->deferredChecks.push_back(check);
+}
+
+static void deferValidateEventStage(GLOBAL_CB_NODE *cb_node, uint32_t eventCount, size_t firstEventIndex,
+                                    VkPipelineStageFlags sourceStageMask) {
+    DEFERRED_CHECK check;
+    check.type = DEFERRED_VALIDATE_EVENT_STAGE;
+    check.event.event = VK_NULL_HANDLE;
+    check.event.count = eventCount;
+    check.event.firstIndex = static_cast<uint32_t>(firstEventIndex);
+    check.event.stageMask = sourceStageMask;
+    cb_node->deferredChecks.push_back(check);
+}
+
+static void deferSetQueryState(GLOBAL_CB_NODE *cb_node, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount,
+                               bool value) {
+    DEFERRED_CHECK check;
+    check.type = DEFERRED_SET_QUERY_STATE;
+    check.query.commandBuffer = cb_node->commandBuffer;
+    check.query.query = {queryPool, firstQuery};
+    check.query.count = queryCount;
+    check.query.value = value;
+    cb_node->deferredChecks.push_back(check);
+}
+
+static void deferValidateQuery(GLOBAL_CB_NODE *cb_node, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+    DEFERRED_CHECK check;
+    check.type = DEFERRED_VALIDATE_QUERY;
+    check.query.commandBuffer = cb_node->commandBuffer;
+    check.query.query = {queryPool, firstQuery};
+    check.query.count = queryCount;
+    check.query.value = true;
+    cb_node->deferredChecks.push_back(check);
+}
+
 // Find CB Info and add mem reference to list container
 // Find Mem Obj Info and add CB reference to list container
 static bool update_cmd_buf_and_mem_references(layer_data *dev_data, const VkCommandBuffer cb, const VkDeviceMemory mem,
@@ -497,7 +742,10 @@ static bool update_cmd_buf_and_mem_references(layer_data *dev_data, const VkComm
         // First update CB binding in MemObj mini CB list
         DEVICE_MEM_INFO *pMemInfo = getMemObjInfo(dev_data, mem);
         if (pMemInfo) {
-            pMemInfo->command_buffer_bindings.insert(cb);
+            {
+                std::lock_guard<std::mutex> lock(getBindingLock(&pMemInfo->command_buffer_bindings));
+                pMemInfo->command_buffer_bindings.insert(cb);
+            }
             // Now update CBInfo's Mem reference list
             GLOBAL_CB_NODE *pCBNode = getCBNode(dev_data, cb);
             // TODO: keep track of all destroyed CBs so we know if this is a stale or simply invalid object
@@ -517,13 +765,17 @@ static bool addCommandBufferBindingImage(layer_data *dev_data, GLOBAL_CB_NODE *c
         // First update CB binding in MemObj mini CB list
         DEVICE_MEM_INFO *pMemInfo = getMemObjInfo(dev_data, img_node->mem);
         if (pMemInfo) {
-            pMemInfo->command_buffer_bindings.insert(cb_node->commandBuffer);
+            {
+                std::lock_guard<std::mutex> lock(getBindingLock(&pMemInfo->command_buffer_bindings));
+                pMemInfo->command_buffer_bindings.insert(cb_node->commandBuffer);
+            }
             // Now update CBInfo's Mem reference list
             cb_node->memObjs.insert(img_node->mem);
         }
         cb_node->object_bindings.insert({reinterpret_cast<uint64_t &>(img_node->image), VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT});
     }
     // Now update cb binding for image
+    std::lock_guard<std::mutex> lock(getBindingLock(&img_node->cb_bindings));
     img_node->cb_bindings.insert(cb_node);
     return skip_call;
 }
@@ -536,12 +788,16 @@ static bool addCommandBufferBindingBuffer(layer_data *dev_data, GLOBAL_CB_NODE *
     // First update CB binding in MemObj mini CB list
     DEVICE_MEM_INFO *pMemInfo = getMemObjInfo(dev_data, buff_node->mem);
     if (pMemInfo) {
-        pMemInfo->command_buffer_bindings.insert(cb_node->commandBuffer);
+        {
+            std::lock_guard<std::mutex> lock(getBindingLock(&pMemInfo->command_buffer_bindings));
+            pMemInfo->command_buffer_bindings.insert(cb_node->commandBuffer);
+        }
         // Now update CBInfo's Mem reference list
         cb_node->memObjs.insert(buff_node->mem);
         cb_node->object_bindings.insert({reinterpret_cast<uint64_t &>(buff_node->buffer), VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT});
     }
     // Now update cb binding for buffer
+    std::lock_guard<std::mutex> lock(getBindingLock(&buff_node->cb_bindings));
     buff_node->cb_bindings.insert(cb_node);
 
     return skip_call;
@@ -559,7 +815,13 @@ static void clear_cmd_buf_and_mem_references(layer_data *dev_data, GLOBAL_CB_NOD
             }
             pCBNode->memObjs.clear();
         }
-        pCBNode->validate_functions.clear();
+        // Drop memory checks since they may name memory that is going away, event and query updates stay
+        auto &checks = pCBNode->deferredChecks;
+        checks.erase(std::remove_if(checks.begin(), checks.end(),
+                                    [](const DEFERRED_CHECK &check) {
+                                        return check.type == DEFERRED_VALIDATE_MEMORY || check.type == DEFERRED_SET_MEMORY_VALID;
+                                    }),
+                     checks.end());
     }
 }
 // Overloaded call to above function when GLOBAL_CB_NODE has not already been looked-up
@@ -628,7 +890,7 @@ static bool freeMemObjInfo(layer_data *dev_data, void *object, VkDeviceMemory me
             skip_call |= reportMemReferencesAndCleanUp(dev_data, pInfo);
         }
         // Delete mem obj info
-        dev_data->memObjMap.erase(dev_data->memObjMap.find(mem));
+        dev_data->memObjMap.erase(mem);
     } else if (VK_NULL_HANDLE != mem) {
         // The request is to free an invalid, non-zero handle
         skip_call = log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
@@ -1059,6 +1321,47 @@ static void build_def_index(shader_module *module) {
             module->def_index[insn.word(2)] = insn.offset();
             break;
 
+        /* Module-level reflection */
+        case spv::OpEntryPoint:
+            module->entrypoints.push_back(insn.offset());
+            break;
+
+        case spv::OpCapability:
+            module->capabilities.push_back(insn.word(1));
+            break;
+
+        case spv::OpDecorate:
+            switch (insn.word(2)) {
+            case spv::DecorationLocation:
+                module->var_locations[insn.word(1)] = insn.word(3);
+                break;
+            case spv::DecorationBuiltIn:
+                module->var_builtins[insn.word(1)] = insn.word(3);
+                break;
+            case spv::DecorationComponent:
+                module->var_components[insn.word(1)] = insn.word(3);
+                break;
+            case spv::DecorationDescriptorSet:
+                module->var_sets[insn.word(1)] = insn.word(3);
+                break;
+            case spv::DecorationBinding:
+                module->var_bindings[insn.word(1)] = insn.word(3);
+                break;
+            case spv::DecorationBlock:
+                module->blocks.insert(insn.word(1));
+                break;
+            case spv::DecorationPatch:
+                module->var_patch.insert(insn.word(1));
+                break;
+            default:
+                break;
+            }
+            break;
+
+        case spv::OpMemberDecorate:
+            module->member_decorations[insn.word(1)].push_back(insn.offset());
+            break;
+
         default:
             /* We don't care about any other defs for now. */
             break;
@@ -1067,14 +1370,13 @@ static void build_def_index(shader_module *module) {
 }
 
 static spirv_inst_iter find_entrypoint(shader_module *src, char const *name, VkShaderStageFlagBits stageBits) {
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpEntryPoint) {
-            auto entrypointName = (char const *)&insn.word(3);
-            auto entrypointStageBits = 1u << insn.word(1);
+    for (auto offset : src->entrypoints) {
+        auto insn = src->at(offset);
+        auto entrypointName = (char const *)&insn.word(3);
+        auto entrypointStageBits = 1u << insn.word(1);
 
-            if (!strcmp(entrypointName, name) && (entrypointStageBits & stageBits)) {
-                return insn;
-            }
+        if (!strcmp(entrypointName, name) && (entrypointStageBits & stageBits)) {
+            return insn;
         }
     }
 
@@ -1345,18 +1647,6 @@ static unsigned get_locations_consumed_by_format(VkFormat format) {
     }
 }
 
-typedef std::pair<unsigned, unsigned> location_t;
-typedef std::pair<unsigned, unsigned> descriptor_slot_t;
-
-struct interface_var {
-    uint32_t id;
-    uint32_t type_id;
-    uint32_t offset;
-    bool is_patch;
-    bool is_block_member;
-    /* TODO: collect the name, too? Isn't required to be present. */
-};
-
 struct shader_stage_attributes {
     char const *const name;
     bool arrayed_input;
@@ -1388,52 +1678,54 @@ static spirv_inst_iter get_struct_type(shader_module const *src, spirv_inst_iter
 }
 
 static void collect_interface_block_members(shader_module const *src,
-                                            std::map<location_t, interface_var> &out,
-                                            std::unordered_map<unsigned, unsigned> const &blocks, bool is_array_of_verts,
+                                            std::map<location_t, interface_var> &out, bool is_array_of_verts,
                                             uint32_t id, uint32_t type_id, bool is_patch) {
     /* Walk down the type_id presented, trying to determine whether it's actually an interface block. */
     auto type = get_struct_type(src, src->get_def(type_id), is_array_of_verts && !is_patch);
-    if (type == src->end() || blocks.find(type.word(1)) == blocks.end()) {
+    if (type == src->end() || src->blocks.find(type.word(1)) == src->blocks.end()) {
         /* this isn't an interface block. */
         return;
     }
 
+    auto member_decorations = src->member_decorations.find(type.word(1));
+    if (member_decorations == src->member_decorations.end()) {
+        return;
+    }
+
     std::unordered_map<unsigned, unsigned> member_components;
 
     /* Walk all the OpMemberDecorate for type's result id -- first pass, collect components. */
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpMemberDecorate && insn.word(1) == type.word(1)) {
-            unsigned member_index = insn.word(2);
+    for (auto insn_offset : member_decorations->second) {
+        auto insn = src->at(insn_offset);
+        unsigned member_index = insn.word(2);
 
-            if (insn.word(3) == spv::DecorationComponent) {
-                unsigned component = insn.word(4);
-                member_components[member_index] = component;
-            }
+        if (insn.word(3) == spv::DecorationComponent) {
+            unsigned component = insn.word(4);
+            member_components[member_index] = component;
         }
     }
 
     /* Second pass -- produce the output, from Location decorations */
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpMemberDecorate && insn.word(1) == type.word(1)) {
-            unsigned member_index = insn.word(2);
-            unsigned member_type_id = type.word(2 + member_index);
+    for (auto insn_offset : member_decorations->second) {
+        auto insn = src->at(insn_offset);
+        unsigned member_index = insn.word(2);
+        unsigned member_type_id = type.word(2 + member_index);
 
-            if (insn.word(3) == spv::DecorationLocation) {
-                unsigned location = insn.word(4);
-                unsigned num_locations = get_locations_consumed_by_type(src, member_type_id, false);
-                auto component_it = member_components.find(member_index);
-                unsigned component = component_it == member_components.end() ? 0 : component_it->second;
+        if (insn.word(3) == spv::DecorationLocation) {
+            unsigned location = insn.word(4);
+            unsigned num_locations = get_locations_consumed_by_type(src, member_type_id, false);
+            auto component_it = member_components.find(member_index);
+            unsigned component = component_it == member_components.end() ? 0 : component_it->second;
 
-                for (unsigned int offset = 0; offset < num_locations; offset++) {
-                    interface_var v;
-                    v.id = id;
-                    /* TODO: member index in interface_var too? */
-                    v.type_id = member_type_id;
-                    v.offset = offset;
-                    v.is_patch = is_patch;
-                    v.is_block_member = true;
-                    out[std::make_pair(location + offset, component)] = v;
-                }
+            for (unsigned int offset = 0; offset < num_locations; offset++) {
+                interface_var v;
+                v.id = id;
+                /* TODO: member index in interface_var too? */
+                v.type_id = member_type_id;
+                v.offset = offset;
+                v.is_patch = is_patch;
+                v.is_block_member = true;
+                out[std::make_pair(location + offset, component)] = v;
             }
         }
     }
@@ -1442,39 +1734,9 @@ static void collect_interface_block_members(shader_module const *src,
 static void collect_interface_by_location(shader_module const *src, spirv_inst_iter entrypoint,
                                           spv::StorageClass sinterface, std::map<location_t, interface_var> &out,
                                           bool is_array_of_verts) {
-    std::unordered_map<unsigned, unsigned> var_locations;
-    std::unordered_map<unsigned, unsigned> var_builtins;
-    std::unordered_map<unsigned, unsigned> var_components;
-    std::unordered_map<unsigned, unsigned> blocks;
-    std::unordered_map<unsigned, unsigned> var_patch;
-
-    for (auto insn : *src) {
-
-        /* We consider two interface models: SSO rendezvous-by-location, and
-         * builtins. Complain about anything that fits neither model.
-         */
-        if (insn.opcode() == spv::OpDecorate) {
-            if (insn.word(2) == spv::DecorationLocation) {
-                var_locations[insn.word(1)] = insn.word(3);
-            }
-
-            if (insn.word(2) == spv::DecorationBuiltIn) {
-                var_builtins[insn.word(1)] = insn.word(3);
-            }
-
-            if (insn.word(2) == spv::DecorationComponent) {
-                var_components[insn.word(1)] = insn.word(3);
-            }
-
-            if (insn.word(2) == spv::DecorationBlock) {
-                blocks[insn.word(1)] = 1;
-            }
-
-            if (insn.word(2) == spv::DecorationPatch) {
-                var_patch[insn.word(1)] = 1;
-            }
-        }
-    }
+    /* We consider two interface models: SSO rendezvous-by-location, and
+     * builtins. Complain about anything that fits neither model.
+     */
 
     /* TODO: handle grouped decorations */
     /* TODO: handle index=1 dual source outputs from FS -- two vars will
@@ -1498,10 +1760,10 @@ static void collect_interface_by_location(shader_module const *src, spirv_inst_i
             unsigned id = insn.word(2);
             unsigned type = insn.word(1);
 
-            int location = value_or_default(var_locations, id, -1);
-            int builtin = value_or_default(var_builtins, id, -1);
-            unsigned component = value_or_default(var_components, id, 0); /* unspecified is OK, is 0 */
-            bool is_patch = var_patch.find(id) != var_patch.end();
+            int location = value_or_default(src->var_locations, id, -1);
+            int builtin = value_or_default(src->var_builtins, id, -1);
+            unsigned component = value_or_default(src->var_components, id, 0); /* unspecified is OK, is 0 */
+            bool is_patch = src->var_patch.find(id) != src->var_patch.end();
 
             /* All variables and interface block members in the Input or Output storage classes
              * must be decorated with either a builtin or an explicit location.
@@ -1526,42 +1788,25 @@ static void collect_interface_by_location(shader_module const *src, spirv_inst_i
                 }
             } else if (builtin == -1) {
                 /* An interface block instance */
-                collect_interface_block_members(src, out, blocks, is_array_of_verts, id, type, is_patch);
+                collect_interface_block_members(src, out, is_array_of_verts, id, type, is_patch);
             }
         }
     }
 }
 
-static void collect_interface_by_descriptor_slot(debug_report_data *report_data, shader_module const *src,
-                                                 std::unordered_set<uint32_t> const &accessible_ids,
+static void collect_interface_by_descriptor_slot(shader_module const *src, std::unordered_set<uint32_t> const &accessible_ids,
                                                  std::vector<std::pair<descriptor_slot_t, interface_var>> &out) {
-
-    std::unordered_map<unsigned, unsigned> var_sets;
-    std::unordered_map<unsigned, unsigned> var_bindings;
-
-    for (auto insn : *src) {
-        /* All variables in the Uniform or UniformConstant storage classes are required to be decorated with both
-         * DecorationDescriptorSet and DecorationBinding.
-         */
-        if (insn.opcode() == spv::OpDecorate) {
-            if (insn.word(2) == spv::DecorationDescriptorSet) {
-                var_sets[insn.word(1)] = insn.word(3);
-            }
-
-            if (insn.word(2) == spv::DecorationBinding) {
-                var_bindings[insn.word(1)] = insn.word(3);
-            }
-        }
-    }
-
+    /* All variables in the Uniform or UniformConstant storage classes are required to be decorated with both
+     * DecorationDescriptorSet and DecorationBinding.
+     */
     for (auto id : accessible_ids) {
         auto insn = src->get_def(id);
         assert(insn != src->end());
 
         if (insn.opcode() == spv::OpVariable &&
             (insn.word(3) == spv::StorageClassUniform || insn.word(3) == spv::StorageClassUniformConstant)) {
-            unsigned set = value_or_default(var_sets, insn.word(2), 0);
-            unsigned binding = value_or_default(var_bindings, insn.word(2), 0);
+            unsigned set = value_or_default(src->var_sets, insn.word(2), 0);
+            unsigned binding = value_or_default(src->var_bindings, insn.word(2), 0);
 
             interface_var v;
             v.id = insn.word(2);
@@ -1574,17 +1819,58 @@ static void collect_interface_by_descriptor_slot(debug_report_data *report_data,
     }
 }
 
+static void mark_accessible_ids(shader_module const *src, spirv_inst_iter entrypoint, std::unordered_set<uint32_t> &ids);
+
+/* Find or build the reflection of entrypoint. Expects src->reflection_lock to be held by caller. */
+static entrypoint_reflection &build_entrypoint_reflection(shader_module const *src, spirv_inst_iter entrypoint) {
+    auto &reflection = src->entrypoint_reflections[entrypoint.offset()];
+    if (!reflection) {
+        reflection.reset(new entrypoint_reflection());
+        mark_accessible_ids(src, entrypoint, reflection->accessible_ids);
+        collect_interface_by_descriptor_slot(src, reflection->accessible_ids, reflection->descriptor_uses);
+    }
+    return *reflection;
+}
+
+/* Resources used by entrypoint, computed the first time any pipeline asks and shared from then on */
+static entrypoint_reflection const &get_entrypoint_reflection(shader_module const *src, spirv_inst_iter entrypoint) {
+    static const entrypoint_reflection missing_entrypoint;
+    if (entrypoint == src->end()) {
+        return missing_entrypoint;
+    }
+    std::lock_guard<std::mutex> lock(src->reflection_lock);
+    return build_entrypoint_reflection(src, entrypoint);
+}
+
+/* Cached collect_interface_by_location() */
+static std::map<location_t, interface_var> const &get_interface_by_location(shader_module const *src,
+                                                                              spirv_inst_iter entrypoint,
+                                                                              spv::StorageClass sinterface,
+                                                                              bool is_array_of_verts) {
+    static const std::map<location_t, interface_var> missing_entrypoint;
+    if (entrypoint == src->end()) {
+        return missing_entrypoint;
+    }
+    std::lock_guard<std::mutex> lock(src->reflection_lock);
+    auto &reflection = build_entrypoint_reflection(src, entrypoint);
+    bool is_output = (sinterface == spv::StorageClassOutput);
+    auto &interface = reflection.interfaces[is_output][is_array_of_verts];
+    if (!reflection.interfaces_built[is_output][is_array_of_verts]) {
+        collect_interface_by_location(src, entrypoint, sinterface, interface, is_array_of_verts);
+        reflection.interfaces_built[is_output][is_array_of_verts] = true;
+    }
+    return interface;
+}
+
 static bool validate_interface_between_stages(debug_report_data *report_data, shader_module const *producer,
                                               spirv_inst_iter producer_entrypoint, shader_stage_attributes const *producer_stage,
                                               shader_module const *consumer, spirv_inst_iter consumer_entrypoint,
                                               shader_stage_attributes const *consumer_stage) {
-    std::map<location_t, interface_var> outputs;
-    std::map<location_t, interface_var> inputs;
-
     bool pass = true;
 
-    collect_interface_by_location(producer, producer_entrypoint, spv::StorageClassOutput, outputs, producer_stage->arrayed_output);
-    collect_interface_by_location(consumer, consumer_entrypoint, spv::StorageClassInput, inputs, consumer_stage->arrayed_input);
+    auto &outputs =
+        get_interface_by_location(producer, producer_entrypoint, spv::StorageClassOutput, producer_stage->arrayed_output);
+    auto &inputs = get_interface_by_location(consumer, consumer_entrypoint, spv::StorageClassInput, consumer_stage->arrayed_input);
 
     auto a_it = outputs.begin();
     auto b_it = inputs.begin();
@@ -1762,10 +2048,9 @@ static bool validate_vi_consistency(debug_report_data *report_data, VkPipelineVe
 
 static bool validate_vi_against_vs_inputs(debug_report_data *report_data, VkPipelineVertexInputStateCreateInfo const *vi,
                                           shader_module const *vs, spirv_inst_iter entrypoint) {
-    std::map<location_t, interface_var> inputs;
     bool pass = true;
 
-    collect_interface_by_location(vs, entrypoint, spv::StorageClassInput, inputs, false);
+    auto &inputs = get_interface_by_location(vs, entrypoint, spv::StorageClassInput, false);
 
     /* Build index by location */
     std::map<uint32_t, VkVertexInputAttributeDescription const *> attribs;
@@ -1829,7 +2114,6 @@ static bool validate_vi_against_vs_inputs(debug_report_data *report_data, VkPipe
 static bool validate_fs_outputs_against_render_pass(debug_report_data *report_data, shader_module const *fs,
                                                     spirv_inst_iter entrypoint, VkRenderPassCreateInfo const *rpci,
                                                     uint32_t subpass_index) {
-    std::map<location_t, interface_var> outputs;
     std::map<uint32_t, VkFormat> color_attachments;
     auto subpass = rpci->pSubpasses[subpass_index];
     for (auto i = 0u; i < subpass.colorAttachmentCount; ++i) {
@@ -1845,7 +2129,7 @@ static bool validate_fs_outputs_against_render_pass(debug_report_data *report_da
 
     /* TODO: dual source blend index (spv::DecIndex, zero if not provided) */
 
-    collect_interface_by_location(fs, entrypoint, spv::StorageClassOutput, outputs, false);
+    auto &outputs = get_interface_by_location(fs, entrypoint, spv::StorageClassOutput, false);
 
     auto it_a = outputs.begin();
     auto it_b = color_attachments.begin();
@@ -2020,43 +2304,46 @@ static bool validate_push_constant_block_against_pipeline(debug_report_data *rep
     type = get_struct_type(src, type, false);
     assert(type != src->end());
 
+    auto member_decorations = src->member_decorations.find(type.word(1));
+    if (member_decorations == src->member_decorations.end()) {
+        return pass;
+    }
+
     /* validate directly off the offsets. this isn't quite correct for arrays
      * and matrices, but is a good first step. TODO: arrays, matrices, weird
      * sizes */
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpMemberDecorate && insn.word(1) == type.word(1)) {
-
-            if (insn.word(3) == spv::DecorationOffset) {
-                unsigned offset = insn.word(4);
-                auto size = 4; /* bytes; TODO: calculate this based on the type */
-
-                bool found_range = false;
-                for (auto const &range : *push_constant_ranges) {
-                    if (range.offset <= offset && range.offset + range.size >= offset + size) {
-                        found_range = true;
-
-                        if ((range.stageFlags & stage) == 0) {
-                            if (log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VkDebugReportObjectTypeEXT(0), 0,
-                                        __LINE__, SHADER_CHECKER_PUSH_CONSTANT_NOT_ACCESSIBLE_FROM_STAGE, "SC",
-                                        "Push constant range covering variable starting at "
-                                        "offset %u not accessible from stage %s",
-                                        offset, string_VkShaderStageFlagBits(stage))) {
-                                pass = false;
-                            }
+    for (auto insn_offset : member_decorations->second) {
+        auto insn = src->at(insn_offset);
+        if (insn.word(3) == spv::DecorationOffset) {
+            unsigned offset = insn.word(4);
+            auto size = 4; /* bytes; TODO: calculate this based on the type */
+
+            bool found_range = false;
+            for (auto const &range : *push_constant_ranges) {
+                if (range.offset <= offset && range.offset + range.size >= offset + size) {
+                    found_range = true;
+
+                    if ((range.stageFlags & stage) == 0) {
+                        if (log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VkDebugReportObjectTypeEXT(0), 0,
+                                    __LINE__, SHADER_CHECKER_PUSH_CONSTANT_NOT_ACCESSIBLE_FROM_STAGE, "SC",
+                                    "Push constant range covering variable starting at "
+                                    "offset %u not accessible from stage %s",
+                                    offset, string_VkShaderStageFlagBits(stage))) {
+                            pass = false;
                         }
-
-                        break;
                     }
+
+                    break;
                 }
+            }
 
-                if (!found_range) {
-                    if (log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VkDebugReportObjectTypeEXT(0), 0,
-                                __LINE__, SHADER_CHECKER_PUSH_CONSTANT_OUT_OF_RANGE, "SC",
-                                "Push constant range covering variable starting at "
-                                "offset %u not declared in layout",
-                                offset)) {
-                        pass = false;
-                    }
+            if (!found_range) {
+                if (log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VkDebugReportObjectTypeEXT(0), 0,
+                            __LINE__, SHADER_CHECKER_PUSH_CONSTANT_OUT_OF_RANGE, "SC",
+                            "Push constant range covering variable starting at "
+                            "offset %u not declared in layout",
+                            offset)) {
+                    pass = false;
                 }
             }
         }
@@ -2067,7 +2354,7 @@ static bool validate_push_constant_block_against_pipeline(debug_report_data *rep
 
 static bool validate_push_constant_usage(debug_report_data *report_data,
                                          std::vector<VkPushConstantRange> const *push_constant_ranges, shader_module const *src,
-                                         std::unordered_set<uint32_t> accessible_ids, VkShaderStageFlagBits stage) {
+                                         std::unordered_set<uint32_t> const &accessible_ids, VkShaderStageFlagBits stage) {
     bool pass = true;
 
     for (auto id : accessible_ids) {
@@ -2096,7 +2383,7 @@ static VkDescriptorSetLayoutBinding const * get_descriptor_binding(PIPELINE_LAYO
 
 // Block of code at start here for managing/tracking Pipeline state that this layer cares about
 
-static uint64_t g_drawCount[NUM_DRAW_TYPES] = {0, 0, 0, 0};
+static std::atomic<uint64_t> g_drawCount[NUM_DRAW_TYPES];
 
 // TODO : Should be tracking lastBound per commandBuffer and when draws occur, report based on that cmd buffer lastBound
 //   Then need to synchronize the accesses based on cmd buffer so that if I'm reading state on one cmd buffer, updates
@@ -2468,135 +2755,132 @@ static bool validate_shader_capabilities(debug_report_data *report_data, shader_
                                          VkPhysicalDeviceFeatures const *enabledFeatures) {
     bool pass = true;
 
+    for (auto capability : src->capabilities) {
+        switch (capability) {
+        case spv::CapabilityMatrix:
+        case spv::CapabilityShader:
+        case spv::CapabilityInputAttachment:
+        case spv::CapabilitySampled1D:
+        case spv::CapabilityImage1D:
+        case spv::CapabilitySampledBuffer:
+        case spv::CapabilityImageBuffer:
+        case spv::CapabilityImageQuery:
+        case spv::CapabilityDerivativeControl:
+            // Always supported by a Vulkan 1.0 implementation -- no feature bits.
+            break;
 
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpCapability) {
-            switch (insn.word(1)) {
-            case spv::CapabilityMatrix:
-            case spv::CapabilityShader:
-            case spv::CapabilityInputAttachment:
-            case spv::CapabilitySampled1D:
-            case spv::CapabilityImage1D:
-            case spv::CapabilitySampledBuffer:
-            case spv::CapabilityImageBuffer:
-            case spv::CapabilityImageQuery:
-            case spv::CapabilityDerivativeControl:
-                // Always supported by a Vulkan 1.0 implementation -- no feature bits.
-                break;
-
-            case spv::CapabilityGeometry:
-                pass &= require_feature(report_data, enabledFeatures->geometryShader, "geometryShader");
-                break;
+        case spv::CapabilityGeometry:
+            pass &= require_feature(report_data, enabledFeatures->geometryShader, "geometryShader");
+            break;
 
-            case spv::CapabilityTessellation:
-                pass &= require_feature(report_data, enabledFeatures->tessellationShader, "tessellationShader");
-                break;
+        case spv::CapabilityTessellation:
+            pass &= require_feature(report_data, enabledFeatures->tessellationShader, "tessellationShader");
+            break;
 
-            case spv::CapabilityFloat64:
-                pass &= require_feature(report_data, enabledFeatures->shaderFloat64, "shaderFloat64");
-                break;
+        case spv::CapabilityFloat64:
+            pass &= require_feature(report_data, enabledFeatures->shaderFloat64, "shaderFloat64");
+            break;
 
-            case spv::CapabilityInt64:
-                pass &= require_feature(report_data, enabledFeatures->shaderInt64, "shaderInt64");
-                break;
+        case spv::CapabilityInt64:
+            pass &= require_feature(report_data, enabledFeatures->shaderInt64, "shaderInt64");
+            break;
 
-            case spv::CapabilityTessellationPointSize:
-            case spv::CapabilityGeometryPointSize:
-                pass &= require_feature(report_data, enabledFeatures->shaderTessellationAndGeometryPointSize,
-                                        "shaderTessellationAndGeometryPointSize");
-                break;
+        case spv::CapabilityTessellationPointSize:
+        case spv::CapabilityGeometryPointSize:
+            pass &= require_feature(report_data, enabledFeatures->shaderTessellationAndGeometryPointSize,
+                                    "shaderTessellationAndGeometryPointSize");
+            break;
 
-            case spv::CapabilityImageGatherExtended:
-                pass &= require_feature(report_data, enabledFeatures->shaderImageGatherExtended, "shaderImageGatherExtended");
-                break;
+        case spv::CapabilityImageGatherExtended:
+            pass &= require_feature(report_data, enabledFeatures->shaderImageGatherExtended, "shaderImageGatherExtended");
+            break;
 
-            case spv::CapabilityStorageImageMultisample:
-                pass &= require_feature(report_data, enabledFeatures->shaderStorageImageMultisample, "shaderStorageImageMultisample");
-                break;
+        case spv::CapabilityStorageImageMultisample:
+            pass &= require_feature(report_data, enabledFeatures->shaderStorageImageMultisample, "shaderStorageImageMultisample");
+            break;
 
-            case spv::CapabilityUniformBufferArrayDynamicIndexing:
-                pass &= require_feature(report_data, enabledFeatures->shaderUniformBufferArrayDynamicIndexing,
-                                        "shaderUniformBufferArrayDynamicIndexing");
-                break;
+        case spv::CapabilityUniformBufferArrayDynamicIndexing:
+            pass &= require_feature(report_data, enabledFeatures->shaderUniformBufferArrayDynamicIndexing,
+                                    "shaderUniformBufferArrayDynamicIndexing");
+            break;
 
-            case spv::CapabilitySampledImageArrayDynamicIndexing:
-                pass &= require_feature(report_data, enabledFeatures->shaderSampledImageArrayDynamicIndexing,
-                                        "shaderSampledImageArrayDynamicIndexing");
-                break;
+        case spv::CapabilitySampledImageArrayDynamicIndexing:
+            pass &= require_feature(report_data, enabledFeatures->shaderSampledImageArrayDynamicIndexing,
+                                    "shaderSampledImageArrayDynamicIndexing");
+            break;
 
-            case spv::CapabilityStorageBufferArrayDynamicIndexing:
-                pass &= require_feature(report_data, enabledFeatures->shaderStorageBufferArrayDynamicIndexing,
-                                        "shaderStorageBufferArrayDynamicIndexing");
-                break;
+        case spv::CapabilityStorageBufferArrayDynamicIndexing:
+            pass &= require_feature(report_data, enabledFeatures->shaderStorageBufferArrayDynamicIndexing,
+                                    "shaderStorageBufferArrayDynamicIndexing");
+            break;
 
-            case spv::CapabilityStorageImageArrayDynamicIndexing:
-                pass &= require_feature(report_data, enabledFeatures->shaderStorageImageArrayDynamicIndexing,
-                                        "shaderStorageImageArrayDynamicIndexing");
-                break;
+        case spv::CapabilityStorageImageArrayDynamicIndexing:
+            pass &= require_feature(report_data, enabledFeatures->shaderStorageImageArrayDynamicIndexing,
+                                    "shaderStorageImageArrayDynamicIndexing");
+            break;
 
-            case spv::CapabilityClipDistance:
-                pass &= require_feature(report_data, enabledFeatures->shaderClipDistance, "shaderClipDistance");
-                break;
+        case spv::CapabilityClipDistance:
+            pass &= require_feature(report_data, enabledFeatures->shaderClipDistance, "shaderClipDistance");
+            break;
 
-            case spv::CapabilityCullDistance:
-                pass &= require_feature(report_data, enabledFeatures->shaderCullDistance, "shaderCullDistance");
-                break;
+        case spv::CapabilityCullDistance:
+            pass &= require_feature(report_data, enabledFeatures->shaderCullDistance, "shaderCullDistance");
+            break;
 
-            case spv::CapabilityImageCubeArray:
-                pass &= require_feature(report_data, enabledFeatures->imageCubeArray, "imageCubeArray");
-                break;
+        case spv::CapabilityImageCubeArray:
+            pass &= require_feature(report_data, enabledFeatures->imageCubeArray, "imageCubeArray");
+            break;
 
-            case spv::CapabilitySampleRateShading:
-                pass &= require_feature(report_data, enabledFeatures->sampleRateShading, "sampleRateShading");
-                break;
+        case spv::CapabilitySampleRateShading:
+            pass &= require_feature(report_data, enabledFeatures->sampleRateShading, "sampleRateShading");
+            break;
 
-            case spv::CapabilitySparseResidency:
-                pass &= require_feature(report_data, enabledFeatures->shaderResourceResidency, "shaderResourceResidency");
-                break;
+        case spv::CapabilitySparseResidency:
+            pass &= require_feature(report_data, enabledFeatures->shaderResourceResidency, "shaderResourceResidency");
+            break;
 
-            case spv::CapabilityMinLod:
-                pass &= require_feature(report_data, enabledFeatures->shaderResourceMinLod, "shaderResourceMinLod");
-                break;
+        case spv::CapabilityMinLod:
+            pass &= require_feature(report_data, enabledFeatures->shaderResourceMinLod, "shaderResourceMinLod");
+            break;
 
-            case spv::CapabilitySampledCubeArray:
-                pass &= require_feature(report_data, enabledFeatures->imageCubeArray, "imageCubeArray");
-                break;
+        case spv::CapabilitySampledCubeArray:
+            pass &= require_feature(report_data, enabledFeatures->imageCubeArray, "imageCubeArray");
+            break;
 
-            case spv::CapabilityImageMSArray:
-                pass &= require_feature(report_data, enabledFeatures->shaderStorageImageMultisample, "shaderStorageImageMultisample");
-                break;
+        case spv::CapabilityImageMSArray:
+            pass &= require_feature(report_data, enabledFeatures->shaderStorageImageMultisample, "shaderStorageImageMultisample");
+            break;
 
-            case spv::CapabilityStorageImageExtendedFormats:
-                pass &= require_feature(report_data, enabledFeatures->shaderStorageImageExtendedFormats,
-                                        "shaderStorageImageExtendedFormats");
-                break;
+        case spv::CapabilityStorageImageExtendedFormats:
+            pass &= require_feature(report_data, enabledFeatures->shaderStorageImageExtendedFormats,
+                                    "shaderStorageImageExtendedFormats");
+            break;
 
-            case spv::CapabilityInterpolationFunction:
-                pass &= require_feature(report_data, enabledFeatures->sampleRateShading, "sampleRateShading");
-                break;
+        case spv::CapabilityInterpolationFunction:
+            pass &= require_feature(report_data, enabledFeatures->sampleRateShading, "sampleRateShading");
+            break;
 
-            case spv::CapabilityStorageImageReadWithoutFormat:
-                pass &= require_feature(report_data, enabledFeatures->shaderStorageImageReadWithoutFormat,
-                                        "shaderStorageImageReadWithoutFormat");
-                break;
+        case spv::CapabilityStorageImageReadWithoutFormat:
+            pass &= require_feature(report_data, enabledFeatures->shaderStorageImageReadWithoutFormat,
+                                    "shaderStorageImageReadWithoutFormat");
+            break;
 
-            case spv::CapabilityStorageImageWriteWithoutFormat:
-                pass &= require_feature(report_data, enabledFeatures->shaderStorageImageWriteWithoutFormat,
-                                        "shaderStorageImageWriteWithoutFormat");
-                break;
+        case spv::CapabilityStorageImageWriteWithoutFormat:
+            pass &= require_feature(report_data, enabledFeatures->shaderStorageImageWriteWithoutFormat,
+                                    "shaderStorageImageWriteWithoutFormat");
+            break;
 
-            case spv::CapabilityMultiViewport:
-                pass &= require_feature(report_data, enabledFeatures->multiViewport, "multiViewport");
-                break;
+        case spv::CapabilityMultiViewport:
+            pass &= require_feature(report_data, enabledFeatures->multiViewport, "multiViewport");
+            break;
 
-            default:
-                if (log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VkDebugReportObjectTypeEXT(0), 0,
-                            __LINE__, SHADER_CHECKER_BAD_CAPABILITY, "SC",
-                            "Shader declares capability %u, not supported in Vulkan.",
-                            insn.word(1)))
-                    pass = false;
-                break;
-            }
+        default:
+            if (log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VkDebugReportObjectTypeEXT(0), 0,
+                        __LINE__, SHADER_CHECKER_BAD_CAPABILITY, "SC",
+                        "Shader declares capability %u, not supported in Vulkan.",
+                        capability))
+                pass = false;
+            break;
         }
     }
 
@@ -2649,7 +2933,7 @@ static bool validate_pipeline_shader_stage(debug_report_data *report_data,
                                            spirv_inst_iter *out_entrypoint,
                                            VkPhysicalDeviceFeatures const *enabledFeatures,
                                            std::unordered_map<VkShaderModule,
-                                           std::unique_ptr<shader_module>> const &shaderModuleMap) {
+                                           std::shared_ptr<shader_module>> const &shaderModuleMap) {
     bool pass = true;
     auto module_it = shaderModuleMap.find(pStage->module);
     auto module = *out_module = module_it->second.get();
@@ -2669,21 +2953,17 @@ static bool validate_pipeline_shader_stage(debug_report_data *report_data,
     /* validate shader capabilities against enabled device features */
     pass &= validate_shader_capabilities(report_data, module, enabledFeatures);
 
-    /* mark accessible ids */
-    std::unordered_set<uint32_t> accessible_ids;
-    mark_accessible_ids(module, entrypoint, accessible_ids);
-
-    /* validate descriptor set layout against what the entrypoint actually uses */
-    std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
-    collect_interface_by_descriptor_slot(report_data, module, accessible_ids, descriptor_uses);
+    /* ids accessible from the entrypoint and the descriptors among them, shared by every pipeline using it */
+    auto &reflection = get_entrypoint_reflection(module, entrypoint);
 
-    auto pipelineLayout = pipeline->pipeline_layout;
+    auto &pipelineLayout = pipeline->pipeline_layout;
 
     /* validate push constant usage */
-    pass &= validate_push_constant_usage(report_data, &pipelineLayout.push_constant_ranges, module, accessible_ids, pStage->stage);
+    pass &= validate_push_constant_usage(report_data, &pipelineLayout.push_constant_ranges, module, reflection.accessible_ids,
+                                         pStage->stage);
 
-    /* validate descriptor use */
-    for (auto use : descriptor_uses) {
+    /* validate descriptor set layout against what the entrypoint actually uses */
+    for (auto &use : reflection.descriptor_uses) {
         // While validating shaders capture which slots are used by the pipeline
         auto & reqs = pipeline->active_slots[use.first.first][use.first.second];
         reqs = descriptor_req(reqs | descriptor_type_to_reqs(module, use.second.type_id));
@@ -2738,7 +3018,8 @@ static bool validate_pipeline_shader_stage(debug_report_data *report_data,
 //  that are actually used by the pipeline into pPipeline->active_slots
 static bool validate_and_capture_pipeline_shader_state(debug_report_data *report_data, PIPELINE_NODE *pPipeline,
                                                        VkPhysicalDeviceFeatures const *enabledFeatures,
-                                                       std::unordered_map<VkShaderModule, unique_ptr<shader_module>> const & shaderModuleMap) {
+                                                       std::unordered_map<VkShaderModule,
+                                                                          shared_ptr<shader_module>> const &shaderModuleMap) {
     auto pCreateInfo = pPipeline->graphicsPipelineCI.ptr();
     int vertex_stage = get_shader_stage_id(VK_SHADER_STAGE_VERTEX_BIT);
     int fragment_stage = get_shader_stage_id(VK_SHADER_STAGE_FRAGMENT_BIT);
@@ -2792,18 +3073,21 @@ static bool validate_and_capture_pipeline_shader_state(debug_report_data *report
                                                         pPipeline->render_pass_ci.ptr(), pCreateInfo->subpass);
     }
 
+    pPipeline->buildActiveSlotPlan();
     return pass;
 }
 
 static bool validate_compute_pipeline(debug_report_data *report_data, PIPELINE_NODE *pPipeline, VkPhysicalDeviceFeatures const *enabledFeatures,
-                                      std::unordered_map<VkShaderModule, unique_ptr<shader_module>> const & shaderModuleMap) {
+                                      std::unordered_map<VkShaderModule, shared_ptr<shader_module>> const & shaderModuleMap) {
     auto pCreateInfo = pPipeline->computePipelineCI.ptr();
 
     shader_module *module;
     spirv_inst_iter entrypoint;
 
-    return validate_pipeline_shader_stage(report_data, &pCreateInfo->stage, pPipeline,
-                                          &module, &entrypoint, enabledFeatures, shaderModuleMap);
+    bool pass = validate_pipeline_shader_stage(report_data, &pCreateInfo->stage, pPipeline,
+                                               &module, &entrypoint, enabledFeatures, shaderModuleMap);
+    pPipeline->buildActiveSlotPlan();
+    return pass;
 }
 // Return Set node ptr for specified set or else NULL
 cvdescriptorset::DescriptorSet *getSetNode(const layer_data *my_data, VkDescriptorSet set) {
@@ -2813,23 +3097,45 @@ cvdescriptorset::DescriptorSet *getSetNode(const layer_data *my_data, VkDescript
     }
     return set_it->second;
 }
-// For the given command buffer, verify and update the state for activeSetBindingsPairs
+// One bound descriptor set a draw uses, see validate_and_update_drawtime_descriptor_state()
+struct active_set_use {
+    cvdescriptorset::DescriptorSet *set;
+    descriptor_binding_plan const *bindings;
+    std::vector<uint32_t> const *dynamic_offsets;
+};
+
+// For the given command buffer, verify and update the state for the sets a draw uses
 //  This includes:
-//  1. Verifying that any dynamic descriptor in that set has a valid dynamic offset bound.
+//  1. Verifying that every descriptor used is updated and references valid resources. Sets whose contents already
+//     passed this check against the same pipeline in this command buffer, with no resource destroyed since, skip it.
+//  2. Verifying that any dynamic descriptor in that set has a valid dynamic offset bound.
 //     To be valid, the dynamic offset combined with the offset and range from its
 //     descriptor update must not overflow the size of its buffer being updated
-//  2. Grow updateImages for given pCB to include any bound STORAGE_IMAGE descriptor images
-//  3. Grow updateBuffers for pCB to include buffers from STORAGE*_BUFFER descriptor buffers
-static bool validate_and_update_drawtime_descriptor_state(
-    layer_data *dev_data, GLOBAL_CB_NODE *pCB,
-    const vector<std::tuple<cvdescriptorset::DescriptorSet *, unordered_map<uint32_t, descriptor_req>,
-                            std::vector<uint32_t> const *>> &activeSetBindingsPairs) {
+//  3. Grow updateImages for given pCB to include any bound STORAGE_IMAGE descriptor images
+//  4. Grow updateBuffers for pCB to include buffers from STORAGE*_BUFFER descriptor buffers
+//  Clears *all_valid if anything fails.
+static bool validate_and_update_drawtime_descriptor_state(layer_data *dev_data, GLOBAL_CB_NODE *pCB, uint64_t slot_plan_id,
+                                                          const vector<active_set_use> &activeSets, bool *all_valid) {
     bool result = false;
-    for (auto set_bindings_pair : activeSetBindingsPairs) {
-        cvdescriptorset::DescriptorSet *set_node = std::get<0>(set_bindings_pair);
+    for (auto &use : activeSets) {
+        cvdescriptorset::DescriptorSet *set_node = use.set;
         std::string err_str;
-        if (!set_node->ValidateDrawState(std::get<1>(set_bindings_pair), *std::get<2>(set_bindings_pair),
-                                         &err_str)) {
+        VALIDATED_DESCRIPTORS key = {set_node->GetVersion(), slot_plan_id};
+        auto validated = pCB->validatedDescriptors.find(key);
+        bool valid = (validated != pCB->validatedDescriptors.end()) && (validated->second == dev_data->descriptor_resource_epoch);
+        if (!valid) {
+            valid = set_node->ValidateDrawState(*use.bindings, &err_str);
+            // Storage updates only depend on the set's contents too, so a cached set has already recorded them
+            set_node->GetStorageUpdates(*use.bindings, &pCB->updateBuffers, &pCB->updateImages);
+            if (valid) {
+                pCB->validatedDescriptors[key] = dev_data->descriptor_resource_epoch;
+            }
+        }
+        if (valid) {
+            valid = set_node->ValidateDynamicOffsets(*use.bindings, *use.dynamic_offsets, &err_str);
+        }
+        if (!valid) {
+            *all_valid = false;
             // Report error here
             auto set = set_node->GetSet();
             result |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
@@ -2837,7 +3143,6 @@ static bool validate_and_update_drawtime_descriptor_state(
                               "DS 0x%" PRIxLEAST64 " encountered the following validation error at draw time: %s",
                               reinterpret_cast<const uint64_t &>(set), err_str.c_str());
         }
-        set_node->GetStorageUpdates(std::get<1>(set_bindings_pair), &pCB->updateBuffers, &pCB->updateImages);
     }
     return result;
 }
@@ -3005,11 +3310,28 @@ static bool validatePipelineDrawtimeState(layer_data const *my_data,
     return skip_call;
 }
 
+// True if nothing a draw's descriptor checks depend on has changed since the last draw at this bind point passed them:
+//  the same pipeline, layout, sets and dynamic offsets are bound, none of those sets has been updated, and no resource
+//  has been destroyed.  The sets are only looked at once the resource epoch shows none of them has been freed.
+static bool descriptors_unchanged_since_validation(const layer_data *my_data, const LAST_BOUND_STATE &state,
+                                                   const PIPELINE_NODE *pPipe) {
+    if (state.validated_generation != state.generation || state.validated_slot_plan_id != pPipe->slot_plan_id ||
+        state.validated_resource_epoch != my_data->descriptor_resource_epoch) {
+        return false;
+    }
+    for (auto &set_version : state.validated_set_versions) {
+        if (set_version.first->GetVersion() != set_version.second) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // Validate overall state at the time of a draw call
 static bool validate_and_update_draw_state(layer_data *my_data, GLOBAL_CB_NODE *pCB, const bool indexedDraw,
                                            const VkPipelineBindPoint bindPoint) {
     bool result = false;
-    auto const &state = pCB->lastBound[bindPoint];
+    auto &state = pCB->lastBound[bindPoint];
     PIPELINE_NODE *pPipe = getPipeline(my_data, state.pipeline);
     if (nullptr == pPipe) {
         result |= log_msg(
@@ -3024,17 +3346,20 @@ static bool validate_and_update_draw_state(layer_data *my_data, GLOBAL_CB_NODE *
     if (VK_PIPELINE_BIND_POINT_GRAPHICS == bindPoint)
         result = validate_draw_state_flags(my_data, pCB, pPipe, indexedDraw);
 
-    // Now complete other state checks
-    if (VK_NULL_HANDLE != state.pipeline_layout.layout) {
+    // Now complete other state checks, skipping the descriptor ones if the previous draw already did them
+    if (VK_NULL_HANDLE != state.pipeline_layout.layout && !descriptors_unchanged_since_validation(my_data, state, pPipe)) {
         string errorString;
-        auto pipeline_layout = pPipe->pipeline_layout;
+        auto const &pipeline_layout = pPipe->pipeline_layout;
+        bool all_valid = true;
 
         // Need a vector (vs. std::set) of active Sets for dynamicOffset validation in case same set bound w/ different offsets
-        vector<std::tuple<cvdescriptorset::DescriptorSet *, unordered_map<uint32_t, descriptor_req>, std::vector<uint32_t> const *>> activeSetBindingsPairs;
-        for (auto & setBindingPair : pPipe->active_slots) {
-            uint32_t setIndex = setBindingPair.first;
+        vector<active_set_use> activeSets;
+        activeSets.reserve(pPipe->active_slot_plan.size());
+        for (auto &setPlan : pPipe->active_slot_plan) {
+            uint32_t setIndex = setPlan.set;
             // If valid set is not bound throw an error
             if ((state.boundDescriptorSets.size() <= setIndex) || (!state.boundDescriptorSets[setIndex])) {
+                all_valid = false;
                 result |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                                   DRAWSTATE_DESCRIPTOR_SET_NOT_BOUND, "DS",
                                   "VkPipeline 0x%" PRIxLEAST64 " uses set #%u but that set is not bound.", (uint64_t)pPipe->pipeline,
@@ -3042,25 +3367,28 @@ static bool validate_and_update_draw_state(layer_data *my_data, GLOBAL_CB_NODE *
             } else if (!verify_set_layout_compatibility(my_data, state.boundDescriptorSets[setIndex], &pipeline_layout, setIndex,
                                                         errorString)) {
                 // Set is bound but not compatible w/ overlapping pipeline_layout from PSO
+                all_valid = false;
                 VkDescriptorSet setHandle = state.boundDescriptorSets[setIndex]->GetSet();
                 result |=
                     log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
                             (uint64_t)setHandle, __LINE__, DRAWSTATE_PIPELINE_LAYOUTS_INCOMPATIBLE, "DS",
                             "VkDescriptorSet (0x%" PRIxLEAST64
                             ") bound as set #%u is not compatible with overlapping VkPipelineLayout 0x%" PRIxLEAST64 " due to: %s",
-                            reinterpret_cast<uint64_t &>(setHandle), setIndex, reinterpret_cast<uint64_t &>(pipeline_layout.layout),
+                            reinterpret_cast<uint64_t &>(setHandle), setIndex,
+                            reinterpret_cast<const uint64_t &>(pipeline_layout.layout),
                             errorString.c_str());
             } else { // Valid set is bound and layout compatible, validate that it's updated
                 // Pull the set node
                 cvdescriptorset::DescriptorSet *pSet = state.boundDescriptorSets[setIndex];
                 // Save vector of all active sets to verify dynamicOffsets below
-                activeSetBindingsPairs.push_back(std::make_tuple(pSet, setBindingPair.second,
-                                                                 &state.dynamicOffsets[setIndex]));
+                active_set_use use = {pSet, &setPlan.bindings, &state.dynamicOffsets[setIndex]};
+                activeSets.push_back(use);
                 // Make sure set has been updated if it has no immutable samplers
                 //  If it has immutable samplers, we'll flag error later as needed depending on binding
                 if (!pSet->IsUpdated()) {
-                    for (auto binding : setBindingPair.second) {
+                    for (auto &binding : setPlan.bindings) {
                         if (!pSet->GetImmutableSamplerPtrFromBinding(binding.first)) {
+                            all_valid = false;
                             result |= log_msg(
                                 my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
                                 (uint64_t)pSet->GetSet(), __LINE__, DRAWSTATE_DESCRIPTOR_SET_NOT_UPDATED, "DS",
@@ -3073,7 +3401,16 @@ static bool validate_and_update_draw_state(layer_data *my_data, GLOBAL_CB_NODE *
             }
         }
         // For given active slots, verify any dynamic descriptors and record updated images & buffers
-        result |= validate_and_update_drawtime_descriptor_state(my_data, pCB, activeSetBindingsPairs);
+        result |= validate_and_update_drawtime_descriptor_state(my_data, pCB, pPipe->slot_plan_id, activeSets, &all_valid);
+        if (all_valid) {
+            state.validated_generation = state.generation;
+            state.validated_slot_plan_id = pPipe->slot_plan_id;
+            state.validated_resource_epoch = my_data->descriptor_resource_epoch;
+            state.validated_set_versions.clear();
+            for (auto &use : activeSets) {
+                state.validated_set_versions.emplace_back(use.set, use.set->GetVersion());
+            }
+        }
     }
 
     // Check general pipeline state that needs to be validated at drawtime
@@ -3084,33 +3421,140 @@ static bool validate_and_update_draw_state(layer_data *my_data, GLOBAL_CB_NODE *
 }
 
 // Validate HW line width capabilities prior to setting requested line width.
-static bool verifyLineWidth(layer_data *my_data, DRAW_STATE_ERROR dsError, const uint64_t &target, float lineWidth) {
+static bool verifyLineWidth(debug_report_data *report_data, PHYS_DEV_PROPERTIES_NODE const &phys_dev_properties,
+                            DRAW_STATE_ERROR dsError, const uint64_t &target, float lineWidth) {
     bool skip_call = false;
 
     // First check to see if the physical device supports wide lines.
-    if ((VK_FALSE == my_data->phys_dev_properties.features.wideLines) && (1.0f != lineWidth)) {
-        skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, target, __LINE__,
+    if ((VK_FALSE == phys_dev_properties.features.wideLines) && (1.0f != lineWidth)) {
+        skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, target, __LINE__,
                              dsError, "DS", "Attempt to set lineWidth to %f but physical device wideLines feature "
                                             "not supported/enabled so lineWidth must be 1.0f!",
                              lineWidth);
     } else {
         // Otherwise, make sure the width falls in the valid range.
-        if ((my_data->phys_dev_properties.properties.limits.lineWidthRange[0] > lineWidth) ||
-            (my_data->phys_dev_properties.properties.limits.lineWidthRange[1] < lineWidth)) {
-            skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, target,
+        if ((phys_dev_properties.properties.limits.lineWidthRange[0] > lineWidth) ||
+            (phys_dev_properties.properties.limits.lineWidthRange[1] < lineWidth)) {
+            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, target,
                                  __LINE__, dsError, "DS", "Attempt to set lineWidth to %f but physical device limits line width "
                                                           "to between [%f, %f]!",
-                                 lineWidth, my_data->phys_dev_properties.properties.limits.lineWidthRange[0],
-                                 my_data->phys_dev_properties.properties.limits.lineWidthRange[1]);
+                                 lineWidth, phys_dev_properties.properties.limits.lineWidthRange[0],
+                                 phys_dev_properties.properties.limits.lineWidthRange[1]);
+        }
+    }
+
+    return skip_call;
+}
+
+// Number of worker threads for pipeline validation, from lunarg_core_validation.pipeline_validation_threads.  None unless
+//  it is set, "auto" picks one thread per core besides the caller's, up to 7.
+static unsigned getPipelineWorkerCount() {
+    const char *option = getLayerOption("lunarg_core_validation.pipeline_validation_threads");
+    if (option[0] >= '0' && option[0] <= '9') {
+        return static_cast<unsigned>(strtoul(option, nullptr, 10));
+    }
+    if (strcmp(option, "auto")) {
+        return 0;
+    }
+    unsigned cores = std::thread::hardware_concurrency();
+    return (cores > 8) ? 7 : (cores ? cores - 1 : 0);
+}
+
+// debug_report_data that records messages instead of delivering them, so checks running on a pipeline validation worker
+//  can report through the usual log_msg() calls and have the messages replayed later on the calling thread
+class captured_messages {
+  public:
+    captured_messages() : report_data_(), callback_() {}
+    captured_messages(const captured_messages &) = delete;
+    captured_messages &operator=(const captured_messages &) = delete;
+
+    // Start capturing the messages target would deliver
+    debug_report_data *capture(debug_report_data const *target) {
+        if (!target) {
+            return nullptr;
         }
+        report_data_ = *target;
+        callback_.pfnMsgCallback = record;
+        callback_.msgFlags = target->active_flags;
+        callback_.pUserData = this;
+        report_data_.debug_callback_list = &callback_;
+        report_data_.default_debug_callback_list = nullptr;
+        return &report_data_;
+    }
+
+    // Deliver the captured messages to target's callbacks, returns true if any callback asked to skip the call
+    bool replay(debug_report_data const *target) const {
+        bool skip_call = false;
+        for (auto &message : messages_) {
+            skip_call |= debug_report_log_msg(target, message.flags, message.object_type, message.object, message.location,
+                                              message.code, message.layer_prefix.c_str(), message.text.c_str());
+        }
+        return skip_call;
     }
 
+  private:
+    struct message {
+        VkFlags flags;
+        VkDebugReportObjectTypeEXT object_type;
+        uint64_t object;
+        size_t location;
+        int32_t code;
+        std::string layer_prefix;
+        std::string text;
+    };
+
+    static VKAPI_ATTR VkBool32 VKAPI_CALL record(VkFlags flags, VkDebugReportObjectTypeEXT object_type, uint64_t object,
+                                                 size_t location, int32_t code, const char *layer_prefix, const char *text,
+                                                 void *user_data) {
+        message m = {flags, object_type, object, location, code, layer_prefix, text};
+        static_cast<captured_messages *>(user_data)->messages_.push_back(std::move(m));
+        // Whether to skip is up to the real callbacks, asked during replay
+        return VK_FALSE;
+    }
+
+    debug_report_data report_data_;
+    VkLayerDbgFunctionNode callback_;
+    std::vector<message> messages_;
+};
+
+// Call check(report_data, i) for each of the count pipelines of a vkCreate*Pipelines call, returning true if any of them
+//  wants the call skipped.  Big enough batches are spread over the device's pipeline validation workers; their messages
+//  are then captured and replayed in pipeline order, so callbacks see the same sequence, on the same thread, as when the
+//  pipelines are checked one by one.  Checks must only read device state.
+template <typename F> static bool validatePipelineBatch(layer_data *dev_data, uint32_t count, F &&check) {
+    worker_pool *workers = nullptr;
+    if (count > 1 && dev_data->pipeline_worker_count) {
+        std::lock_guard<std::mutex> lock(dev_data->pipeline_workers_lock);
+        if (!dev_data->pipeline_workers) {
+            dev_data->pipeline_workers.reset(new worker_pool(dev_data->pipeline_worker_count));
+        }
+        workers = dev_data->pipeline_workers.get();
+    }
+
+    bool skip_call = false;
+    if (!workers) {
+        for (uint32_t i = 0; i < count; i++) {
+            skip_call |= check(dev_data->report_data, i);
+        }
+        return skip_call;
+    }
+
+    std::unique_ptr<captured_messages[]> messages(new captured_messages[count]);
+    std::unique_ptr<bool[]> skip(new bool[count]);
+    workers->parallel_for(count, [&](size_t i) {
+        skip[i] = check(messages[i].capture(dev_data->report_data), static_cast<uint32_t>(i));
+    });
+    for (uint32_t i = 0; i < count; i++) {
+        skip_call |= skip[i];
+        skip_call |= messages[i].replay(dev_data->report_data);
+    }
     return skip_call;
 }
 
-// Verify that create state for a pipeline is valid
-static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device, std::vector<PIPELINE_NODE *> pPipelines,
-                                      int pipelineIndex) {
+// Verify that create state for a pipeline is valid, reporting through report_data.  Only reads device state, so
+//  pipelines of one batch may be checked concurrently under a shared hold of global_lock.
+static bool verifyPipelineCreateState(layer_data *my_data, debug_report_data *report_data,
+                                      std::vector<PIPELINE_NODE *> const &pPipelines, int pipelineIndex) {
     bool skip_call = false;
 
     PIPELINE_NODE *pPipeline = pPipelines[pipelineIndex];
@@ -3122,13 +3566,13 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
         PIPELINE_NODE *pBasePipeline = nullptr;
         if (!((pPipeline->graphicsPipelineCI.basePipelineHandle != VK_NULL_HANDLE) ^
               (pPipeline->graphicsPipelineCI.basePipelineIndex != -1))) {
-            skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                                  DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS",
                                  "Invalid Pipeline CreateInfo: exactly one of base pipeline index and handle must be specified");
         } else if (pPipeline->graphicsPipelineCI.basePipelineIndex != -1) {
             if (pPipeline->graphicsPipelineCI.basePipelineIndex >= pipelineIndex) {
                 skip_call |=
-                    log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+                    log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                             DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS",
                             "Invalid Pipeline CreateInfo: base pipeline must occur earlier in array than derivative pipeline.");
             } else {
@@ -3139,7 +3583,7 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
         }
 
         if (pBasePipeline && !(pBasePipeline->graphicsPipelineCI.flags & VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT)) {
-            skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                                  DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS",
                                  "Invalid Pipeline CreateInfo: base pipeline does not allow derivatives.");
         }
@@ -3155,7 +3599,7 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
                     // only attachment state, so memcmp is best suited for the comparison
                     if (memcmp(static_cast<const void *>(pAttachments), static_cast<const void *>(&pAttachments[i]),
                                sizeof(pAttachments[0]))) {
-                        skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0,
+                        skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0,
                                              __LINE__, DRAWSTATE_INDEPENDENT_BLEND, "DS",
                                              "Invalid Pipeline CreateInfo: If independent blend feature not "
                                              "enabled, all elements of pAttachments must be identical");
@@ -3167,7 +3611,7 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
         if (!my_data->phys_dev_properties.features.logicOp &&
             (pPipeline->graphicsPipelineCI.pColorBlendState->logicOpEnable != VK_FALSE)) {
             skip_call |=
-                log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                         DRAWSTATE_DISABLED_LOGIC_OP, "DS",
                         "Invalid Pipeline CreateInfo: If logic operations feature not enabled, logicOpEnable must be VK_FALSE");
         }
@@ -3175,7 +3619,7 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
             ((pPipeline->graphicsPipelineCI.pColorBlendState->logicOp < VK_LOGIC_OP_CLEAR) ||
              (pPipeline->graphicsPipelineCI.pColorBlendState->logicOp > VK_LOGIC_OP_SET))) {
             skip_call |=
-                log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                         DRAWSTATE_INVALID_LOGIC_OP, "DS",
                         "Invalid Pipeline CreateInfo: If logicOpEnable is VK_TRUE, logicOp must be a valid VkLogicOp value");
         }
@@ -3187,13 +3631,13 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
     auto renderPass = getRenderPass(my_data, pPipeline->graphicsPipelineCI.renderPass);
     if (renderPass &&
         pPipeline->graphicsPipelineCI.subpass >= renderPass->pCreateInfo->subpassCount) {
-        skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+        skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                              DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS", "Invalid Pipeline CreateInfo State: Subpass index %u "
                                                                             "is out of range for this renderpass (0..%u)",
                              pPipeline->graphicsPipelineCI.subpass, renderPass->pCreateInfo->subpassCount - 1);
     }
 
-    if (!validate_and_capture_pipeline_shader_state(my_data->report_data, pPipeline, &my_data->phys_dev_properties.features,
+    if (!validate_and_capture_pipeline_shader_state(report_data, pPipeline, &my_data->phys_dev_properties.features,
                                                     my_data->shaderModuleMap)) {
         skip_call = true;
     }
@@ -3201,7 +3645,7 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
     if (pPipeline->duplicate_shaders) {
         for (uint32_t stage = VK_SHADER_STAGE_VERTEX_BIT; stage & VK_SHADER_STAGE_ALL_GRAPHICS; stage <<= 1) {
             if (pPipeline->duplicate_shaders & stage) {
-                skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VkDebugReportObjectTypeEXT(0), 0,
+                skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VkDebugReportObjectTypeEXT(0), 0,
                                      __LINE__, DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS",
                                      "Invalid Pipeline CreateInfo State: Multiple shaders provided for stage %s",
                                      string_VkShaderStageFlagBits(VkShaderStageFlagBits(stage)));
@@ -3211,13 +3655,13 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
     // VS is required
     if (!(pPipeline->active_shaders & VK_SHADER_STAGE_VERTEX_BIT)) {
         skip_call |=
-            log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+            log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                     DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS", "Invalid Pipeline CreateInfo State: Vtx Shader required");
     }
     // Either both or neither TC/TE shaders should be defined
     if (((pPipeline->active_shaders & VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT) == 0) !=
         ((pPipeline->active_shaders & VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT) == 0)) {
-        skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+        skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                              DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS",
                              "Invalid Pipeline CreateInfo State: TE and TC shaders must be included or excluded as a pair");
     }
@@ -3226,7 +3670,7 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
         (pPipeline->active_shaders &
          (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT | VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT |
           VK_SHADER_STAGE_GEOMETRY_BIT | VK_SHADER_STAGE_FRAGMENT_BIT))) {
-        skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+        skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                              DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS",
                              "Invalid Pipeline CreateInfo State: Do not specify Compute Shader for Gfx Pipeline");
     }
@@ -3235,7 +3679,7 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
     if (pPipeline->active_shaders & (VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT | VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT) &&
         (!pPipeline->graphicsPipelineCI.pInputAssemblyState ||
          pPipeline->graphicsPipelineCI.pInputAssemblyState->topology != VK_PRIMITIVE_TOPOLOGY_PATCH_LIST)) {
-        skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+        skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                              DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS", "Invalid Pipeline CreateInfo State: "
                                                                             "VK_PRIMITIVE_TOPOLOGY_PATCH_LIST must be set as IA "
                                                                             "topology for tessellation pipelines");
@@ -3244,20 +3688,20 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
         pPipeline->graphicsPipelineCI.pInputAssemblyState->topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST) {
         if (~pPipeline->active_shaders & VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT) {
             skip_call |=
-                log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                         DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS", "Invalid Pipeline CreateInfo State: "
                                                                        "VK_PRIMITIVE_TOPOLOGY_PATCH_LIST primitive "
                                                                        "topology is only valid for tessellation pipelines");
         }
         if (!pPipeline->graphicsPipelineCI.pTessellationState) {
-            skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                                  DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS",
                                  "Invalid Pipeline CreateInfo State: "
                                  "pTessellationState is NULL when VK_PRIMITIVE_TOPOLOGY_PATCH_LIST primitive "
                                  "topology used. pTessellationState must not be NULL in this case.");
         } else if (!pPipeline->graphicsPipelineCI.pTessellationState->patchControlPoints ||
                    (pPipeline->graphicsPipelineCI.pTessellationState->patchControlPoints > 32)) {
-            skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                                  DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, "DS", "Invalid Pipeline CreateInfo State: "
                                                                                 "VK_PRIMITIVE_TOPOLOGY_PATCH_LIST primitive "
                                                                                 "topology used with patchControlPoints value %u."
@@ -3268,7 +3712,8 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
     // If a rasterization state is provided, make sure that the line width conforms to the HW.
     if (pPipeline->graphicsPipelineCI.pRasterizationState) {
         if (!isDynamic(pPipeline, VK_DYNAMIC_STATE_LINE_WIDTH)) {
-            skip_call |= verifyLineWidth(my_data, DRAWSTATE_INVALID_PIPELINE_CREATE_STATE, reinterpret_cast<uint64_t &>(pPipeline),
+            skip_call |= verifyLineWidth(report_data, my_data->phys_dev_properties, DRAWSTATE_INVALID_PIPELINE_CREATE_STATE,
+                                         reinterpret_cast<uint64_t &>(pPipeline),
                                          pPipeline->graphicsPipelineCI.pRasterizationState->lineWidth);
         }
     }
@@ -3278,13 +3723,13 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
     if (!pPipeline->graphicsPipelineCI.pRasterizationState ||
         (pPipeline->graphicsPipelineCI.pRasterizationState->rasterizerDiscardEnable == VK_FALSE)) {
         if (!pPipeline->graphicsPipelineCI.pViewportState) {
-            skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                                  DRAWSTATE_VIEWPORT_SCISSOR_MISMATCH, "DS", "Gfx Pipeline pViewportState is null. Even if viewport "
                                                                             "and scissors are dynamic PSO must include "
                                                                             "viewportCount and scissorCount in pViewportState.");
         } else if (pPipeline->graphicsPipelineCI.pViewportState->scissorCount !=
                    pPipeline->graphicsPipelineCI.pViewportState->viewportCount) {
-            skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                                  DRAWSTATE_VIEWPORT_SCISSOR_MISMATCH, "DS",
                                  "Gfx Pipeline viewport count (%u) must match scissor count (%u).",
                                  pPipeline->graphicsPipelineCI.pViewportState->viewportCount,
@@ -3297,7 +3742,7 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
                 if (pPipeline->graphicsPipelineCI.pViewportState->viewportCount &&
                     !pPipeline->graphicsPipelineCI.pViewportState->pViewports) {
                     skip_call |=
-                        log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
+                        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                                 DRAWSTATE_VIEWPORT_SCISSOR_MISMATCH, "DS",
                                 "Gfx Pipeline viewportCount is %u, but pViewports is NULL. For non-zero viewportCount, you "
                                 "must either include pViewports data, or include viewport in pDynamicState and set it with "
@@ -3308,7 +3753,7 @@ static bool verifyPipelineCreateState(layer_data *my_data, const VkDevice device
             if (!dynScissor) {
                 if (pPipeline->graphicsPipelineCI.pViewportState->scissorCount &&
                     !pPipeline->graphicsPipelineCI.pViewportState->pScissors) {
-                    skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0,
+                    skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0,
                                          __LINE__, DRAWSTATE_VIEWPORT_SCISSOR_MISMATCH, "DS",
                                          "Gfx Pipeline scissorCount is %u, but pScissors is NULL. For non-zero scissorCount, you "
                                          "must either include pScissors data, or include scissor in pDynamicState and set it with "
@@ -3411,201 +3856,97 @@ static bool validateUpdateConsistency(layer_data *my_data, const VkDevice device
     }
     return skip_call;
 }
-//TODO: Consolidate functions
-bool FindLayout(const GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, IMAGE_CMD_BUF_LAYOUT_NODE &node, const VkImageAspectFlags aspectMask) {
-    layer_data *my_data = get_my_data_ptr(get_dispatch_key(pCB->commandBuffer), layer_data_map);
-    if (!(imgpair.subresource.aspectMask & aspectMask)) {
-        return false;
-    }
-    VkImageAspectFlags oldAspectMask = imgpair.subresource.aspectMask;
-    imgpair.subresource.aspectMask = aspectMask;
-    auto imgsubIt = pCB->imageLayoutMap.find(imgpair);
-    if (imgsubIt == pCB->imageLayoutMap.end()) {
-        return false;
-    }
-    if (node.layout != VK_IMAGE_LAYOUT_MAX_ENUM && node.layout != imgsubIt->second.layout) {
-        log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
-                reinterpret_cast<uint64_t&>(imgpair.image), __LINE__, DRAWSTATE_INVALID_LAYOUT, "DS",
-                "Cannot query for VkImage 0x%" PRIx64 " layout when combined aspect mask %d has multiple layout types: %s and %s",
-                reinterpret_cast<uint64_t&>(imgpair.image), oldAspectMask, string_VkImageLayout(node.layout), string_VkImageLayout(imgsubIt->second.layout));
+// Per-CB layouts of image, created empty the first time the command buffer uses the image.  Returns nullptr if the image
+//  is not tracked.
+static CB_IMAGE_LAYOUT_NODE *getCBImageLayouts(const layer_data *dev_data, GLOBAL_CB_NODE *pCB, VkImage image) {
+    auto cb_entry = pCB->imageLayoutMap.find(image);
+    if (cb_entry != pCB->imageLayoutMap.end()) {
+        return &cb_entry->second;
     }
-    if (node.initialLayout != VK_IMAGE_LAYOUT_MAX_ENUM && node.initialLayout != imgsubIt->second.initialLayout) {
-        log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
-                reinterpret_cast<uint64_t&>(imgpair.image), __LINE__, DRAWSTATE_INVALID_LAYOUT, "DS",
-                "Cannot query for VkImage 0x%" PRIx64 " layout when combined aspect mask %d has multiple initial layout types: %s and %s",
-                reinterpret_cast<uint64_t&>(imgpair.image), oldAspectMask, string_VkImageLayout(node.initialLayout), string_VkImageLayout(imgsubIt->second.initialLayout));
-    }
-    node = imgsubIt->second;
-    return true;
-}
-
-bool FindLayout(const layer_data *my_data, ImageSubresourcePair imgpair, VkImageLayout &layout, const VkImageAspectFlags aspectMask) {
-    if (!(imgpair.subresource.aspectMask & aspectMask)) {
-        return false;
-    }
-    VkImageAspectFlags oldAspectMask = imgpair.subresource.aspectMask;
-    imgpair.subresource.aspectMask = aspectMask;
-    auto imgsubIt = my_data->imageLayoutMap.find(imgpair);
-    if (imgsubIt == my_data->imageLayoutMap.end()) {
-        return false;
-    }
-    if (layout != VK_IMAGE_LAYOUT_MAX_ENUM && layout != imgsubIt->second.layout) {
-        log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
-                reinterpret_cast<uint64_t&>(imgpair.image), __LINE__, DRAWSTATE_INVALID_LAYOUT, "DS",
-                "Cannot query for VkImage 0x%" PRIx64 " layout when combined aspect mask %d has multiple layout types: %s and %s",
-                reinterpret_cast<uint64_t&>(imgpair.image), oldAspectMask, string_VkImageLayout(layout), string_VkImageLayout(imgsubIt->second.layout));
-    }
-    layout = imgsubIt->second.layout;
-    return true;
-}
-
-// find layout(s) on the cmd buf level
-bool FindLayout(const GLOBAL_CB_NODE *pCB, VkImage image, VkImageSubresource range, IMAGE_CMD_BUF_LAYOUT_NODE &node) {
-    ImageSubresourcePair imgpair = {image, true, range};
-    node = IMAGE_CMD_BUF_LAYOUT_NODE(VK_IMAGE_LAYOUT_MAX_ENUM, VK_IMAGE_LAYOUT_MAX_ENUM);
-    FindLayout(pCB, imgpair, node, VK_IMAGE_ASPECT_COLOR_BIT);
-    FindLayout(pCB, imgpair, node, VK_IMAGE_ASPECT_DEPTH_BIT);
-    FindLayout(pCB, imgpair, node, VK_IMAGE_ASPECT_STENCIL_BIT);
-    FindLayout(pCB, imgpair, node, VK_IMAGE_ASPECT_METADATA_BIT);
-    if (node.layout == VK_IMAGE_LAYOUT_MAX_ENUM) {
-        imgpair = {image, false, VkImageSubresource()};
-        auto imgsubIt = pCB->imageLayoutMap.find(imgpair);
-        if (imgsubIt == pCB->imageLayoutMap.end())
-            return false;
-        node = imgsubIt->second;
+    auto global_entry = dev_data->imageLayoutMap.find(image);
+    if (global_entry == dev_data->imageLayoutMap.end()) {
+        return nullptr;
     }
-    return true;
-}
-
-// find layout(s) on the global level
-bool FindLayout(const layer_data *my_data, ImageSubresourcePair imgpair, VkImageLayout &layout) {
-    layout = VK_IMAGE_LAYOUT_MAX_ENUM;
-    FindLayout(my_data, imgpair, layout, VK_IMAGE_ASPECT_COLOR_BIT);
-    FindLayout(my_data, imgpair, layout, VK_IMAGE_ASPECT_DEPTH_BIT);
-    FindLayout(my_data, imgpair, layout, VK_IMAGE_ASPECT_STENCIL_BIT);
-    FindLayout(my_data, imgpair, layout, VK_IMAGE_ASPECT_METADATA_BIT);
-    if (layout == VK_IMAGE_LAYOUT_MAX_ENUM) {
-        imgpair = {imgpair.image, false, VkImageSubresource()};
-        auto imgsubIt = my_data->imageLayoutMap.find(imgpair);
-        if (imgsubIt == my_data->imageLayoutMap.end())
-            return false;
-        layout = imgsubIt->second.layout;
+    const auto &subresources = global_entry->second.subresources;
+    auto result =
+        pCB->imageLayoutMap.emplace(std::piecewise_construct, std::forward_as_tuple(image),
+                                    std::forward_as_tuple(subresources.mipLevels, subresources.arrayLayers, &pCB->memory));
+    return &result.first->second;
+}
+
+// Update the layouts of the subresources in range on the cmd buf level.  For each piece of the range whose layout is
+//  uniform, update(current, node) gets the piece's layout, or nullptr where the command buffer has not used it yet, and
+//  returns true to replace it with node.
+template <typename F>
+static void UpdateLayouts(const layer_data *dev_data, GLOBAL_CB_NODE *pCB, VkImage image, const VkImageSubresourceRange &range,
+                          F &&update) {
+    CB_IMAGE_LAYOUT_NODE *cb_layouts = getCBImageLayouts(dev_data, pCB, image);
+    if (!cb_layouts) {
+        return;
     }
-    return true;
-}
-
-bool FindLayout(const layer_data *my_data, VkImage image, VkImageSubresource range, VkImageLayout &layout) {
-    ImageSubresourcePair imgpair = {image, true, range};
-    return FindLayout(my_data, imgpair, layout);
+    struct LAYOUT_UPDATE {
+        uint32_t begin;
+        uint32_t end;
+        IMAGE_CMD_BUF_LAYOUT_NODE node;
+    };
+    // Gather first, the pieces shift as soon as the map is written
+    std::vector<LAYOUT_UPDATE> updates;
+    cb_layouts->forEachIndexRange(range, [&](uint32_t begin, uint32_t end) {
+        cb_layouts->layouts.for_each(begin, end,
+                                     [&](uint32_t piece_begin, uint32_t piece_end, const IMAGE_CMD_BUF_LAYOUT_NODE *current) {
+                                         IMAGE_CMD_BUF_LAYOUT_NODE node;
+                                         if (update(current, node)) {
+                                             updates.push_back({piece_begin, piece_end, node});
+                                         }
+                                     });
+    });
+    for (auto &layout_update : updates) {
+        cb_layouts->layouts.set(layout_update.begin, layout_update.end, layout_update.node);
+    }
+}
+
+static VkImageSubresourceRange SubresourceRange(const VkImageSubresourceLayers &subLayers) {
+    VkImageSubresourceRange range = {subLayers.aspectMask, subLayers.mipLevel, 1, subLayers.baseArrayLayer, subLayers.layerCount};
+    return range;
 }
 
+// Collect the layouts the subresources of image are in on the global level
 bool FindLayouts(const layer_data *my_data, VkImage image, std::vector<VkImageLayout> &layouts) {
-    auto sub_data = my_data->imageSubresourceMap.find(image);
-    if (sub_data == my_data->imageSubresourceMap.end())
+    auto image_layouts = my_data->imageLayoutMap.find(image);
+    if (image_layouts == my_data->imageLayoutMap.end())
         return false;
-    auto img_node = getImageNode(my_data, image);
-    if (!img_node)
-        return false;
-    bool ignoreGlobal = false;
+    const auto &subresources = image_layouts->second.subresources;
+    uint32_t tracked = 0;
+    subresources.layouts.for_each([&](uint32_t begin, uint32_t end, const VkImageLayout *layout) {
+        layouts.push_back(*layout);
+        tracked += end - begin;
+    });
     // TODO: Make this robust for >1 aspect mask. Now it will just say ignore
     // potential errors in this case.
-    if (sub_data->second.size() >= (img_node->createInfo.arrayLayers * img_node->createInfo.mipLevels + 1)) {
-        ignoreGlobal = true;
-    }
-    for (auto imgsubpair : sub_data->second) {
-        if (ignoreGlobal && !imgsubpair.hasSubresource)
-            continue;
-        auto img_data = my_data->imageLayoutMap.find(imgsubpair);
-        if (img_data != my_data->imageLayoutMap.end()) {
-            layouts.push_back(img_data->second.layout);
-        }
+    if (tracked < subresources.mipLevels * subresources.arrayLayers) {
+        layouts.push_back(image_layouts->second.image.layout);
     }
     return true;
 }
 
-// Set the layout on the global level
-void SetLayout(layer_data *my_data, ImageSubresourcePair imgpair, const VkImageLayout &layout) {
-    VkImage &image = imgpair.image;
-    // TODO (mlentine): Maybe set format if new? Not used atm.
-    my_data->imageLayoutMap[imgpair].layout = layout;
-    // TODO (mlentine): Maybe make vector a set?
-    auto subresource = std::find(my_data->imageSubresourceMap[image].begin(), my_data->imageSubresourceMap[image].end(), imgpair);
-    if (subresource == my_data->imageSubresourceMap[image].end()) {
-        my_data->imageSubresourceMap[image].push_back(imgpair);
-    }
-}
-
-// Set the layout on the cmdbuf level
-void SetLayout(GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, const IMAGE_CMD_BUF_LAYOUT_NODE &node) {
-    pCB->imageLayoutMap[imgpair] = node;
-    // TODO (mlentine): Maybe make vector a set?
-    auto subresource =
-        std::find(pCB->imageSubresourceMap[imgpair.image].begin(), pCB->imageSubresourceMap[imgpair.image].end(), imgpair);
-    if (subresource == pCB->imageSubresourceMap[imgpair.image].end()) {
-        pCB->imageSubresourceMap[imgpair.image].push_back(imgpair);
-    }
-}
-
-void SetLayout(GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, const VkImageLayout &layout) {
-    // TODO (mlentine): Maybe make vector a set?
-    if (std::find(pCB->imageSubresourceMap[imgpair.image].begin(), pCB->imageSubresourceMap[imgpair.image].end(), imgpair) !=
-        pCB->imageSubresourceMap[imgpair.image].end()) {
-        pCB->imageLayoutMap[imgpair].layout = layout;
-    } else {
-        // TODO (mlentine): Could be expensive and might need to be removed.
-        assert(imgpair.hasSubresource);
-        IMAGE_CMD_BUF_LAYOUT_NODE node;
-        if (!FindLayout(pCB, imgpair.image, imgpair.subresource, node)) {
-            node.initialLayout = layout;
-        }
-        SetLayout(pCB, imgpair, {node.initialLayout, layout});
-    }
-}
-
-template <class OBJECT, class LAYOUT>
-void SetLayout(OBJECT *pObject, ImageSubresourcePair imgpair, const LAYOUT &layout, VkImageAspectFlags aspectMask) {
-    if (imgpair.subresource.aspectMask & aspectMask) {
-        imgpair.subresource.aspectMask = aspectMask;
-        SetLayout(pObject, imgpair, layout);
-    }
-}
-
-template <class OBJECT, class LAYOUT>
-void SetLayout(OBJECT *pObject, VkImage image, VkImageSubresource range, const LAYOUT &layout) {
-    ImageSubresourcePair imgpair = {image, true, range};
-    SetLayout(pObject, imgpair, layout, VK_IMAGE_ASPECT_COLOR_BIT);
-    SetLayout(pObject, imgpair, layout, VK_IMAGE_ASPECT_DEPTH_BIT);
-    SetLayout(pObject, imgpair, layout, VK_IMAGE_ASPECT_STENCIL_BIT);
-    SetLayout(pObject, imgpair, layout, VK_IMAGE_ASPECT_METADATA_BIT);
-}
-
-template <class OBJECT, class LAYOUT> void SetLayout(OBJECT *pObject, VkImage image, const LAYOUT &layout) {
-    ImageSubresourcePair imgpair = {image, false, VkImageSubresource()};
-    SetLayout(pObject, image, imgpair, layout);
-}
-
+// Set the layout of the subresources of imageView on the cmdbuf level
 void SetLayout(const layer_data *dev_data, GLOBAL_CB_NODE *pCB, VkImageView imageView, const VkImageLayout &layout) {
     auto iv_data = getImageViewData(dev_data, imageView);
     assert(iv_data);
-    const VkImage &image = iv_data->image;
-    const VkImageSubresourceRange &subRange = iv_data->subresourceRange;
-    // TODO: Do not iterate over every possibility - consolidate where possible
-    for (uint32_t j = 0; j < subRange.levelCount; j++) {
-        uint32_t level = subRange.baseMipLevel + j;
-        for (uint32_t k = 0; k < subRange.layerCount; k++) {
-            uint32_t layer = subRange.baseArrayLayer + k;
-            VkImageSubresource sub = {subRange.aspectMask, level, layer};
-            // TODO: If ImageView was created with depth or stencil, transition both layouts as
-            // the aspectMask is ignored and both are used. Verify that the extra implicit layout
-            // is OK for descriptor set layout validation
-            if (subRange.aspectMask & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) {
-                if (vk_format_is_depth_and_stencil(iv_data->format)) {
-                    sub.aspectMask |= (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT);
-                }
-            }
-            SetLayout(pCB, image, sub, layout);
+    VkImageSubresourceRange range = iv_data->subresourceRange;
+    // TODO: If ImageView was created with depth or stencil, transition both layouts as
+    // the aspectMask is ignored and both are used. Verify that the extra implicit layout
+    // is OK for descriptor set layout validation
+    if (range.aspectMask & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) {
+        if (vk_format_is_depth_and_stencil(iv_data->format)) {
+            range.aspectMask |= (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT);
         }
     }
+    UpdateLayouts(dev_data, pCB, iv_data->image, range,
+                  [&](const IMAGE_CMD_BUF_LAYOUT_NODE *current, IMAGE_CMD_BUF_LAYOUT_NODE &node) {
+                      node = IMAGE_CMD_BUF_LAYOUT_NODE(current ? current->initialLayout : layout, layout);
+                      return true;
+                  });
 }
 
 // Validate that given set is valid and that it's not being used by an in-flight CmdBuffer
@@ -3614,14 +3955,14 @@ void SetLayout(const layer_data *dev_data, GLOBAL_CB_NODE *pCB, VkImageView imag
 // Return true if validation error occurs and callback returns true (to skip upcoming API call down the chain)
 static bool validateIdleDescriptorSet(const layer_data *my_data, VkDescriptorSet set, std::string func_str) {
     bool skip_call = false;
-    auto set_node = my_data->setMap.find(set);
-    if (set_node == my_data->setMap.end()) {
+    auto set_node = getSetNode(my_data, set);
+    if (!set_node) {
         skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
                              (uint64_t)(set), __LINE__, DRAWSTATE_DOUBLE_DESTROY, "DS",
                              "Cannot call %s() on descriptor set 0x%" PRIxLEAST64 " that has not been allocated.", func_str.c_str(),
                              (uint64_t)(set));
     } else {
-        if (set_node->second->in_use.load()) {
+        if (set_node->in_use.load()) {
             skip_call |= log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
                                  VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT, (uint64_t)(set), __LINE__, DRAWSTATE_OBJECT_INUSE,
                                  "DS", "Cannot call %s() on descriptor set 0x%" PRIxLEAST64 " that is in use by a command buffer.",
@@ -3635,6 +3976,8 @@ static bool validateIdleDescriptorSet(const layer_data *my_data, VkDescriptorSet
 static void freeDescriptorSet(layer_data *dev_data, cvdescriptorset::DescriptorSet *descriptor_set) {
     dev_data->setMap.erase(descriptor_set->GetSet());
     delete descriptor_set;
+    // Command buffers may still remember this set from their last validated draw
+    dev_data->descriptor_resource_epoch++;
 }
 // Free all DS Pools including their Sets & related sub-structs
 // NOTE : Calls to this function should be wrapped in mutex
@@ -3818,7 +4161,10 @@ static bool addCmd(layer_data *my_data, GLOBAL_CB_NODE *pCB, const CMD_TYPE cmd,
 //  Add object_binding to cmd buffer
 //  Add cb_binding to object
 static void addCommandBufferBinding(std::unordered_set<GLOBAL_CB_NODE *> *cb_bindings, VK_OBJECT obj, GLOBAL_CB_NODE *cb_node) {
-    cb_bindings->insert(cb_node);
+    {
+        std::lock_guard<std::mutex> lock(getBindingLock(cb_bindings));
+        cb_bindings->insert(cb_node);
+    }
     cb_node->object_bindings.insert(obj);
 }
 // For a given object, if cb_node is in that objects cb_bindings, remove cb_node
@@ -3861,10 +4207,10 @@ static void removeCommandBufferBinding(layer_data *dev_data, VK_OBJECT const *ob
 // Reset the command buffer state
 //  Maintain the createInfo and set state to CB_NEW, but clear all other state
 static void resetCB(layer_data *dev_data, const VkCommandBuffer cb) {
-    GLOBAL_CB_NODE *pCB = dev_data->commandBufferMap[cb];
+    auto cb_it = dev_data->commandBufferMap.find(cb);
+    GLOBAL_CB_NODE *pCB = cb_it == dev_data->commandBufferMap.end() ? nullptr : cb_it->second;
     if (pCB) {
         pCB->in_use.store(0);
-        pCB->cmds.clear();
         // Reset CB state (note that createInfo is not cleared)
         pCB->commandBuffer = cb;
         memset(&pCB->beginInfo, 0, sizeof(VkCommandBufferBeginInfo));
@@ -3889,17 +4235,7 @@ static void resetCB(layer_data *dev_data, const VkCommandBuffer cb) {
         pCB->activeRenderPass = nullptr;
         pCB->activeSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
         pCB->activeSubpass = 0;
-        pCB->broken_bindings.clear();
-        pCB->waitedEvents.clear();
-        pCB->events.clear();
-        pCB->writeEventsBeforeWait.clear();
         pCB->waitedEventsBeforeQueryReset.clear();
-        pCB->queryToStateMap.clear();
-        pCB->activeQueries.clear();
-        pCB->startedQueries.clear();
-        pCB->imageSubresourceMap.clear();
-        pCB->imageLayoutMap.clear();
-        pCB->eventToStageMap.clear();
         pCB->drawData.clear();
         pCB->currentDrawData.buffers.clear();
         pCB->primaryCommandBuffer = VK_NULL_HANDLE;
@@ -3907,12 +4243,7 @@ static void resetCB(layer_data *dev_data, const VkCommandBuffer cb) {
         for (auto secondary_cb : pCB->secondaryCommandBuffers) {
             dev_data->globalInFlightCmdBuffers.erase(secondary_cb);
         }
-        pCB->secondaryCommandBuffers.clear();
-        pCB->updateImages.clear();
-        pCB->updateBuffers.clear();
         clear_cmd_buf_and_mem_references(dev_data, pCB);
-        pCB->eventUpdates.clear();
-        pCB->queryUpdates.clear();
 
         // Remove object bindings
         for (auto obj : pCB->object_bindings) {
@@ -3924,8 +4255,9 @@ static void resetCB(layer_data *dev_data, const VkCommandBuffer cb) {
             if (fb_node)
                 fb_node->cb_bindings.erase(pCB);
         }
-        pCB->framebuffers.clear();
         pCB->activeFramebuffer = VK_NULL_HANDLE;
+        // Everything above that had to be unlinked from other objects has been, drop the rest wholesale
+        pCB->resetRecordedState();
     }
 }
 
@@ -4002,7 +4334,7 @@ static void printCB(layer_data *my_data, const VkCommandBuffer cb) {
     if (pCB && pCB->cmds.size() > 0) {
         log_msg(my_data->report_data, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                 DRAWSTATE_NONE, "DS", "Cmds in CB 0x%p", (void *)cb);
-        vector<CMD_NODE> cmds = pCB->cmds;
+        const auto &cmds = pCB->cmds;
         for (auto ii = cmds.begin(); ii != cmds.end(); ++ii) {
             // TODO : Need to pass cb as srcObj here
             log_msg(my_data->report_data, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0,
@@ -4098,7 +4430,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     VkLayerInstanceDispatchTable *pTable = my_data->instance_dispatch_table;
     pTable->DestroyInstance(instance, pAllocator);
 
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
     // Clean up logging callback, if any
     while (my_data->logging_callback.size() > 0) {
         VkDebugReportCallbackEXT callback = my_data->logging_callback.back();
@@ -4195,6 +4527,9 @@ static bool ValidateRequestedFeatures(layer_data *dev_data, const VkPhysicalDevi
     return skip_call;
 }
 
+// prototype
+static void replayAsyncCmd(void *context, const void *record, size_t size);
+
 VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo *pCreateInfo,
                                             const VkAllocationCallbacks *pAllocator, VkDevice *pDevice) {
     layer_data *my_instance_data = get_my_data_ptr(get_dispatch_key(gpu), layer_data_map);
@@ -4224,7 +4559,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         return result;
     }
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(global_lock);
     layer_data *my_device_data = get_my_data_ptr(get_dispatch_key(*pDevice), layer_data_map);
 
     // Setup device dispatch table
@@ -4249,6 +4584,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     }
     // Store physical device mem limits into device layer_data struct
     my_instance_data->instance_dispatch_table->GetPhysicalDeviceMemoryProperties(gpu, &my_device_data->phys_dev_mem_props);
+    // Optionally move validation of the most frequent recording commands onto a worker thread
+    if (!strcmp(getLayerOption("lunarg_core_validation.async_validation"), "true")) {
+        my_device_data->async_queue.reset(new async_record_queue(replayAsyncCmd, my_device_data));
+        my_device_data->async_cb_stripes.reset(new ASYNC_CB_STRIPE[ASYNC_CB_STRIPE_COUNT]);
+    }
+    my_device_data->pipeline_worker_count = getPipelineWorkerCount();
     lock.unlock();
 
     ValidateLayerOrdering(*pCreateInfo);
@@ -4263,7 +4604,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dispatch_key key = get_dispatch_key(device);
     layer_data *dev_data = get_my_data_ptr(key, layer_data_map);
     // Free all the memory
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
+    // Nothing is left for the async validation worker to do, stop it before the state it reads goes away
+    dev_data->async_queue.reset();
+    dev_data->pipeline_workers.reset();
     deletePipelines(dev_data);
     deleteRenderPasses(dev_data);
     deleteCommandBuffers(dev_data);
@@ -4277,7 +4621,6 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dev_data->descriptorSetLayoutMap.clear();
     dev_data->imageViewMap.clear();
     dev_data->imageMap.clear();
-    dev_data->imageSubresourceMap.clear();
     dev_data->imageLayoutMap.clear();
     dev_data->bufferViewMap.clear();
     dev_data->bufferMap.clear();
@@ -4309,7 +4652,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
             }
         }
     }
-    layer_debug_report_destroy_device(device);
+    layer_debug_report_destroy_device(dev_data->report_data, device);
     lock.unlock();
 
 #if DISPATCH_MAP_DEBUG
@@ -4333,39 +4676,39 @@ static const VkExtensionProperties instance_extensions[] = {{VK_EXT_DEBUG_REPORT
 // as the global IMAGE layout
 static bool ValidateCmdBufImageLayouts(layer_data *dev_data, GLOBAL_CB_NODE *pCB) {
     bool skip_call = false;
-    for (auto cb_image_data : pCB->imageLayoutMap) {
-        VkImageLayout imageLayout;
-        if (!FindLayout(dev_data, cb_image_data.first, imageLayout)) {
+    for (auto &cb_image_data : pCB->imageLayoutMap) {
+        const VkImage image = cb_image_data.first;
+        auto global_entry = dev_data->imageLayoutMap.find(image);
+        if (global_entry == dev_data->imageLayoutMap.end()) {
             skip_call |=
                 log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0,
                         __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS", "Cannot submit cmd buffer using deleted image 0x%" PRIx64 ".",
-                        reinterpret_cast<const uint64_t &>(cb_image_data.first));
-        } else {
-            if (cb_image_data.second.initialLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
+                        reinterpret_cast<const uint64_t &>(image));
+            continue;
+        }
+        auto &global_layouts = global_entry->second.subresources;
+        const VkImageLayout createdLayout = global_entry->second.image.layout;
+        cb_image_data.second.layouts.for_each([&](uint32_t begin, uint32_t end, const IMAGE_CMD_BUF_LAYOUT_NODE *cb_node) {
+            if (cb_node->initialLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
                 // TODO: Set memory invalid which is in mem_tracker currently
-            } else if (imageLayout != cb_image_data.second.initialLayout) {
-                if (cb_image_data.first.hasSubresource) {
-                    skip_call |= log_msg(
-                        dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                        reinterpret_cast<uint64_t &>(pCB->commandBuffer), __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
-                        "Cannot submit cmd buffer using image (0x%" PRIx64 ") [sub-resource: aspectMask 0x%X array layer %u, mip level %u], "
-                        "with layout %s when first use is %s.",
-                        reinterpret_cast<const uint64_t &>(cb_image_data.first.image), cb_image_data.first.subresource.aspectMask,
-                                cb_image_data.first.subresource.arrayLayer,
-                                cb_image_data.first.subresource.mipLevel, string_VkImageLayout(imageLayout),
-                        string_VkImageLayout(cb_image_data.second.initialLayout));
-                } else {
-                    skip_call |= log_msg(
-                        dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                        reinterpret_cast<uint64_t &>(pCB->commandBuffer), __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
-                        "Cannot submit cmd buffer using image (0x%" PRIx64 ") with layout %s when "
-                        "first use is %s.",
-                        reinterpret_cast<const uint64_t &>(cb_image_data.first.image), string_VkImageLayout(imageLayout),
-                        string_VkImageLayout(cb_image_data.second.initialLayout));
-                }
+            } else {
+                global_layouts.layouts.for_each(begin, end, [&](uint32_t piece_begin, uint32_t, const VkImageLayout *layout) {
+                    VkImageLayout imageLayout = layout ? *layout : createdLayout;
+                    if (imageLayout != cb_node->initialLayout) {
+                        VkImageSubresource sub = global_layouts.subresource(piece_begin);
+                        skip_call |= log_msg(
+                            dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                            reinterpret_cast<uint64_t &>(pCB->commandBuffer), __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
+                            "Cannot submit cmd buffer using image (0x%" PRIx64 ") [sub-resource: aspectMask 0x%X "
+                            "array layer %u, mip level %u], "
+                            "with layout %s when first use is %s.",
+                            reinterpret_cast<const uint64_t &>(image), sub.aspectMask, sub.arrayLayer, sub.mipLevel,
+                            string_VkImageLayout(imageLayout), string_VkImageLayout(cb_node->initialLayout));
+                    }
+                });
             }
-            SetLayout(dev_data, cb_image_data.first, cb_image_data.second.layout);
-        }
+            global_layouts.layouts.set(begin, end, cb_node->layout);
+        });
     }
     return skip_call;
 }
@@ -4739,13 +5082,52 @@ ValidateFenceForSubmit(layer_data *dev_data, FENCE_NODE *pFence)
     return skip_call;
 }
 
+static bool setEventStageMask(QUEUE_NODE *pQueue, GLOBAL_CB_NODE *pCB, VkEvent event, VkPipelineStageFlags stageMask);
+static bool validateEventStageMask(layer_data *dev_data, QUEUE_NODE *pQueue, GLOBAL_CB_NODE *pCB, uint32_t eventCount,
+                                   size_t firstEventIndex, VkPipelineStageFlags sourceStageMask);
+static bool setQueryState(layer_data *dev_data, QUEUE_NODE *pQueue, VkCommandBuffer commandBuffer, QueryObject object,
+                          uint32_t queryCount, bool value);
+static bool validateQuery(layer_data *dev_data, QUEUE_NODE *pQueue, VkQueryPool queryPool, uint32_t queryCount,
+                          uint32_t firstQuery);
+
+// Run the checks deferred by vkCmd* calls for a batch of command buffers being submitted to pQueue
+static bool replayDeferredChecks(layer_data *dev_data, QUEUE_NODE *pQueue, const std::vector<GLOBAL_CB_NODE *> &cb_nodes) {
+    bool skip_call = false;
+    for (auto pCBNode : cb_nodes) {
+        for (auto &check : pCBNode->deferredChecks) {
+            switch (check.type) {
+            case DEFERRED_VALIDATE_MEMORY:
+                skip_call |= validate_memory_is_valid(dev_data, check.memory.mem, check.memory.caller, check.memory.image);
+                break;
+            case DEFERRED_SET_MEMORY_VALID:
+                set_memory_valid(dev_data, check.memory.mem, check.memory.valid, check.memory.image);
+                break;
+            case DEFERRED_SET_EVENT_STAGE:
+                skip_call |= setEventStageMask(pQueue, pCBNode, check.event.event, check.event.stageMask);
+                break;
+            case DEFERRED_VALIDATE_EVENT_STAGE:
+                skip_call |= validateEventStageMask(dev_data, pQueue, pCBNode, check.event.count, check.event.firstIndex,
+                                                    check.event.stageMask);
+                break;
+            case DEFERRED_SET_QUERY_STATE:
+                skip_call |= setQueryState(dev_data, pQueue, check.query.commandBuffer, check.query.query, check.query.count,
+                                           check.query.value);
+                break;
+            case DEFERRED_VALIDATE_QUERY:
+                skip_call |= validateQuery(dev_data, pQueue, check.query.query.pool, check.query.count, check.query.query.index);
+                break;
+            }
+        }
+    }
+    return skip_call;
+}
 
 VKAPI_ATTR VkResult VKAPI_CALL
 QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(queue), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
 
     auto pQueue = getQueueNode(dev_data, queue);
     auto pFence = getFenceNode(dev_data, fence);
@@ -4819,6 +5201,7 @@ QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, V
         }
 
         std::vector<VkCommandBuffer> cbs;
+        std::vector<GLOBAL_CB_NODE *> cb_nodes;
 
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
             auto pCBNode = getCBNode(dev_data, submit->pCommandBuffers[i]);
@@ -4831,18 +5214,11 @@ QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, V
 
                 pCBNode->submitCount++; // increment submit count
                 skip_call |= validatePrimaryCommandBufferState(dev_data, pCBNode);
-                // Call submit-time functions to validate/update state
-                for (auto &function : pCBNode->validate_functions) {
-                    skip_call |= function();
-                }
-                for (auto &function : pCBNode->eventUpdates) {
-                    skip_call |= function(queue);
-                }
-                for (auto &function : pCBNode->queryUpdates) {
-                    skip_call |= function(queue);
-                }
+                cb_nodes.push_back(pCBNode);
             }
         }
+        // Validate/update state that had to wait for submit time, for the whole batch at once
+        skip_call |= replayDeferredChecks(dev_data, pQueue, cb_nodes);
 
         submitTarget.emplace_back(cbs, semaphoreList);
     }
@@ -4858,7 +5234,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAll
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = my_data->device_dispatch_table->AllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     // TODO : Track allocations and overall size here
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(syncedGlobalLock(my_data));
     add_mem_obj_info(my_data, device, *pMemory, pAllocateInfo);
     print_mem_list(my_data);
     return result;
@@ -4875,8 +5251,9 @@ FreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks *pAl
     // buffers (on host or device) for anything other than destroying those objects will result in
     // undefined behavior.
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(my_data));
     bool skip_call = freeMemObjInfo(my_data, device, mem, false);
+    my_data->descriptor_resource_epoch++;
     print_mem_list(my_data);
     printCBList(my_data);
     lock.unlock();
@@ -4898,9 +5275,8 @@ static bool ValidateMapMemRange(layer_data *my_data, VkDeviceMemory mem, VkDevic
                             "VkMapMemory: Attempting to map memory range of size zero");
     }
 
-    auto mem_element = my_data->memObjMap.find(mem);
-    if (mem_element != my_data->memObjMap.end()) {
-        auto mem_info = mem_element->second.get();
+    auto mem_info = getMemObjInfo(my_data, mem);
+    if (mem_info) {
         // It is an application error to call VkMapMemory on an object that is already mapped
         if (mem_info->mem_range.size != 0) {
             skip_call = log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT,
@@ -5001,7 +5377,7 @@ WaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBo
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
     // Verify fence status of submitted fences
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     for (uint32_t i = 0; i < fenceCount; i++) {
         skip_call |= verifyWaitFenceState(dev_data, pFences[i], "vkWaitForFences");
     }
@@ -5030,7 +5406,7 @@ WaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBo
 VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(VkDevice device, VkFence fence) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     skip_call = verifyWaitFenceState(dev_data, fence, "vkGetFenceStatus");
     lock.unlock();
 
@@ -5052,7 +5428,7 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyI
                                                             VkQueue *pQueue) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     dev_data->device_dispatch_table->GetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
 
     // Add queue to tracking set only if it is new
     auto result = dev_data->queues.emplace(*pQueue);
@@ -5065,6 +5441,7 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyI
 VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue queue) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(queue), layer_data_map);
     bool skip_call = false;
+    flushAsyncValidation(dev_data);
     skip_call |= decrementResources(dev_data, queue);
     if (skip_call)
         return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -5075,7 +5452,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue queue) {
 VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice device) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     for (auto queue : dev_data->queues) {
         skip_call |= decrementResources(dev_data, queue);
     }
@@ -5090,7 +5467,7 @@ VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice device) {
 VKAPI_ATTR void VKAPI_CALL DestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto fence_pair = dev_data->fenceMap.find(fence);
     if (fence_pair != dev_data->fenceMap.end()) {
         if (fence_pair->second.state == FENCE_INFLIGHT) {
@@ -5110,7 +5487,7 @@ VKAPI_ATTR void VKAPI_CALL
 DestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto item = dev_data->semaphoreMap.find(semaphore);
     if (item != dev_data->semaphoreMap.end()) {
         if (item->second.in_use.load()) {
@@ -5127,7 +5504,7 @@ DestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallb
 VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto event_node = getEventNode(dev_data, event);
     if (event_node) {
         if (event_node->in_use.load()) {
@@ -5150,7 +5527,7 @@ VKAPI_ATTR void VKAPI_CALL
 DestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     // TODO : Add detection for an in-flight queryPool
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto qp_node = getQueryPoolNode(dev_data, queryPool);
     if (qp_node) {
         // Any bound cmd buffers are now invalid
@@ -5167,7 +5544,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQueryPool
                                                    VkQueryResultFlags flags) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     unordered_map<QueryObject, vector<VkCommandBuffer>> queriesInFlight;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     for (auto cmdBuffer : dev_data->globalInFlightCmdBuffers) {
         auto pCB = getCBNode(dev_data, cmdBuffer);
         for (auto queryStatePair : pCB->queryToStateMap) {
@@ -5304,7 +5681,7 @@ static void remove_memory_ranges(uint64_t handle, VkDeviceMemory mem, vector<MEM
 VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer,
                                          const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     if (!validateIdleBuffer(dev_data, buffer)) {
         // Clean up memory binding and range information for buffer
         auto buff_node = getBufferNode(dev_data, buffer);
@@ -5318,6 +5695,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer,
             }
             clear_object_binding(dev_data, reinterpret_cast<uint64_t &>(buffer), VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT);
             dev_data->bufferMap.erase(buff_node->buffer);
+            dev_data->descriptor_resource_epoch++;
         }
         lock.unlock();
         dev_data->device_dispatch_table->DestroyBuffer(device, buffer, pAllocator);
@@ -5328,11 +5706,9 @@ VKAPI_ATTR void VKAPI_CALL
 DestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
-    auto item = dev_data->bufferViewMap.find(bufferView);
-    if (item != dev_data->bufferViewMap.end()) {
-        dev_data->bufferViewMap.erase(item);
-    }
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
+    dev_data->bufferViewMap.erase(bufferView);
+    dev_data->descriptor_resource_epoch++;
     lock.unlock();
     dev_data->device_dispatch_table->DestroyBufferView(device, bufferView, pAllocator);
 }
@@ -5340,7 +5716,7 @@ DestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCa
 VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto img_node = getImageNode(dev_data, image);
     if (img_node) {
         // Any bound cmd buffers are now invalid
@@ -5354,14 +5730,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice device, VkImage image, const Vk
         }
         // Remove image from imageMap
         dev_data->imageMap.erase(img_node->image);
+        dev_data->descriptor_resource_epoch++;
     }
-    const auto& subEntry = dev_data->imageSubresourceMap.find(image);
-    if (subEntry != dev_data->imageSubresourceMap.end()) {
-        for (const auto& pair : subEntry->second) {
-            dev_data->imageLayoutMap.erase(pair);
-        }
-        dev_data->imageSubresourceMap.erase(subEntry);
-    }
+    dev_data->imageLayoutMap.erase(image);
     lock.unlock();
     dev_data->device_dispatch_table->DestroyImage(device, image, pAllocator);
 }
@@ -5384,7 +5755,7 @@ VKAPI_ATTR VkResult VKAPI_CALL
 BindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory mem, VkDeviceSize memoryOffset) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     // Track objects tied to memory
     uint64_t buffer_handle = (uint64_t)(buffer);
     bool skip_call = set_mem_binding(dev_data, mem, buffer_handle, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, "vkBindBufferMemory");
@@ -5436,7 +5807,7 @@ BindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory mem, VkDeviceS
             dev_data->phys_dev_properties.properties.limits.minUniformBufferOffsetAlignment,
             dev_data->phys_dev_properties.properties.limits.minStorageBufferOffsetAlignment
         };
-        VkBufferUsageFlags usage = dev_data->bufferMap[buffer].get()->createInfo.usage;
+        VkBufferUsageFlags usage = getBufferNode(dev_data, buffer)->createInfo.usage;
 
         for (int i = 0; i < 3; i++) {
             if (usage & usage_list[i]) {
@@ -5459,34 +5830,11 @@ BindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory mem, VkDeviceS
     return result;
 }
 
-VKAPI_ATTR void VKAPI_CALL
-GetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements *pMemoryRequirements) {
-    layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    // TODO : What to track here?
-    //   Could potentially save returned mem requirements and validate values passed into BindBufferMemory
-    my_data->device_dispatch_table->GetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
-}
-
-VKAPI_ATTR void VKAPI_CALL
-GetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements *pMemoryRequirements) {
-    layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    // TODO : What to track here?
-    //   Could potentially save returned mem requirements and validate values passed into BindImageMemory
-    my_data->device_dispatch_table->GetImageMemoryRequirements(device, image, pMemoryRequirements);
-}
-
-VKAPI_ATTR void VKAPI_CALL
-DestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks *pAllocator) {
-    // TODO : Clean up any internal data structures using this obj.
-    get_my_data_ptr(get_dispatch_key(device), layer_data_map)
-        ->device_dispatch_table->DestroyImageView(device, imageView, pAllocator);
-}
-
 VKAPI_ATTR void VKAPI_CALL
 DestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks *pAllocator) {
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(my_data));
     my_data->shaderModuleMap.erase(shaderModule);
     lock.unlock();
 
@@ -5497,7 +5845,7 @@ VKAPI_ATTR void VKAPI_CALL
 DestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     // TODO : Add detection for in-flight pipeline
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto pipe_node = getPipeline(dev_data, pipeline);
     if (pipe_node) {
         // Any bound cmd buffers are now invalid
@@ -5512,32 +5860,13 @@ DestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallback
 VKAPI_ATTR void VKAPI_CALL
 DestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     dev_data->pipelineLayoutMap.erase(pipelineLayout);
     lock.unlock();
 
     dev_data->device_dispatch_table->DestroyPipelineLayout(device, pipelineLayout, pAllocator);
 }
 
-VKAPI_ATTR void VKAPI_CALL
-DestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks *pAllocator) {
-    // TODO : Clean up any internal data structures using this obj.
-    get_my_data_ptr(get_dispatch_key(device), layer_data_map)->device_dispatch_table->DestroySampler(device, sampler, pAllocator);
-}
-
-VKAPI_ATTR void VKAPI_CALL
-DestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks *pAllocator) {
-    // TODO : Clean up any internal data structures using this obj.
-    get_my_data_ptr(get_dispatch_key(device), layer_data_map)
-        ->device_dispatch_table->DestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
-}
-
-VKAPI_ATTR void VKAPI_CALL
-DestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks *pAllocator) {
-    // TODO : Clean up any internal data structures using this obj.
-    get_my_data_ptr(get_dispatch_key(device), layer_data_map)
-        ->device_dispatch_table->DestroyDescriptorPool(device, descriptorPool, pAllocator);
-}
 // Verify cmdBuffer in given cb_node is not in global in-flight set, and return skip_call result
 //  If this is a secondary command buffer, then make sure its primary is also in-flight
 //  If primary is not in-flight, then remove secondary from global in-flight set
@@ -5579,7 +5908,7 @@ VKAPI_ATTR void VKAPI_CALL
 FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer *pCommandBuffers) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
 
     for (uint32_t i = 0; i < commandBufferCount; i++) {
         auto cb_node = getCBNode(dev_data, pCommandBuffers[i]);
@@ -5621,7 +5950,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkComman
     VkResult result = dev_data->device_dispatch_table->CreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         dev_data->commandPoolMap[*pCommandPool].createFlags = pCreateInfo->flags;
         dev_data->commandPoolMap[*pCommandPool].queueFamilyIndex = pCreateInfo->queueFamilyIndex;
     }
@@ -5634,7 +5963,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice device, const VkQueryPoo
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->CreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         dev_data->queryPoolMap[*pQueryPool].createInfo = *pCreateInfo;
     }
     return result;
@@ -5645,7 +5974,7 @@ VKAPI_ATTR void VKAPI_CALL
 DestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     // Verify that command buffers in pool are complete (not in-flight)
     auto pPool = getCommandPoolNode(dev_data, commandPool);
     skip_call |= checkCommandBuffersInFlight(dev_data, pPool, "destroy command pool with");
@@ -5681,7 +6010,7 @@ ResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetF
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto pPool = getCommandPoolNode(dev_data, commandPool);
     skip_call |= checkCommandBuffersInFlight(dev_data, pPool, "reset command pool with");
     lock.unlock();
@@ -5706,7 +6035,7 @@ ResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetF
 VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     for (uint32_t i = 0; i < fenceCount; ++i) {
         auto pFence = getFenceNode(dev_data, pFences[i]);
         if (pFence && pFence->state == FENCE_INFLIGHT) {
@@ -5751,7 +6080,7 @@ void invalidateCommandBuffers(std::unordered_set<GLOBAL_CB_NODE *> cb_nodes, VK_
 VKAPI_ATTR void VKAPI_CALL
 DestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto fb_node = getFramebuffer(dev_data, framebuffer);
     if (fb_node) {
         invalidateCommandBuffers(fb_node->cb_bindings,
@@ -5765,7 +6094,7 @@ DestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocatio
 VKAPI_ATTR void VKAPI_CALL
 DestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     dev_data->renderPassMap.erase(renderPass);
     // TODO: leaking all the guts of the renderpass node here!
     lock.unlock();
@@ -5779,7 +6108,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
     VkResult result = dev_data->device_dispatch_table->CreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         // TODO : This doesn't create deep copy of pQueueFamilyIndices so need to fix that if/when we want that data to be valid
         dev_data->bufferMap.insert(std::make_pair(*pBuffer, unique_ptr<BUFFER_NODE>(new BUFFER_NODE(*pBuffer, pCreateInfo))));
     }
@@ -5804,7 +6133,7 @@ static bool PreCallValidateCreateBufferView(layer_data *dev_data, const VkBuffer
 VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
                                                 const VkAllocationCallbacks *pAllocator, VkBufferView *pView) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     bool skip_call = PreCallValidateCreateBufferView(dev_data, pCreateInfo);
     lock.unlock();
     if (skip_call)
@@ -5825,14 +6154,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateI
     VkResult result = dev_data->device_dispatch_table->CreateImage(device, pCreateInfo, pAllocator, pImage);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         IMAGE_LAYOUT_NODE image_node;
         image_node.layout = pCreateInfo->initialLayout;
         image_node.format = pCreateInfo->format;
         dev_data->imageMap.insert(std::make_pair(*pImage, unique_ptr<IMAGE_NODE>(new IMAGE_NODE(*pImage, pCreateInfo))));
-        ImageSubresourcePair subpair = {*pImage, false, VkImageSubresource()};
-        dev_data->imageSubresourceMap[*pImage].push_back(subpair);
-        dev_data->imageLayoutMap[subpair] = image_node;
+        dev_data->imageLayoutMap.emplace(std::piecewise_construct, std::forward_as_tuple(*pImage),
+                                         std::forward_as_tuple(image_node, pCreateInfo->mipLevels, pCreateInfo->arrayLayers));
     }
     return result;
 }
@@ -5856,25 +6184,6 @@ static void ResolveRemainingLevelsLayers(layer_data *dev_data, VkImageSubresourc
     }
 }
 
-// Return the correct layer/level counts if the caller used the special
-// values VK_REMAINING_MIP_LEVELS or VK_REMAINING_ARRAY_LAYERS.
-static void ResolveRemainingLevelsLayers(layer_data *dev_data, uint32_t *levels, uint32_t *layers, VkImageSubresourceRange range,
-                                         VkImage image) {
-    /* expects global_lock to be held by caller */
-
-    *levels = range.levelCount;
-    *layers = range.layerCount;
-    auto image_node = getImageNode(dev_data, image);
-    if (image_node) {
-        if (range.levelCount == VK_REMAINING_MIP_LEVELS) {
-            *levels = image_node->createInfo.mipLevels - range.baseMipLevel;
-        }
-        if (range.layerCount == VK_REMAINING_ARRAY_LAYERS) {
-            *layers = image_node->createInfo.arrayLayers - range.baseArrayLayer;
-        }
-    }
-}
-
 static bool PreCallValidateCreateImageView(layer_data *dev_data, const VkImageViewCreateInfo *pCreateInfo) {
     bool skip_call = false;
     IMAGE_NODE *image_node = getImageNode(dev_data, pCreateInfo->image);
@@ -5897,7 +6206,7 @@ static inline void PostCallRecordCreateImageView(layer_data *dev_data, const VkI
 VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
                                                const VkAllocationCallbacks *pAllocator, VkImageView *pView) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     bool skip_call = PreCallValidateCreateImageView(dev_data, pCreateInfo);
     lock.unlock();
     if (skip_call)
@@ -5917,7 +6226,7 @@ CreateFence(VkDevice device, const VkFenceCreateInfo *pCreateInfo, const VkAlloc
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->CreateFence(device, pCreateInfo, pAllocator, pFence);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         auto &fence_node = dev_data->fenceMap[*pFence];
         fence_node.fence = *pFence;
         fence_node.createInfo = *pCreateInfo;
@@ -5926,34 +6235,6 @@ CreateFence(VkDevice device, const VkFenceCreateInfo *pCreateInfo, const VkAlloc
     return result;
 }
 
-// TODO handle pipeline caches
-VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo *pCreateInfo,
-                                                   const VkAllocationCallbacks *pAllocator, VkPipelineCache *pPipelineCache) {
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    VkResult result = dev_data->device_dispatch_table->CreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
-    return result;
-}
-
-VKAPI_ATTR void VKAPI_CALL
-DestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks *pAllocator) {
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    dev_data->device_dispatch_table->DestroyPipelineCache(device, pipelineCache, pAllocator);
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL
-GetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t *pDataSize, void *pData) {
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    VkResult result = dev_data->device_dispatch_table->GetPipelineCacheData(device, pipelineCache, pDataSize, pData);
-    return result;
-}
-
-VKAPI_ATTR VkResult VKAPI_CALL
-MergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache *pSrcCaches) {
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    VkResult result = dev_data->device_dispatch_table->MergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
-    return result;
-}
-
 // utility function to set collective state for pipeline
 void set_pipeline_state(PIPELINE_NODE *pPipe) {
     // If any attachment used by this pipeline has blendEnable, set top-level blendEnable
@@ -5991,32 +6272,35 @@ CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
     uint32_t i = 0;
-    std::unique_lock<std::mutex> lock(global_lock);
+    // Creation only reads device state, so other threads may carry on while the batch is validated
+    read_lock_guard read_lock(syncedGlobalLock(dev_data));
 
     for (i = 0; i < count; i++) {
         pPipeNode[i] = new PIPELINE_NODE;
         pPipeNode[i]->initGraphicsPipeline(&pCreateInfos[i]);
         pPipeNode[i]->render_pass_ci.initialize(getRenderPass(dev_data, pCreateInfos[i].renderPass)->pCreateInfo);
         pPipeNode[i]->pipeline_layout = *getPipelineLayout(dev_data, pCreateInfos[i].layout);
-
-        skip_call |= verifyPipelineCreateState(dev_data, device, pPipeNode, i);
+        // Collective state is only read at bind/draw time, so compute it once here
+        set_pipeline_state(pPipeNode[i]);
     }
 
+    skip_call |= validatePipelineBatch(dev_data, count, [&](debug_report_data *report_data, uint32_t index) {
+        return verifyPipelineCreateState(dev_data, report_data, pPipeNode, index);
+    });
+    read_lock.unlock();
+
     if (!skip_call) {
-        lock.unlock();
         result = dev_data->device_dispatch_table->CreateGraphicsPipelines(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                           pPipelines);
-        lock.lock();
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         for (i = 0; i < count; i++) {
             pPipeNode[i]->pipeline = pPipelines[i];
             dev_data->pipelineMap[pPipeNode[i]->pipeline] = pPipeNode[i];
         }
-        lock.unlock();
     } else {
         for (i = 0; i < count; i++) {
             delete pPipeNode[i];
         }
-        lock.unlock();
         return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     return result;
@@ -6034,7 +6318,7 @@ CreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
     uint32_t i = 0;
-    std::unique_lock<std::mutex> lock(global_lock);
+    read_lock_guard read_lock(syncedGlobalLock(dev_data));
     for (i = 0; i < count; i++) {
         // TODO: Verify compute stage bits
 
@@ -6043,29 +6327,28 @@ CreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t
         pPipeNode[i]->initComputePipeline(&pCreateInfos[i]);
         pPipeNode[i]->pipeline_layout = *getPipelineLayout(dev_data, pCreateInfos[i].layout);
         // memcpy(&pPipeNode[i]->computePipelineCI, (const void *)&pCreateInfos[i], sizeof(VkComputePipelineCreateInfo));
-
-        // TODO: Add Compute Pipeline Verification
-        skip_call |= !validate_compute_pipeline(dev_data->report_data, pPipeNode[i], &dev_data->phys_dev_properties.features,
-                                                dev_data->shaderModuleMap);
-        // skip_call |= verifyPipelineCreateState(dev_data, device, pPipeNode[i]);
     }
 
+    // TODO: Add Compute Pipeline Verification
+    skip_call |= validatePipelineBatch(dev_data, count, [&](debug_report_data *report_data, uint32_t index) {
+        return !validate_compute_pipeline(report_data, pPipeNode[index], &dev_data->phys_dev_properties.features,
+                                          dev_data->shaderModuleMap);
+    });
+    read_lock.unlock();
+
     if (!skip_call) {
-        lock.unlock();
         result = dev_data->device_dispatch_table->CreateComputePipelines(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                          pPipelines);
-        lock.lock();
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         for (i = 0; i < count; i++) {
             pPipeNode[i]->pipeline = pPipelines[i];
             dev_data->pipelineMap[pPipeNode[i]->pipeline] = pPipeNode[i];
         }
-        lock.unlock();
     } else {
         for (i = 0; i < count; i++) {
             // Clean up any locally allocated data structures
             delete pPipeNode[i];
         }
-        lock.unlock();
         return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     return result;
@@ -6076,7 +6359,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(VkDevice device, const VkSamplerCre
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->CreateSampler(device, pCreateInfo, pAllocator, pSampler);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         dev_data->samplerMap[*pSampler] = unique_ptr<SAMPLER_NODE>(new SAMPLER_NODE(pSampler, pCreateInfo));
     }
     return result;
@@ -6089,7 +6372,7 @@ CreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo
     VkResult result = dev_data->device_dispatch_table->CreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     if (VK_SUCCESS == result) {
         // TODOSC : Capture layout bindings set
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         dev_data->descriptorSetLayoutMap[*pSetLayout] =
             new cvdescriptorset::DescriptorSetLayout(dev_data->report_data, pCreateInfo, *pSetLayout);
     }
@@ -6200,7 +6483,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
 
     VkResult result = dev_data->device_dispatch_table->CreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         PIPELINE_LAYOUT_NODE &plNode = dev_data->pipelineLayoutMap[*pPipelineLayout];
         plNode.layout = *pPipelineLayout;
         plNode.set_layouts.resize(pCreateInfo->setLayoutCount);
@@ -6233,7 +6516,7 @@ CreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateI
                         "Out of memory while attempting to allocate DESCRIPTOR_POOL_NODE in vkCreateDescriptorPool()"))
                 return VK_ERROR_VALIDATION_FAILED_EXT;
         } else {
-            std::lock_guard<std::mutex> lock(global_lock);
+            std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
             dev_data->descriptorPoolMap[*pDescriptorPool] = pNewNode;
         }
     } else {
@@ -6247,7 +6530,7 @@ ResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescript
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->ResetDescriptorPool(device, descriptorPool, flags);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         clearDescriptorPool(dev_data, device, descriptorPool, flags);
     }
     return result;
@@ -6272,7 +6555,7 @@ static void PostCallRecordAllocateDescriptorSets(layer_data *dev_data, const VkD
 VKAPI_ATTR VkResult VKAPI_CALL
 AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo, VkDescriptorSet *pDescriptorSets) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     cvdescriptorset::AllocateDescriptorSetsData common_data(pAllocateInfo->descriptorSetCount);
     bool skip_call = PreCallValidateAllocateDescriptorSets(dev_data, pAllocateInfo, &common_data);
     lock.unlock();
@@ -6316,7 +6599,7 @@ static void PostCallRecordFreeDescriptorSets(layer_data *dev_data, VkDescriptorP
 
     // For each freed descriptor add its resources back into the pool as available and remove from pool and setMap
     for (uint32_t i = 0; i < count; ++i) {
-        auto set_state = dev_data->setMap[descriptor_sets[i]];
+        auto set_state = getSetNode(dev_data, descriptor_sets[i]);
         uint32_t type_index = 0, descriptor_count = 0;
         for (uint32_t j = 0; j < set_state->GetBindingCount(); ++j) {
             type_index = static_cast<uint32_t>(set_state->GetTypeFromIndex(j));
@@ -6332,7 +6615,7 @@ VKAPI_ATTR VkResult VKAPI_CALL
 FreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t count, const VkDescriptorSet *pDescriptorSets) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     // Make sure that no sets being destroyed are in-flight
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     bool skip_call = PreCallValidateFreeDescriptorSets(dev_data, descriptorPool, count, pDescriptorSets);
     lock.unlock();
 
@@ -6376,7 +6659,7 @@ UpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWri
                      uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies) {
     // Only map look-up at top level is for device-level layer_data
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     bool skip_call = PreCallValidateUpdateDescriptorSets(dev_data, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
                                                          pDescriptorCopies);
     lock.unlock();
@@ -6395,14 +6678,14 @@ AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pCrea
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->AllocateCommandBuffers(device, pCreateInfo, pCommandBuffer);
     if (VK_SUCCESS == result) {
-        std::unique_lock<std::mutex> lock(global_lock);
+        std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
         auto pPool = getCommandPoolNode(dev_data, pCreateInfo->commandPool);
 
         if (pPool) {
             for (uint32_t i = 0; i < pCreateInfo->commandBufferCount; i++) {
                 // Add command buffer to its commandPool map
                 pPool->commandBuffers.push_back(pCommandBuffer[i]);
-                GLOBAL_CB_NODE *pCB = new GLOBAL_CB_NODE;
+                GLOBAL_CB_NODE *pCB = new GLOBAL_CB_NODE(&pPool->cb_memory);
                 // Add command buffer to map
                 dev_data->commandBufferMap[pCommandBuffer[i]] = pCB;
                 resetCB(dev_data, pCommandBuffer[i]);
@@ -6420,7 +6703,7 @@ VKAPI_ATTR VkResult VKAPI_CALL
 BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     // Validate command buffer level
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
@@ -6563,7 +6846,7 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
     bool skip_call = false;
     VkResult result = VK_SUCCESS;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         if ((VK_COMMAND_BUFFER_LEVEL_PRIMARY == pCB->createInfo.level) || !(pCB->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
@@ -6600,7 +6883,7 @@ VKAPI_ATTR VkResult VKAPI_CALL
 ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     VkCommandPool cmdPool = pCB->createInfo.commandPool;
     auto pPool = getCommandPoolNode(dev_data, cmdPool);
@@ -6625,12 +6908,117 @@ ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flag
     return result;
 }
 
-VKAPI_ATTR void VKAPI_CALL
-CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
-    bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+// Recording commands that the async validation worker can take over.  Each is validated by its
+//  PreCallValidateAndRecord* function, whether that runs in the entry point or in replayAsyncCmd().  Any other
+//  recording command waits for the worker to catch up on its own command buffer before it takes its locks (see
+//  cbSyncedGlobalLock()), and anything else flushes the worker first (see syncedGlobalLock()), so state is always
+//  tracked in call order.
+enum ASYNC_CMD_TYPE {
+    ASYNC_CMD_BIND_PIPELINE,
+    ASYNC_CMD_SET_VIEWPORT,
+    ASYNC_CMD_SET_SCISSOR,
+    ASYNC_CMD_BIND_DESCRIPTOR_SETS,
+    ASYNC_CMD_BIND_INDEX_BUFFER,
+    ASYNC_CMD_BIND_VERTEX_BUFFERS,
+    ASYNC_CMD_DRAW,
+    ASYNC_CMD_DRAW_INDEXED,
+    ASYNC_CMD_DRAW_INDIRECT,
+    ASYNC_CMD_DRAW_INDEXED_INDIRECT,
+    ASYNC_CMD_DISPATCH,
+    ASYNC_CMD_DISPATCH_INDIRECT,
+    ASYNC_CMD_PUSH_CONSTANTS,
+};
+
+// Parameters of a queued command.  Only what validation looks at is kept, array parameters it needs are copied into
+//  the queue straight after the record.
+struct ASYNC_CMD {
+    ASYNC_CMD_TYPE type;
+    VkCommandBuffer commandBuffer;
+    union {
+        struct {
+            VkPipelineBindPoint pipelineBindPoint;
+            VkPipeline pipeline;
+        } bind_pipeline;
+        struct {
+            uint32_t first;
+            uint32_t count;
+        } viewport_scissor;
+        // Followed by setCount VkDescriptorSets, then dynamicOffsetCount uint32_t offsets
+        struct {
+            VkPipelineBindPoint pipelineBindPoint;
+            VkPipelineLayout layout;
+            uint32_t firstSet;
+            uint32_t setCount;
+            uint32_t dynamicOffsetCount;
+        } bind_descriptor_sets;
+        struct {
+            VkBuffer buffer;
+            VkDeviceSize offset;
+            VkIndexType indexType;
+        } bind_index_buffer;
+        // Followed by bindingCount VkBuffers
+        struct {
+            uint32_t firstBinding;
+            uint32_t bindingCount;
+        } bind_vertex_buffers;
+        struct {
+            uint32_t vertexCount;
+            uint32_t instanceCount;
+            uint32_t firstVertex;
+            uint32_t firstInstance;
+        } draw;
+        struct {
+            uint32_t indexCount;
+            uint32_t instanceCount;
+            uint32_t firstIndex;
+            int32_t vertexOffset;
+            uint32_t firstInstance;
+        } draw_indexed;
+        // Indirect draws and dispatches, count and stride are unused for vkCmdDispatchIndirect
+        struct {
+            VkBuffer buffer;
+            VkDeviceSize offset;
+            uint32_t count;
+            uint32_t stride;
+        } indirect;
+        struct {
+            uint32_t x;
+            uint32_t y;
+            uint32_t z;
+        } dispatch;
+        struct {
+            VkPipelineLayout layout;
+            VkShaderStageFlags stageFlags;
+            uint32_t offset;
+            uint32_t size;
+        } push_constants;
+    };
+};
+
+// Hand cmd and its arrays to the async validation worker.  Returns false without queueing anything when async
+//  validation is off or the arrays are too big for the queue, in which case the caller validates the command itself.
+static bool queueAsyncCmd(layer_data *dev_data, const ASYNC_CMD &cmd, const void *array0 = nullptr, size_t array0_size = 0,
+                          const void *array1 = nullptr, size_t array1_size = 0) {
+    size_t size = sizeof(ASYNC_CMD) + array0_size + array1_size;
+    if (!dev_data->async_queue || size > dev_data->async_queue->max_record_size())
+        return false;
+    // Counted before it is queued, see cbSyncedGlobalLock()
+    getAsyncCBStripe(dev_data, cmd.commandBuffer).queued.fetch_add(1);
+    return dev_data->async_queue->push(size, [&](void *record) {
+        char *data = static_cast<char *>(record);
+        memcpy(data, &cmd, sizeof(ASYNC_CMD));
+        if (array0_size)
+            memcpy(data + sizeof(ASYNC_CMD), array0, array0_size);
+        if (array1_size)
+            memcpy(data + sizeof(ASYNC_CMD) + array0_size, array1, array1_size);
+    });
+}
+
+static bool PreCallValidateAndRecordCmdBindPipeline(layer_data *dev_data, VkCommandBuffer commandBuffer,
+                                                    VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
+    bool skip_call = false;
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_BINDPIPELINE, "vkCmdBindPipeline()");
         if ((VK_PIPELINE_BIND_POINT_COMPUTE == pipelineBindPoint) && (pCB->activeRenderPass)) {
@@ -6644,8 +7032,8 @@ CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindP
         PIPELINE_NODE *pPN = getPipeline(dev_data, pipeline);
         if (pPN) {
             pCB->lastBound[pipelineBindPoint].pipeline = pipeline;
+            pCB->lastBound[pipelineBindPoint].generation++;
             set_cb_pso_status(pCB, pPN);
-            set_pipeline_state(pPN);
         } else {
             skip_call |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT,
                                  (uint64_t)pipeline, __LINE__, DRAWSTATE_INVALID_PIPELINE, "DS",
@@ -6654,48 +7042,70 @@ CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindP
         addCommandBufferBinding(&getPipeline(dev_data, pipeline)->cb_bindings,
                                 {reinterpret_cast<uint64_t &>(pipeline), VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT}, pCB);
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                           VkPipeline pipeline) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_BIND_PIPELINE, commandBuffer};
+    cmd.bind_pipeline = {pipelineBindPoint, pipeline};
+    if (queueAsyncCmd(dev_data, cmd) ||
+        !PreCallValidateAndRecordCmdBindPipeline(dev_data, commandBuffer, pipelineBindPoint, pipeline))
         dev_data->device_dispatch_table->CmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
 }
 
-VKAPI_ATTR void VKAPI_CALL
-CmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport *pViewports) {
+static bool PreCallValidateAndRecordCmdSetViewport(layer_data *dev_data, VkCommandBuffer commandBuffer, uint32_t firstViewport,
+                                                   uint32_t viewportCount, const VkViewport *pViewports) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETVIEWPORTSTATE, "vkCmdSetViewport()");
         pCB->status |= CBSTATUS_VIEWPORT_SET;
         pCB->viewportMask |= ((1u<<viewportCount) - 1u) << firstViewport;
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
+                                          const VkViewport *pViewports) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_SET_VIEWPORT, commandBuffer};
+    cmd.viewport_scissor = {firstViewport, viewportCount};
+    if (queueAsyncCmd(dev_data, cmd) ||
+        !PreCallValidateAndRecordCmdSetViewport(dev_data, commandBuffer, firstViewport, viewportCount, pViewports))
         dev_data->device_dispatch_table->CmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
 }
 
-VKAPI_ATTR void VKAPI_CALL
-CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D *pScissors) {
+static bool PreCallValidateAndRecordCmdSetScissor(layer_data *dev_data, VkCommandBuffer commandBuffer, uint32_t firstScissor,
+                                                  uint32_t scissorCount, const VkRect2D *pScissors) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETSCISSORSTATE, "vkCmdSetScissor()");
         pCB->status |= CBSTATUS_SCISSOR_SET;
         pCB->scissorMask |= ((1u<<scissorCount) - 1u) << firstScissor;
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
+                                         const VkRect2D *pScissors) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_SET_SCISSOR, commandBuffer};
+    cmd.viewport_scissor = {firstScissor, scissorCount};
+    if (queueAsyncCmd(dev_data, cmd) ||
+        !PreCallValidateAndRecordCmdSetScissor(dev_data, commandBuffer, firstScissor, scissorCount, pScissors))
         dev_data->device_dispatch_table->CmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
 }
 
 VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETLINEWIDTHSTATE, "vkCmdSetLineWidth()");
         pCB->status |= CBSTATUS_LINE_WIDTH_SET;
@@ -6707,7 +7117,8 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float
                                  "vkCmdSetLineWidth called but pipeline was created without VK_DYNAMIC_STATE_LINE_WIDTH "
                                  "flag.  This is undefined behavior and could be ignored.");
         } else {
-            skip_call |= verifyLineWidth(dev_data, DRAWSTATE_INVALID_SET, reinterpret_cast<uint64_t &>(commandBuffer), lineWidth);
+            skip_call |= verifyLineWidth(dev_data->report_data, dev_data->phys_dev_properties, DRAWSTATE_INVALID_SET,
+                                         reinterpret_cast<uint64_t &>(commandBuffer), lineWidth);
         }
     }
     lock.unlock();
@@ -6719,8 +7130,8 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETDEPTHBIASSTATE, "vkCmdSetDepthBias()");
         pCB->status |= CBSTATUS_DEPTH_BIAS_SET;
@@ -6734,8 +7145,8 @@ CmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, fl
 VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETBLENDSTATE, "vkCmdSetBlendConstants()");
         pCB->status |= CBSTATUS_BLEND_CONSTANTS_SET;
@@ -6749,8 +7160,8 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETDEPTHBOUNDSSTATE, "vkCmdSetDepthBounds()");
         pCB->status |= CBSTATUS_DEPTH_BOUNDS_SET;
@@ -6764,8 +7175,8 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETSTENCILREADMASKSTATE, "vkCmdSetStencilCompareMask()");
         pCB->status |= CBSTATUS_STENCIL_READ_MASK_SET;
@@ -6779,8 +7190,8 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETSTENCILWRITEMASKSTATE, "vkCmdSetStencilWriteMask()");
         pCB->status |= CBSTATUS_STENCIL_WRITE_MASK_SET;
@@ -6794,8 +7205,8 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETSTENCILREFERENCESTATE, "vkCmdSetStencilReference()");
         pCB->status |= CBSTATUS_STENCIL_REFERENCE_SET;
@@ -6805,20 +7216,21 @@ CmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMas
         dev_data->device_dispatch_table->CmdSetStencilReference(commandBuffer, faceMask, reference);
 }
 
-VKAPI_ATTR void VKAPI_CALL
-CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout,
-                      uint32_t firstSet, uint32_t setCount, const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
-                      const uint32_t *pDynamicOffsets) {
+static bool PreCallValidateAndRecordCmdBindDescriptorSets(layer_data *dev_data, VkCommandBuffer commandBuffer,
+                                                          VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout,
+                                                          uint32_t firstSet, uint32_t setCount,
+                                                          const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
+                                                          const uint32_t *pDynamicOffsets) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         if (pCB->state == CB_RECORDING) {
             // Track total count of dynamic descriptor types to make sure we have an offset for each one
             uint32_t totalDynamicDescriptors = 0;
             string errorString = "";
             uint32_t lastSetIndex = firstSet + setCount - 1;
+            pCB->lastBound[pipelineBindPoint].generation++;
             if (lastSetIndex >= pCB->lastBound[pipelineBindPoint].boundDescriptorSets.size()) {
                 pCB->lastBound[pipelineBindPoint].boundDescriptorSets.resize(lastSetIndex + 1);
                 pCB->lastBound[pipelineBindPoint].dynamicOffsets.resize(lastSetIndex + 1);
@@ -6829,7 +7241,10 @@ CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelin
                 cvdescriptorset::DescriptorSet *pSet = getSetNode(dev_data, pDescriptorSets[i]);
                 if (pSet) {
                     pCB->lastBound[pipelineBindPoint].uniqueBoundSets.insert(pSet);
-                    pSet->BindCommandBuffer(pCB);
+                    {
+                        std::lock_guard<std::mutex> binding_lock(getBindingLock(pSet));
+                        pSet->BindCommandBuffer(pCB);
+                    }
                     pCB->lastBound[pipelineBindPoint].pipeline_layout = *pipeline_layout;
                     pCB->lastBound[pipelineBindPoint].boundDescriptorSets[i + firstSet] = pSet;
                     skip_call |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_INFORMATION_BIT_EXT,
@@ -6969,27 +7384,35 @@ CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelin
             skip_call |= report_error_no_cb_begin(dev_data, commandBuffer, "vkCmdBindDescriptorSets()");
         }
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                                 VkPipelineLayout layout, uint32_t firstSet, uint32_t setCount,
+                                                 const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
+                                                 const uint32_t *pDynamicOffsets) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_BIND_DESCRIPTOR_SETS, commandBuffer};
+    cmd.bind_descriptor_sets = {pipelineBindPoint, layout, firstSet, setCount, dynamicOffsetCount};
+    if (queueAsyncCmd(dev_data, cmd, pDescriptorSets, setCount * sizeof(VkDescriptorSet), pDynamicOffsets,
+                      dynamicOffsetCount * sizeof(uint32_t)) ||
+        !PreCallValidateAndRecordCmdBindDescriptorSets(dev_data, commandBuffer, pipelineBindPoint, layout, firstSet, setCount,
+                                                       pDescriptorSets, dynamicOffsetCount, pDynamicOffsets))
         dev_data->device_dispatch_table->CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, setCount,
                                                                pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
 }
 
-VKAPI_ATTR void VKAPI_CALL
-CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {
+static bool PreCallValidateAndRecordCmdBindIndexBuffer(layer_data *dev_data, VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                                       VkDeviceSize offset, VkIndexType indexType) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
     // TODO : Somewhere need to verify that IBs have correct usage state flagged
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
     auto buff_node = getBufferNode(dev_data, buffer);
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     if (cb_node && buff_node) {
         skip_call |= ValidateMemoryIsBoundToBuffer(dev_data, buff_node, "vkCmdBindIndexBuffer()");
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, buff_node->mem, "vkCmdBindIndexBuffer()");
-        };
-        cb_node->validate_functions.push_back(function);
+        deferMemoryValidation(cb_node, buff_node->mem, "vkCmdBindIndexBuffer()");
         skip_call |= addCmd(dev_data, cb_node, CMD_BINDINDEXBUFFER, "vkCmdBindIndexBuffer()");
         VkDeviceSize offset_align = 0;
         switch (indexType) {
@@ -7013,8 +7436,16 @@ CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize
     } else {
         assert(0);
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                              VkIndexType indexType) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_BIND_INDEX_BUFFER, commandBuffer};
+    cmd.bind_index_buffer = {buffer, offset, indexType};
+    if (queueAsyncCmd(dev_data, cmd) ||
+        !PreCallValidateAndRecordCmdBindIndexBuffer(dev_data, commandBuffer, buffer, offset, indexType))
         dev_data->device_dispatch_table->CmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
 }
 
@@ -7030,32 +7461,36 @@ void updateResourceTracking(GLOBAL_CB_NODE *pCB, uint32_t firstBinding, uint32_t
 
 static inline void updateResourceTrackingOnDraw(GLOBAL_CB_NODE *pCB) { pCB->drawData.push_back(pCB->currentDrawData); }
 
-VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding,
-                                                uint32_t bindingCount, const VkBuffer *pBuffers,
-                                                const VkDeviceSize *pOffsets) {
+static bool PreCallValidateAndRecordCmdBindVertexBuffers(layer_data *dev_data, VkCommandBuffer commandBuffer, uint32_t firstBinding,
+                                                         uint32_t bindingCount, const VkBuffer *pBuffers,
+                                                         const VkDeviceSize *pOffsets) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
     // TODO : Somewhere need to verify that VBs have correct usage state flagged
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     if (cb_node) {
         for (uint32_t i = 0; i < bindingCount; ++i) {
             auto buff_node = getBufferNode(dev_data, pBuffers[i]);
             assert(buff_node);
             skip_call |= ValidateMemoryIsBoundToBuffer(dev_data, buff_node, "vkCmdBindVertexBuffers()");
-            std::function<bool()> function = [=]() {
-                return validate_memory_is_valid(dev_data, buff_node->mem, "vkCmdBindVertexBuffers()");
-            };
-            cb_node->validate_functions.push_back(function);
+            deferMemoryValidation(cb_node, buff_node->mem, "vkCmdBindVertexBuffers()");
         }
         addCmd(dev_data, cb_node, CMD_BINDVERTEXBUFFER, "vkCmdBindVertexBuffer()");
         updateResourceTracking(cb_node, firstBinding, bindingCount, pBuffers);
     } else {
         skip_call |= report_error_no_cb_begin(dev_data, commandBuffer, "vkCmdBindVertexBuffer()");
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
+                                                const VkBuffer *pBuffers, const VkDeviceSize *pOffsets) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_BIND_VERTEX_BUFFERS, commandBuffer};
+    cmd.bind_vertex_buffers = {firstBinding, bindingCount};
+    if (queueAsyncCmd(dev_data, cmd, pBuffers, bindingCount * sizeof(VkBuffer)) ||
+        !PreCallValidateAndRecordCmdBindVertexBuffers(dev_data, commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets))
         dev_data->device_dispatch_table->CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
 }
 
@@ -7070,30 +7505,21 @@ static bool markStoreImagesAndBuffersAsWritten(layer_data *dev_data, GLOBAL_CB_N
 
         auto img_node = getImageNode(dev_data, iv_data->image);
         assert(img_node);
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, img_node->mem, true, iv_data->image);
-            return false;
-        };
-        pCB->validate_functions.push_back(function);
+        deferSetMemoryValid(pCB, img_node->mem, true, iv_data->image);
     }
     for (auto buffer : pCB->updateBuffers) {
         auto buff_node = getBufferNode(dev_data, buffer);
         assert(buff_node);
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, buff_node->mem, true);
-            return false;
-        };
-        pCB->validate_functions.push_back(function);
+        deferSetMemoryValid(pCB, buff_node->mem, true);
     }
     return skip_call;
 }
 
-VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
-                                   uint32_t firstVertex, uint32_t firstInstance) {
+static bool PreCallValidateAndRecordCmdDraw(layer_data *dev_data, VkCommandBuffer commandBuffer, uint32_t vertexCount,
+                                            uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_DRAW, "vkCmdDraw()");
         pCB->drawCount[DRAW]++;
@@ -7109,18 +7535,25 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t verte
         }
         skip_call |= outsideRenderPass(dev_data, pCB, "vkCmdDraw");
     }
-    lock.unlock();
-    if (!skip_call)
-        dev_data->device_dispatch_table->CmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+    return skip_call;
 }
 
-VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount,
-                                          uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset,
-                                                            uint32_t firstInstance) {
+VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
+                                   uint32_t firstVertex, uint32_t firstInstance) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_DRAW, commandBuffer};
+    cmd.draw = {vertexCount, instanceCount, firstVertex, firstInstance};
+    if (queueAsyncCmd(dev_data, cmd) ||
+        !PreCallValidateAndRecordCmdDraw(dev_data, commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance))
+        dev_data->device_dispatch_table->CmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+static bool PreCallValidateAndRecordCmdDrawIndexed(layer_data *dev_data, VkCommandBuffer commandBuffer, uint32_t indexCount,
+                                                   uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset,
+                                                   uint32_t firstInstance) {
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_DRAWINDEXED, "vkCmdDrawIndexed()");
         pCB->drawCount[DRAW_INDEXED]++;
@@ -7136,19 +7569,27 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_
         }
         skip_call |= outsideRenderPass(dev_data, pCB, "vkCmdDrawIndexed");
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
+                                          uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_DRAW_INDEXED, commandBuffer};
+    cmd.draw_indexed = {indexCount, instanceCount, firstIndex, vertexOffset, firstInstance};
+    if (queueAsyncCmd(dev_data, cmd) ||
+        !PreCallValidateAndRecordCmdDrawIndexed(dev_data, commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset,
+                                                firstInstance))
         dev_data->device_dispatch_table->CmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset,
                                                         firstInstance);
 }
 
-VKAPI_ATTR void VKAPI_CALL
-CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t count, uint32_t stride) {
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+static bool PreCallValidateAndRecordCmdDrawIndirect(layer_data *dev_data, VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                                    VkDeviceSize offset, uint32_t count, uint32_t stride) {
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto buff_node = getBufferNode(dev_data, buffer);
     if (cb_node && buff_node) {
         skip_call |= ValidateMemoryIsBoundToBuffer(dev_data, buff_node, "vkCmdDrawIndirect()");
@@ -7169,18 +7610,25 @@ CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize off
     } else {
         assert(0);
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t count,
+                                           uint32_t stride) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_DRAW_INDIRECT, commandBuffer};
+    cmd.indirect = {buffer, offset, count, stride};
+    if (queueAsyncCmd(dev_data, cmd) ||
+        !PreCallValidateAndRecordCmdDrawIndirect(dev_data, commandBuffer, buffer, offset, count, stride))
         dev_data->device_dispatch_table->CmdDrawIndirect(commandBuffer, buffer, offset, count, stride);
 }
 
-VKAPI_ATTR void VKAPI_CALL
-CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t count, uint32_t stride) {
+static bool PreCallValidateAndRecordCmdDrawIndexedIndirect(layer_data *dev_data, VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                                           VkDeviceSize offset, uint32_t count, uint32_t stride) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto buff_node = getBufferNode(dev_data, buffer);
     if (cb_node && buff_node) {
         skip_call |= ValidateMemoryIsBoundToBuffer(dev_data, buff_node, "vkCmdDrawIndexedIndirect()");
@@ -7202,34 +7650,48 @@ CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceS
     } else {
         assert(0);
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                  uint32_t count, uint32_t stride) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_DRAW_INDEXED_INDIRECT, commandBuffer};
+    cmd.indirect = {buffer, offset, count, stride};
+    if (queueAsyncCmd(dev_data, cmd) ||
+        !PreCallValidateAndRecordCmdDrawIndexedIndirect(dev_data, commandBuffer, buffer, offset, count, stride))
         dev_data->device_dispatch_table->CmdDrawIndexedIndirect(commandBuffer, buffer, offset, count, stride);
 }
 
-VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z) {
+static bool PreCallValidateAndRecordCmdDispatch(layer_data *dev_data, VkCommandBuffer commandBuffer, uint32_t x, uint32_t y,
+                                                uint32_t z) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= validate_and_update_draw_state(dev_data, pCB, false, VK_PIPELINE_BIND_POINT_COMPUTE);
         skip_call |= markStoreImagesAndBuffersAsWritten(dev_data, pCB);
         skip_call |= addCmd(dev_data, pCB, CMD_DISPATCH, "vkCmdDispatch()");
         skip_call |= insideRenderPass(dev_data, pCB, "vkCmdDispatch");
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_DISPATCH, commandBuffer};
+    cmd.dispatch = {x, y, z};
+    if (queueAsyncCmd(dev_data, cmd) ||
+        !PreCallValidateAndRecordCmdDispatch(dev_data, commandBuffer, x, y, z))
         dev_data->device_dispatch_table->CmdDispatch(commandBuffer, x, y, z);
 }
 
-VKAPI_ATTR void VKAPI_CALL
-CmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+static bool PreCallValidateAndRecordCmdDispatchIndirect(layer_data *dev_data, VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                                        VkDeviceSize offset) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto buff_node = getBufferNode(dev_data, buffer);
     if (cb_node && buff_node) {
         skip_call |= ValidateMemoryIsBoundToBuffer(dev_data, buff_node, "vkCmdDispatchIndirect()");
@@ -7239,8 +7701,15 @@ CmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize
         skip_call |= addCmd(dev_data, cb_node, CMD_DISPATCHINDIRECT, "vkCmdDispatchIndirect()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdDispatchIndirect()");
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_DISPATCH_INDIRECT, commandBuffer};
+    cmd.indirect = {buffer, offset, 0, 0};
+    if (queueAsyncCmd(dev_data, cmd) ||
+        !PreCallValidateAndRecordCmdDispatchIndirect(dev_data, commandBuffer, buffer, offset))
         dev_data->device_dispatch_table->CmdDispatchIndirect(commandBuffer, buffer, offset);
 }
 
@@ -7248,9 +7717,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer
                                          uint32_t regionCount, const VkBufferCopy *pRegions) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto src_buff_node = getBufferNode(dev_data, srcBuffer);
     auto dst_buff_node = getBufferNode(dev_data, dstBuffer);
     if (cb_node && src_buff_node && dst_buff_node) {
@@ -7265,15 +7734,8 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer
         skip_call |= validateBufferUsageFlags(dev_data, dst_buff_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, "vkCmdCopyBuffer()",
                                               "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
 
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, src_buff_node->mem, "vkCmdCopyBuffer()");
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() {
-            set_memory_valid(dev_data, dst_buff_node->mem, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        deferMemoryValidation(cb_node, src_buff_node->mem, "vkCmdCopyBuffer()");
+        deferSetMemoryValid(cb_node, dst_buff_node->mem, true);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_COPYBUFFER, "vkCmdCopyBuffer()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyBuffer()");
@@ -7290,23 +7752,23 @@ static bool VerifySourceImageLayout(layer_data *dev_data, GLOBAL_CB_NODE *cb_nod
                                     VkImageSubresourceLayers subLayers, VkImageLayout srcImageLayout) {
     bool skip_call = false;
 
-    for (uint32_t i = 0; i < subLayers.layerCount; ++i) {
-        uint32_t layer = i + subLayers.baseArrayLayer;
-        VkImageSubresource sub = {subLayers.aspectMask, subLayers.mipLevel, layer};
-        IMAGE_CMD_BUF_LAYOUT_NODE node;
-        if (!FindLayout(cb_node, srcImage, sub, node)) {
-            SetLayout(cb_node, srcImage, sub, IMAGE_CMD_BUF_LAYOUT_NODE(srcImageLayout, srcImageLayout));
-            continue;
-        }
-        if (node.layout != srcImageLayout) {
-            // TODO: Improve log message in the next pass
-            skip_call |=
-                log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0,
-                        __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS", "Cannot copy from an image whose source layout is %s "
-                                                                        "and doesn't match the current layout %s.",
-                        string_VkImageLayout(srcImageLayout), string_VkImageLayout(node.layout));
-        }
-    }
+    UpdateLayouts(dev_data, cb_node, srcImage, SubresourceRange(subLayers),
+                  [&](const IMAGE_CMD_BUF_LAYOUT_NODE *current, IMAGE_CMD_BUF_LAYOUT_NODE &node) {
+                      if (!current) {
+                          node = IMAGE_CMD_BUF_LAYOUT_NODE(srcImageLayout, srcImageLayout);
+                          return true;
+                      }
+                      if (current->layout != srcImageLayout) {
+                          // TODO: Improve log message in the next pass
+                          skip_call |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                               VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0, __LINE__,
+                                               DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
+                                               "Cannot copy from an image whose source layout is %s "
+                                               "and doesn't match the current layout %s.",
+                                               string_VkImageLayout(srcImageLayout), string_VkImageLayout(current->layout));
+                      }
+                      return false;
+                  });
     if (srcImageLayout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL) {
         if (srcImageLayout == VK_IMAGE_LAYOUT_GENERAL) {
             // TODO : Can we deal with image node from the top of call tree and avoid map look-up here?
@@ -7331,22 +7793,22 @@ static bool VerifyDestImageLayout(layer_data *dev_data, GLOBAL_CB_NODE *cb_node,
                                   VkImageSubresourceLayers subLayers, VkImageLayout destImageLayout) {
     bool skip_call = false;
 
-    for (uint32_t i = 0; i < subLayers.layerCount; ++i) {
-        uint32_t layer = i + subLayers.baseArrayLayer;
-        VkImageSubresource sub = {subLayers.aspectMask, subLayers.mipLevel, layer};
-        IMAGE_CMD_BUF_LAYOUT_NODE node;
-        if (!FindLayout(cb_node, destImage, sub, node)) {
-            SetLayout(cb_node, destImage, sub, IMAGE_CMD_BUF_LAYOUT_NODE(destImageLayout, destImageLayout));
-            continue;
-        }
-        if (node.layout != destImageLayout) {
-            skip_call |=
-                log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0,
-                        __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS", "Cannot copy from an image whose dest layout is %s and "
-                                                                        "doesn't match the current layout %s.",
-                        string_VkImageLayout(destImageLayout), string_VkImageLayout(node.layout));
-        }
-    }
+    UpdateLayouts(dev_data, cb_node, destImage, SubresourceRange(subLayers),
+                  [&](const IMAGE_CMD_BUF_LAYOUT_NODE *current, IMAGE_CMD_BUF_LAYOUT_NODE &node) {
+                      if (!current) {
+                          node = IMAGE_CMD_BUF_LAYOUT_NODE(destImageLayout, destImageLayout);
+                          return true;
+                      }
+                      if (current->layout != destImageLayout) {
+                          skip_call |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                               VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT, 0, __LINE__,
+                                               DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
+                                               "Cannot copy from an image whose dest layout is %s "
+                                               "and doesn't match the current layout %s.",
+                                               string_VkImageLayout(destImageLayout), string_VkImageLayout(current->layout));
+                      }
+                      return false;
+                  });
     if (destImageLayout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
         if (destImageLayout == VK_IMAGE_LAYOUT_GENERAL) {
             auto image_node = getImageNode(dev_data, destImage);
@@ -7371,9 +7833,9 @@ CmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcI
              VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy *pRegions) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto src_img_node = getImageNode(dev_data, srcImage);
     auto dst_img_node = getImageNode(dev_data, dstImage);
     if (cb_node && src_img_node && dst_img_node) {
@@ -7387,15 +7849,8 @@ CmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcI
                                              "VK_BUFFER_USAGE_TRANSFER_SRC_BIT");
         skip_call |= validateImageUsageFlags(dev_data, dst_img_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, "vkCmdCopyImage()",
                                              "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, src_img_node->mem, "vkCmdCopyImage()", srcImage);
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() {
-            set_memory_valid(dev_data, dst_img_node->mem, true, dstImage);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        deferMemoryValidation(cb_node, src_img_node->mem, "vkCmdCopyImage()", srcImage);
+        deferSetMemoryValid(cb_node, dst_img_node->mem, true, dstImage);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_COPYIMAGE, "vkCmdCopyImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyImage()");
@@ -7417,9 +7872,9 @@ CmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcI
              VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit *pRegions, VkFilter filter) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto src_img_node = getImageNode(dev_data, srcImage);
     auto dst_img_node = getImageNode(dev_data, dstImage);
     if (cb_node && src_img_node && dst_img_node) {
@@ -7433,15 +7888,8 @@ CmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcI
                                              "VK_BUFFER_USAGE_TRANSFER_SRC_BIT");
         skip_call |= validateImageUsageFlags(dev_data, dst_img_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, "vkCmdBlitImage()",
                                              "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, src_img_node->mem, "vkCmdBlitImage()", srcImage);
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() {
-            set_memory_valid(dev_data, dst_img_node->mem, true, dstImage);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        deferMemoryValidation(cb_node, src_img_node->mem, "vkCmdBlitImage()", srcImage);
+        deferSetMemoryValid(cb_node, dst_img_node->mem, true, dstImage);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_BLITIMAGE, "vkCmdBlitImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdBlitImage()");
@@ -7459,9 +7907,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
                                                 uint32_t regionCount, const VkBufferImageCopy *pRegions) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto src_buff_node = getBufferNode(dev_data, srcBuffer);
     auto dst_img_node = getImageNode(dev_data, dstImage);
     if (cb_node && src_buff_node && dst_img_node) {
@@ -7473,13 +7921,8 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
                                               "vkCmdCopyBufferToImage()", "VK_BUFFER_USAGE_TRANSFER_SRC_BIT");
         skip_call |= validateImageUsageFlags(dev_data, dst_img_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true,
                                              "vkCmdCopyBufferToImage()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, dst_img_node->mem, true, dstImage);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() { return validate_memory_is_valid(dev_data, src_buff_node->mem, "vkCmdCopyBufferToImage()"); };
-        cb_node->validate_functions.push_back(function);
+        deferSetMemoryValid(cb_node, dst_img_node->mem, true, dstImage);
+        deferMemoryValidation(cb_node, src_buff_node->mem, "vkCmdCopyBufferToImage()");
 
         skip_call |= addCmd(dev_data, cb_node, CMD_COPYBUFFERTOIMAGE, "vkCmdCopyBufferToImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyBufferToImage()");
@@ -7500,9 +7943,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, V
                                                 uint32_t regionCount, const VkBufferImageCopy *pRegions) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto src_img_node = getImageNode(dev_data, srcImage);
     auto dst_buff_node = getBufferNode(dev_data, dstBuffer);
     if (cb_node && src_img_node && dst_buff_node) {
@@ -7516,15 +7959,8 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, V
                                              "vkCmdCopyImageToBuffer()", "VK_BUFFER_USAGE_TRANSFER_SRC_BIT");
         skip_call |= validateBufferUsageFlags(dev_data, dst_buff_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true,
                                               "vkCmdCopyImageToBuffer()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, src_img_node->mem, "vkCmdCopyImageToBuffer()", srcImage);
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() {
-            set_memory_valid(dev_data, dst_buff_node->mem, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        deferMemoryValidation(cb_node, src_img_node->mem, "vkCmdCopyImageToBuffer()", srcImage);
+        deferSetMemoryValid(cb_node, dst_buff_node->mem, true);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_COPYIMAGETOBUFFER, "vkCmdCopyImageToBuffer()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyImageToBuffer()");
@@ -7544,9 +7980,9 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
                                            VkDeviceSize dstOffset, VkDeviceSize dataSize, const uint32_t *pData) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto dst_buff_node = getBufferNode(dev_data, dstBuffer);
     if (cb_node && dst_buff_node) {
         skip_call |= ValidateMemoryIsBoundToBuffer(dev_data, dst_buff_node, "vkCmdUpdateBuffer()");
@@ -7555,11 +7991,7 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
         // Validate that DST buffer has correct usage flags set
         skip_call |= validateBufferUsageFlags(dev_data, dst_buff_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true,
                                               "vkCmdUpdateBuffer()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, dst_buff_node->mem, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        deferSetMemoryValid(cb_node, dst_buff_node->mem, true);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_UPDATEBUFFER, "vkCmdUpdateBuffer()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyUpdateBuffer()");
@@ -7575,9 +8007,9 @@ VKAPI_ATTR void VKAPI_CALL
 CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto dst_buff_node = getBufferNode(dev_data, dstBuffer);
     if (cb_node && dst_buff_node) {
         skip_call |= ValidateMemoryIsBoundToBuffer(dev_data, dst_buff_node, "vkCmdFillBuffer()");
@@ -7586,11 +8018,7 @@ CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize ds
         // Validate that DST buffer has correct usage flags set
         skip_call |= validateBufferUsageFlags(dev_data, dst_buff_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, "vkCmdFillBuffer()",
                                               "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, dst_buff_node->mem, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        deferSetMemoryValid(cb_node, dst_buff_node->mem, true);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_FILLBUFFER, "vkCmdFillBuffer()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdCopyFillBuffer()");
@@ -7607,8 +8035,8 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(VkCommandBuffer commandBuffer, ui
                                                const VkClearRect *pRects) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_CLEARATTACHMENTS, "vkCmdClearAttachments()");
         // Warn if this is issued prior to Draw Cmd and clearing the entire attachment
@@ -7677,19 +8105,15 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(VkCommandBuffer commandBuffer, VkI
                                               uint32_t rangeCount, const VkImageSubresourceRange *pRanges) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
     // TODO : Verify memory is in VK_IMAGE_STATE_CLEAR state
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto img_node = getImageNode(dev_data, image);
     if (cb_node && img_node) {
         skip_call |= ValidateMemoryIsBoundToImage(dev_data, img_node, "vkCmdClearColorImage()");
         skip_call |= addCommandBufferBindingImage(dev_data, cb_node, img_node, "vkCmdClearColorImage()");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, img_node->mem, true, image);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        deferSetMemoryValid(cb_node, img_node->mem, true, image);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_CLEARCOLORIMAGE, "vkCmdClearColorImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdClearColorImage()");
@@ -7707,19 +8131,15 @@ CmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageL
                           const VkImageSubresourceRange *pRanges) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
     // TODO : Verify memory is in VK_IMAGE_STATE_CLEAR state
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto img_node = getImageNode(dev_data, image);
     if (cb_node && img_node) {
         skip_call |= ValidateMemoryIsBoundToImage(dev_data, img_node, "vkCmdClearDepthStencilImage()");
         skip_call |= addCommandBufferBindingImage(dev_data, cb_node, img_node, "vkCmdClearDepthStencilImage()");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, img_node->mem, true, image);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        deferSetMemoryValid(cb_node, img_node->mem, true, image);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_CLEARDEPTHSTENCILIMAGE, "vkCmdClearDepthStencilImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdClearDepthStencilImage()");
@@ -7737,9 +8157,9 @@ CmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout s
                 VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve *pRegions) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto src_img_node = getImageNode(dev_data, srcImage);
     auto dst_img_node = getImageNode(dev_data, dstImage);
     if (cb_node && src_img_node && dst_img_node) {
@@ -7748,15 +8168,8 @@ CmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout s
         // Update bindings between images and cmd buffer
         skip_call |= addCommandBufferBindingImage(dev_data, cb_node, src_img_node, "vkCmdCopyImage()");
         skip_call |= addCommandBufferBindingImage(dev_data, cb_node, dst_img_node, "vkCmdCopyImage()");
-        std::function<bool()> function = [=]() {
-            return validate_memory_is_valid(dev_data, src_img_node->mem, "vkCmdResolveImage()", srcImage);
-        };
-        cb_node->validate_functions.push_back(function);
-        function = [=]() {
-            set_memory_valid(dev_data, dst_img_node->mem, true, dstImage);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
+        deferMemoryValidation(cb_node, src_img_node->mem, "vkCmdResolveImage()", srcImage);
+        deferSetMemoryValid(cb_node, dst_img_node->mem, true, dstImage);
 
         skip_call |= addCmd(dev_data, cb_node, CMD_RESOLVEIMAGE, "vkCmdResolveImage()");
         skip_call |= insideRenderPass(dev_data, cb_node, "vkCmdResolveImage()");
@@ -7769,15 +8182,10 @@ CmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout s
                                                          regionCount, pRegions);
 }
 
-bool setEventStageMask(VkQueue queue, VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
-    if (pCB) {
-        pCB->eventToStageMap[event] = stageMask;
-    }
-    auto queue_data = dev_data->queueMap.find(queue);
-    if (queue_data != dev_data->queueMap.end()) {
-        queue_data->second.eventToStageMap[event] = stageMask;
+static bool setEventStageMask(QUEUE_NODE *pQueue, GLOBAL_CB_NODE *pCB, VkEvent event, VkPipelineStageFlags stageMask) {
+    pCB->eventToStageMap[event] = stageMask;
+    if (pQueue) {
+        pQueue->eventToStageMap[event] = stageMask;
     }
     return false;
 }
@@ -7786,8 +8194,8 @@ VKAPI_ATTR void VKAPI_CALL
 CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_SETEVENT, "vkCmdSetEvent()");
         skip_call |= insideRenderPass(dev_data, pCB, "vkCmdSetEvent");
@@ -7795,15 +8203,12 @@ CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags s
         if (event_node) {
             addCommandBufferBinding(&event_node->cb_bindings,
                                     {reinterpret_cast<uint64_t &>(event), VK_DEBUG_REPORT_OBJECT_TYPE_EVENT_EXT}, pCB);
-            event_node->cb_bindings.insert(pCB);
         }
         pCB->events.push_back(event);
         if (!pCB->waitedEvents.count(event)) {
             pCB->writeEventsBeforeWait.push_back(event);
         }
-        std::function<bool(VkQueue)> eventUpdate =
-            std::bind(setEventStageMask, std::placeholders::_1, commandBuffer, event, stageMask);
-        pCB->eventUpdates.push_back(eventUpdate);
+        deferSetEventStage(pCB, event, stageMask);
     }
     lock.unlock();
     if (!skip_call)
@@ -7814,8 +8219,8 @@ VKAPI_ATTR void VKAPI_CALL
 CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_RESETEVENT, "vkCmdResetEvent()");
         skip_call |= insideRenderPass(dev_data, pCB, "vkCmdResetEvent");
@@ -7823,15 +8228,12 @@ CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags
         if (event_node) {
             addCommandBufferBinding(&event_node->cb_bindings,
                                     {reinterpret_cast<uint64_t &>(event), VK_DEBUG_REPORT_OBJECT_TYPE_EVENT_EXT}, pCB);
-            event_node->cb_bindings.insert(pCB);
         }
         pCB->events.push_back(event);
         if (!pCB->waitedEvents.count(event)) {
             pCB->writeEventsBeforeWait.push_back(event);
         }
-        std::function<bool(VkQueue)> eventUpdate =
-            std::bind(setEventStageMask, std::placeholders::_1, commandBuffer, event, VkPipelineStageFlags(0));
-        pCB->eventUpdates.push_back(eventUpdate);
+        deferSetEventStage(pCB, event, VkPipelineStageFlags(0));
     }
     lock.unlock();
     if (!skip_call)
@@ -7843,39 +8245,29 @@ static bool TransitionImageLayouts(VkCommandBuffer cmdBuffer, uint32_t memBarrie
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(cmdBuffer), layer_data_map);
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, cmdBuffer);
     bool skip = false;
-    uint32_t levelCount = 0;
-    uint32_t layerCount = 0;
 
     for (uint32_t i = 0; i < memBarrierCount; ++i) {
         auto mem_barrier = &pImgMemBarriers[i];
         if (!mem_barrier)
             continue;
-        // TODO: Do not iterate over every possibility - consolidate where
-        // possible
-        ResolveRemainingLevelsLayers(dev_data, &levelCount, &layerCount, mem_barrier->subresourceRange, mem_barrier->image);
-
-        for (uint32_t j = 0; j < levelCount; j++) {
-            uint32_t level = mem_barrier->subresourceRange.baseMipLevel + j;
-            for (uint32_t k = 0; k < layerCount; k++) {
-                uint32_t layer = mem_barrier->subresourceRange.baseArrayLayer + k;
-                VkImageSubresource sub = {mem_barrier->subresourceRange.aspectMask, level, layer};
-                IMAGE_CMD_BUF_LAYOUT_NODE node;
-                if (!FindLayout(pCB, mem_barrier->image, sub, node)) {
-                    SetLayout(pCB, mem_barrier->image, sub,
-                              IMAGE_CMD_BUF_LAYOUT_NODE(mem_barrier->oldLayout, mem_barrier->newLayout));
-                    continue;
-                }
-                if (mem_barrier->oldLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
-                    // TODO: Set memory invalid which is in mem_tracker currently
-                } else if (node.layout != mem_barrier->oldLayout) {
-                    skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0,
-                                    __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS", "You cannot transition the layout from %s "
-                                                                                    "when current layout is %s.",
-                                    string_VkImageLayout(mem_barrier->oldLayout), string_VkImageLayout(node.layout));
-                }
-                SetLayout(pCB, mem_barrier->image, sub, mem_barrier->newLayout);
-            }
-        }
+        UpdateLayouts(dev_data, pCB, mem_barrier->image, mem_barrier->subresourceRange,
+                      [&](const IMAGE_CMD_BUF_LAYOUT_NODE *current, IMAGE_CMD_BUF_LAYOUT_NODE &node) {
+                          if (!current) {
+                              node = IMAGE_CMD_BUF_LAYOUT_NODE(mem_barrier->oldLayout, mem_barrier->newLayout);
+                              return true;
+                          }
+                          if (mem_barrier->oldLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
+                              // TODO: Set memory invalid which is in mem_tracker currently
+                          } else if (current->layout != mem_barrier->oldLayout) {
+                              skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0,
+                                              0, __LINE__, DRAWSTATE_INVALID_IMAGE_LAYOUT, "DS",
+                                              "You cannot transition the layout from %s "
+                                              "when current layout is %s.",
+                                              string_VkImageLayout(mem_barrier->oldLayout), string_VkImageLayout(current->layout));
+                          }
+                          node = IMAGE_CMD_BUF_LAYOUT_NODE(current->initialLayout, mem_barrier->newLayout);
+                          return true;
+                      });
     }
     return skip;
 }
@@ -8193,17 +8585,16 @@ static bool ValidateBarriers(const char *funcName, VkCommandBuffer cmdBuffer, ui
     return skip_call;
 }
 
-bool validateEventStageMask(VkQueue queue, GLOBAL_CB_NODE *pCB, uint32_t eventCount, size_t firstEventIndex, VkPipelineStageFlags sourceStageMask) {
+static bool validateEventStageMask(layer_data *dev_data, QUEUE_NODE *pQueue, GLOBAL_CB_NODE *pCB, uint32_t eventCount,
+                                   size_t firstEventIndex, VkPipelineStageFlags sourceStageMask) {
     bool skip_call = false;
     VkPipelineStageFlags stageMask = 0;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(queue), layer_data_map);
+    if (!pQueue)
+        return false;
     for (uint32_t i = 0; i < eventCount; ++i) {
         auto event = pCB->events[firstEventIndex + i];
-        auto queue_data = dev_data->queueMap.find(queue);
-        if (queue_data == dev_data->queueMap.end())
-            return false;
-        auto event_data = queue_data->second.eventToStageMap.find(event);
-        if (event_data != queue_data->second.eventToStageMap.end()) {
+        auto event_data = pQueue->eventToStageMap.find(event);
+        if (event_data != pQueue->eventToStageMap.end()) {
             stageMask |= event_data->second;
         } else {
             auto global_event_data = getEventNode(dev_data, event);
@@ -8238,8 +8629,8 @@ CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent
               uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         auto firstEventIndex = pCB->events.size();
         for (uint32_t i = 0; i < eventCount; ++i) {
@@ -8248,14 +8639,11 @@ CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent
                 addCommandBufferBinding(&event_node->cb_bindings,
                                         {reinterpret_cast<const uint64_t &>(pEvents[i]), VK_DEBUG_REPORT_OBJECT_TYPE_EVENT_EXT},
                                         pCB);
-                event_node->cb_bindings.insert(pCB);
             }
             pCB->waitedEvents.insert(pEvents[i]);
             pCB->events.push_back(pEvents[i]);
         }
-        std::function<bool(VkQueue)> eventUpdate =
-            std::bind(validateEventStageMask, std::placeholders::_1, pCB, eventCount, firstEventIndex, sourceStageMask);
-        pCB->eventUpdates.push_back(eventUpdate);
+        deferValidateEventStage(pCB, eventCount, firstEventIndex, sourceStageMask);
         if (pCB->state == CB_RECORDING) {
             skip_call |= addCmd(dev_data, pCB, CMD_WAITEVENTS, "vkCmdWaitEvents()");
         } else {
@@ -8280,8 +8668,8 @@ CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageM
                    uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= addCmd(dev_data, pCB, CMD_PIPELINEBARRIER, "vkCmdPipelineBarrier()");
         skip_call |= TransitionImageLayouts(commandBuffer, imageMemoryBarrierCount, pImageMemoryBarriers);
@@ -8296,15 +8684,17 @@ CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageM
                                                             pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
 }
 
-bool setQueryState(VkQueue queue, VkCommandBuffer commandBuffer, QueryObject object, bool value) {
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+static bool setQueryState(layer_data *dev_data, QUEUE_NODE *pQueue, VkCommandBuffer commandBuffer, QueryObject object,
+                          uint32_t queryCount, bool value) {
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
-    if (pCB) {
-        pCB->queryToStateMap[object] = value;
-    }
-    auto queue_data = dev_data->queueMap.find(queue);
-    if (queue_data != dev_data->queueMap.end()) {
-        queue_data->second.queryToStateMap[object] = value;
+    for (uint32_t i = 0; i < queryCount; i++) {
+        QueryObject query = {object.pool, object.index + i};
+        if (pCB) {
+            pCB->queryToStateMap[query] = value;
+        }
+        if (pQueue) {
+            pQueue->queryToStateMap[query] = value;
+        }
     }
     return false;
 }
@@ -8313,8 +8703,8 @@ VKAPI_ATTR void VKAPI_CALL
 CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot, VkFlags flags) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         QueryObject query = {queryPool, slot};
         pCB->activeQueries.insert(query);
@@ -8333,8 +8723,8 @@ CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slo
 VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         QueryObject query = {queryPool, slot};
         if (!pCB->activeQueries.count(query)) {
@@ -8345,8 +8735,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPoo
         } else {
             pCB->activeQueries.erase(query);
         }
-        std::function<bool(VkQueue)> queryUpdate = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, true);
-        pCB->queryUpdates.push_back(queryUpdate);
+        deferSetQueryState(pCB, queryPool, slot, 1, true);
         if (pCB->state == CB_RECORDING) {
             skip_call |= addCmd(dev_data, pCB, CMD_ENDQUERY, "VkCmdEndQuery()");
         } else {
@@ -8364,15 +8753,14 @@ VKAPI_ATTR void VKAPI_CALL
 CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         for (uint32_t i = 0; i < queryCount; i++) {
             QueryObject query = {queryPool, firstQuery + i};
-            pCB->waitedEventsBeforeQueryReset[query] = pCB->waitedEvents;
-            std::function<bool(VkQueue)> queryUpdate = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, false);
-            pCB->queryUpdates.push_back(queryUpdate);
+            pCB->waitedEventsBeforeQueryReset[query] = unordered_set<VkEvent>(pCB->waitedEvents.begin(), pCB->waitedEvents.end());
         }
+        deferSetQueryState(pCB, queryPool, firstQuery, queryCount, false);
         if (pCB->state == CB_RECORDING) {
             skip_call |= addCmd(dev_data, pCB, CMD_RESETQUERYPOOL, "VkCmdResetQueryPool()");
         } else {
@@ -8387,17 +8775,16 @@ CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t
         dev_data->device_dispatch_table->CmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
 }
 
-bool validateQuery(VkQueue queue, GLOBAL_CB_NODE *pCB, VkQueryPool queryPool, uint32_t queryCount, uint32_t firstQuery) {
+static bool validateQuery(layer_data *dev_data, QUEUE_NODE *pQueue, VkQueryPool queryPool, uint32_t queryCount,
+                          uint32_t firstQuery) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(pCB->commandBuffer), layer_data_map);
-    auto queue_data = dev_data->queueMap.find(queue);
-    if (queue_data == dev_data->queueMap.end())
+    if (!pQueue)
         return false;
     for (uint32_t i = 0; i < queryCount; i++) {
         QueryObject query = {queryPool, firstQuery + i};
-        auto query_data = queue_data->second.queryToStateMap.find(query);
+        auto query_data = pQueue->queryToStateMap.find(query);
         bool fail = false;
-        if (query_data != queue_data->second.queryToStateMap.end()) {
+        if (query_data != pQueue->queryToStateMap.end()) {
             if (!query_data->second) {
                 fail = true;
             }
@@ -8426,9 +8813,9 @@ CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, ui
                         VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    cb_record_lock lock(dev_data, commandBuffer);
 
-    auto cb_node = getCBNode(dev_data, commandBuffer);
+    auto cb_node = lock.cb_node();
     auto dst_buff_node = getBufferNode(dev_data, dstBuffer);
     if (cb_node && dst_buff_node) {
         skip_call |= ValidateMemoryIsBoundToBuffer(dev_data, dst_buff_node, "vkCmdCopyQueryPoolResults()");
@@ -8437,14 +8824,8 @@ CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, ui
         // Validate that DST buffer has correct usage flags set
         skip_call |= validateBufferUsageFlags(dev_data, dst_buff_node, VK_BUFFER_USAGE_TRANSFER_DST_BIT, true,
                                               "vkCmdCopyQueryPoolResults()", "VK_BUFFER_USAGE_TRANSFER_DST_BIT");
-        std::function<bool()> function = [=]() {
-            set_memory_valid(dev_data, dst_buff_node->mem, true);
-            return false;
-        };
-        cb_node->validate_functions.push_back(function);
-        std::function<bool(VkQueue)> queryUpdate =
-            std::bind(validateQuery, std::placeholders::_1, cb_node, queryPool, queryCount, firstQuery);
-        cb_node->queryUpdates.push_back(queryUpdate);
+        deferSetMemoryValid(cb_node, dst_buff_node->mem, true);
+        deferValidateQuery(cb_node, queryPool, firstQuery, queryCount);
         if (cb_node->state == CB_RECORDING) {
             skip_call |= addCmd(dev_data, cb_node, CMD_COPYQUERYPOOLRESULTS, "vkCmdCopyQueryPoolResults()");
         } else {
@@ -8462,13 +8843,12 @@ CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, ui
                                                                  dstOffset, stride, flags);
 }
 
-VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
-                                            VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size,
-                                            const void *pValues) {
+static bool PreCallValidateAndRecordCmdPushConstants(layer_data *dev_data, VkCommandBuffer commandBuffer, VkPipelineLayout layout,
+                                                     VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size,
+                                                     const void *pValues) {
     bool skip_call = false;
-    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         if (pCB->state == CB_RECORDING) {
             skip_call |= addCmd(dev_data, pCB, CMD_PUSHCONSTANTS, "vkCmdPushConstants()");
@@ -8548,21 +8928,95 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPip
                         offset, offset + size, (uint32_t)stageFlags, (uint64_t)layout);
         }
     }
-    lock.unlock();
-    if (!skip_call)
+    return skip_call;
+}
+
+VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
+                                            uint32_t offset, uint32_t size, const void *pValues) {
+    layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
+    ASYNC_CMD cmd = {ASYNC_CMD_PUSH_CONSTANTS, commandBuffer};
+    cmd.push_constants = {layout, stageFlags, offset, size};
+    if (queueAsyncCmd(dev_data, cmd) ||
+        !PreCallValidateAndRecordCmdPushConstants(dev_data, commandBuffer, layout, stageFlags, offset, size, pValues))
         dev_data->device_dispatch_table->CmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
 }
 
+// Worker side of async validation: run a queued command's validation and state tracking.  The command itself went
+//  down the chain when it was queued, so anything found is only reported.
+static void replayAsyncCmd(void *context, const void *record, size_t size) {
+    layer_data *dev_data = static_cast<layer_data *>(context);
+    const ASYNC_CMD &cmd = *static_cast<const ASYNC_CMD *>(record);
+    const char *arrays = static_cast<const char *>(record) + sizeof(ASYNC_CMD);
+    switch (cmd.type) {
+    case ASYNC_CMD_BIND_PIPELINE:
+        PreCallValidateAndRecordCmdBindPipeline(dev_data, cmd.commandBuffer, cmd.bind_pipeline.pipelineBindPoint,
+                                                cmd.bind_pipeline.pipeline);
+        break;
+    case ASYNC_CMD_SET_VIEWPORT:
+        PreCallValidateAndRecordCmdSetViewport(dev_data, cmd.commandBuffer, cmd.viewport_scissor.first, cmd.viewport_scissor.count,
+                                               nullptr);
+        break;
+    case ASYNC_CMD_SET_SCISSOR:
+        PreCallValidateAndRecordCmdSetScissor(dev_data, cmd.commandBuffer, cmd.viewport_scissor.first, cmd.viewport_scissor.count,
+                                              nullptr);
+        break;
+    case ASYNC_CMD_BIND_DESCRIPTOR_SETS: {
+        auto &args = cmd.bind_descriptor_sets;
+        auto sets = reinterpret_cast<const VkDescriptorSet *>(arrays);
+        auto offsets = reinterpret_cast<const uint32_t *>(arrays + args.setCount * sizeof(VkDescriptorSet));
+        PreCallValidateAndRecordCmdBindDescriptorSets(dev_data, cmd.commandBuffer, args.pipelineBindPoint, args.layout,
+                                                      args.firstSet, args.setCount, sets, args.dynamicOffsetCount, offsets);
+        break;
+    }
+    case ASYNC_CMD_BIND_INDEX_BUFFER:
+        PreCallValidateAndRecordCmdBindIndexBuffer(dev_data, cmd.commandBuffer, cmd.bind_index_buffer.buffer,
+                                                   cmd.bind_index_buffer.offset, cmd.bind_index_buffer.indexType);
+        break;
+    case ASYNC_CMD_BIND_VERTEX_BUFFERS:
+        PreCallValidateAndRecordCmdBindVertexBuffers(dev_data, cmd.commandBuffer, cmd.bind_vertex_buffers.firstBinding,
+                                                     cmd.bind_vertex_buffers.bindingCount,
+                                                     reinterpret_cast<const VkBuffer *>(arrays), nullptr);
+        break;
+    case ASYNC_CMD_DRAW:
+        PreCallValidateAndRecordCmdDraw(dev_data, cmd.commandBuffer, cmd.draw.vertexCount, cmd.draw.instanceCount,
+                                        cmd.draw.firstVertex, cmd.draw.firstInstance);
+        break;
+    case ASYNC_CMD_DRAW_INDEXED:
+        PreCallValidateAndRecordCmdDrawIndexed(dev_data, cmd.commandBuffer, cmd.draw_indexed.indexCount,
+                                               cmd.draw_indexed.instanceCount, cmd.draw_indexed.firstIndex,
+                                               cmd.draw_indexed.vertexOffset, cmd.draw_indexed.firstInstance);
+        break;
+    case ASYNC_CMD_DRAW_INDIRECT:
+        PreCallValidateAndRecordCmdDrawIndirect(dev_data, cmd.commandBuffer, cmd.indirect.buffer, cmd.indirect.offset,
+                                                cmd.indirect.count, cmd.indirect.stride);
+        break;
+    case ASYNC_CMD_DRAW_INDEXED_INDIRECT:
+        PreCallValidateAndRecordCmdDrawIndexedIndirect(dev_data, cmd.commandBuffer, cmd.indirect.buffer, cmd.indirect.offset,
+                                                       cmd.indirect.count, cmd.indirect.stride);
+        break;
+    case ASYNC_CMD_DISPATCH:
+        PreCallValidateAndRecordCmdDispatch(dev_data, cmd.commandBuffer, cmd.dispatch.x, cmd.dispatch.y, cmd.dispatch.z);
+        break;
+    case ASYNC_CMD_DISPATCH_INDIRECT:
+        PreCallValidateAndRecordCmdDispatchIndirect(dev_data, cmd.commandBuffer, cmd.indirect.buffer, cmd.indirect.offset);
+        break;
+    case ASYNC_CMD_PUSH_CONSTANTS:
+        PreCallValidateAndRecordCmdPushConstants(dev_data, cmd.commandBuffer, cmd.push_constants.layout,
+                                                 cmd.push_constants.stageFlags, cmd.push_constants.offset,
+                                                 cmd.push_constants.size, nullptr);
+        break;
+    }
+    getAsyncCBStripe(dev_data, cmd.commandBuffer).validated.fetch_add(1, std::memory_order_release);
+}
+
 VKAPI_ATTR void VKAPI_CALL
 CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t slot) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
-        QueryObject query = {queryPool, slot};
-        std::function<bool(VkQueue)> queryUpdate = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, true);
-        pCB->queryUpdates.push_back(queryUpdate);
+        deferSetQueryState(pCB, queryPool, slot, 1, true);
         if (pCB->state == CB_RECORDING) {
             skip_call |= addCmd(dev_data, pCB, CMD_WRITETIMESTAMP, "vkCmdWriteTimestamp()");
         } else {
@@ -8767,7 +9221,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFrameb
                                                  const VkAllocationCallbacks *pAllocator,
                                                  VkFramebuffer *pFramebuffer) {
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     bool skip_call = PreCallValidateCreateFramebuffer(dev_data, pCreateInfo);
     lock.unlock();
 
@@ -9179,28 +9633,84 @@ static bool CreatePassDAG(const layer_data *my_data, VkDevice device, const VkRe
 }
 
 
+// Shader modules by content hash, shared by all devices. An entry lives as long as some VkShaderModule created from
+//  the same SPIR-V does, so creating a module again, on any device, reuses its index and entrypoint reflection instead
+//  of rebuilding them.
+static std::mutex shader_module_cache_lock;
+static std::unordered_multimap<uint64_t, std::weak_ptr<shader_module>> shader_module_cache;
+// Size of shader_module_cache after expired entries were last dropped
+static size_t shader_module_cache_swept_size = 0;
+
+static uint64_t hash_spirv(uint32_t const *words, size_t count) {
+    // FNV-1a over whole words
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < count; i++) {
+        hash ^= words[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static std::shared_ptr<shader_module> findCachedShaderModule(uint64_t hash, VkShaderModuleCreateInfo const *pCreateInfo) {
+    size_t count = pCreateInfo->codeSize / sizeof(uint32_t);
+    std::lock_guard<std::mutex> lock(shader_module_cache_lock);
+    auto range = shader_module_cache.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        auto module = it->second.lock();
+        if (module && module->words.size() == count &&
+            !memcmp(module->words.data(), pCreateInfo->pCode, count * sizeof(uint32_t))) {
+            return module;
+        }
+    }
+    return nullptr;
+}
+
+static void cacheShaderModule(std::shared_ptr<shader_module> const &module) {
+    std::lock_guard<std::mutex> lock(shader_module_cache_lock);
+    // Drop entries for destroyed modules whenever the cache has doubled since the last sweep
+    if (shader_module_cache.size() >= 2 * shader_module_cache_swept_size + 16) {
+        for (auto it = shader_module_cache.begin(); it != shader_module_cache.end();) {
+            if (it->second.expired()) {
+                it = shader_module_cache.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        shader_module_cache_swept_size = shader_module_cache.size();
+    }
+    shader_module_cache.emplace(module->content_hash, module);
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                   const VkAllocationCallbacks *pAllocator,
                                                   VkShaderModule *pShaderModule) {
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
 
-    /* Use SPIRV-Tools validator to try and catch any issues with the module itself */
-    spv_context ctx = spvContextCreate(SPV_ENV_VULKAN_1_0);
-    spv_const_binary_t binary { pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t) };
-    spv_diagnostic diag = nullptr;
+    uint64_t content_hash = hash_spirv(pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t));
+    auto module = findCachedShaderModule(content_hash, pCreateInfo);
+    bool spirv_valid = module && module->spirv_valid;
 
-    auto result = spvValidate(ctx, &binary, &diag);
-    if (result != SPV_SUCCESS) {
-        skip_call |= log_msg(my_data->report_data,
-                             result == SPV_WARNING ? VK_DEBUG_REPORT_WARNING_BIT_EXT : VK_DEBUG_REPORT_ERROR_BIT_EXT,
-                             VkDebugReportObjectTypeEXT(0), 0,
-                             __LINE__, SHADER_CHECKER_INCONSISTENT_SPIRV, "SC", "SPIR-V module not valid: %s",
-                             diag && diag->error ? diag->error : "(no error text)");
-    }
+    /* Use SPIRV-Tools validator to try and catch any issues with the module itself, unless identical SPIR-V
+     * already passed */
+    if (!spirv_valid) {
+        spv_context ctx = spvContextCreate(SPV_ENV_VULKAN_1_0);
+        spv_const_binary_t binary { pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t) };
+        spv_diagnostic diag = nullptr;
+
+        auto result = spvValidate(ctx, &binary, &diag);
+        if (result != SPV_SUCCESS) {
+            skip_call |= log_msg(my_data->report_data,
+                                 result == SPV_WARNING ? VK_DEBUG_REPORT_WARNING_BIT_EXT : VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                 VkDebugReportObjectTypeEXT(0), 0,
+                                 __LINE__, SHADER_CHECKER_INCONSISTENT_SPIRV, "SC", "SPIR-V module not valid: %s",
+                                 diag && diag->error ? diag->error : "(no error text)");
+        }
+        spirv_valid = (result == SPV_SUCCESS);
 
-    spvDiagnosticDestroy(diag);
-    spvContextDestroy(ctx);
+        spvDiagnosticDestroy(diag);
+        spvContextDestroy(ctx);
+    }
 
     if (skip_call)
         return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -9208,8 +9718,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
     VkResult res = my_data->device_dispatch_table->CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
 
     if (res == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        my_data->shaderModuleMap[*pShaderModule] = unique_ptr<shader_module>(new shader_module(pCreateInfo));
+        if (!module) {
+            module = std::make_shared<shader_module>(pCreateInfo, content_hash, spirv_valid);
+            cacheShaderModule(module);
+        }
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(my_data));
+        my_data->shaderModuleMap[*pShaderModule] = module;
     }
     return res;
 }
@@ -9318,7 +9832,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderP
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
 
     skip_call |= ValidateLayouts(dev_data, device, pCreateInfo);
     // TODO: As part of wrapping up the mem_tracker/core_validation merge the following routine should be consolidated with
@@ -9466,8 +9980,8 @@ static void deleteRenderPasses(layer_data *my_data) {
 
 static bool VerifyFramebufferAndRenderPassLayouts(layer_data *dev_data, GLOBAL_CB_NODE *pCB, const VkRenderPassBeginInfo *pRenderPassBegin) {
     bool skip_call = false;
-    const VkRenderPassCreateInfo *pRenderPassInfo = dev_data->renderPassMap[pRenderPassBegin->renderPass]->pCreateInfo;
-    const safe_VkFramebufferCreateInfo framebufferInfo = dev_data->frameBufferMap[pRenderPassBegin->framebuffer]->createInfo;
+    const VkRenderPassCreateInfo *pRenderPassInfo = getRenderPass(dev_data, pRenderPassBegin->renderPass)->pCreateInfo;
+    const safe_VkFramebufferCreateInfo &framebufferInfo = getFramebuffer(dev_data, pRenderPassBegin->framebuffer)->createInfo;
     if (pRenderPassInfo->attachmentCount != framebufferInfo.attachmentCount) {
         skip_call |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
                              DRAWSTATE_INVALID_RENDERPASS, "DS", "You cannot start a render pass using a framebuffer "
@@ -9477,35 +9991,27 @@ static bool VerifyFramebufferAndRenderPassLayouts(layer_data *dev_data, GLOBAL_C
         const VkImageView &image_view = framebufferInfo.pAttachments[i];
         auto image_data = getImageViewData(dev_data, image_view);
         assert(image_data);
-        const VkImage &image = image_data->image;
-        const VkImageSubresourceRange &subRange = image_data->subresourceRange;
         IMAGE_CMD_BUF_LAYOUT_NODE newNode = {pRenderPassInfo->pAttachments[i].initialLayout,
                                              pRenderPassInfo->pAttachments[i].initialLayout};
-        // TODO: Do not iterate over every possibility - consolidate where possible
-        for (uint32_t j = 0; j < subRange.levelCount; j++) {
-            uint32_t level = subRange.baseMipLevel + j;
-            for (uint32_t k = 0; k < subRange.layerCount; k++) {
-                uint32_t layer = subRange.baseArrayLayer + k;
-                VkImageSubresource sub = {subRange.aspectMask, level, layer};
-                IMAGE_CMD_BUF_LAYOUT_NODE node;
-                if (!FindLayout(pCB, image, sub, node)) {
-                    SetLayout(pCB, image, sub, newNode);
-                    continue;
+        UpdateLayouts(
+            dev_data, pCB, image_data->image, image_data->subresourceRange,
+            [&](const IMAGE_CMD_BUF_LAYOUT_NODE *current, IMAGE_CMD_BUF_LAYOUT_NODE &node) {
+                if (!current) {
+                    node = newNode;
+                    return true;
                 }
-                if (newNode.layout != VK_IMAGE_LAYOUT_UNDEFINED &&
-                    newNode.layout != node.layout) {
-                    skip_call |=
-                        log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0, __LINE__,
-                                DRAWSTATE_INVALID_RENDERPASS, "DS",
-                                "You cannot start a render pass using attachment %u "
-                                "where the render pass initial layout is %s and the previous "
-                                "known layout of the attachment is %s. The layouts must match, or "
-                                "the render pass initial layout for the attachment must be "
-                                "VK_IMAGE_LAYOUT_UNDEFINED",
-                                i, string_VkImageLayout(newNode.layout), string_VkImageLayout(node.layout));
+                if (newNode.layout != VK_IMAGE_LAYOUT_UNDEFINED && newNode.layout != current->layout) {
+                    skip_call |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, (VkDebugReportObjectTypeEXT)0, 0,
+                                         __LINE__, DRAWSTATE_INVALID_RENDERPASS, "DS",
+                                         "You cannot start a render pass using attachment %u "
+                                         "where the render pass initial layout is %s and the previous "
+                                         "known layout of the attachment is %s. The layouts must match, or "
+                                         "the render pass initial layout for the attachment must be "
+                                         "VK_IMAGE_LAYOUT_UNDEFINED",
+                                         i, string_VkImageLayout(newNode.layout), string_VkImageLayout(current->layout));
                 }
-            }
-        }
+                return false;
+            });
     }
     return skip_call;
 }
@@ -9605,8 +10111,8 @@ VKAPI_ATTR void VKAPI_CALL
 CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin, VkSubpassContents contents) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     auto renderPass = pRenderPassBegin ? getRenderPass(dev_data, pRenderPassBegin->renderPass) : nullptr;
     auto framebuffer = pRenderPassBegin ? getFramebuffer(dev_data, pRenderPassBegin->framebuffer) : nullptr;
     if (pCB) {
@@ -9620,32 +10126,19 @@ CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *p
                                                          renderPass->attachments[i].stencil_load_op,
                                                          VK_ATTACHMENT_LOAD_OP_CLEAR)) {
                     clear_op_size = static_cast<uint32_t>(i) + 1;
-                    std::function<bool()> function = [=]() {
-                        set_memory_valid(dev_data, fb_info.mem, true, fb_info.image);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    deferSetMemoryValid(pCB, fb_info.mem, true, fb_info.image);
                 } else if (FormatSpecificLoadAndStoreOpSettings(format, renderPass->attachments[i].load_op,
                                                                 renderPass->attachments[i].stencil_load_op,
                                                                 VK_ATTACHMENT_LOAD_OP_DONT_CARE)) {
-                    std::function<bool()> function = [=]() {
-                        set_memory_valid(dev_data, fb_info.mem, false, fb_info.image);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    deferSetMemoryValid(pCB, fb_info.mem, false, fb_info.image);
                 } else if (FormatSpecificLoadAndStoreOpSettings(format, renderPass->attachments[i].load_op,
                                                                 renderPass->attachments[i].stencil_load_op,
                                                                 VK_ATTACHMENT_LOAD_OP_LOAD)) {
-                    std::function<bool()> function = [=]() {
-                        return validate_memory_is_valid(dev_data, fb_info.mem, "vkCmdBeginRenderPass()", fb_info.image);
-                    };
-                    pCB->validate_functions.push_back(function);
+                    deferMemoryValidation(pCB, fb_info.mem, "vkCmdBeginRenderPass()", fb_info.image);
                 }
-                if (renderPass->attachment_first_read[renderPass->attachments[i].attachment]) {
-                    std::function<bool()> function = [=]() {
-                        return validate_memory_is_valid(dev_data, fb_info.mem, "vkCmdBeginRenderPass()", fb_info.image);
-                    };
-                    pCB->validate_functions.push_back(function);
+                auto first_read = renderPass->attachment_first_read.find(renderPass->attachments[i].attachment);
+                if (first_read != renderPass->attachment_first_read.end() && first_read->second) {
+                    deferMemoryValidation(pCB, fb_info.mem, "vkCmdBeginRenderPass()", fb_info.image);
                 }
             }
             if (clear_op_size > pRenderPassBegin->clearValueCount) {
@@ -9674,7 +10167,10 @@ CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *p
             pCB->activeSubpassContents = contents;
             pCB->framebuffers.insert(pRenderPassBegin->framebuffer);
             // Connect this framebuffer to this cmdBuffer
-            framebuffer->cb_bindings.insert(pCB);
+            {
+                std::lock_guard<std::mutex> binding_lock(getBindingLock(&framebuffer->cb_bindings));
+                framebuffer->cb_bindings.insert(pCB);
+            }
 
             // transition attachments to the correct layouts for the first subpass
             TransitionSubpassLayouts(dev_data, pCB, &pCB->activeRenderPassBeginInfo, pCB->activeSubpass);
@@ -9693,8 +10189,8 @@ CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *p
 VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    GLOBAL_CB_NODE *pCB = lock.cb_node();
     if (pCB) {
         skip_call |= validatePrimaryCommandBuffer(dev_data, pCB, "vkCmdNextSubpass");
         skip_call |= addCmd(dev_data, pCB, CMD_NEXTSUBPASS, "vkCmdNextSubpass()");
@@ -9711,8 +10207,8 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpa
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
-    auto pCB = getCBNode(dev_data, commandBuffer);
+    cb_record_lock lock(dev_data, commandBuffer);
+    auto pCB = lock.cb_node();
     if (pCB) {
         RENDER_PASS_NODE* pRPNode = pCB->activeRenderPass;
         auto framebuffer = getFramebuffer(dev_data, pCB->activeFramebuffer);
@@ -9722,19 +10218,11 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
                 VkFormat format = pRPNode->pCreateInfo->pAttachments[pRPNode->attachments[i].attachment].format;
                 if (FormatSpecificLoadAndStoreOpSettings(format, pRPNode->attachments[i].store_op,
                                                          pRPNode->attachments[i].stencil_store_op, VK_ATTACHMENT_STORE_OP_STORE)) {
-                    std::function<bool()> function = [=]() {
-                        set_memory_valid(dev_data, fb_info.mem, true, fb_info.image);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    deferSetMemoryValid(pCB, fb_info.mem, true, fb_info.image);
                 } else if (FormatSpecificLoadAndStoreOpSettings(format, pRPNode->attachments[i].store_op,
                                                                 pRPNode->attachments[i].stencil_store_op,
                                                                 VK_ATTACHMENT_STORE_OP_DONT_CARE)) {
-                    std::function<bool()> function = [=]() {
-                        set_memory_valid(dev_data, fb_info.mem, false, fb_info.image);
-                        return false;
-                    };
-                    pCB->validate_functions.push_back(function);
+                    deferSetMemoryValid(pCB, fb_info.mem, false, fb_info.image);
                 }
             }
         }
@@ -9954,7 +10442,7 @@ VKAPI_ATTR void VKAPI_CALL
 CmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBuffersCount, const VkCommandBuffer *pCommandBuffers) {
     bool skip_call = false;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(commandBuffer), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     GLOBAL_CB_NODE *pCB = getCBNode(dev_data, commandBuffer);
     if (pCB) {
         GLOBAL_CB_NODE *pSubCB = NULL;
@@ -10044,8 +10532,11 @@ CmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBuffersCount,
             pSubCB->primaryCommandBuffer = pCB->commandBuffer;
             pCB->secondaryCommandBuffers.insert(pSubCB->commandBuffer);
             dev_data->globalInFlightCmdBuffers.insert(pSubCB->commandBuffer);
-            for (auto &function : pSubCB->queryUpdates) {
-                pCB->queryUpdates.push_back(function);
+            // Query state changes made by the secondary happen when the primary is submitted
+            for (auto &check : pSubCB->deferredChecks) {
+                if (check.type == DEFERRED_SET_QUERY_STATE || check.type == DEFERRED_VALIDATE_QUERY) {
+                    pCB->deferredChecks.push_back(check);
+                }
             }
         }
         skip_call |= validatePrimaryCommandBuffer(dev_data, pCB, "vkCmdExecuteComands");
@@ -10101,7 +10592,7 @@ MapMemory(VkDevice device, VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize
 
     bool skip_call = false;
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
 #if MTMERGESOURCE
     DEVICE_MEM_INFO *pMemObj = getMemObjInfo(dev_data, mem);
     if (pMemObj) {
@@ -10137,7 +10628,7 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(VkDevice device, VkDeviceMemory mem) {
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(my_data));
     skip_call |= deleteMemRanges(my_data, mem);
     lock.unlock();
     if (!skip_call) {
@@ -10215,7 +10706,7 @@ FlushMappedMemoryRanges(VkDevice device, uint32_t memRangeCount, const VkMappedM
     bool skip_call = false;
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(my_data));
     skip_call |= validateAndCopyNoncoherentMemoryToDriver(my_data, memRangeCount, pMemRanges);
     skip_call |= validateMemoryIsMapped(my_data, "vkFlushMappedMemoryRanges", memRangeCount, pMemRanges);
     lock.unlock();
@@ -10231,7 +10722,7 @@ InvalidateMappedMemoryRanges(VkDevice device, uint32_t memRangeCount, const VkMa
     bool skip_call = false;
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(my_data));
     skip_call |= validateMemoryIsMapped(my_data, "vkInvalidateMappedMemoryRanges", memRangeCount, pMemRanges);
     lock.unlock();
     if (!skip_call) {
@@ -10244,7 +10735,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(VkDevice device, VkImage image, V
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto image_node = getImageNode(dev_data, image);
     if (image_node) {
         // Track objects tied to memory
@@ -10287,7 +10778,7 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(VkDevice device, VkEvent event) {
     bool skip_call = false;
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto event_node = getEventNode(dev_data, event);
     if (event_node) {
         event_node->needsSignaled = false;
@@ -10319,7 +10810,7 @@ QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *p
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(queue), layer_data_map);
     VkResult result = VK_ERROR_VALIDATION_FAILED_EXT;
     bool skip_call = false;
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto pFence = getFenceNode(dev_data, fence);
     auto pQueue = getQueueNode(dev_data, queue);
 
@@ -10403,7 +10894,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice device, const VkSemaphor
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->CreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         SEMAPHORE_NODE* sNode = &dev_data->semaphoreMap[*pSemaphore];
         sNode->signaled = false;
         sNode->queue = VK_NULL_HANDLE;
@@ -10417,7 +10908,7 @@ CreateEvent(VkDevice device, const VkEventCreateInfo *pCreateInfo, const VkAlloc
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     VkResult result = dev_data->device_dispatch_table->CreateEvent(device, pCreateInfo, pAllocator, pEvent);
     if (result == VK_SUCCESS) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         dev_data->eventMap[*pEvent].needsSignaled = false;
         dev_data->eventMap[*pEvent].in_use.store(0);
         dev_data->eventMap[*pEvent].write_in_use = 0;
@@ -10433,7 +10924,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapc
     VkResult result = dev_data->device_dispatch_table->CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         dev_data->device_extensions.swapchainMap[*pSwapchain] = unique_ptr<SWAPCHAIN_NODE>(new SWAPCHAIN_NODE(pCreateInfo));
     }
 
@@ -10445,25 +10936,17 @@ DestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocatio
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto swapchain_data = getSwapchainNode(dev_data, swapchain);
     if (swapchain_data) {
         if (swapchain_data->images.size() > 0) {
             for (auto swapchain_image : swapchain_data->images) {
-                auto image_sub = dev_data->imageSubresourceMap.find(swapchain_image);
-                if (image_sub != dev_data->imageSubresourceMap.end()) {
-                    for (auto imgsubpair : image_sub->second) {
-                        auto image_item = dev_data->imageLayoutMap.find(imgsubpair);
-                        if (image_item != dev_data->imageLayoutMap.end()) {
-                            dev_data->imageLayoutMap.erase(image_item);
-                        }
-                    }
-                    dev_data->imageSubresourceMap.erase(image_sub);
-                }
+                dev_data->imageLayoutMap.erase(swapchain_image);
                 skip_call =
                     clear_object_binding(dev_data, (uint64_t)swapchain_image, VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT);
                 dev_data->imageMap.erase(swapchain_image);
             }
+            dev_data->descriptor_resource_epoch++;
         }
         dev_data->device_extensions.swapchainMap.erase(swapchain);
     }
@@ -10481,7 +10964,7 @@ GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pCoun
         // This should never happen and is checked by param checker.
         if (!pCount)
             return result;
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
         const size_t count = *pCount;
         auto swapchain_node = getSwapchainNode(dev_data, swapchain);
         if (swapchain_node && !swapchain_node->images.empty()) {
@@ -10516,9 +10999,8 @@ GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pCoun
             image_node->valid = false;
             image_node->mem = MEMTRACKER_SWAP_CHAIN_IMAGE_KEY;
             swapchain_node->images.push_back(pSwapchainImages[i]);
-            ImageSubresourcePair subpair = {pSwapchainImages[i], false, VkImageSubresource()};
-            dev_data->imageSubresourceMap[pSwapchainImages[i]].push_back(subpair);
-            dev_data->imageLayoutMap[subpair] = image_layout_node;
+            dev_data->imageLayoutMap.emplace(std::piecewise_construct, std::forward_as_tuple(pSwapchainImages[i]),
+                                             std::forward_as_tuple(image_layout_node, image_ci.mipLevels, image_ci.arrayLayers));
             dev_data->device_extensions.imageToSwapchainMap[pSwapchainImages[i]] = swapchain;
         }
     }
@@ -10529,7 +11011,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(queue), layer_data_map);
     bool skip_call = false;
 
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(syncedGlobalLock(dev_data));
     for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
         auto pSemaphore = getSemaphoreNode(dev_data, pPresentInfo->pWaitSemaphores[i]);
         if (pSemaphore && !pSemaphore->signaled) {
@@ -10587,7 +11069,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(VkDevice device, VkSwapchainK
     layer_data *dev_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     bool skip_call = false;
 
-    std::unique_lock<std::mutex> lock(global_lock);
+    std::unique_lock<rw_lock> lock(syncedGlobalLock(dev_data));
     auto pSemaphore = getSemaphoreNode(dev_data, semaphore);
     if (pSemaphore && pSemaphore->signaled) {
         skip_call |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SEMAPHORE_EXT,
@@ -10738,7 +11220,7 @@ CreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCre
     VkLayerInstanceDispatchTable *pTable = my_data->instance_dispatch_table;
     VkResult res = pTable->CreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pMsgCallback);
     if (VK_SUCCESS == res) {
-        std::lock_guard<std::mutex> lock(global_lock);
+        std::lock_guard<rw_lock> lock(global_lock);
         res = layer_create_msg_callback(my_data->report_data, false, pCreateInfo, pAllocator, pMsgCallback);
     }
     return res;
@@ -10750,7 +11232,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(VkInstance instance,
     layer_data *my_data = get_my_data_ptr(get_dispatch_key(instance), layer_data_map);
     VkLayerInstanceDispatchTable *pTable = my_data->instance_dispatch_table;
     pTable->DestroyDebugReportCallbackEXT(instance, msgCallback, pAllocator);
-    std::lock_guard<std::mutex> lock(global_lock);
+    std::lock_guard<rw_lock> lock(global_lock);
     layer_destroy_msg_callback(my_data->report_data, msgCallback, pAllocator);
 }
 
@@ -10874,6 +11356,8 @@ intercept_core_instance_command(const char *name) {
     return nullptr;
 }
 
+// Commands with no validation or state tracking here yet (pipeline caches, memory requirements queries, destroying image
+// views, samplers and descriptor set layouts and pools) are left out so calls to them skip this layer
 static PFN_vkVoidFunction
 intercept_core_device_command(const char *name) {
     static const struct {
@@ -10897,13 +11381,9 @@ intercept_core_device_command(const char *name) {
         {"vkDestroyBuffer", reinterpret_cast<PFN_vkVoidFunction>(DestroyBuffer)},
         {"vkDestroyBufferView", reinterpret_cast<PFN_vkVoidFunction>(DestroyBufferView)},
         {"vkDestroyImage", reinterpret_cast<PFN_vkVoidFunction>(DestroyImage)},
-        {"vkDestroyImageView", reinterpret_cast<PFN_vkVoidFunction>(DestroyImageView)},
         {"vkDestroyShaderModule", reinterpret_cast<PFN_vkVoidFunction>(DestroyShaderModule)},
         {"vkDestroyPipeline", reinterpret_cast<PFN_vkVoidFunction>(DestroyPipeline)},
         {"vkDestroyPipelineLayout", reinterpret_cast<PFN_vkVoidFunction>(DestroyPipelineLayout)},
-        {"vkDestroySampler", reinterpret_cast<PFN_vkVoidFunction>(DestroySampler)},
-        {"vkDestroyDescriptorSetLayout", reinterpret_cast<PFN_vkVoidFunction>(DestroyDescriptorSetLayout)},
-        {"vkDestroyDescriptorPool", reinterpret_cast<PFN_vkVoidFunction>(DestroyDescriptorPool)},
         {"vkDestroyFramebuffer", reinterpret_cast<PFN_vkVoidFunction>(DestroyFramebuffer)},
         {"vkDestroyRenderPass", reinterpret_cast<PFN_vkVoidFunction>(DestroyRenderPass)},
         {"vkCreateBuffer", reinterpret_cast<PFN_vkVoidFunction>(CreateBuffer)},
@@ -10911,10 +11391,6 @@ intercept_core_device_command(const char *name) {
         {"vkCreateImage", reinterpret_cast<PFN_vkVoidFunction>(CreateImage)},
         {"vkCreateImageView", reinterpret_cast<PFN_vkVoidFunction>(CreateImageView)},
         {"vkCreateFence", reinterpret_cast<PFN_vkVoidFunction>(CreateFence)},
-        {"vkCreatePipelineCache", reinterpret_cast<PFN_vkVoidFunction>(CreatePipelineCache)},
-        {"vkDestroyPipelineCache", reinterpret_cast<PFN_vkVoidFunction>(DestroyPipelineCache)},
-        {"vkGetPipelineCacheData", reinterpret_cast<PFN_vkVoidFunction>(GetPipelineCacheData)},
-        {"vkMergePipelineCaches", reinterpret_cast<PFN_vkVoidFunction>(MergePipelineCaches)},
         {"vkCreateGraphicsPipelines", reinterpret_cast<PFN_vkVoidFunction>(CreateGraphicsPipelines)},
         {"vkCreateComputePipelines", reinterpret_cast<PFN_vkVoidFunction>(CreateComputePipelines)},
         {"vkCreateSampler", reinterpret_cast<PFN_vkVoidFunction>(CreateSampler)},
@@ -10989,8 +11465,6 @@ intercept_core_device_command(const char *name) {
         {"vkAllocateMemory", reinterpret_cast<PFN_vkVoidFunction>(AllocateMemory)},
         {"vkFreeMemory", reinterpret_cast<PFN_vkVoidFunction>(FreeMemory)},
         {"vkBindBufferMemory", reinterpret_cast<PFN_vkVoidFunction>(BindBufferMemory)},
-        {"vkGetBufferMemoryRequirements", reinterpret_cast<PFN_vkVoidFunction>(GetBufferMemoryRequirements)},
-        {"vkGetImageMemoryRequirements", reinterpret_cast<PFN_vkVoidFunction>(GetImageMemoryRequirements)},
         {"vkGetQueryPoolResults", reinterpret_cast<PFN_vkVoidFunction>(GetQueryPoolResults)},
         {"vkBindImageMemory", reinterpret_cast<PFN_vkVoidFunction>(BindImageMemory)},
         {"vkQueueBindSparse", reinterpret_cast<PFN_vkVoidFunction>(QueueBindSparse)},
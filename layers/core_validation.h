@@ -59,6 +59,7 @@
 #include <unordered_set>
 #include <vector>
 #include <list>
+#include <algorithm>
 
 #if MTMERGE
 
@@ -125,6 +126,16 @@ struct IMAGE_LAYOUT_NODE {
     VkFormat format;
 };
 
+// Device level layouts of one image, as of the last submission.  Subresources no submitted command has transitioned are
+//  still in the layout the image was created in.
+struct GLOBAL_IMAGE_LAYOUT_NODE {
+    GLOBAL_IMAGE_LAYOUT_NODE(const IMAGE_LAYOUT_NODE &image, uint32_t mipLevels, uint32_t arrayLayers)
+        : image(image), subresources(mipLevels, arrayLayers) {}
+
+    IMAGE_LAYOUT_NODE image;
+    IMAGE_LAYOUT_RANGES<VkImageLayout> subresources;
+};
+
 class PIPELINE_NODE : public BASE_NODE {
   public:
     VkPipeline pipeline;
@@ -135,6 +146,10 @@ class PIPELINE_NODE : public BASE_NODE {
     uint32_t duplicate_shaders;
     // Capture which slots (set#->bindings) are actually used by the shaders of this pipeline
     std::unordered_map<uint32_t, std::unordered_map<uint32_t, descriptor_req>> active_slots;
+    // active_slots sorted by set and binding number, see buildActiveSlotPlan().  Draw time checks walk this instead.
+    std::vector<descriptor_set_plan> active_slot_plan;
+    // Identifies active_slot_plan for the life of the process, so results checked against it can be cached
+    uint64_t slot_plan_id;
     // Vtx input info (if any)
     std::vector<VkVertexInputBindingDescription> vertexBindingDescriptions;
     std::vector<VkVertexInputAttributeDescription> vertexAttributeDescriptions;
@@ -147,6 +162,7 @@ class PIPELINE_NODE : public BASE_NODE {
     // Default constructor
     PIPELINE_NODE()
         : pipeline{}, graphicsPipelineCI{}, computePipelineCI{}, active_shaders(0), duplicate_shaders(0), active_slots(),
+          active_slot_plan(), slot_plan_id(0),
           vertexBindingDescriptions(), vertexAttributeDescriptions(), attachments(), blendConstantsEnabled(false), render_pass_ci(),
           pipeline_layout() {}
 
@@ -194,6 +210,24 @@ class PIPELINE_NODE : public BASE_NODE {
             break;
         }
     }
+    // Flatten active_slots, once the shaders have filled it in, into active_slot_plan
+    void buildActiveSlotPlan() {
+        static std::atomic<uint64_t> next_slot_plan_id(1);
+        active_slot_plan.clear();
+        for (auto &set : active_slots) {
+            descriptor_set_plan plan;
+            plan.set = set.first;
+            plan.bindings.assign(set.second.begin(), set.second.end());
+            std::sort(plan.bindings.begin(), plan.bindings.end(),
+                      [](std::pair<uint32_t, descriptor_req> const &a, std::pair<uint32_t, descriptor_req> const &b) {
+                          return a.first < b.first;
+                      });
+            active_slot_plan.push_back(std::move(plan));
+        }
+        std::sort(active_slot_plan.begin(), active_slot_plan.end(),
+                  [](descriptor_set_plan const &a, descriptor_set_plan const &b) { return a.set < b.set; });
+        slot_plan_id = next_slot_plan_id++;
+    }
 };
 
 class PHYS_DEV_PROPERTIES_NODE {
@@ -272,6 +306,8 @@ struct COMMAND_POOL_NODE {
     uint32_t queueFamilyIndex;
     // TODO: why is this std::list?
     std::list<VkCommandBuffer> commandBuffers; // container of cmd buffers allocated from this pool
+    // Blocks shared by the arenas of this pool's command buffers
+    block_pool cb_memory;
 };
 
 // Stuff from Device Limits Layer
@@ -45,7 +45,10 @@
 #endif
 
 #include "vulkan/vulkan.h"
+#include "vk_layer_arena.h"
+#include "vk_layer_range_map.h"
 #include <atomic>
+#include <mutex>
 #include <string.h>
 #include <unordered_set>
 #include <unordered_map>
@@ -102,6 +105,14 @@ enum descriptor_req {
     DESCRIPTOR_REQ_MULTI_SAMPLE = DESCRIPTOR_REQ_SINGLE_SAMPLE << 1,
 };
 
+// The bindings a pipeline uses in one descriptor set, with what it requires of each, sorted by binding number
+typedef std::vector<std::pair<uint32_t, descriptor_req>> descriptor_binding_plan;
+
+struct descriptor_set_plan {
+    uint32_t set;
+    descriptor_binding_plan bindings;
+};
+
 struct DESCRIPTOR_POOL_NODE {
     VkDescriptorPool pool;
     uint32_t maxSets;       // Max descriptor sets allowed in this pool
@@ -268,6 +279,10 @@ class IMAGE_CMD_BUF_LAYOUT_NODE {
     VkImageLayout layout;
 };
 
+inline bool operator==(const IMAGE_CMD_BUF_LAYOUT_NODE &a, const IMAGE_CMD_BUF_LAYOUT_NODE &b) {
+    return a.initialLayout == b.initialLayout && a.layout == b.layout;
+}
+
 struct MT_PASS_ATTACHMENT_INFO {
     uint32_t attachment;
     VkAttachmentLoadOp load_op;
@@ -423,35 +438,76 @@ template <> struct hash<QueryObject> {
 }
 struct DRAW_DATA { std::vector<VkBuffer> buffers; };
 
-struct ImageSubresourcePair {
-    VkImage image;
-    bool hasSubresource;
-    VkImageSubresource subresource;
+// Descriptor set contents, by DescriptorSet::GetVersion(), that passed draw time validation against a pipeline's slot plan
+struct VALIDATED_DESCRIPTORS {
+    uint64_t set_version;
+    uint64_t slot_plan_id;
 };
 
-inline bool operator==(const ImageSubresourcePair &img1, const ImageSubresourcePair &img2) {
-    if (img1.image != img2.image || img1.hasSubresource != img2.hasSubresource)
-        return false;
-    return !img1.hasSubresource ||
-           (img1.subresource.aspectMask == img2.subresource.aspectMask && img1.subresource.mipLevel == img2.subresource.mipLevel &&
-            img1.subresource.arrayLayer == img2.subresource.arrayLayer);
+inline bool operator==(const VALIDATED_DESCRIPTORS &a, const VALIDATED_DESCRIPTORS &b) {
+    return a.set_version == b.set_version && a.slot_plan_id == b.slot_plan_id;
 }
 
 namespace std {
-template <> struct hash<ImageSubresourcePair> {
-    size_t operator()(ImageSubresourcePair img) const throw() {
-        size_t hashVal = hash<uint64_t>()(reinterpret_cast<uint64_t &>(img.image));
-        hashVal ^= hash<bool>()(img.hasSubresource);
-        if (img.hasSubresource) {
-            hashVal ^= hash<uint32_t>()(reinterpret_cast<uint32_t &>(img.subresource.aspectMask));
-            hashVal ^= hash<uint32_t>()(img.subresource.mipLevel);
-            hashVal ^= hash<uint32_t>()(img.subresource.arrayLayer);
-        }
-        return hashVal;
+template <> struct hash<VALIDATED_DESCRIPTORS> {
+    size_t operator()(VALIDATED_DESCRIPTORS validated) const throw() {
+        return hash<uint64_t>()(validated.set_version * 31 + validated.slot_plan_id);
     }
 };
 }
 
+// Layouts of the subresources of one image.  Each (aspect plane, mip level, array layer) gets an index such that the
+//  layers of a level, and all levels when every layer is covered, are contiguous, so a command spanning many subresources
+//  is a handful of range updates rather than one entry per subresource.  Planes follow the aspect bit order: color,
+//  depth, stencil, metadata.
+template <typename LAYOUT, typename Allocator = std::allocator<LAYOUT>> class IMAGE_LAYOUT_RANGES {
+  public:
+    static const uint32_t PLANE_COUNT = 4;
+
+    IMAGE_LAYOUT_RANGES(uint32_t mipLevels, uint32_t arrayLayers, const Allocator &alloc = Allocator())
+        : mipLevels(mipLevels), arrayLayers(arrayLayers), layouts(alloc) {}
+
+    uint32_t index(uint32_t plane, uint32_t level, uint32_t layer) const {
+        return (plane * mipLevels + level) * arrayLayers + layer;
+    }
+
+    VkImageSubresource subresource(uint32_t index) const {
+        VkImageSubresource sub;
+        sub.arrayLayer = index % arrayLayers;
+        sub.mipLevel = (index / arrayLayers) % mipLevels;
+        sub.aspectMask = 1u << (index / arrayLayers / mipLevels);
+        return sub;
+    }
+
+    // Call f(begin, end) for each index range covering the aspects, levels and layers of range, clipped to the image
+    template <typename F> void forEachIndexRange(const VkImageSubresourceRange &range, F &&f) const {
+        if (range.baseMipLevel >= mipLevels || range.baseArrayLayer >= arrayLayers) {
+            return;
+        }
+        // Counts may be VK_REMAINING_*, so clip without forming base + count
+        uint32_t levelEnd = (range.levelCount > mipLevels - range.baseMipLevel) ? mipLevels : range.baseMipLevel + range.levelCount;
+        uint32_t layerEnd =
+            (range.layerCount > arrayLayers - range.baseArrayLayer) ? arrayLayers : range.baseArrayLayer + range.layerCount;
+        bool allLayers = (range.baseArrayLayer == 0 && layerEnd == arrayLayers);
+        for (uint32_t plane = 0; plane < PLANE_COUNT; ++plane) {
+            if (!(range.aspectMask & (1u << plane))) {
+                continue;
+            }
+            if (allLayers) {
+                f(index(plane, range.baseMipLevel, 0), index(plane, levelEnd, 0));
+            } else {
+                for (uint32_t level = range.baseMipLevel; level < levelEnd; ++level) {
+                    f(index(plane, level, range.baseArrayLayer), index(plane, level, layerEnd));
+                }
+            }
+        }
+    }
+
+    uint32_t mipLevels;
+    uint32_t arrayLayers;
+    range_map<LAYOUT, Allocator> layouts;
+};
+
 // Store layouts and pushconstants for PipelineLayout
 struct PIPELINE_LAYOUT_NODE {
     VkPipelineLayout layout;
@@ -478,6 +534,16 @@ struct LAST_BOUND_STATE {
     std::vector<cvdescriptorset::DescriptorSet *> boundDescriptorSets;
     // one dynamic offset per dynamic descriptor bound to this CB
     std::vector<std::vector<uint32_t>> dynamicOffsets;
+    // Bumped whenever the pipeline, the pipeline layout, a bound set or its dynamic offsets change
+    uint64_t generation;
+    // What the last draw that found every descriptor it uses valid saw, see validate_and_update_draw_state().  A draw
+    //  that sees the same is known to be valid without looking at the sets again.
+    uint64_t validated_generation;
+    uint64_t validated_slot_plan_id;
+    uint64_t validated_resource_epoch;
+    std::vector<std::pair<cvdescriptorset::DescriptorSet *, uint64_t>> validated_set_versions;
+
+    LAST_BOUND_STATE() { reset(); }
 
     void reset() {
         pipeline = VK_NULL_HANDLE;
@@ -485,9 +551,57 @@ struct LAST_BOUND_STATE {
         uniqueBoundSets.clear();
         boundDescriptorSets.clear();
         dynamicOffsets.clear();
+        generation = 1;
+        validated_generation = 0;
+        validated_set_versions.clear();
     }
 };
 // Cmd Buffer Wrapper Struct - TODO : This desperately needs its own class
+// Checks and state updates that can only be done at QueueSubmit time. vkCmd* calls append these to the command buffer and
+//  QueueSubmit replays them in recording order.
+enum DEFERRED_CHECK_TYPE {
+    DEFERRED_VALIDATE_MEMORY,      // Memory (or swapchain image) read by the command must hold valid data
+    DEFERRED_SET_MEMORY_VALID,     // Memory (or swapchain image) written by the command becomes valid or undefined
+    DEFERRED_SET_EVENT_STAGE,      // Event is set (or reset, with a zero stageMask) from the given stages
+    DEFERRED_VALIDATE_EVENT_STAGE, // srcStageMask of a wait must match the stages its events were set from
+    DEFERRED_SET_QUERY_STATE,      // Query becomes available or unavailable
+    DEFERRED_VALIDATE_QUERY,       // Queries copied to a buffer must be available
+};
+
+struct DEFERRED_CHECK {
+    DEFERRED_CHECK_TYPE type;
+    union {
+        // DEFERRED_VALIDATE_MEMORY, DEFERRED_SET_MEMORY_VALID
+        struct {
+            VkDeviceMemory mem;
+            VkImage image;      // Only looked at for swapchain images
+            const char *caller; // API name for error messages, always a string literal
+            bool valid;
+        } memory;
+        // DEFERRED_SET_EVENT_STAGE, DEFERRED_VALIDATE_EVENT_STAGE
+        struct {
+            VkEvent event;
+            uint32_t count;      // Waited events are the count entries of GLOBAL_CB_NODE::events from firstIndex
+            uint32_t firstIndex;
+            VkPipelineStageFlags stageMask;
+        } event;
+        // DEFERRED_SET_QUERY_STATE, DEFERRED_VALIDATE_QUERY
+        struct {
+            VkCommandBuffer commandBuffer; // May be a secondary command buffer executed by the one being submitted
+            QueryObject query;             // First of count queries
+            uint32_t count;
+            bool value;
+        } query;
+    };
+};
+
+// Containers for state recorded into a command buffer, allocated from the command buffer's arena
+template <typename T> using cb_vector = std::vector<T, arena_allocator<T>>;
+template <typename T> using cb_unordered_set = std::unordered_set<T, std::hash<T>, std::equal_to<T>, arena_allocator<T>>;
+template <typename K, typename V>
+using cb_unordered_map = std::unordered_map<K, V, std::hash<K>, std::equal_to<K>, arena_allocator<std::pair<const K, V>>>;
+typedef IMAGE_LAYOUT_RANGES<IMAGE_CMD_BUF_LAYOUT_NODE, arena_allocator<IMAGE_CMD_BUF_LAYOUT_NODE>> CB_IMAGE_LAYOUT_NODE;
+
 struct GLOBAL_CB_NODE : public BASE_NODE {
     VkCommandBuffer commandBuffer;
     VkCommandBufferAllocateInfo createInfo;
@@ -499,7 +613,10 @@ struct GLOBAL_CB_NODE : public BASE_NODE {
     CB_STATE state;                     // Track cmd buffer update state
     uint64_t submitCount;               // Number of times CB has been submitted
     CBStatusFlags status;               // Track status of various bindings on cmd buffer
-    std::vector<CMD_NODE> cmds;              // vector of commands bound to this command buffer
+    // Backs every cb_* container below, which resetRecordedState() drops in one go on reset. Must be declared before
+    //  them so it outlives them when the node is deleted.
+    arena memory;
+    cb_vector<CMD_NODE> cmds;           // vector of commands bound to this command buffer
     // Currently storing "lastBound" objects on per-CB basis
     //  long-term may want to create caches of "lastBound" states and could have
     //  each individual CMD_NODE referencing its own "lastBound" state
@@ -513,38 +630,43 @@ struct GLOBAL_CB_NODE : public BASE_NODE {
     VkSubpassContents activeSubpassContents;
     uint32_t activeSubpass;
     VkFramebuffer activeFramebuffer;
-    std::unordered_set<VkFramebuffer> framebuffers;
+    cb_unordered_set<VkFramebuffer> framebuffers;
     // Unified data structs to track objects bound to this command buffer as well as object
     //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
-    std::unordered_set<VK_OBJECT> object_bindings;
-    std::vector<VK_OBJECT> broken_bindings;
+    cb_unordered_set<VK_OBJECT> object_bindings;
+    cb_vector<VK_OBJECT> broken_bindings;
 
-    std::unordered_set<VkEvent> waitedEvents;
-    std::vector<VkEvent> writeEventsBeforeWait;
-    std::vector<VkEvent> events;
+    cb_unordered_set<VkEvent> waitedEvents;
+    cb_vector<VkEvent> writeEventsBeforeWait;
+    cb_vector<VkEvent> events;
     std::unordered_map<QueryObject, std::unordered_set<VkEvent>> waitedEventsBeforeQueryReset;
-    std::unordered_map<QueryObject, bool> queryToStateMap; // 0 is unavailable, 1 is available
-    std::unordered_set<QueryObject> activeQueries;
-    std::unordered_set<QueryObject> startedQueries;
-    std::unordered_map<ImageSubresourcePair, IMAGE_CMD_BUF_LAYOUT_NODE> imageLayoutMap;
-    std::unordered_map<VkImage, std::vector<ImageSubresourcePair>> imageSubresourceMap;
-    std::unordered_map<VkEvent, VkPipelineStageFlags> eventToStageMap;
+    cb_unordered_map<QueryObject, bool> queryToStateMap; // 0 is unavailable, 1 is available
+    cb_unordered_set<QueryObject> activeQueries;
+    cb_unordered_set<QueryObject> startedQueries;
+    cb_unordered_map<VkImage, CB_IMAGE_LAYOUT_NODE> imageLayoutMap;
+    cb_unordered_map<VkEvent, VkPipelineStageFlags> eventToStageMap;
     std::vector<DRAW_DATA> drawData;
     DRAW_DATA currentDrawData;
     VkCommandBuffer primaryCommandBuffer;
     // Track images and buffers that are updated by this CB at the point of a draw
-    std::unordered_set<VkImageView> updateImages;
-    std::unordered_set<VkBuffer> updateBuffers;
+    cb_unordered_set<VkImageView> updateImages;
+    cb_unordered_set<VkBuffer> updateBuffers;
+    // Descriptors already validated, and their storage updates recorded, at an earlier draw. The value is the device's
+    //  descriptor_resource_epoch at the time, later draws only skip the checks if no resource has been destroyed since.
+    cb_unordered_map<VALIDATED_DESCRIPTORS, uint64_t> validatedDescriptors;
     // If cmd buffer is primary, track secondary command buffers pending
     // execution
-    std::unordered_set<VkCommandBuffer> secondaryCommandBuffers;
+    cb_unordered_set<VkCommandBuffer> secondaryCommandBuffers;
     // MTMTODO : Scrub these data fields and merge active sets w/ lastBound as appropriate
-    std::vector<std::function<bool()>> validate_functions;
-    std::unordered_set<VkDeviceMemory> memObjs;
-    std::vector<std::function<bool(VkQueue)>> eventUpdates;
-    std::vector<std::function<bool(VkQueue)>> queryUpdates;
+    cb_unordered_set<VkDeviceMemory> memObjs;
+    cb_vector<DEFERRED_CHECK> deferredChecks;
+    // Held by vkCmd* entry points while they record into this command buffer
+    std::mutex record_lock;
 
+    explicit GLOBAL_CB_NODE(block_pool *pool);
     ~GLOBAL_CB_NODE();
+    // Empty all of the cb_* containers by rewinding the arena, without walking what they held
+    void resetRecordedState();
 };
 
 struct CB_SUBMISSION {
@@ -21,6 +21,7 @@
 #include "descriptor_sets.h"
 #include "vk_enum_string_helper.h"
 #include "vk_safe_struct.h"
+#include <atomic>
 #include <sstream>
 
 // Construct DescriptorSetLayout instance from given create info
@@ -265,9 +266,15 @@ bool cvdescriptorset::DescriptorSetLayout::VerifyUpdateConsistency(uint32_t curr
 cvdescriptorset::AllocateDescriptorSetsData::AllocateDescriptorSetsData(uint32_t count)
     : required_descriptors_by_type{}, layout_nodes(count, nullptr) {}
 
+// Versions handed out to sets, process wide so that a version identifies one set's contents even after it is freed
+static uint64_t NextSetVersion() {
+    static std::atomic<uint64_t> next_version(1);
+    return next_version++;
+}
+
 cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const DescriptorSetLayout *layout,
                                               const core_validation::layer_data *dev_data)
-    : some_update_(false), set_(set), p_layout_(layout), device_data_(dev_data) {
+    : some_update_(false), version_(NextSetVersion()), set_(set), p_layout_(layout), device_data_(dev_data) {
     // Foreach binding, create default descriptors of given type
     for (uint32_t i = 0; i < p_layout_->GetBindingCount(); ++i) {
         auto type = p_layout_->GetTypeFromIndex(i);
@@ -345,14 +352,12 @@ bool cvdescriptorset::DescriptorSet::IsCompatible(const DescriptorSetLayout *lay
     return layout->IsCompatible(p_layout_, error);
 }
 
-// Validate that the state of this set is appropriate for the given bindings and dynami_offsets at Draw time
+// Validate that the state of this set is appropriate for the given bindings at Draw time
 //  This includes validating that all descriptors in the given bindings are updated,
-//  that any update buffers are valid, and that any dynamic offsets are within the bounds of their buffers.
+//  and that any update buffers are valid.
 // Return true if state is acceptable, or false and write an error message into error string
-bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::unordered_map<uint32_t, descriptor_req> &bindings,
-                                                       const std::vector<uint32_t> &dynamic_offsets, std::string *error) const {
-    auto dyn_offset_index = 0;
-    for (auto binding_pair : bindings) {
+bool cvdescriptorset::DescriptorSet::ValidateDrawState(const descriptor_binding_plan &bindings, std::string *error) const {
+    for (auto &binding_pair : bindings) {
         auto binding = binding_pair.first;
         if (!p_layout_->HasBinding(binding)) {
             std::stringstream error_str;
@@ -396,35 +401,6 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::unordered_map<
                                 return false;
                             }
                         }
-                        if (descriptors_[i]->IsDynamic()) {
-                            // Validate that dynamic offsets are within the buffer
-                            auto buffer_size = buffer_node->createInfo.size;
-                            auto range = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetRange();
-                            auto desc_offset = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetOffset();
-                            auto dyn_offset = dynamic_offsets[dyn_offset_index++];
-                            if (VK_WHOLE_SIZE == range) {
-                                if ((dyn_offset + desc_offset) > buffer_size) {
-                                    std::stringstream error_str;
-                                    error_str << "Dynamic descriptor in binding #" << binding << " at global descriptor index " << i
-                                              << " uses buffer " << buffer
-                                              << " with update range of VK_WHOLE_SIZE has dynamic offset " << dyn_offset
-                                              << " combined with offset " << desc_offset << " that oversteps the buffer size of "
-                                              << buffer_size << ".";
-                                    *error = error_str.str();
-                                    return false;
-                                }
-                            } else {
-                                if ((dyn_offset + desc_offset + range) > buffer_size) {
-                                    std::stringstream error_str;
-                                    error_str << "Dynamic descriptor in binding #" << binding << " at global descriptor index " << i
-                                              << " uses buffer " << buffer << " with dynamic offset " << dyn_offset
-                                              << " combined with offset " << desc_offset << " and range " << range
-                                              << " that oversteps the buffer size of " << buffer_size << ".";
-                                    *error = error_str.str();
-                                    return false;
-                                }
-                            }
-                        }
                     }
                     else if (descriptor_class == ImageSampler || descriptor_class == Image) {
                         auto image_view = (descriptor_class == ImageSampler)
@@ -474,12 +450,70 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::unordered_map<
     return true;
 }
 
+// Validate that the dynamic offsets keep each dynamic descriptor in the given bindings within its buffer. Dynamic offsets
+//  are consumed in binding order by the dynamic descriptors of the bindings.
+// Return true if state is acceptable, or false and write an error message into error string
+bool cvdescriptorset::DescriptorSet::ValidateDynamicOffsets(const descriptor_binding_plan &bindings,
+                                                            const std::vector<uint32_t> &dynamic_offsets,
+                                                            std::string *error) const {
+    size_t dyn_offset_index = 0;
+    for (auto &binding_pair : bindings) {
+        auto binding = binding_pair.first;
+        if (!p_layout_->HasBinding(binding)) {
+            continue;
+        }
+        auto start_idx = p_layout_->GetGlobalStartIndexFromBinding(binding);
+        auto end_idx = p_layout_->GetGlobalEndIndexFromBinding(binding);
+        for (uint32_t i = start_idx; i <= end_idx; ++i) {
+            if (!descriptors_[i]->updated || descriptors_[i]->GetClass() != GeneralBuffer || !descriptors_[i]->IsDynamic()) {
+                continue;
+            }
+            if (dyn_offset_index >= dynamic_offsets.size()) {
+                // Too few offsets were bound, which vkCmdBindDescriptorSets already reported
+                return true;
+            }
+            auto buffer = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetBuffer();
+            auto buffer_node = getBufferNode(device_data_, buffer);
+            if (!buffer_node) {
+                continue;
+            }
+            // Validate that dynamic offsets are within the buffer
+            auto buffer_size = buffer_node->createInfo.size;
+            auto range = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetRange();
+            auto desc_offset = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetOffset();
+            auto dyn_offset = dynamic_offsets[dyn_offset_index++];
+            if (VK_WHOLE_SIZE == range) {
+                if ((dyn_offset + desc_offset) > buffer_size) {
+                    std::stringstream error_str;
+                    error_str << "Dynamic descriptor in binding #" << binding << " at global descriptor index " << i
+                              << " uses buffer " << buffer << " with update range of VK_WHOLE_SIZE has dynamic offset "
+                              << dyn_offset << " combined with offset " << desc_offset << " that oversteps the buffer size of "
+                              << buffer_size << ".";
+                    *error = error_str.str();
+                    return false;
+                }
+            } else {
+                if ((dyn_offset + desc_offset + range) > buffer_size) {
+                    std::stringstream error_str;
+                    error_str << "Dynamic descriptor in binding #" << binding << " at global descriptor index " << i
+                              << " uses buffer " << buffer << " with dynamic offset " << dyn_offset << " combined with offset "
+                              << desc_offset << " and range " << range << " that oversteps the buffer size of " << buffer_size
+                              << ".";
+                    *error = error_str.str();
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 // For given bindings, place any update buffers or images into the passed-in unordered_sets
-uint32_t cvdescriptorset::DescriptorSet::GetStorageUpdates(const std::unordered_map<uint32_t, descriptor_req> &bindings,
-                                                           std::unordered_set<VkBuffer> *buffer_set,
-                                                           std::unordered_set<VkImageView> *image_set) const {
+uint32_t cvdescriptorset::DescriptorSet::GetStorageUpdates(const descriptor_binding_plan &bindings,
+                                                           cb_unordered_set<VkBuffer> *buffer_set,
+                                                           cb_unordered_set<VkImageView> *image_set) const {
     auto num_updates = 0;
-    for (auto binding_pair : bindings) {
+    for (auto &binding_pair : bindings) {
         auto binding = binding_pair.first;
         // If a binding doesn't exist, skip it
         if (!p_layout_->HasBinding(binding)) {
@@ -531,6 +565,7 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorS
     }
     if (update->descriptorCount)
         some_update_ = true;
+    version_ = NextSetVersion();
 
     InvalidateBoundCmdBuffers();
 }
@@ -626,6 +661,7 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet
     }
     if (update->descriptorCount)
         some_update_ = true;
+    version_ = NextSetVersion();
 
     InvalidateBoundCmdBuffers();
 }
@@ -313,11 +313,15 @@ class DescriptorSet : public BASE_NODE {
     // Is this set compatible with the given layout?
     bool IsCompatible(const DescriptorSetLayout *, std::string *) const;
     // For given bindings validate state at time of draw is correct, returning false on error and writing error details into string*
-    bool ValidateDrawState(const std::unordered_map<uint32_t, descriptor_req> &, const std::vector<uint32_t> &, std::string *) const;
+    //  Only depends on the set's contents and the resources they reference, not on any dynamic offsets.
+    bool ValidateDrawState(const descriptor_binding_plan &, std::string *) const;
+    // For given bindings, validate that dynamic offsets keep each dynamic descriptor within its buffer. Call once
+    //  ValidateDrawState() has passed for the same bindings.
+    bool ValidateDynamicOffsets(const descriptor_binding_plan &, const std::vector<uint32_t> &, std::string *) const;
     // For given set of bindings, add any buffers and images that will be updated to their respective unordered_sets & return number
     // of objects inserted
-    uint32_t GetStorageUpdates(const std::unordered_map<uint32_t, descriptor_req> &, std::unordered_set<VkBuffer> *,
-                               std::unordered_set<VkImageView> *) const;
+    uint32_t GetStorageUpdates(const descriptor_binding_plan &, cb_unordered_set<VkBuffer> *,
+                               cb_unordered_set<VkImageView> *) const;
 
     // Descriptor Update functions. These functions validate state and perform update separately
     // Validate contents of a WriteUpdate
@@ -349,6 +353,9 @@ class DescriptorSet : public BASE_NODE {
     };
     // Return true if any part of set has ever been updated
     bool IsUpdated() const { return some_update_; };
+    // Changes whenever the descriptors of the set do, and is never reused by any other set or contents, so results of
+    //  checking the set can be cached by version
+    uint64_t GetVersion() const { return version_; };
 
   private:
     bool VerifyWriteUpdateContents(const VkWriteDescriptorSet *, const uint32_t, std::string *) const;
@@ -359,6 +366,7 @@ class DescriptorSet : public BASE_NODE {
     // Private helper to set all bound cmd buffers to INVALID state
     void InvalidateBoundCmdBuffers();
     bool some_update_; // has any part of the set ever been updated?
+    uint64_t version_;
     VkDescriptorSet set_;
     const DescriptorSetLayout *p_layout_;
     std::vector<std::unique_ptr<Descriptor>> descriptors_;
@@ -69,7 +69,7 @@ struct layer_data {
           physicalDeviceProperties(){};
 };
 
-static unordered_map<void *, layer_data *> layer_data_map;
+static dispatch_key_map<layer_data> layer_data_map;
 static std::mutex global_lock;
 
 static void init_image(layer_data *my_data, const VkAllocationCallbacks *pAllocator) {
@@ -201,6 +201,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice,
 VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     dispatch_key key = get_dispatch_key(device);
     layer_data *my_data = get_my_data_ptr(key, layer_data_map);
+    layer_debug_report_destroy_device(my_data->report_data, device);
     my_data->device_dispatch_table->DestroyDevice(device, pAllocator);
     delete my_data->device_dispatch_table;
     layer_data_map.erase(key);
@@ -1287,12 +1288,6 @@ GetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresour
     }
 }
 
-VKAPI_ATTR void VKAPI_CALL
-GetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties *pProperties) {
-    layer_data *phy_dev_data = get_my_data_ptr(get_dispatch_key(physicalDevice), layer_data_map);
-    phy_dev_data->instance_dispatch_table->GetPhysicalDeviceProperties(physicalDevice, pProperties);
-}
-
 VKAPI_ATTR VkResult VKAPI_CALL
 EnumerateInstanceLayerProperties(uint32_t *pCount, VkLayerProperties *pProperties) {
     return util_GetLayerProperties(1, &global_layer, pCount, pProperties);
@@ -1382,7 +1377,6 @@ intercept_core_instance_command(const char *name) {
         { "vkEnumerateDeviceLayerProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateDeviceLayerProperties) },
         { "vkEnumerateInstanceExtensionProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateInstanceExtensionProperties) },
         { "vkEnumerateDeviceExtensionProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateDeviceExtensionProperties) },
-        { "vkGetPhysicalDeviceProperties", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceProperties) },
     };
 
     for (size_t i = 0; i < ARRAY_SIZE(core_instance_commands); i++) {
@@ -20,10 +20,13 @@
  * Author: Tobin Ehlis <tobin@lunarg.com>
  */
 
+#include <atomic>
 #include <mutex>
 
 #include "vk_enum_string_helper.h"
+#include "vk_layer_arena.h"
 #include "vk_layer_extension_utils.h"
+#include "vk_layer_rwlock.h"
 #include "vk_layer_table.h"
 #include "vk_layer_utils.h"
 #include "vulkan/vk_layer.h"
@@ -82,12 +85,24 @@ struct instance_extension_enables {
 };
 
 typedef std::unordered_map<uint64_t, OBJTRACK_NODE *> object_map_type;
+
+// Tracking for all objects of one type.  Each type has its own lock, so validating a buffer handle does not wait on
+//  command buffers being allocated on another thread; lock is only ever held for one type at a time.  Nodes come from
+//  the type's own slab and go back to it when the object is destroyed.
+struct object_type_data {
+    std::mutex lock;
+    object_map_type map;
+    slab<OBJTRACK_NODE> nodes;
+    uint64_t count;
+
+    object_type_data() : count(0) {}
+};
+
 struct layer_data {
     VkInstance instance;
     VkPhysicalDevice physical_device;
 
-    uint64_t num_objects[VK_DEBUG_REPORT_OBJECT_TYPE_RANGE_SIZE_EXT + 1];
-    uint64_t num_total_objects;
+    std::atomic<uint64_t> num_total_objects;
 
     debug_report_data *report_data;
     std::vector<VkDebugReportCallbackEXT> logging_callback;
@@ -102,29 +117,30 @@ struct layer_data {
 
     std::vector<VkQueueFamilyProperties> queue_family_properties;
 
-    // Vector of unordered_maps per object type to hold OBJTRACK_NODE info
-    std::vector<object_map_type> object_map;
-    // Special-case map for swapchain images
+    // OBJTRACK_NODE info per object type
+    object_type_data objects[VK_DEBUG_REPORT_OBJECT_TYPE_RANGE_SIZE_EXT + 1];
+    // Special-case map for swapchain images, guarded by the image type's lock and using its slab
     std::unordered_map<uint64_t, OBJTRACK_NODE *> swapchainImageMap;
-    // Map of queue information structures, one per queue
+    // Map of queue information structures, one per queue, guarded by the queue type's lock
     std::unordered_map<VkQueue, OT_QUEUE_INFO *> queue_info_map;
 
     // Default constructor
     layer_data()
-        : instance(nullptr), physical_device(nullptr), num_objects{}, num_total_objects(0), report_data(nullptr),
-          wsi_enabled(false), objtrack_extensions_enabled(false), num_tmp_callbacks(0), tmp_dbg_create_infos(nullptr),
-		  tmp_callbacks(nullptr), object_map{} {
-        object_map.resize(VK_DEBUG_REPORT_OBJECT_TYPE_RANGE_SIZE_EXT + 1);
-    }
+        : instance(nullptr), physical_device(nullptr), num_total_objects(0), report_data(nullptr), wsi_enabled(false),
+          objtrack_extensions_enabled(false), num_tmp_callbacks(0), tmp_dbg_create_infos(nullptr), tmp_callbacks(nullptr) {}
 };
 
 
 static std::unordered_map<void *, struct instance_extension_enables> instanceExtMap;
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static dispatch_key_map<layer_data> layer_data_map;
 static device_table_map ot_device_table_map;
 static instance_table_map ot_instance_table_map;
-static std::mutex global_lock;
-static uint64_t object_track_index = 0;
+// Held exclusively while instances and devices come and go or instance state changes, and shared only where that state
+//  is read.  Entry points otherwise take just the per-type locks in layer_data, since a shared hold on every call would
+//  have every thread bouncing the same cache line; destroying an instance or device while it is still in use from
+//  another thread is invalid anyway.
+static rw_lock global_lock;
+static std::atomic<uint64_t> object_track_index(0);
 
 // Array of object name strings for OBJECT_TYPE enum conversion
 static const char *object_name[VK_DEBUG_REPORT_OBJECT_TYPE_RANGE_SIZE_EXT] = {
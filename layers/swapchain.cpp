@@ -34,7 +34,7 @@ namespace swapchain {
 static std::mutex global_lock;
 
 // The following is for logging error messages:
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static dispatch_key_map<layer_data> layer_data_map;
 
 static const VkExtensionProperties instance_extensions[] = {{VK_EXT_DEBUG_REPORT_EXTENSION_NAME, VK_EXT_DEBUG_REPORT_SPEC_VERSION}};
 
@@ -1338,6 +1338,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         }
         my_data->deviceMap.erase(device);
     }
+    layer_debug_report_destroy_device(my_data->report_data, device);
     delete my_data->device_dispatch_table;
     layer_data_map.erase(key);
 }
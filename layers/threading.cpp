@@ -170,6 +170,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     } else {
         finishMultiThread();
     }
+    layer_debug_report_destroy_device(dev_data->report_data, device);
     layer_data_map.erase(key);
 }
 
@@ -353,8 +354,7 @@ AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllo
     // Record mapping from command buffer to command pool
     if (VK_SUCCESS == result) {
         for (uint32_t index = 0; index < pAllocateInfo->commandBufferCount; index++) {
-            std::lock_guard<std::mutex> lock(command_pool_lock);
-            command_pool_map[pCommandBuffers[index]] = pAllocateInfo->commandPool;
+            setCommandPool(pCommandBuffers[index], pAllocateInfo->commandPool);
         }
     }
 
@@ -378,8 +378,7 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool com
         // These updates need to be done before calling down to the driver.
         for (uint32_t index = 0; index < commandBufferCount; index++) {
             finishWriteObject(my_data, pCommandBuffers[index], lockCommandPool);
-            std::lock_guard<std::mutex> lock(command_pool_lock);
-            command_pool_map.erase(pCommandBuffers[index]);
+            eraseCommandPool(pCommandBuffers[index]);
         }
     }
 
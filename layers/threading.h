@@ -22,8 +22,11 @@
 #define THREADING_H
 #include <condition_variable>
 #include <mutex>
+#include <stdint.h>
+#include <unordered_map>
 #include <vector>
 #include "vk_layer_config.h"
+#include "vk_layer_handle_hash.h"
 #include "vk_layer_logging.h"
 
 #if defined(__LP64__) || defined(_WIN64) || defined(__x86_64__) || defined(_M_X64) || defined(__ia64) || defined(_M_IA64) ||       \
@@ -68,143 +71,143 @@ inline bool startMultiThread() {
 inline void finishMultiThread() { vulkan_in_use = false; }
 } // namespace threading
 
+// Objects in use are spread over shards by handle, each with its own lock, so threads working on different objects
+//  rarely touch the same lock.  Threads only wait on a shard's condition when they actually collide on an object.
+static const size_t COUNTER_SHARD_COUNT = 16;
+
+template <typename T> inline size_t counter_shard_index(T object) { return hash_handle(object) & (COUNTER_SHARD_COUNT - 1); }
+
 template <typename T> class counter {
   public:
     const char *typeName;
     VkDebugReportObjectTypeEXT objectType;
-    std::unordered_map<T, object_use_data> uses;
-    std::mutex counter_lock;
-    std::condition_variable counter_condition;
+
     void startWrite(debug_report_data *report_data, T object) {
         bool skipCall = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (uses.find(object) == uses.end()) {
+        counter_shard &shard = shards[counter_shard_index(object)];
+        std::unique_lock<std::mutex> lock(shard.lock);
+        auto use = shard.uses.find(object);
+        if (use == shard.uses.end()) {
             // There is no current use of the object.  Record writer thread.
-            struct object_use_data *use_data = &uses[object];
+            struct object_use_data *use_data = &shard.uses[object];
             use_data->reader_count = 0;
             use_data->writer_count = 1;
             use_data->thread = tid;
         } else {
-            struct object_use_data *use_data = &uses[object];
-            if (use_data->reader_count == 0) {
-                // There are no readers.  Two writers just collided.
-                if (use_data->thread != tid) {
-                    skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object),
-                                        /*location*/ 0, THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
-                                        "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld",
-                                        typeName, use_data->thread, tid);
-                    if (skipCall) {
-                        // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.find(object) != uses.end()) {
-                            counter_condition.wait(lock);
-                        }
-                        // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *use_data = &uses[object];
-                        use_data->thread = tid;
-                        use_data->reader_count = 0;
-                        use_data->writer_count = 1;
-                    } else {
-                        // Continue with an unsafe use of the object.
-                        use_data->thread = tid;
-                        use_data->writer_count += 1;
-                    }
+            struct object_use_data *use_data = &use->second;
+            if (use_data->thread != tid) {
+                // There are readers or another writer.  This writer collided with them.
+                skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object),
+                                    /*location*/ 0, THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
+                                    "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld",
+                                    typeName, use_data->thread, tid);
+                if (skipCall) {
+                    // Wait for thread-safe access to object instead of skipping call.
+                    waitForRelease(shard, lock, object);
+                    // There is now no current use of the object.  Record writer thread.
+                    struct object_use_data *use_data = &shard.uses[object];
+                    use_data->thread = tid;
+                    use_data->reader_count = 0;
+                    use_data->writer_count = 1;
                 } else {
-                    // This is either safe multiple use in one call, or recursive use.
-                    // There is no way to make recursion safe.  Just forge ahead.
+                    // Continue with an unsafe use of the object.
+                    use_data->thread = tid;
                     use_data->writer_count += 1;
                 }
             } else {
-                // There are readers.  This writer collided with them.
-                if (use_data->thread != tid) {
-                    skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object),
-                                        /*location*/ 0, THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
-                                        "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld",
-                                        typeName, use_data->thread, tid);
-                    if (skipCall) {
-                        // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.find(object) != uses.end()) {
-                            counter_condition.wait(lock);
-                        }
-                        // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *use_data = &uses[object];
-                        use_data->thread = tid;
-                        use_data->reader_count = 0;
-                        use_data->writer_count = 1;
-                    } else {
-                        // Continue with an unsafe use of the object.
-                        use_data->thread = tid;
-                        use_data->writer_count += 1;
-                    }
-                } else {
-                    // This is either safe multiple use in one call, or recursive use.
-                    // There is no way to make recursion safe.  Just forge ahead.
-                    use_data->writer_count += 1;
-                }
+                // This is either safe multiple use in one call, or recursive use.
+                // There is no way to make recursion safe.  Just forge ahead.
+                use_data->writer_count += 1;
             }
         }
     }
 
     void finishWrite(T object) {
         // Object is no longer in use
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].writer_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
-        }
-        // Notify any waiting threads that this object may be safe to use
-        lock.unlock();
-        counter_condition.notify_all();
+        counter_shard &shard = shards[counter_shard_index(object)];
+        std::unique_lock<std::mutex> lock(shard.lock);
+        struct object_use_data *use_data = &shard.uses[object];
+        use_data->writer_count -= 1;
+        release(shard, lock, object, use_data);
     }
 
     void startRead(debug_report_data *report_data, T object) {
         bool skipCall = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (uses.find(object) == uses.end()) {
+        counter_shard &shard = shards[counter_shard_index(object)];
+        std::unique_lock<std::mutex> lock(shard.lock);
+        auto use = shard.uses.find(object);
+        if (use == shard.uses.end()) {
             // There is no current use of the object.  Record reader count
-            struct object_use_data *use_data = &uses[object];
+            struct object_use_data *use_data = &shard.uses[object];
             use_data->reader_count = 1;
             use_data->writer_count = 0;
             use_data->thread = tid;
-        } else if (uses[object].writer_count > 0 && uses[object].thread != tid) {
+        } else if (use->second.writer_count > 0 && use->second.thread != tid) {
             // There is a writer of the object.
             skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object),
                                 /*location*/ 0, THREADING_CHECKER_MULTIPLE_THREADS, "THREADING",
                                 "THREADING ERROR : object of type %s is simultaneously used in thread %ld and thread %ld", typeName,
-                                uses[object].thread, tid);
+                                use->second.thread, tid);
             if (skipCall) {
                 // Wait for thread-safe access to object instead of skipping call.
-                while (uses.find(object) != uses.end()) {
-                    counter_condition.wait(lock);
-                }
+                waitForRelease(shard, lock, object);
                 // There is no current use of the object.  Record reader count
-                struct object_use_data *use_data = &uses[object];
+                struct object_use_data *use_data = &shard.uses[object];
                 use_data->reader_count = 1;
                 use_data->writer_count = 0;
                 use_data->thread = tid;
             } else {
-                uses[object].reader_count += 1;
+                use->second.reader_count += 1;
             }
         } else {
             // There are other readers of the object.  Increase reader count
-            uses[object].reader_count += 1;
+            use->second.reader_count += 1;
         }
     }
     void finishRead(T object) {
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].reader_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
-        }
-        // Notify any waiting threads that this object may be safe to use
-        lock.unlock();
-        counter_condition.notify_all();
+        counter_shard &shard = shards[counter_shard_index(object)];
+        std::unique_lock<std::mutex> lock(shard.lock);
+        struct object_use_data *use_data = &shard.uses[object];
+        use_data->reader_count -= 1;
+        release(shard, lock, object, use_data);
     }
     counter(const char *name = "", VkDebugReportObjectTypeEXT type = VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT) {
         typeName = name;
         objectType = type;
     }
+
+  private:
+    struct counter_shard {
+        counter_shard() : waiters(0) {}
+        std::mutex lock;
+        std::condition_variable condition;
+        // Threads blocked in waitForRelease, so releases can skip the notify when nobody is waiting
+        int waiters;
+        std::unordered_map<T, object_use_data> uses;
+    };
+    counter_shard shards[COUNTER_SHARD_COUNT];
+
+    void waitForRelease(counter_shard &shard, std::unique_lock<std::mutex> &lock, T object) {
+        shard.waiters++;
+        while (shard.uses.find(object) != shard.uses.end()) {
+            shard.condition.wait(lock);
+        }
+        shard.waiters--;
+    }
+
+    void release(counter_shard &shard, std::unique_lock<std::mutex> &lock, T object, object_use_data *use_data) {
+        if ((use_data->reader_count == 0) && (use_data->writer_count == 0)) {
+            shard.uses.erase(object);
+        }
+        bool notify = shard.waiters > 0;
+        lock.unlock();
+        // Notify any waiting threads that this object may be safe to use
+        if (notify) {
+            shard.condition.notify_all();
+        }
+    }
 };
 
 struct layer_data {
@@ -320,16 +323,35 @@ WRAPPER(VkDebugReportCallbackEXT)
 WRAPPER(uint64_t)
 #endif // DISTINCT_NONDISPATCHABLE_HANDLES
 
-static std::unordered_map<void *, layer_data *> layer_data_map;
-static std::mutex command_pool_lock;
-static std::unordered_map<VkCommandBuffer, VkCommandPool> command_pool_map;
+static dispatch_key_map<layer_data> layer_data_map;
+
+// Command buffer to command pool mapping, sharded like counter<T> since every command buffer use looks it up
+struct command_pool_shard {
+    std::mutex lock;
+    std::unordered_map<VkCommandBuffer, VkCommandPool> pools;
+};
+static command_pool_shard command_pool_map[COUNTER_SHARD_COUNT];
+
+static VkCommandPool getCommandPool(VkCommandBuffer object) {
+    command_pool_shard &shard = command_pool_map[counter_shard_index(object)];
+    std::lock_guard<std::mutex> lock(shard.lock);
+    return shard.pools[object];
+}
+static void setCommandPool(VkCommandBuffer object, VkCommandPool pool) {
+    command_pool_shard &shard = command_pool_map[counter_shard_index(object)];
+    std::lock_guard<std::mutex> lock(shard.lock);
+    shard.pools[object] = pool;
+}
+static void eraseCommandPool(VkCommandBuffer object) {
+    command_pool_shard &shard = command_pool_map[counter_shard_index(object)];
+    std::lock_guard<std::mutex> lock(shard.lock);
+    shard.pools.erase(object);
+}
 
 // VkCommandBuffer needs check for implicit use of command pool
 static void startWriteObject(struct layer_data *my_data, VkCommandBuffer object, bool lockPool = true) {
     if (lockPool) {
-        std::unique_lock<std::mutex> lock(command_pool_lock);
-        VkCommandPool pool = command_pool_map[object];
-        lock.unlock();
+        VkCommandPool pool = getCommandPool(object);
         startWriteObject(my_data, pool);
     }
     my_data->c_VkCommandBuffer.startWrite(my_data->report_data, object);
@@ -337,24 +359,18 @@ static void startWriteObject(struct layer_data *my_data, VkCommandBuffer object,
 static void finishWriteObject(struct layer_data *my_data, VkCommandBuffer object, bool lockPool = true) {
     my_data->c_VkCommandBuffer.finishWrite(object);
     if (lockPool) {
-        std::unique_lock<std::mutex> lock(command_pool_lock);
-        VkCommandPool pool = command_pool_map[object];
-        lock.unlock();
+        VkCommandPool pool = getCommandPool(object);
         finishWriteObject(my_data, pool);
     }
 }
 static void startReadObject(struct layer_data *my_data, VkCommandBuffer object) {
-    std::unique_lock<std::mutex> lock(command_pool_lock);
-    VkCommandPool pool = command_pool_map[object];
-    lock.unlock();
+    VkCommandPool pool = getCommandPool(object);
     startReadObject(my_data, pool);
     my_data->c_VkCommandBuffer.startRead(my_data->report_data, object);
 }
 static void finishReadObject(struct layer_data *my_data, VkCommandBuffer object) {
     my_data->c_VkCommandBuffer.finishRead(object);
-    std::unique_lock<std::mutex> lock(command_pool_lock);
-    VkCommandPool pool = command_pool_map[object];
-    lock.unlock();
+    VkCommandPool pool = getCommandPool(object);
     finishReadObject(my_data, pool);
 }
 #endif // THREADING_H
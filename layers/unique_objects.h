@@ -39,17 +39,18 @@
 #include "vk_layer_extension_utils.h"
 #include "vk_safe_struct.h"
 #include "vk_layer_utils.h"
+#include "vk_layer_handle_table.h"
 
 namespace unique_objects {
 
-// All increments must be guarded by global_lock
-static uint64_t global_unique_id = 1;
+// Maps the unique IDs handed to the application back to actual object handles.  One table serves every instance and
+// device so that IDs stay unique across all of them.
+static handle_table unique_id_mapping;
 
 struct layer_data {
     VkInstance instance;
 
     bool wsi_enabled;
-    std::unordered_map<uint64_t, uint64_t> unique_id_mapping; // Map uniqueID to actual object handle
     VkPhysicalDevice gpu;
 
     layer_data() : wsi_enabled(false), gpu(VK_NULL_HANDLE){};
@@ -67,10 +68,12 @@ struct instance_extension_enables {
 };
 
 static std::unordered_map<void *, struct instance_extension_enables> instanceExtMap;
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static dispatch_key_map<layer_data> layer_data_map;
 static device_table_map unique_objects_device_table_map;
 static instance_table_map unique_objects_instance_table_map;
-static std::mutex global_lock; // Protect map accesses and unique_id increments
+static std::mutex global_lock; // Protect display_id_mapping
+// Unique IDs of displays already handed out, by actual display handle, as displays are enumerated rather than created
+static std::unordered_map<uint64_t, uint64_t> display_id_mapping;
 
 struct GenericHeader {
     VkStructureType sType;
@@ -228,7 +231,6 @@ VkResult explicit_AllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pA
     const VkMemoryAllocateInfo *input_allocate_info = pAllocateInfo;
     std::unique_ptr<safe_VkMemoryAllocateInfo> safe_allocate_info;
     std::unique_ptr<safe_VkDedicatedAllocationMemoryAllocateInfoNV> safe_dedicated_allocate_info;
-    layer_data *my_map_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
 
     if ((pAllocateInfo != nullptr) &&
         ContainsExtStruct(pAllocateInfo, VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV)) {
@@ -247,21 +249,16 @@ VkResult explicit_AllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pA
                 safe_dedicated_allocate_info->initialize(
                     reinterpret_cast<const VkDedicatedAllocationMemoryAllocateInfoNV *>(orig_pnext));
 
-                std::unique_lock<std::mutex> lock(global_lock);
-
                 if (safe_dedicated_allocate_info->buffer != VK_NULL_HANDLE) {
-                    uint64_t local_buffer = reinterpret_cast<uint64_t &>(safe_dedicated_allocate_info->buffer);
-                    safe_dedicated_allocate_info->buffer =
-                        reinterpret_cast<VkBuffer &>(my_map_data->unique_id_mapping[local_buffer]);
+                    uint64_t local_buffer = unique_id_mapping.unwrap(reinterpret_cast<uint64_t &>(safe_dedicated_allocate_info->buffer));
+                    safe_dedicated_allocate_info->buffer = reinterpret_cast<VkBuffer &>(local_buffer);
                 }
 
                 if (safe_dedicated_allocate_info->image != VK_NULL_HANDLE) {
-                    uint64_t local_image = reinterpret_cast<uint64_t &>(safe_dedicated_allocate_info->image);
-                    safe_dedicated_allocate_info->image = reinterpret_cast<VkImage &>(my_map_data->unique_id_mapping[local_image]);
+                    uint64_t local_image = unique_id_mapping.unwrap(reinterpret_cast<uint64_t &>(safe_dedicated_allocate_info->image));
+                    safe_dedicated_allocate_info->image = reinterpret_cast<VkImage &>(local_image);
                 }
 
-                lock.unlock();
-
                 input_pnext->pNext = reinterpret_cast<GenericHeader *>(safe_dedicated_allocate_info.get());
                 input_pnext = reinterpret_cast<GenericHeader *>(input_pnext->pNext);
             } else {
@@ -276,9 +273,7 @@ VkResult explicit_AllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pA
                           ->AllocateMemory(device, input_allocate_info, pAllocator, pMemory);
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        uint64_t unique_id = global_unique_id++;
-        my_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(*pMemory);
+        uint64_t unique_id = unique_id_mapping.wrap(reinterpret_cast<uint64_t &>(*pMemory));
         *pMemory = reinterpret_cast<VkDeviceMemory &>(unique_id);
     }
 
@@ -291,33 +286,27 @@ VkResult explicit_CreateComputePipelines(VkDevice device, VkPipelineCache pipeli
     // STRUCT USES:{'pipelineCache': 'VkPipelineCache', 'pCreateInfos[createInfoCount]': {'stage': {'module': 'VkShaderModule'},
     // 'layout': 'VkPipelineLayout', 'basePipelineHandle': 'VkPipeline'}}
     // LOCAL DECLS:{'pCreateInfos': 'VkComputePipelineCreateInfo*'}
-    layer_data *my_device_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     safe_VkComputePipelineCreateInfo *local_pCreateInfos = NULL;
     if (pCreateInfos) {
-        std::lock_guard<std::mutex> lock(global_lock);
         local_pCreateInfos = new safe_VkComputePipelineCreateInfo[createInfoCount];
         for (uint32_t idx0 = 0; idx0 < createInfoCount; ++idx0) {
             local_pCreateInfos[idx0].initialize(&pCreateInfos[idx0]);
             if (pCreateInfos[idx0].basePipelineHandle) {
                 local_pCreateInfos[idx0].basePipelineHandle =
-                    (VkPipeline)my_device_data
-                        ->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].basePipelineHandle)];
+                    (VkPipeline)unique_id_mapping.unwrap(reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].basePipelineHandle));
             }
             if (pCreateInfos[idx0].layout) {
                 local_pCreateInfos[idx0].layout =
-                    (VkPipelineLayout)
-                        my_device_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].layout)];
+                    (VkPipelineLayout)unique_id_mapping.unwrap(reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].layout));
             }
             if (pCreateInfos[idx0].stage.module) {
                 local_pCreateInfos[idx0].stage.module =
-                    (VkShaderModule)
-                        my_device_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].stage.module)];
+                    (VkShaderModule)unique_id_mapping.unwrap(reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].stage.module));
             }
         }
     }
     if (pipelineCache) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        pipelineCache = (VkPipelineCache)my_device_data->unique_id_mapping[reinterpret_cast<uint64_t &>(pipelineCache)];
+        pipelineCache = (VkPipelineCache)unique_id_mapping.unwrap(reinterpret_cast<uint64_t &>(pipelineCache));
     }
 
     VkResult result = get_dispatch_table(unique_objects_device_table_map, device)
@@ -326,10 +315,8 @@ VkResult explicit_CreateComputePipelines(VkDevice device, VkPipelineCache pipeli
     delete[] local_pCreateInfos;
     if (VK_SUCCESS == result) {
         uint64_t unique_id = 0;
-        std::lock_guard<std::mutex> lock(global_lock);
         for (uint32_t i = 0; i < createInfoCount; ++i) {
-            unique_id = global_unique_id++;
-            my_device_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(pPipelines[i]);
+            unique_id = unique_id_mapping.wrap(reinterpret_cast<uint64_t &>(pPipelines[i]));
             pPipelines[i] = reinterpret_cast<VkPipeline &>(unique_id);
         }
     }
@@ -342,42 +329,35 @@ VkResult explicit_CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipel
     // STRUCT USES:{'pipelineCache': 'VkPipelineCache', 'pCreateInfos[createInfoCount]': {'layout': 'VkPipelineLayout',
     // 'pStages[stageCount]': {'module': 'VkShaderModule'}, 'renderPass': 'VkRenderPass', 'basePipelineHandle': 'VkPipeline'}}
     // LOCAL DECLS:{'pCreateInfos': 'VkGraphicsPipelineCreateInfo*'}
-    layer_data *my_device_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     safe_VkGraphicsPipelineCreateInfo *local_pCreateInfos = NULL;
     if (pCreateInfos) {
         local_pCreateInfos = new safe_VkGraphicsPipelineCreateInfo[createInfoCount];
-        std::lock_guard<std::mutex> lock(global_lock);
         for (uint32_t idx0 = 0; idx0 < createInfoCount; ++idx0) {
             local_pCreateInfos[idx0].initialize(&pCreateInfos[idx0]);
             if (pCreateInfos[idx0].basePipelineHandle) {
                 local_pCreateInfos[idx0].basePipelineHandle =
-                    (VkPipeline)my_device_data
-                        ->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].basePipelineHandle)];
+                    (VkPipeline)unique_id_mapping.unwrap(reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].basePipelineHandle));
             }
             if (pCreateInfos[idx0].layout) {
                 local_pCreateInfos[idx0].layout =
-                    (VkPipelineLayout)
-                        my_device_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].layout)];
+                    (VkPipelineLayout)unique_id_mapping.unwrap(reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].layout));
             }
             if (pCreateInfos[idx0].pStages) {
                 for (uint32_t idx1 = 0; idx1 < pCreateInfos[idx0].stageCount; ++idx1) {
                     if (pCreateInfos[idx0].pStages[idx1].module) {
-                        local_pCreateInfos[idx0].pStages[idx1].module =
-                            (VkShaderModule)my_device_data
-                                ->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].pStages[idx1].module)];
+                        local_pCreateInfos[idx0].pStages[idx1].module = (VkShaderModule)unique_id_mapping.unwrap(
+                            reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].pStages[idx1].module));
                     }
                 }
             }
             if (pCreateInfos[idx0].renderPass) {
                 local_pCreateInfos[idx0].renderPass =
-                    (VkRenderPass)
-                        my_device_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].renderPass)];
+                    (VkRenderPass)unique_id_mapping.unwrap(reinterpret_cast<const uint64_t &>(pCreateInfos[idx0].renderPass));
             }
         }
     }
     if (pipelineCache) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        pipelineCache = (VkPipelineCache)my_device_data->unique_id_mapping[reinterpret_cast<uint64_t &>(pipelineCache)];
+        pipelineCache = (VkPipelineCache)unique_id_mapping.unwrap(reinterpret_cast<uint64_t &>(pipelineCache));
     }
 
     VkResult result =
@@ -387,10 +367,8 @@ VkResult explicit_CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipel
     delete[] local_pCreateInfos;
     if (VK_SUCCESS == result) {
         uint64_t unique_id = 0;
-        std::lock_guard<std::mutex> lock(global_lock);
         for (uint32_t i = 0; i < createInfoCount; ++i) {
-            unique_id = global_unique_id++;
-            my_device_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(pPipelines[i]);
+            unique_id = unique_id_mapping.wrap(reinterpret_cast<uint64_t &>(pPipelines[i]));
             pPipelines[i] = reinterpret_cast<VkPipeline &>(unique_id);
         }
     }
@@ -399,18 +377,12 @@ VkResult explicit_CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipel
 
 VkResult explicit_CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR *pCreateInfo,
                                      const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchain) {
-    layer_data *my_map_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
-
     safe_VkSwapchainCreateInfoKHR *local_pCreateInfo = NULL;
     if (pCreateInfo) {
-        std::lock_guard<std::mutex> lock(global_lock);
         local_pCreateInfo = new safe_VkSwapchainCreateInfoKHR(pCreateInfo);
         local_pCreateInfo->oldSwapchain =
-            (VkSwapchainKHR)my_map_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfo->oldSwapchain)];
-        // Need to pull surface mapping from the instance-level map
-        layer_data *instance_data = get_my_data_ptr(get_dispatch_key(my_map_data->gpu), layer_data_map);
-        local_pCreateInfo->surface =
-            (VkSurfaceKHR)instance_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pCreateInfo->surface)];
+            (VkSwapchainKHR)unique_id_mapping.unwrap(reinterpret_cast<const uint64_t &>(pCreateInfo->oldSwapchain));
+        local_pCreateInfo->surface = (VkSurfaceKHR)unique_id_mapping.unwrap(reinterpret_cast<const uint64_t &>(pCreateInfo->surface));
     }
 
     VkResult result = get_dispatch_table(unique_objects_device_table_map, device)
@@ -418,9 +390,7 @@ VkResult explicit_CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInf
     if (local_pCreateInfo)
         delete local_pCreateInfo;
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        uint64_t unique_id =global_unique_id++;
-        my_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(*pSwapchain);
+        uint64_t unique_id = unique_id_mapping.wrap(reinterpret_cast<uint64_t &>(*pSwapchain));
         *pSwapchain = reinterpret_cast<VkSwapchainKHR &>(unique_id);
     }
     return result;
@@ -430,10 +400,8 @@ VkResult explicit_GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchai
                                         VkImage *pSwapchainImages) {
     // UNWRAP USES:
     //  0 : swapchain,VkSwapchainKHR, pSwapchainImages,VkImage
-    layer_data *my_device_data = get_my_data_ptr(get_dispatch_key(device), layer_data_map);
     if (VK_NULL_HANDLE != swapchain) {
-        std::lock_guard<std::mutex> lock(global_lock);
-        swapchain = (VkSwapchainKHR)my_device_data->unique_id_mapping[reinterpret_cast<uint64_t &>(swapchain)];
+        swapchain = (VkSwapchainKHR)unique_id_mapping.unwrap(reinterpret_cast<uint64_t &>(swapchain));
     }
     VkResult result = get_dispatch_table(unique_objects_device_table_map, device)
                           ->GetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
@@ -441,10 +409,8 @@ VkResult explicit_GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchai
     if (VK_SUCCESS == result) {
         if ((*pSwapchainImageCount > 0) && pSwapchainImages) {
             uint64_t unique_id = 0;
-            std::lock_guard<std::mutex> lock(global_lock);
             for (uint32_t i = 0; i < *pSwapchainImageCount; ++i) {
-                unique_id = global_unique_id++;
-                my_device_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(pSwapchainImages[i]);
+                unique_id = unique_id_mapping.wrap(reinterpret_cast<uint64_t &>(pSwapchainImages[i]));
                 pSwapchainImages[i] = reinterpret_cast<VkImage &>(unique_id);
             }
         }
@@ -453,18 +419,26 @@ VkResult explicit_GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchai
 }
 
  #ifndef __ANDROID__
+// Returns the unique ID for a display, handing out a new one the first time the display is seen
+static VkDisplayKHR wrapDisplay(VkDisplayKHR display) {
+    std::lock_guard<std::mutex> lock(global_lock);
+    uint64_t &unique_id = display_id_mapping[reinterpret_cast<uint64_t &>(display)];
+    if (!unique_id) {
+        unique_id = unique_id_mapping.wrap(reinterpret_cast<uint64_t &>(display));
+    }
+    return reinterpret_cast<VkDisplayKHR &>(unique_id);
+}
+
 VkResult explicit_GetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties)
 {
-    layer_data *my_map_data = get_my_data_ptr(get_dispatch_key(physicalDevice), layer_data_map);
     safe_VkDisplayPropertiesKHR* local_pProperties = NULL;
     {
-        std::lock_guard<std::mutex> lock(global_lock);
         if (pProperties) {
             local_pProperties = new safe_VkDisplayPropertiesKHR[*pPropertyCount];
             for (uint32_t idx0=0; idx0<*pPropertyCount; ++idx0) {
                 local_pProperties[idx0].initialize(&pProperties[idx0]);
                 if (pProperties[idx0].display) {
-                    local_pProperties[idx0].display = (VkDisplayKHR)my_map_data->unique_id_mapping[reinterpret_cast<const uint64_t &>(pProperties[idx0].display)];
+                    local_pProperties[idx0].display = (VkDisplayKHR)unique_id_mapping.unwrap(reinterpret_cast<const uint64_t &>(pProperties[idx0].display));
                 }
             }
         }
@@ -474,11 +448,7 @@ VkResult explicit_GetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physica
     if (result == VK_SUCCESS && pProperties)
     {
         for (uint32_t idx0=0; idx0<*pPropertyCount; ++idx0) {
-            std::lock_guard<std::mutex> lock(global_lock);
-
-            uint64_t unique_id = global_unique_id++;
-            my_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(local_pProperties[idx0].display);
-            pProperties[idx0].display = reinterpret_cast<VkDisplayKHR&>(unique_id);
+            pProperties[idx0].display = wrapDisplay(local_pProperties[idx0].display);
             pProperties[idx0].displayName = local_pProperties[idx0].displayName;
             pProperties[idx0].physicalDimensions = local_pProperties[idx0].physicalDimensions;
             pProperties[idx0].physicalResolution = local_pProperties[idx0].physicalResolution;
@@ -494,15 +464,11 @@ VkResult explicit_GetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physica
 
 VkResult explicit_GetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays)
 {
-    layer_data *my_map_data = get_my_data_ptr(get_dispatch_key(physicalDevice), layer_data_map);
     VkResult result = get_dispatch_table(unique_objects_instance_table_map, physicalDevice)->GetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
     if (VK_SUCCESS == result) {
         if ((*pDisplayCount > 0) && pDisplays) {
-            std::lock_guard<std::mutex> lock(global_lock);
             for (uint32_t i = 0; i < *pDisplayCount; i++) {
-		    auto it = my_map_data->unique_id_mapping.find(reinterpret_cast<const uint64_t &> (pDisplays[i]));
-                assert (it !=  my_map_data->unique_id_mapping.end());
-                pDisplays[i] = reinterpret_cast<VkDisplayKHR&> (it->second);
+                pDisplays[i] = wrapDisplay(pDisplays[i]);
             }
         }
     }
@@ -512,11 +478,9 @@ VkResult explicit_GetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalD
 
 VkResult explicit_GetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties)
 {
-    layer_data *my_map_data = get_my_data_ptr(get_dispatch_key(physicalDevice), layer_data_map);
     safe_VkDisplayModePropertiesKHR* local_pProperties = NULL;
     {
-        std::lock_guard<std::mutex> lock(global_lock);
-        display = (VkDisplayKHR)my_map_data->unique_id_mapping[reinterpret_cast<uint64_t &>(display)];
+        display = (VkDisplayKHR)unique_id_mapping.unwrap(reinterpret_cast<uint64_t &>(display));
         if (pProperties) {
             local_pProperties = new safe_VkDisplayModePropertiesKHR[*pPropertyCount];
             for (uint32_t idx0=0; idx0<*pPropertyCount; ++idx0) {
@@ -529,10 +493,7 @@ VkResult explicit_GetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, V
     if (result == VK_SUCCESS && pProperties)
     {
         for (uint32_t idx0=0; idx0<*pPropertyCount; ++idx0) {
-            std::lock_guard<std::mutex> lock(global_lock);
-
-            uint64_t unique_id = global_unique_id++;
-            my_map_data->unique_id_mapping[unique_id] = reinterpret_cast<uint64_t &>(local_pProperties[idx0].displayMode);
+            uint64_t unique_id = unique_id_mapping.wrap(reinterpret_cast<uint64_t &>(local_pProperties[idx0].displayMode));
             pProperties[idx0].displayMode = reinterpret_cast<VkDisplayModeKHR&>(unique_id);
             pProperties[idx0].parameters.visibleRegion.width = local_pProperties[idx0].parameters.visibleRegion.width;
             pProperties[idx0].parameters.visibleRegion.height = local_pProperties[idx0].parameters.visibleRegion.height;
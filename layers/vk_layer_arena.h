@@ -0,0 +1,280 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_ARENA_H
+#define VK_LAYER_ARENA_H
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <stdint.h>
+#include <stdlib.h>
+#include <type_traits>
+#include <utility>
+
+// Fixed size memory blocks shared by a group of arenas, e.g. all command buffers allocated from one VkCommandPool.
+//  Blocks handed back by arena::rewind() go on a free list and are reused by the next arena that needs one, so once
+//  a group of arenas has warmed up, rewinding and refilling them does not touch the heap.  Blocks are only returned
+//  to the heap when the pool is destroyed, by which point all of its arenas must be gone.
+class block_pool {
+  public:
+    static const size_t BLOCK_SIZE = 16 * 1024;
+
+    struct block {
+        block *next;
+    };
+
+    block_pool() : free_list_(nullptr) {}
+    block_pool(const block_pool &) = delete;
+    block_pool &operator=(const block_pool &) = delete;
+    ~block_pool() {
+        while (free_list_) {
+            block *next = free_list_->next;
+            free(free_list_);
+            free_list_ = next;
+        }
+    }
+
+    block *acquire() {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            if (free_list_) {
+                block *result = free_list_;
+                free_list_ = result->next;
+                return result;
+            }
+        }
+        return allocate_block();
+    }
+
+    // Return a chain of blocks linked through next, from first to last
+    void release(block *first, block *last) {
+        std::lock_guard<std::mutex> lock(lock_);
+        last->next = free_list_;
+        free_list_ = first;
+    }
+
+    static block *allocate_block() {
+        block *result = static_cast<block *>(malloc(BLOCK_SIZE));
+        if (!result) {
+            throw std::bad_alloc();
+        }
+        return result;
+    }
+
+  private:
+    std::mutex lock_;
+    block *free_list_;
+};
+
+// Bump allocator whose memory is only ever released all at once by rewind(), which is O(1) in the number of
+//  allocations made.  Small requests are carved out of blocks from a block_pool; requests too big to share a block get
+//  their own heap allocation, which rewind() frees.  An arena without a pool allocates and frees its blocks directly.
+//  Not thread safe, each arena is meant to be used by whoever owns it at the time.
+class arena {
+  public:
+    explicit arena(block_pool *pool = nullptr)
+        : pool_(pool), first_(nullptr), last_(nullptr), cursor_(nullptr), end_(nullptr), large_(nullptr) {}
+    arena(const arena &) = delete;
+    arena &operator=(const arena &) = delete;
+    ~arena() { rewind(); }
+
+    void *allocate(size_t size, size_t alignment) {
+        if (size > LARGE_THRESHOLD) {
+            return allocate_large(size);
+        }
+        uintptr_t aligned = (reinterpret_cast<uintptr_t>(cursor_) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        if (!cursor_ || aligned + size > reinterpret_cast<uintptr_t>(end_)) {
+            add_block();
+            aligned = (reinterpret_cast<uintptr_t>(cursor_) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        }
+        cursor_ = reinterpret_cast<char *>(aligned + size);
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    // Release everything allocated from this arena
+    void rewind() {
+        if (first_) {
+            if (pool_) {
+                pool_->release(first_, last_);
+            } else {
+                while (first_) {
+                    block_pool::block *next = first_->next;
+                    free(first_);
+                    first_ = next;
+                }
+            }
+            first_ = last_ = nullptr;
+            cursor_ = end_ = nullptr;
+        }
+        while (large_) {
+            block_pool::block *next = large_->next;
+            free(large_);
+            large_ = next;
+        }
+    }
+
+  private:
+    // Keep the block header padding at the strictest fundamental alignment
+    static const size_t HEADER_SIZE = 16;
+    // Anything over this goes straight to the heap so a block is never mostly wasted
+    static const size_t LARGE_THRESHOLD = block_pool::BLOCK_SIZE / 4;
+
+    void add_block() {
+        block_pool::block *b = pool_ ? pool_->acquire() : block_pool::allocate_block();
+        b->next = nullptr;
+        if (last_) {
+            last_->next = b;
+        } else {
+            first_ = b;
+        }
+        last_ = b;
+        cursor_ = reinterpret_cast<char *>(b) + HEADER_SIZE;
+        end_ = reinterpret_cast<char *>(b) + block_pool::BLOCK_SIZE;
+    }
+
+    void *allocate_large(size_t size) {
+        block_pool::block *b = static_cast<block_pool::block *>(malloc(HEADER_SIZE + size));
+        if (!b) {
+            throw std::bad_alloc();
+        }
+        b->next = large_;
+        large_ = b;
+        return reinterpret_cast<char *>(b) + HEADER_SIZE;
+    }
+
+    block_pool *pool_;
+    // Blocks in use, oldest first, allocations come from the tail
+    block_pool::block *first_;
+    block_pool::block *last_;
+    char *cursor_;
+    char *end_;
+    block_pool::block *large_;
+};
+
+// Standard allocator interface over an arena.  deallocate() is a no-op: memory comes back when the arena is rewound,
+//  so containers using this allocator may simply be abandoned and rebuilt in place after a rewind (see
+//  arena_rebuild()), provided their elements need no destruction beyond freeing memory.
+template <typename T> class arena_allocator {
+  public:
+    typedef T value_type;
+
+    // Implicit so containers can be constructed straight from an arena pointer
+    arena_allocator(arena *a) : arena_(a) {}
+    template <typename U> arena_allocator(const arena_allocator<U> &other) : arena_(other.get_arena()) {}
+
+    T *allocate(size_t n) { return static_cast<T *>(arena_->allocate(n * sizeof(T), std::alignment_of<T>::value)); }
+    void deallocate(T *, size_t) {}
+
+    arena *get_arena() const { return arena_; }
+
+  private:
+    arena *arena_;
+};
+
+template <typename T, typename U> bool operator==(const arena_allocator<T> &a, const arena_allocator<U> &b) {
+    return a.get_arena() == b.get_arena();
+}
+template <typename T, typename U> bool operator!=(const arena_allocator<T> &a, const arena_allocator<U> &b) {
+    return a.get_arena() != b.get_arena();
+}
+
+// Replace a container whose memory came from a now rewound arena with an empty one, without touching the old contents
+template <typename C> void arena_rebuild(C &container, arena *a) {
+    new (&container) C(a);
+}
+
+// Allocator for many objects of one type that come and go individually, e.g. the tracking node for each handle a
+//  layer has seen.  Objects are carved out of chunks that double in size up to MAX_CHUNK_SIZE, and destroyed objects
+//  go on a free list that create() takes from first, so once the slab has warmed up, creating and destroying objects
+//  at a steady rate does not touch the heap.  Chunks are only returned to the heap when the slab is destroyed, which
+//  does not run the destructors of objects still alive in it.  Not thread safe, callers serialize access as they do
+//  for whatever container the objects are kept in.
+template <typename T> class slab {
+  public:
+    slab() : chunks_(nullptr), free_list_(nullptr), cursor_(0), end_(0) {}
+    slab(const slab &) = delete;
+    slab &operator=(const slab &) = delete;
+    ~slab() {
+        while (chunks_) {
+            chunk *next = chunks_->next;
+            free(chunks_);
+            chunks_ = next;
+        }
+    }
+
+    template <typename... Args> T *create(Args &&... args) { return new (allocate()) T(std::forward<Args>(args)...); }
+
+    void destroy(T *object) {
+        object->~T();
+        slot *s = reinterpret_cast<slot *>(object);
+        s->next = free_list_;
+        free_list_ = s;
+    }
+
+  private:
+    static const size_t FIRST_CHUNK_SIZE = 64;
+    static const size_t MAX_CHUNK_SIZE = 4096;
+
+    union slot {
+        slot *next;
+        typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type storage;
+    };
+
+    struct chunk {
+        chunk *next;
+        size_t size;
+    };
+
+    // Chunk header rounded up so the slots after it stay aligned
+    static const size_t HEADER_SIZE =
+        (sizeof(chunk) + std::alignment_of<slot>::value - 1) & ~(std::alignment_of<slot>::value - 1);
+
+    slot *slots(chunk *c) { return reinterpret_cast<slot *>(reinterpret_cast<char *>(c) + HEADER_SIZE); }
+
+    void *allocate() {
+        if (free_list_) {
+            slot *s = free_list_;
+            free_list_ = s->next;
+            return s;
+        }
+        if (cursor_ == end_) {
+            size_t size = chunks_ ? chunks_->size * 2 : FIRST_CHUNK_SIZE;
+            if (size > MAX_CHUNK_SIZE) {
+                size = MAX_CHUNK_SIZE;
+            }
+            chunk *c = static_cast<chunk *>(malloc(HEADER_SIZE + size * sizeof(slot)));
+            if (!c) {
+                throw std::bad_alloc();
+            }
+            c->next = chunks_;
+            c->size = size;
+            chunks_ = c;
+            cursor_ = 0;
+            end_ = size;
+        }
+        return &slots(chunks_)[cursor_++];
+    }
+
+    // Newest chunk first, fresh slots are handed out from the newest chunk before it is replaced
+    chunk *chunks_;
+    slot *free_list_;
+    size_t cursor_;
+    size_t end_;
+};
+
+#endif // VK_LAYER_ARENA_H
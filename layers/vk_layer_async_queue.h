@@ -0,0 +1,211 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_ASYNC_QUEUE_H
+#define VK_LAYER_ASYNC_QUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+
+// Queue of variable sized records that a dedicated worker thread hands, in push order, to a replay function.
+//  Records are copied into a ring of fixed size slots.  A push reserves its slot with one atomic increment and
+//  publishes it with one atomic store, so producers never take a lock or wait on each other; they only touch the
+//  queue's mutex to wake a worker that went to sleep on an empty queue, or to wait when the ring is full.  Any number
+//  of threads may push.
+//
+//  Rules for callers:
+//  - Records must be trivially copyable, they are moved around with memcpy and never destroyed.
+//  - The replay function runs on the worker thread and sees a record in place, it must not keep a pointer to it.
+//  - flush() returns once everything pushed before the call has been replayed.  Calling it, or wait(), from the
+//    replay function is a no-op, since the worker cannot wait on itself.
+class async_record_queue {
+  public:
+    typedef void (*replay_function)(void *context, const void *record, size_t size);
+
+    async_record_queue(replay_function replay, void *context, size_t capacity = DEFAULT_CAPACITY)
+        : replay_(replay), context_(context), mask_(slot_count(capacity) - 1), slots_(new slot[mask_ + 1]), head_(0), tail_(0),
+          worker_sleeping_(false), waiters_(0), stopping_(false) {
+        for (uint64_t i = 0; i <= mask_; i++) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        worker_ = std::thread(&async_record_queue::run, this);
+    }
+    async_record_queue(const async_record_queue &) = delete;
+    async_record_queue &operator=(const async_record_queue &) = delete;
+    ~async_record_queue() {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            stopping_ = true;
+        }
+        work_available_.notify_one();
+        worker_.join();
+    }
+
+    // Largest record push() accepts, callers fall back to doing the work themselves for anything bigger
+    size_t max_record_size() const { return MAX_RECORD_SIZE; }
+
+    // Copy size bytes, which write() fills in given a pointer to them, onto the end of the queue.  Returns false
+    //  without calling write() if size is over max_record_size().
+    template <typename W> bool push(size_t size, W &&write) {
+        if (size > max_record_size()) {
+            return false;
+        }
+        // Sequentially consistent, so counts callers keep of their own pushes agree with the order records are replayed in
+        uint64_t position = head_.fetch_add(1);
+        slot &s = slots_[position & mask_];
+        // The slot still holds the record from one lap back until the worker has replayed it.  Once the ring is full,
+        //  wait for the worker to empty half of it rather than waking for every slot it frees.
+        if (s.sequence.load(std::memory_order_acquire) != position) {
+            wait([&] {
+                return s.sequence.load(std::memory_order_acquire) == position &&
+                       tail_.load(std::memory_order_acquire) + (mask_ + 1) / 2 >= position;
+            });
+        }
+        s.size = size;
+        write(s.data);
+        s.sequence.store(position + 1, std::memory_order_release);
+        // The worker only sleeps once it has replayed everything published, so only a push onto an empty queue can
+        //  find it asleep.  Pairs with the fence in sleep().
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (worker_sleeping_.load(std::memory_order_relaxed)) {
+            {
+                std::lock_guard<std::mutex> lock(lock_);
+            }
+            work_available_.notify_one();
+        }
+        return true;
+    }
+
+    void flush() {
+        uint64_t target = head_.load(std::memory_order_acquire);
+        wait([&] { return tail_.load(std::memory_order_acquire) >= target; });
+    }
+
+    // Block until done() returns true.  It is checked again each time the worker finishes a batch of records, so it
+    //  should depend on what the replay function has done.
+    template <typename P> void wait(P &&done) {
+        if (done() || std::this_thread::get_id() == worker_.get_id()) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(lock_);
+        // Pairs with the fence in run()
+        waiters_.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        progress_.wait(lock, done);
+        waiters_.fetch_sub(1);
+    }
+
+  private:
+    static const size_t DEFAULT_CAPACITY = 1024 * 1024;
+    static const size_t SLOT_SIZE = 256;
+    static const size_t MAX_RECORD_SIZE = SLOT_SIZE - 2 * sizeof(uint64_t);
+    // Waiters are woken at least this often while producers keep the worker busy
+    static const uint64_t BATCH_SIZE = 64;
+    // Times the worker yields, once it has caught up, before it goes to sleep
+    static const unsigned IDLE_YIELDS = 16;
+
+    struct slot {
+        // position + 1 once the record for position has been written, position + slot count once it is replayed and
+        //  the slot is free for the next lap
+        std::atomic<uint64_t> sequence;
+        uint64_t size;
+        uint64_t data[MAX_RECORD_SIZE / sizeof(uint64_t)];
+    };
+
+    // Largest power of two number of slots that fits in capacity, and at least two
+    static uint64_t slot_count(size_t capacity) {
+        uint64_t count = 2;
+        while (count * 2 * sizeof(slot) <= capacity) {
+            count *= 2;
+        }
+        return count;
+    }
+
+    bool published(uint64_t position) const {
+        return slots_[position & mask_].sequence.load(std::memory_order_acquire) == position + 1;
+    }
+
+    void run() {
+        uint64_t position = 0;
+        while (true) {
+            uint64_t batch_end = position + BATCH_SIZE;
+            while (position != batch_end && published(position)) {
+                slot &s = slots_[position & mask_];
+                replay_(context_, s.data, static_cast<size_t>(s.size));
+                s.sequence.store(position + mask_ + 1, std::memory_order_release);
+                position++;
+            }
+            tail_.store(position, std::memory_order_release);
+            // Flushes and pushes waiting for a free slot are woken once per batch rather than once per record.  Pairs
+            //  with the fence in wait().
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiters_.load(std::memory_order_relaxed)) {
+                {
+                    std::lock_guard<std::mutex> lock(lock_);
+                }
+                progress_.notify_all();
+            }
+            if (position == batch_end) {
+                continue;
+            }
+            if (!sleep(position)) {
+                return;
+            }
+        }
+    }
+
+    // Wait for the record at position to be published.  Returns false if the queue is being destroyed instead.
+    bool sleep(uint64_t position) {
+        // Recording usually comes in bursts, so give the producers a chance to run before paying for a wakeup
+        for (unsigned i = 0; i < IDLE_YIELDS; i++) {
+            std::this_thread::yield();
+            if (published(position)) {
+                return true;
+            }
+        }
+        std::unique_lock<std::mutex> lock(lock_);
+        worker_sleeping_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        work_available_.wait(lock, [&] { return stopping_ || published(position); });
+        worker_sleeping_.store(false, std::memory_order_relaxed);
+        // Nothing can be pushed once destruction has started, so anything published before it has been replayed
+        return published(position);
+    }
+
+    replay_function replay_;
+    void *context_;
+    uint64_t mask_;
+    std::unique_ptr<slot[]> slots_;
+    // Positions that only ever increase, masked to index slots_: the next one to hand out to a push, and the first one
+    //  the worker has not replayed yet as of its last batch
+    std::atomic<uint64_t> head_;
+    std::atomic<uint64_t> tail_;
+    std::atomic<bool> worker_sleeping_;
+    // Threads blocked in wait()
+    std::atomic<uint32_t> waiters_;
+    bool stopping_;
+    std::mutex lock_;
+    std::condition_variable work_available_;
+    std::condition_variable progress_;
+    std::thread worker_;
+};
+
+#endif // VK_LAYER_ASYNC_QUEUE_H
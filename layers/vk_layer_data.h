@@ -21,6 +21,7 @@
 #define LAYER_DATA_H
 
 #include <unordered_map>
+#include "vk_layer_dispatch_key_map.h"
 #include "vk_layer_table.h"
 
 template <typename DATA_T> DATA_T *get_my_data_ptr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
@@ -40,4 +41,8 @@ template <typename DATA_T> DATA_T *get_my_data_ptr(void *data_key, std::unordere
     return debug_data;
 }
 
+template <typename DATA_T> DATA_T *get_my_data_ptr(void *data_key, dispatch_key_map<DATA_T> &layer_data_map) {
+    return layer_data_map.get_or_create(data_key);
+}
+
 #endif // LAYER_DATA_H
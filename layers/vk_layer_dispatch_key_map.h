@@ -0,0 +1,112 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_DISPATCH_KEY_MAP_H
+#define VK_LAYER_DISPATCH_KEY_MAP_H
+
+#include <atomic>
+#include <mutex>
+#include <stddef.h>
+#include <utility>
+
+#include "vk_layer_read_mostly_map.h"
+
+// Map from a dispatch key to what a layer keeps per instance or device, e.g. its layer_data or dispatch table, which
+//  every entry point looks up.  The first few keys added also sit in a small array of slots that get() scans before
+//  anything else, so in the usual process with an instance and a device or two a lookup is a couple of pointer
+//  compares, with no hashing and no lock.  Keys past those are found in the lock-free index of a read_mostly_map.
+//  Entries only come and go when instances and devices do; those calls serialize on the map's own lock.
+//
+//  Rules for callers:
+//  - The map stores pointers and never deletes them, callers free what they erase as before.
+//  - Erasing an entry while another thread is still calling into its instance or device is the application's error.
+template <typename T> class dispatch_key_map {
+  public:
+    dispatch_key_map() {
+        for (size_t i = 0; i < HOT_SLOTS; i++) {
+            hot_keys_[i].store(nullptr, std::memory_order_relaxed);
+            hot_values_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    dispatch_key_map(const dispatch_key_map &) = delete;
+    dispatch_key_map &operator=(const dispatch_key_map &) = delete;
+
+    // Returns the entry for key, or nullptr if there is none
+    T *get(void *key) const {
+        for (size_t i = 0; i < HOT_SLOTS; i++) {
+            if (hot_keys_[i].load(std::memory_order_acquire) == key) {
+                return hot_values_[i].load(std::memory_order_relaxed);
+            }
+        }
+        T *const *entry = map_.get(key);
+        return entry ? *entry : nullptr;
+    }
+
+    // Returns the entry for key, adding a new T for it first if there is none.  created, if given, says which happened.
+    T *get_or_create(void *key, bool *created = nullptr) {
+        if (created) {
+            *created = false;
+        }
+        T *value = get(key);
+        if (value) {
+            return value;
+        }
+        std::lock_guard<std::mutex> lock(write_lock_);
+        // Another thread may have added it since
+        T *const *entry = map_.get(key);
+        if (entry) {
+            return *entry;
+        }
+        value = new T;
+        map_.insert(std::make_pair(key, value));
+        for (size_t i = 0; i < HOT_SLOTS; i++) {
+            if (!hot_keys_[i].load(std::memory_order_relaxed)) {
+                // The value goes in first, a reader that sees the key sees it too
+                hot_values_[i].store(value, std::memory_order_relaxed);
+                hot_keys_[i].store(key, std::memory_order_release);
+                break;
+            }
+        }
+        if (created) {
+            *created = true;
+        }
+        return value;
+    }
+
+    size_t erase(void *key) {
+        std::lock_guard<std::mutex> lock(write_lock_);
+        for (size_t i = 0; i < HOT_SLOTS; i++) {
+            if (hot_keys_[i].load(std::memory_order_relaxed) == key) {
+                hot_keys_[i].store(nullptr, std::memory_order_release);
+                hot_values_[i].store(nullptr, std::memory_order_relaxed);
+                break;
+            }
+        }
+        return map_.erase(key);
+    }
+
+  private:
+    static const size_t HOT_SLOTS = 4;
+
+    // A slot is free while its key is nullptr, which get() is never asked for
+    std::atomic<void *> hot_keys_[HOT_SLOTS];
+    std::atomic<T *> hot_values_[HOT_SLOTS];
+    read_mostly_map<void *, T *> map_;
+    std::mutex write_lock_;
+};
+
+#endif // VK_LAYER_DISPATCH_KEY_MAP_H
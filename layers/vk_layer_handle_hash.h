@@ -0,0 +1,39 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_HANDLE_HASH_H
+#define VK_LAYER_HANDLE_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Dispatchable handles are pointers everywhere, non-dispatchable ones are pointers on 64-bit and uint64_t on 32-bit
+template <typename P> inline uint64_t handle_bits(P *handle) { return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle)); }
+inline uint64_t handle_bits(uint64_t handle) { return handle; }
+
+// Handles are mostly aligned pointers that differ in a few middle bits, so mix every bit into the low ones before they
+//  are masked down to index a power-of-two table
+inline size_t hash_handle_bits(uint64_t bits) {
+    bits ^= bits >> 33;
+    bits *= 0xff51afd7ed558ccdULL;
+    bits ^= bits >> 33;
+    return static_cast<size_t>(bits);
+}
+
+template <typename H> inline size_t hash_handle(H handle) { return hash_handle_bits(handle_bits(handle)); }
+
+#endif // VK_LAYER_HANDLE_HASH_H
@@ -0,0 +1,185 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_HANDLE_TABLE_H
+#define VK_LAYER_HANDLE_TABLE_H
+
+#include <assert.h>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Table of handles a layer gives out in place of the ones the driver returned, as unique_objects does.
+//  A wrapped handle is the slot's index + 1 in the low 32 bits and the slot's generation in the high 32 bits, so it is
+//  never 0, and unwrap() is a couple of loads from the slot with no lock.  erase() bumps the slot's generation, so a
+//  handle that was erased, or never given out, unwraps to 0 even after its slot has been reused.
+//  wrap() and erase() take slots from and return them to a lock-free free list.  Slots live in chunks that double in
+//  size as the table grows and are only freed with the table, so a reader can always look at any slot it can index.
+//
+//  Rules for callers:
+//  - All methods may be called from any thread without a lock.
+//  - Erasing a handle while another thread is still using it is the application's error, as it is for the driver's
+//    handle; such a call gets either the old handle or 0.
+class handle_table {
+  public:
+    handle_table() : next_index_(0), free_head_(0) {
+        for (size_t i = 0; i < MAX_CHUNKS; i++) {
+            chunks_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+    ~handle_table() {
+        for (size_t i = 0; i < MAX_CHUNKS; i++) {
+            delete[] chunks_[i].load(std::memory_order_relaxed);
+        }
+    }
+    handle_table(const handle_table &) = delete;
+    handle_table &operator=(const handle_table &) = delete;
+
+    // Returns a new wrapped handle for handle
+    uint64_t wrap(uint64_t handle) {
+        uint32_t index;
+        if (!pop_free(&index)) {
+            index = next_index_.fetch_add(1, std::memory_order_relaxed);
+            assert(index != UINT32_MAX);
+            allocate_chunk(index);
+        }
+        slot *s = find_slot(index);
+        uint32_t generation = s->generation.load(std::memory_order_relaxed);
+        s->handle.store(handle, std::memory_order_release);
+        return (static_cast<uint64_t>(generation) << 32) | (static_cast<uint64_t>(index) + 1);
+    }
+
+    // Returns the handle wrapped is standing in for, or 0 if wrapped is 0, erased or unknown
+    uint64_t unwrap(uint64_t wrapped) const {
+        uint32_t index_bits = static_cast<uint32_t>(wrapped);
+        if (!index_bits) {
+            return 0;
+        }
+        const slot *s = find_slot(index_bits - 1);
+        if (!s) {
+            return 0;
+        }
+        // A handle read here is only stale if the slot was erased, and then the generation no longer matches
+        uint64_t handle = s->handle.load(std::memory_order_acquire);
+        if (s->generation.load(std::memory_order_acquire) != static_cast<uint32_t>(wrapped >> 32)) {
+            return 0;
+        }
+        return handle;
+    }
+
+    // Forgets wrapped and returns the handle it stood in for, or 0 as unwrap() would
+    uint64_t erase(uint64_t wrapped) {
+        uint32_t index_bits = static_cast<uint32_t>(wrapped);
+        if (!index_bits) {
+            return 0;
+        }
+        slot *s = find_slot(index_bits - 1);
+        if (!s) {
+            return 0;
+        }
+        uint32_t generation = static_cast<uint32_t>(wrapped >> 32);
+        if (!s->generation.compare_exchange_strong(generation, generation + 1, std::memory_order_acq_rel)) {
+            return 0;
+        }
+        uint64_t handle = s->handle.exchange(0, std::memory_order_acq_rel);
+        push_free(index_bits - 1);
+        return handle;
+    }
+
+  private:
+    // Chunk k holds FIRST_CHUNK_SIZE << k slots, enough chunks to cover every 32-bit index
+    static const unsigned FIRST_CHUNK_BITS = 8;
+    static const size_t FIRST_CHUNK_SIZE = size_t(1) << FIRST_CHUNK_BITS;
+    static const size_t MAX_CHUNKS = 33 - FIRST_CHUNK_BITS;
+
+    struct slot {
+        slot() : handle(0), generation(0), next_free(0) {}
+        std::atomic<uint64_t> handle;
+        std::atomic<uint32_t> generation;
+        // Index + 1 of the next free slot while this one is on the free list, 0 at the end of the list
+        std::atomic<uint32_t> next_free;
+    };
+
+    static unsigned top_bit(uint64_t bits) {
+#if defined(__GNUC__)
+        return 63 - __builtin_clzll(bits);
+#else
+        unsigned bit = 0;
+        while (bits >>= 1) {
+            bit++;
+        }
+        return bit;
+#endif
+    }
+
+    static size_t chunk_of(uint32_t index) { return top_bit(static_cast<uint64_t>(index) + FIRST_CHUNK_SIZE) - FIRST_CHUNK_BITS; }
+
+    slot *find_slot(uint32_t index) const {
+        uint64_t position = static_cast<uint64_t>(index) + FIRST_CHUNK_SIZE;
+        size_t chunk = top_bit(position) - FIRST_CHUNK_BITS;
+        slot *slots = chunks_[chunk].load(std::memory_order_acquire);
+        if (!slots) {
+            return nullptr;
+        }
+        return &slots[position - (uint64_t(1) << (chunk + FIRST_CHUNK_BITS))];
+    }
+
+    void allocate_chunk(uint32_t index) {
+        size_t chunk = chunk_of(index);
+        if (chunks_[chunk].load(std::memory_order_acquire)) {
+            return;
+        }
+        slot *slots = new slot[FIRST_CHUNK_SIZE << chunk];
+        slot *expected = nullptr;
+        if (!chunks_[chunk].compare_exchange_strong(expected, slots, std::memory_order_acq_rel)) {
+            // Another thread got there first
+            delete[] slots;
+        }
+    }
+
+    // The free list head is the index + 1 of the first free slot in the low 32 bits and a count of changes to the
+    //  list in the high 32 bits, so a pop racing with a pop and push of the same slot fails its compare-exchange
+    bool pop_free(uint32_t *index) {
+        uint64_t head = free_head_.load(std::memory_order_acquire);
+        while (static_cast<uint32_t>(head)) {
+            uint32_t first = static_cast<uint32_t>(head) - 1;
+            uint32_t next = find_slot(first)->next_free.load(std::memory_order_relaxed);
+            uint64_t new_head = (((head >> 32) + 1) << 32) | next;
+            if (free_head_.compare_exchange_weak(head, new_head, std::memory_order_acquire, std::memory_order_acquire)) {
+                *index = first;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void push_free(uint32_t index) {
+        slot *s = find_slot(index);
+        uint64_t head = free_head_.load(std::memory_order_relaxed);
+        uint64_t new_head;
+        do {
+            s->next_free.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            new_head = (((head >> 32) + 1) << 32) | (static_cast<uint64_t>(index) + 1);
+        } while (!free_head_.compare_exchange_weak(head, new_head, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    std::atomic<uint32_t> next_index_;
+    std::atomic<uint64_t> free_head_;
+    std::atomic<slot *> chunks_[MAX_CHUNKS];
+};
+
+#endif // VK_LAYER_HANDLE_TABLE_H
@@ -29,17 +29,64 @@
 #include "vk_loader_platform.h"
 #include "vulkan/vk_layer.h"
 #include <cinttypes>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <unordered_map>
 #include <vector>
 
+// A message is counted against its limit per layer prefix, message code and object
+struct debug_message_key {
+    const char *layer_prefix;
+    int32_t msg_code;
+    uint64_t object;
+    bool operator==(const debug_message_key &other) const {
+        return msg_code == other.msg_code && object == other.object && layer_prefix == other.layer_prefix;
+    }
+};
+
+struct debug_message_key_hash {
+    size_t operator()(const debug_message_key &key) const {
+        size_t hash = std::hash<uint64_t>()(key.object);
+        hash ^= std::hash<int32_t>()(key.msg_code) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<const char *>()(key.layer_prefix) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+struct debug_message_count {
+    VkFlags msg_flags;
+    VkDebugReportObjectTypeEXT object_type;
+    uint32_t limit;
+    uint64_t count;
+    // What the callbacks returned when the message was last reported, given back for the suppressed ones
+    bool bail;
+};
+
+// Limits set from <layer>.message_limit and <layer>.message_limits in vk_layer_settings.txt, and how often each message
+//  was logged since the last flush, so repeats past the limit are dropped before formatting.  A limit of UINT32_MAX means
+//  none.
+struct debug_message_limits {
+    uint32_t default_limit;
+    std::unordered_map<int32_t, uint32_t> code_limits;
+
+    std::mutex count_lock;
+    std::unordered_map<debug_message_key, debug_message_count, debug_message_key_hash> counts;
+};
+
 typedef struct _debug_report_data {
     VkLayerDbgFunctionNode *debug_callback_list;
     VkLayerDbgFunctionNode *default_debug_callback_list;
     VkFlags active_flags;
     bool g_DEBUG_REPORT;
+
+    // Set before any message is logged, null when there are no limits and log_msg costs what it did without them.  Shared
+    //  with copies of this record, such as the ones capturing messages for replay, so a message counts once against its
+    //  limit whichever copy logged it.
+    std::shared_ptr<debug_message_limits> message_limits;
 } debug_report_data;
 
 template debug_report_data *get_my_data_ptr<debug_report_data>(void *data_key,
@@ -133,11 +180,7 @@ static inline debug_report_data *
 debug_report_create_instance(VkLayerInstanceDispatchTable *table, VkInstance inst, uint32_t extension_count,
                              const char *const *ppEnabledExtensions) // layer or extension name to be enabled
 {
-    debug_report_data *debug_data = (debug_report_data *)malloc(sizeof(debug_report_data));
-    if (!debug_data)
-        return NULL;
-
-    memset(debug_data, 0, sizeof(debug_report_data));
+    debug_report_data *debug_data = new debug_report_data();
     for (uint32_t i = 0; i < extension_count; i++) {
         // TODO: Check other property fields
         if (strcmp(ppEnabledExtensions[i], VK_EXT_DEBUG_REPORT_EXTENSION_NAME) == 0) {
@@ -147,11 +190,35 @@ debug_report_create_instance(VkLayerInstanceDispatchTable *table, VkInstance ins
     return debug_data;
 }
 
+// Reports how many times each message over its limit was suppressed since the last flush, and starts the counts over
+static inline void layer_debug_report_flush_suppressed(debug_report_data *debug_data) {
+    if (!debug_data || !debug_data->message_limits) {
+        return;
+    }
+    std::unordered_map<debug_message_key, debug_message_count, debug_message_key_hash> counts;
+    {
+        std::lock_guard<std::mutex> lock(debug_data->message_limits->count_lock);
+        counts.swap(debug_data->message_limits->counts);
+    }
+    for (auto &message : counts) {
+        const debug_message_count &count = message.second;
+        if (count.count <= count.limit || !(debug_data->active_flags & count.msg_flags)) {
+            continue;
+        }
+        char summary[128];
+        snprintf(summary, sizeof(summary), "Suppressed %" PRIu64 " occurrences of message code %d past its limit of %u",
+                 count.count - count.limit, message.first.msg_code, count.limit);
+        debug_report_log_msg(debug_data, count.msg_flags, count.object_type, message.first.object, 0, message.first.msg_code,
+                             message.first.layer_prefix, summary);
+    }
+}
+
 static inline void layer_debug_report_destroy_instance(debug_report_data *debug_data) {
     if (debug_data) {
+        layer_debug_report_flush_suppressed(debug_data);
         RemoveAllMessageCallbacks(debug_data, &debug_data->default_debug_callback_list);
         RemoveAllMessageCallbacks(debug_data, &debug_data->debug_callback_list);
-        free(debug_data);
+        delete debug_data;
     }
 }
 
@@ -161,8 +228,22 @@ static inline debug_report_data *layer_debug_report_create_device(debug_report_d
     return instance_debug_data;
 }
 
-static inline void layer_debug_report_destroy_device(VkDevice device) {
-    // Nothing to do since we're using instance data record
+static inline void layer_debug_report_destroy_device(debug_report_data *debug_data, VkDevice device) {
+    // The instance data record is shared, only the suppressed message summary is due now
+    layer_debug_report_flush_suppressed(debug_data);
+}
+
+// Sets how many times log_msg reports each message before dropping it, UINT32_MAX for no limit.  code_limits overrides
+// default_limit for the message codes it lists.
+static inline void layer_debug_report_set_message_limits(debug_report_data *debug_data, uint32_t default_limit,
+                                                        const std::unordered_map<int32_t, uint32_t> &code_limits) {
+    if (default_limit == UINT32_MAX && code_limits.empty()) {
+        debug_data->message_limits.reset();
+        return;
+    }
+    debug_data->message_limits = std::make_shared<debug_message_limits>();
+    debug_data->message_limits->default_limit = default_limit;
+    debug_data->message_limits->code_limits = code_limits;
 }
 
 static inline void layer_destroy_msg_callback(debug_report_data *debug_data, VkDebugReportCallbackEXT callback,
@@ -341,6 +422,28 @@ static inline bool log_msg(const debug_report_data *debug_data, VkFlags msgFlags
         return false;
     }
 
+    debug_message_key key = {pLayerPrefix, msgCode, srcObject};
+    bool counted = false;
+    debug_message_limits *limits = debug_data->message_limits.get();
+    if (limits) {
+        auto code_limit = limits->code_limits.find(msgCode);
+        uint32_t limit = (code_limit != limits->code_limits.end()) ? code_limit->second : limits->default_limit;
+        if (limit != UINT32_MAX) {
+            std::lock_guard<std::mutex> lock(limits->count_lock);
+            auto found = limits->counts.find(key);
+            if (found == limits->counts.end()) {
+                debug_message_count first = {msgFlags, objectType, limit, 0, false};
+                found = limits->counts.insert(std::make_pair(key, first)).first;
+            }
+            debug_message_count &count = found->second;
+            if (count.count++ >= limit) {
+                // Counted for the summary, but neither formatted nor reported
+                return count.bail;
+            }
+            counted = true;
+        }
+    }
+
     va_list argptr;
     va_start(argptr, format);
     char *str;
@@ -352,6 +455,13 @@ static inline bool log_msg(const debug_report_data *debug_data, VkFlags msgFlags
     bool result = debug_report_log_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix,
                                        str ? str : "Allocation failure");
     free(str);
+    if (result && counted) {
+        std::lock_guard<std::mutex> lock(limits->count_lock);
+        auto count = limits->counts.find(key);
+        if (count != limits->counts.end()) {
+            count->second.bail = true;
+        }
+    }
     return result;
 }
 
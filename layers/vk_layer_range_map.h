@@ -0,0 +1,135 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_RANGE_MAP_H
+#define VK_LAYER_RANGE_MAP_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <utility>
+
+// Map from uint32_t indices to values, stored as runs of consecutive indices sharing a value.  Setting a range costs
+//  O(log n) in the number of runs however many indices it covers, and adjacent runs with equal values are merged, so
+//  state that is mostly updated in large uniform blocks stays small.  Indices that were never set have no value.
+//  T must be copyable and equality comparable.
+template <typename T, typename Allocator = std::allocator<T>> class range_map {
+  public:
+    explicit range_map(const Allocator &alloc = Allocator()) : runs_(std::less<uint32_t>(), run_allocator(alloc)) {}
+
+    // Value at index, or nullptr if it was never set
+    const T *find(uint32_t index) const {
+        auto it = runs_.upper_bound(index);
+        if (it == runs_.begin()) {
+            return nullptr;
+        }
+        --it;
+        return (index < it->second.end) ? &it->second.value : nullptr;
+    }
+
+    // Set every index in [begin, end) to value
+    void set(uint32_t begin, uint32_t end, const T &value) {
+        if (begin >= end) {
+            return;
+        }
+        split(begin);
+        split(end);
+        auto first = runs_.lower_bound(begin);
+        auto last = runs_.lower_bound(end);
+        runs_.erase(first, last);
+        // Merge with neighbours holding the same value
+        auto next = runs_.find(end);
+        if (next != runs_.end() && next->second.value == value) {
+            end = next->second.end;
+            runs_.erase(next);
+        }
+        auto prev = runs_.lower_bound(begin);
+        if (prev != runs_.begin()) {
+            --prev;
+            if (prev->second.end == begin && prev->second.value == value) {
+                prev->second.end = end;
+                return;
+            }
+        }
+        runs_.insert(prev, std::make_pair(begin, run{end, value}));
+    }
+
+    // Call f(begin, end, value) for each piece of [begin, end) over which the value does not change, in index order.
+    //  value is nullptr over indices that were never set.
+    template <typename F> void for_each(uint32_t begin, uint32_t end, F &&f) const {
+        auto it = runs_.upper_bound(begin);
+        if (it != runs_.begin()) {
+            auto prev = std::prev(it);
+            if (prev->second.end > begin) {
+                it = prev;
+            }
+        }
+        uint32_t pos = begin;
+        for (; pos < end && it != runs_.end(); ++it) {
+            if (it->first >= end) {
+                break;
+            }
+            if (it->first > pos) {
+                f(pos, it->first, static_cast<const T *>(nullptr));
+                pos = it->first;
+            }
+            uint32_t run_end = (it->second.end < end) ? it->second.end : end;
+            f(pos, run_end, &it->second.value);
+            pos = run_end;
+        }
+        if (pos < end) {
+            f(pos, end, static_cast<const T *>(nullptr));
+        }
+    }
+
+    // Call f(begin, end, value) for every run that has been set, in index order
+    template <typename F> void for_each(F &&f) const {
+        for (auto &entry : runs_) {
+            f(entry.first, entry.second.end, &entry.second.value);
+        }
+    }
+
+    bool empty() const { return runs_.empty(); }
+    size_t run_count() const { return runs_.size(); }
+
+  private:
+    struct run {
+        uint32_t end;
+        T value;
+    };
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const uint32_t, run>> run_allocator;
+
+    // Make index the start of a run if it falls inside one
+    void split(uint32_t index) {
+        auto it = runs_.upper_bound(index);
+        if (it == runs_.begin()) {
+            return;
+        }
+        --it;
+        if (it->first < index && index < it->second.end) {
+            run tail = {it->second.end, it->second.value};
+            it->second.end = index;
+            runs_.insert(std::next(it), std::make_pair(index, tail));
+        }
+    }
+
+    // Keyed by the first index of each run
+    std::map<uint32_t, run, std::less<uint32_t>, run_allocator> runs_;
+};
+
+#endif // VK_LAYER_RANGE_MAP_H
@@ -0,0 +1,209 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_READ_MOSTLY_MAP_H
+#define VK_LAYER_READ_MOSTLY_MAP_H
+
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "vk_layer_handle_hash.h"
+
+// Handle-keyed map for layer state that is looked up on every call but only inserted or erased at create/destroy time.
+//  Entries are owned by a std::unordered_map, which writers use exactly as before (operator[], insert, erase, iteration).
+//  Every entry is also published into a flat open-addressing index of atomic slots, and get() probes only that index,
+//  so lookups take no lock and never wait on a writer.
+//
+//  Rules for callers:
+//  - Writers (anything other than get()) must be serialized externally.
+//  - get() only protects the index itself; keeping the returned entry alive is up to the caller.
+//  - When the index grows it is replaced, and the old one is kept around for readers that may still be walking it.
+//    reclaim() frees those, so only call it when no get() can be in flight.
+//  - VK_NULL_HANDLE keys may be stored but are never returned by get().
+template <typename Key, typename T> class read_mostly_map {
+  public:
+    typedef typename std::unordered_map<Key, T>::iterator iterator;
+    typedef typename std::unordered_map<Key, T>::const_iterator const_iterator;
+
+    read_mostly_map() : table_(nullptr), used_(0) {}
+    read_mostly_map(const read_mostly_map &) = delete;
+    read_mostly_map &operator=(const read_mostly_map &) = delete;
+
+    // Lock-free lookup, returns nullptr if key is not present
+    T *get(Key key) const {
+        uint64_t bits = handle_bits(key);
+        const index_table *table = table_.load(std::memory_order_acquire);
+        if (!table || !bits) {
+            return nullptr;
+        }
+        for (size_t i = hash_handle_bits(bits) & table->mask;; i = (i + 1) & table->mask) {
+            uint64_t slot_key = table->slots[i].key.load(std::memory_order_acquire);
+            if (slot_key == bits) {
+                return table->slots[i].value.load(std::memory_order_acquire);
+            }
+            if (slot_key == 0) {
+                return nullptr;
+            }
+        }
+    }
+
+    T &operator[](const Key &key) {
+        auto result = map_.emplace(key, T());
+        if (result.second) {
+            publish(key, &result.first->second);
+        }
+        return result.first->second;
+    }
+
+    template <typename P> std::pair<iterator, bool> insert(P &&value) {
+        auto result = map_.insert(std::forward<P>(value));
+        if (result.second) {
+            publish(result.first->first, &result.first->second);
+        }
+        return result;
+    }
+
+    size_t erase(const Key &key) {
+        auto it = map_.find(key);
+        if (it == map_.end()) {
+            return 0;
+        }
+        unpublish(key);
+        map_.erase(it);
+        return 1;
+    }
+
+    void clear() {
+        map_.clear();
+        if (current_) {
+            table_.store(nullptr, std::memory_order_release);
+            retired_.push_back(std::move(current_));
+        }
+        used_ = 0;
+    }
+
+    // Free index tables replaced by a rehash or clear()
+    void reclaim() { retired_.clear(); }
+
+    size_t size() const { return map_.size(); }
+    bool empty() const { return map_.empty(); }
+    size_t count(const Key &key) const { return map_.count(key); }
+
+    iterator begin() { return map_.begin(); }
+    iterator end() { return map_.end(); }
+    const_iterator begin() const { return map_.begin(); }
+    const_iterator end() const { return map_.end(); }
+
+  private:
+    struct slot {
+        slot() : key(0), value(nullptr) {}
+        // Once set, a slot's key never changes for the life of the table; erase only clears the value
+        std::atomic<uint64_t> key;
+        std::atomic<T *> value;
+    };
+
+    struct index_table {
+        explicit index_table(size_t capacity) : mask(capacity - 1), slots(new slot[capacity]) {}
+        size_t mask;
+        std::unique_ptr<slot[]> slots;
+    };
+
+    void publish(const Key &key, T *value) {
+        uint64_t bits = handle_bits(key);
+        if (!bits) {
+            return;
+        }
+        // Keep the index at most 3/4 full, counting erased slots, so every probe sequence ends at an empty slot
+        if (!current_ || (used_ + 1) * 4 > (current_->mask + 1) * 3) {
+            rehash();
+        }
+        for (size_t i = hash_handle_bits(bits) & current_->mask;; i = (i + 1) & current_->mask) {
+            slot &s = current_->slots[i];
+            uint64_t slot_key = s.key.load(std::memory_order_relaxed);
+            if (slot_key == bits) {
+                s.value.store(value, std::memory_order_release);
+                return;
+            }
+            if (slot_key == 0) {
+                s.value.store(value, std::memory_order_relaxed);
+                s.key.store(bits, std::memory_order_release);
+                used_++;
+                return;
+            }
+        }
+    }
+
+    void unpublish(const Key &key) {
+        uint64_t bits = handle_bits(key);
+        if (!bits || !current_) {
+            return;
+        }
+        for (size_t i = hash_handle_bits(bits) & current_->mask;; i = (i + 1) & current_->mask) {
+            slot &s = current_->slots[i];
+            uint64_t slot_key = s.key.load(std::memory_order_relaxed);
+            if (slot_key == bits) {
+                s.value.store(nullptr, std::memory_order_release);
+                return;
+            }
+            if (slot_key == 0) {
+                return;
+            }
+        }
+    }
+
+    // Build a fresh index from map_, dropping erased slots and leaving it at most half full
+    void rehash() {
+        size_t capacity = 16;
+        while (capacity < map_.size() * 2) {
+            capacity *= 2;
+        }
+        std::unique_ptr<index_table> table(new index_table(capacity));
+        used_ = 0;
+        for (auto &entry : map_) {
+            uint64_t bits = handle_bits(entry.first);
+            if (!bits) {
+                continue;
+            }
+            size_t i = hash_handle_bits(bits) & table->mask;
+            while (table->slots[i].key.load(std::memory_order_relaxed) != 0) {
+                i = (i + 1) & table->mask;
+            }
+            table->slots[i].value.store(&entry.second, std::memory_order_relaxed);
+            table->slots[i].key.store(bits, std::memory_order_relaxed);
+            used_++;
+        }
+        table_.store(table.get(), std::memory_order_release);
+        if (current_) {
+            retired_.push_back(std::move(current_));
+        }
+        current_ = std::move(table);
+    }
+
+    std::unordered_map<Key, T> map_;
+    // What get() reads, mirrors current_
+    std::atomic<index_table *> table_;
+    std::unique_ptr<index_table> current_;
+    std::vector<std::unique_ptr<index_table>> retired_;
+    // Occupied slots in current_, including erased ones
+    size_t used_;
+};
+
+#endif // VK_LAYER_READ_MOSTLY_MAP_H
@@ -0,0 +1,133 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_RWLOCK_H
+#define VK_LAYER_RWLOCK_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+
+// Reader/writer lock for layer state that is read on every call but only restructured occasionally.
+//  Writers use the BasicLockable interface (lock/unlock) so std::unique_lock and std::lock_guard work as
+//  they did with a plain std::mutex.  Readers use lock_shared/unlock_shared, normally via read_lock_guard.
+//  An uncontended read acquisition is a single compare-and-swap; readers and writers only block on the
+//  internal mutex when the other side actually holds the lock.  Pending writers block new readers so a
+//  steady stream of readers cannot starve them.
+class rw_lock {
+  public:
+    rw_lock() : state_(0) {}
+    rw_lock(const rw_lock &) = delete;
+    rw_lock &operator=(const rw_lock &) = delete;
+
+    void lock() {
+        writer_mutex_.lock();
+        uint32_t prev = state_.fetch_or(WRITER_PENDING);
+        if (prev & READER_MASK) {
+            std::unique_lock<std::mutex> lock(wait_mutex_);
+            wait_condition_.wait(lock, [this] { return (state_.load() & READER_MASK) == 0; });
+        }
+        state_.store(WRITER_PENDING | WRITER_ACTIVE);
+    }
+
+    bool try_lock() {
+        if (!writer_mutex_.try_lock()) {
+            return false;
+        }
+        uint32_t expected = 0;
+        if (!state_.compare_exchange_strong(expected, WRITER_PENDING | WRITER_ACTIVE)) {
+            writer_mutex_.unlock();
+            return false;
+        }
+        return true;
+    }
+
+    void unlock() {
+        {
+            std::lock_guard<std::mutex> lock(wait_mutex_);
+            state_.store(0);
+        }
+        wait_condition_.notify_all();
+        writer_mutex_.unlock();
+    }
+
+    void lock_shared() {
+        uint32_t prev = state_.load();
+        while (true) {
+            if ((prev & WRITER_PENDING) == 0) {
+                if (state_.compare_exchange_weak(prev, prev + 1)) {
+                    return;
+                }
+            } else {
+                std::unique_lock<std::mutex> lock(wait_mutex_);
+                wait_condition_.wait(lock, [this] { return (state_.load() & WRITER_PENDING) == 0; });
+                prev = state_.load();
+            }
+        }
+    }
+
+    void unlock_shared() {
+        uint32_t prev = state_.fetch_sub(1);
+        if ((prev & WRITER_PENDING) && ((prev & READER_MASK) == 1)) {
+            // Last reader out while a writer is waiting for us to drain
+            std::lock_guard<std::mutex> lock(wait_mutex_);
+            wait_condition_.notify_all();
+        }
+    }
+
+  private:
+    static const uint32_t WRITER_ACTIVE = 0x80000000;
+    static const uint32_t WRITER_PENDING = 0x40000000;
+    static const uint32_t READER_MASK = 0x3FFFFFFF;
+
+    // Low bits count active readers, high bits flag a waiting or active writer
+    std::atomic<uint32_t> state_;
+    // Serializes writers against each other
+    std::mutex writer_mutex_;
+    // Only used to park threads that have to wait on the other side
+    std::mutex wait_mutex_;
+    std::condition_variable wait_condition_;
+};
+
+// Scoped shared hold on an rw_lock, the read-side equivalent of std::unique_lock
+class read_lock_guard {
+  public:
+    explicit read_lock_guard(rw_lock &lock) : lock_(&lock), owns_(true) { lock_->lock_shared(); }
+    read_lock_guard(const read_lock_guard &) = delete;
+    read_lock_guard &operator=(const read_lock_guard &) = delete;
+    ~read_lock_guard() {
+        if (owns_) {
+            lock_->unlock_shared();
+        }
+    }
+
+    void lock() {
+        lock_->lock_shared();
+        owns_ = true;
+    }
+    void unlock() {
+        lock_->unlock_shared();
+        owns_ = false;
+    }
+
+  private:
+    rw_lock *lock_;
+    bool owns_;
+};
+
+#endif // VK_LAYER_RWLOCK_H
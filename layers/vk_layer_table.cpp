@@ -30,34 +30,34 @@ static instance_table_map tableInstanceMap;
 // Map lookup must be thread safe
 VkLayerDispatchTable *device_dispatch_table(void *object) {
     dispatch_key key = get_dispatch_key(object);
-    device_table_map::const_iterator it = tableMap.find((void *)key);
-    assert(it != tableMap.end() && "Not able to find device dispatch entry");
-    return it->second;
+    VkLayerDispatchTable *pTable = tableMap.get((void *)key);
+    assert(pTable && "Not able to find device dispatch entry");
+    return pTable;
 }
 
 VkLayerInstanceDispatchTable *instance_dispatch_table(void *object) {
     dispatch_key key = get_dispatch_key(object);
-    instance_table_map::const_iterator it = tableInstanceMap.find((void *)key);
+    VkLayerInstanceDispatchTable *pTable = tableInstanceMap.get((void *)key);
 #if DISPATCH_MAP_DEBUG
-    if (it != tableInstanceMap.end()) {
+    if (pTable) {
         fprintf(stderr, "instance_dispatch_table: map:  0x%p, object:  0x%p, key:  0x%p, table:  0x%p\n", &tableInstanceMap, object, key,
-                it->second);
+                pTable);
     } else {
         fprintf(stderr, "instance_dispatch_table: map:  0x%p, object:  0x%p, key:  0x%p, table: UNKNOWN\n", &tableInstanceMap, object, key);
     }
 #endif
-    assert(it != tableInstanceMap.end() && "Not able to find instance dispatch entry");
-    return it->second;
+    assert(pTable && "Not able to find instance dispatch entry");
+    return pTable;
 }
 
 void destroy_dispatch_table(device_table_map &map, dispatch_key key) {
 #if DISPATCH_MAP_DEBUG
-    device_table_map::const_iterator it = map.find((void *)key);
-    if (it != map.end()) {
-        fprintf(stderr, "destroy device dispatch_table: map:  0x%p, key:  0x%p, table:  0x%p\n", &map, key, it->second);
+    void *pTable = map.get((void *)key);
+    if (pTable) {
+        fprintf(stderr, "destroy device dispatch_table: map:  0x%p, key:  0x%p, table:  0x%p\n", &map, key, pTable);
     } else {
         fprintf(stderr, "destroy device dispatch table: map:  0x%p, key:  0x%p, table: UNKNOWN\n", &map, key);
-        assert(it != map.end());
+        assert(pTable);
     }
 #endif
     map.erase(key);
@@ -65,12 +65,12 @@ void destroy_dispatch_table(device_table_map &map, dispatch_key key) {
 
 void destroy_dispatch_table(instance_table_map &map, dispatch_key key) {
 #if DISPATCH_MAP_DEBUG
-    instance_table_map::const_iterator it = map.find((void *)key);
-    if (it != map.end()) {
-        fprintf(stderr, "destroy instance dispatch_table: map:  0x%p, key:  0x%p, table:  0x%p\n", &map, key, it->second);
+    void *pTable = map.get((void *)key);
+    if (pTable) {
+        fprintf(stderr, "destroy instance dispatch_table: map:  0x%p, key:  0x%p, table:  0x%p\n", &map, key, pTable);
     } else {
         fprintf(stderr, "destroy instance dispatch table: map:  0x%p, key:  0x%p, table: UNKNOWN\n", &map, key);
-        assert(it != map.end());
+        assert(pTable);
     }
 #endif
     map.erase(key);
@@ -82,33 +82,33 @@ void destroy_instance_dispatch_table(dispatch_key key) { destroy_dispatch_table(
 
 VkLayerDispatchTable *get_dispatch_table(device_table_map &map, void *object) {
     dispatch_key key = get_dispatch_key(object);
-    device_table_map::const_iterator it = map.find((void *)key);
+    VkLayerDispatchTable *pTable = map.get((void *)key);
 #if DISPATCH_MAP_DEBUG
-    if (it != map.end()) {
+    if (pTable) {
         fprintf(stderr, "device_dispatch_table: map:  0x%p, object:  0x%p, key:  0x%p, table:  0x%p\n", &tableInstanceMap, object, key,
-                it->second);
+                pTable);
     } else {
         fprintf(stderr, "device_dispatch_table: map:  0x%p, object:  0x%p, key:  0x%p, table: UNKNOWN\n", &tableInstanceMap, object, key);
     }
 #endif
-    assert(it != map.end() && "Not able to find device dispatch entry");
-    return it->second;
+    assert(pTable && "Not able to find device dispatch entry");
+    return pTable;
 }
 
 VkLayerInstanceDispatchTable *get_dispatch_table(instance_table_map &map, void *object) {
     //    VkLayerInstanceDispatchTable *pDisp = *(VkLayerInstanceDispatchTable **) object;
     dispatch_key key = get_dispatch_key(object);
-    instance_table_map::const_iterator it = map.find((void *)key);
+    VkLayerInstanceDispatchTable *pTable = map.get((void *)key);
 #if DISPATCH_MAP_DEBUG
-    if (it != map.end()) {
+    if (pTable) {
         fprintf(stderr, "instance_dispatch_table: map:  0x%p, object:  0x%p, key:  0x%p, table:  0x%p\n", &tableInstanceMap, object, key,
-                it->second);
+                pTable);
     } else {
         fprintf(stderr, "instance_dispatch_table: map:  0x%p, object:  0x%p, key:  0x%p, table: UNKNOWN\n", &tableInstanceMap, object, key);
     }
 #endif
-    assert(it != map.end() && "Not able to find instance dispatch entry");
-    return it->second;
+    assert(pTable && "Not able to find instance dispatch entry");
+    return pTable;
 }
 
 VkLayerInstanceCreateInfo *get_chain_info(const VkInstanceCreateInfo *pCreateInfo, VkLayerFunction func) {
@@ -137,21 +137,19 @@ VkLayerDeviceCreateInfo *get_chain_info(const VkDeviceCreateInfo *pCreateInfo, V
  * If use the object themselves as key to map then implies Create entrypoints have to be intercepted
  * and a new key inserted into map */
 VkLayerInstanceDispatchTable *initInstanceTable(VkInstance instance, const PFN_vkGetInstanceProcAddr gpa, instance_table_map &map) {
-    VkLayerInstanceDispatchTable *pTable;
     dispatch_key key = get_dispatch_key(instance);
-    instance_table_map::const_iterator it = map.find((void *)key);
+    bool created;
+    VkLayerInstanceDispatchTable *pTable = map.get_or_create((void *)key, &created);
 
-    if (it == map.end()) {
-        pTable = new VkLayerInstanceDispatchTable;
-        map[(void *)key] = pTable;
+    if (created) {
 #if DISPATCH_MAP_DEBUG
         fprintf(stderr, "New, Instance: map:  0x%p, key:  0x%p, table:  0x%p\n", &map, key, pTable);
 #endif
     } else {
 #if DISPATCH_MAP_DEBUG
-        fprintf(stderr, "Instance: map:  0x%p, key:  0x%p, table:  0x%p\n", &map, key, it->second);
+        fprintf(stderr, "Instance: map:  0x%p, key:  0x%p, table:  0x%p\n", &map, key, pTable);
 #endif
-        return it->second;
+        return pTable;
     }
 
     layer_init_instance_dispatch_table(instance, pTable, gpa);
@@ -164,21 +162,19 @@ VkLayerInstanceDispatchTable *initInstanceTable(VkInstance instance, const PFN_v
 }
 
 VkLayerDispatchTable *initDeviceTable(VkDevice device, const PFN_vkGetDeviceProcAddr gpa, device_table_map &map) {
-    VkLayerDispatchTable *pTable;
     dispatch_key key = get_dispatch_key(device);
-    device_table_map::const_iterator it = map.find((void *)key);
+    bool created;
+    VkLayerDispatchTable *pTable = map.get_or_create((void *)key, &created);
 
-    if (it == map.end()) {
-        pTable = new VkLayerDispatchTable;
-        map[(void *)key] = pTable;
+    if (created) {
 #if DISPATCH_MAP_DEBUG
         fprintf(stderr, "New, Device: map:  0x%p, key:  0x%p, table:  0x%p\n", &map, key, pTable);
 #endif
     } else {
 #if DISPATCH_MAP_DEBUG
-        fprintf(stderr, "Device: map:  0x%p, key:  0x%p, table:  0x%p\n", &map, key, it->second);
+        fprintf(stderr, "Device: map:  0x%p, key:  0x%p, table:  0x%p\n", &map, key, pTable);
 #endif
-        return it->second;
+        return pTable;
     }
 
     layer_init_device_dispatch_table(device, pTable, gpa);
@@ -18,8 +18,10 @@
  *
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "vulkan/vulkan.h"
 #include "vk_layer_config.h"
@@ -604,6 +606,41 @@ VkStringErrorFlags vk_string_validate(const int max_length, const char *utf8) {
     return result;
 }
 
+// Reads <layer>.message_limit, a count, and <layer>.message_limits, a comma-separated list of msgCode:count pairs
+static void layer_message_limits(debug_report_data *report_data, const char *layer_identifier) {
+    std::string message_limit_key = layer_identifier;
+    std::string message_limits_key = layer_identifier;
+    message_limit_key.append(".message_limit");
+    message_limits_key.append(".message_limits");
+
+    uint32_t default_limit = UINT32_MAX;
+    const char *message_limit = getLayerOption(message_limit_key.c_str());
+    if (*message_limit) {
+        default_limit = static_cast<uint32_t>(strtoul(message_limit, nullptr, 0));
+    }
+
+    std::unordered_map<int32_t, uint32_t> code_limits;
+    std::string limit_list = getLayerOption(message_limits_key.c_str());
+    while (limit_list.length() != 0) {
+        std::size_t limit_length = limit_list.find(",");
+        if (limit_length == limit_list.npos) {
+            limit_length = limit_list.size();
+        }
+        const std::string limit = limit_list.substr(0, limit_length);
+        std::size_t separator = limit.find(":");
+        if (separator != limit.npos) {
+            code_limits[static_cast<int32_t>(strtol(limit.substr(0, separator).c_str(), nullptr, 0))] =
+                static_cast<uint32_t>(strtoul(limit.substr(separator + 1).c_str(), nullptr, 0));
+        }
+        limit_list.erase(0, limit_length);
+        if (limit_list.find(",") == 0) {
+            limit_list.erase(0, 1);
+        }
+    }
+
+    layer_debug_report_set_message_limits(report_data, default_limit, code_limits);
+}
+
 // Debug callbacks get created in three ways:
 //   o  Application-defined debug callbacks
 //   o  Through settings in a vk_layer_settings.txt file
@@ -627,6 +664,8 @@ void layer_debug_actions(debug_report_data *report_data, std::vector<VkDebugRepo
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
 
+    layer_message_limits(report_data, layer_identifier);
+
     // Initialize layer options
     VkDebugReportFlagsEXT report_flags = GetLayerOptionFlags(report_flags_key, report_flags_option_definitions, 0);
     VkLayerDbgActionFlags debug_action = GetLayerOptionFlags(debug_action_key, debug_actions_option_definitions, 0);
@@ -0,0 +1,131 @@
+/* Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_WORKER_POOL_H
+#define VK_LAYER_WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Fixed set of worker threads for splitting a batch of independent jobs, e.g. the pipelines of one
+//  vkCreateGraphicsPipelines call.  parallel_for() hands out job indices one at a time to the workers and to the calling
+//  thread, which takes part rather than sitting idle, and returns once every job has finished.
+//
+//  Rules for callers:
+//  - Jobs must not call back into the same pool.
+//  - parallel_for() may be called from any number of threads, concurrent batches simply run one after the other.
+class worker_pool {
+  public:
+    explicit worker_pool(unsigned thread_count)
+        : job_(nullptr), job_context_(nullptr), job_count_(0), next_(0), busy_workers_(0), generation_(0), stopping_(false) {
+        for (unsigned i = 0; i < thread_count; i++) {
+            threads_.push_back(std::thread(&worker_pool::run, this));
+        }
+    }
+    worker_pool(const worker_pool &) = delete;
+    worker_pool &operator=(const worker_pool &) = delete;
+    ~worker_pool() {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            stopping_ = true;
+        }
+        work_available_.notify_all();
+        for (auto &thread : threads_) {
+            thread.join();
+        }
+    }
+
+    unsigned thread_count() const { return static_cast<unsigned>(threads_.size()); }
+
+    // Call f(i) once for every i in [0, count), in no particular order or thread
+    template <typename F> void parallel_for(size_t count, F &&f) {
+        if (threads_.empty() || count < 2) {
+            for (size_t i = 0; i < count; i++) {
+                f(i);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> batch(batch_lock_);
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            job_ = &call<typename std::remove_reference<F>::type>;
+            job_context_ = &f;
+            job_count_ = count;
+            next_.store(0);
+            busy_workers_ = threads_.size();
+            generation_++;
+        }
+        work_available_.notify_all();
+        run_jobs();
+        std::unique_lock<std::mutex> lock(lock_);
+        batch_done_.wait(lock, [this] { return busy_workers_ == 0; });
+    }
+
+  private:
+    typedef void (*job_function)(void *context, size_t index);
+
+    template <typename F> static void call(void *context, size_t index) { (*static_cast<F *>(context))(index); }
+
+    void run_jobs() {
+        for (size_t i = next_.fetch_add(1); i < job_count_; i = next_.fetch_add(1)) {
+            job_(job_context_, i);
+        }
+    }
+
+    void run() {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(lock_);
+        while (true) {
+            work_available_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+            if (stopping_) {
+                return;
+            }
+            seen = generation_;
+            lock.unlock();
+            run_jobs();
+            lock.lock();
+            if (--busy_workers_ == 0) {
+                batch_done_.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> threads_;
+    // Current batch, only changed while no worker is busy
+    job_function job_;
+    void *job_context_;
+    size_t job_count_;
+    // Next job index to hand out
+    std::atomic<size_t> next_;
+    // Workers that have not yet finished with the current batch
+    size_t busy_workers_;
+    // Bumped for every batch so workers can tell a new one from a spurious wakeup
+    uint64_t generation_;
+    bool stopping_;
+    // Serializes parallel_for() callers
+    std::mutex batch_lock_;
+    std::mutex lock_;
+    std::condition_variable work_available_;
+    std::condition_variable batch_done_;
+};
+
+#endif // VK_LAYER_WORKER_POOL_H
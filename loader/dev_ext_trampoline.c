@@ -18,6 +18,7 @@
  * Author: Jon Ashburn <jon@lunarg.com>
  */
 
+#define _GNU_SOURCE
 #include "vk_loader_platform.h"
 #include "loader.h"
 #if defined(__linux__)
@@ -1524,508 +1525,4911 @@ VKAPI_ATTR void VKAPI_CALL vkDevExt249(VkDevice device) {
     disp->ext_dispatch.DevExt[249](device);
 }
 
-void *loader_get_dev_ext_trampoline(uint32_t index) {
-    switch (index) {
-    case 0:
-        return vkDevExt0;
-    case 1:
-        return vkDevExt1;
-    case 2:
-        return vkDevExt2;
-    case 3:
-        return vkDevExt3;
-    case 4:
-        return vkDevExt4;
-    case 5:
-        return vkDevExt5;
-    case 6:
-        return vkDevExt6;
-    case 7:
-        return vkDevExt7;
-    case 8:
-        return vkDevExt8;
-    case 9:
-        return vkDevExt9;
-    case 10:
-        return vkDevExt10;
-    case 11:
-        return vkDevExt11;
-    case 12:
-        return vkDevExt12;
-    case 13:
-        return vkDevExt13;
-    case 14:
-        return vkDevExt14;
-    case 15:
-        return vkDevExt15;
-    case 16:
-        return vkDevExt16;
-    case 17:
-        return vkDevExt17;
-    case 18:
-        return vkDevExt18;
-    case 19:
-        return vkDevExt19;
-    case 20:
-        return vkDevExt20;
-    case 21:
-        return vkDevExt21;
-    case 22:
-        return vkDevExt22;
-    case 23:
-        return vkDevExt23;
-    case 24:
-        return vkDevExt24;
-    case 25:
-        return vkDevExt25;
-    case 26:
-        return vkDevExt26;
-    case 27:
-        return vkDevExt27;
-    case 28:
-        return vkDevExt28;
-    case 29:
-        return vkDevExt29;
-    case 30:
-        return vkDevExt30;
-    case 31:
-        return vkDevExt31;
-    case 32:
-        return vkDevExt32;
-    case 33:
-        return vkDevExt33;
-    case 34:
-        return vkDevExt34;
-    case 35:
-        return vkDevExt35;
-    case 36:
-        return vkDevExt36;
-    case 37:
-        return vkDevExt37;
-    case 38:
-        return vkDevExt38;
-    case 39:
-        return vkDevExt39;
-    case 40:
-        return vkDevExt40;
-    case 41:
-        return vkDevExt41;
-    case 42:
-        return vkDevExt42;
-    case 43:
-        return vkDevExt43;
-    case 44:
-        return vkDevExt44;
-    case 45:
-        return vkDevExt45;
-    case 46:
-        return vkDevExt46;
-    case 47:
-        return vkDevExt47;
-    case 48:
-        return vkDevExt48;
-    case 49:
-        return vkDevExt49;
-    case 50:
-        return vkDevExt50;
-    case 51:
-        return vkDevExt51;
-    case 52:
-        return vkDevExt52;
-    case 53:
-        return vkDevExt53;
-    case 54:
-        return vkDevExt54;
-    case 55:
-        return vkDevExt55;
-    case 56:
-        return vkDevExt56;
-    case 57:
-        return vkDevExt57;
-    case 58:
-        return vkDevExt58;
-    case 59:
-        return vkDevExt59;
-    case 60:
-        return vkDevExt60;
-    case 61:
-        return vkDevExt61;
-    case 62:
-        return vkDevExt62;
-    case 63:
-        return vkDevExt63;
-    case 64:
-        return vkDevExt64;
-    case 65:
-        return vkDevExt65;
-    case 66:
-        return vkDevExt66;
-    case 67:
-        return vkDevExt67;
-    case 68:
-        return vkDevExt68;
-    case 69:
-        return vkDevExt69;
-    case 70:
-        return vkDevExt70;
-    case 71:
-        return vkDevExt71;
-    case 72:
-        return vkDevExt72;
-    case 73:
-        return vkDevExt73;
-    case 74:
-        return vkDevExt74;
-    case 75:
-        return vkDevExt75;
-    case 76:
-        return vkDevExt76;
-    case 77:
-        return vkDevExt77;
-    case 78:
-        return vkDevExt78;
-    case 79:
-        return vkDevExt79;
-    case 80:
-        return vkDevExt80;
-    case 81:
-        return vkDevExt81;
-    case 82:
-        return vkDevExt82;
-    case 83:
-        return vkDevExt83;
-    case 84:
-        return vkDevExt84;
-    case 85:
-        return vkDevExt85;
-    case 86:
-        return vkDevExt86;
-    case 87:
-        return vkDevExt87;
-    case 88:
-        return vkDevExt88;
-    case 89:
-        return vkDevExt89;
-    case 90:
-        return vkDevExt90;
-    case 91:
-        return vkDevExt91;
-    case 92:
-        return vkDevExt92;
-    case 93:
-        return vkDevExt93;
-    case 94:
-        return vkDevExt94;
-    case 95:
-        return vkDevExt95;
-    case 96:
-        return vkDevExt96;
-    case 97:
-        return vkDevExt97;
-    case 98:
-        return vkDevExt98;
-    case 99:
-        return vkDevExt99;
-    case 100:
-        return vkDevExt100;
-    case 101:
-        return vkDevExt101;
-    case 102:
-        return vkDevExt102;
-    case 103:
-        return vkDevExt103;
-    case 104:
-        return vkDevExt104;
-    case 105:
-        return vkDevExt105;
-    case 106:
-        return vkDevExt106;
-    case 107:
-        return vkDevExt107;
-    case 108:
-        return vkDevExt108;
-    case 109:
-        return vkDevExt109;
-    case 110:
-        return vkDevExt110;
-    case 111:
-        return vkDevExt111;
-    case 112:
-        return vkDevExt112;
-    case 113:
-        return vkDevExt113;
-    case 114:
-        return vkDevExt114;
-    case 115:
-        return vkDevExt115;
-    case 116:
-        return vkDevExt116;
-    case 117:
-        return vkDevExt117;
-    case 118:
-        return vkDevExt118;
-    case 119:
-        return vkDevExt119;
-    case 120:
-        return vkDevExt120;
-    case 121:
-        return vkDevExt121;
-    case 122:
-        return vkDevExt122;
-    case 123:
-        return vkDevExt123;
-    case 124:
-        return vkDevExt124;
-    case 125:
-        return vkDevExt125;
-    case 126:
-        return vkDevExt126;
-    case 127:
-        return vkDevExt127;
-    case 128:
-        return vkDevExt128;
-    case 129:
-        return vkDevExt129;
-    case 130:
-        return vkDevExt130;
-    case 131:
-        return vkDevExt131;
-    case 132:
-        return vkDevExt132;
-    case 133:
-        return vkDevExt133;
-    case 134:
-        return vkDevExt134;
-    case 135:
-        return vkDevExt135;
-    case 136:
-        return vkDevExt136;
-    case 137:
-        return vkDevExt137;
-    case 138:
-        return vkDevExt138;
-    case 139:
-        return vkDevExt139;
-    case 140:
-        return vkDevExt140;
-    case 141:
-        return vkDevExt141;
-    case 142:
-        return vkDevExt142;
-    case 143:
-        return vkDevExt143;
-    case 144:
-        return vkDevExt144;
-    case 145:
-        return vkDevExt145;
-    case 146:
-        return vkDevExt146;
-    case 147:
-        return vkDevExt147;
-    case 148:
-        return vkDevExt148;
-    case 149:
-        return vkDevExt149;
-    case 150:
-        return vkDevExt150;
-    case 151:
-        return vkDevExt151;
-    case 152:
-        return vkDevExt152;
-    case 153:
-        return vkDevExt153;
-    case 154:
-        return vkDevExt154;
-    case 155:
-        return vkDevExt155;
-    case 156:
-        return vkDevExt156;
-    case 157:
-        return vkDevExt157;
-    case 158:
-        return vkDevExt158;
-    case 159:
-        return vkDevExt159;
-    case 160:
-        return vkDevExt160;
-    case 161:
-        return vkDevExt161;
-    case 162:
-        return vkDevExt162;
-    case 163:
-        return vkDevExt163;
-    case 164:
-        return vkDevExt164;
-    case 165:
-        return vkDevExt165;
-    case 166:
-        return vkDevExt166;
-    case 167:
-        return vkDevExt167;
-    case 168:
-        return vkDevExt168;
-    case 169:
-        return vkDevExt169;
-    case 170:
-        return vkDevExt170;
-    case 171:
-        return vkDevExt171;
-    case 172:
-        return vkDevExt172;
-    case 173:
-        return vkDevExt173;
-    case 174:
-        return vkDevExt174;
-    case 175:
-        return vkDevExt175;
-    case 176:
-        return vkDevExt176;
-    case 177:
-        return vkDevExt177;
-    case 178:
-        return vkDevExt178;
-    case 179:
-        return vkDevExt179;
-    case 180:
-        return vkDevExt180;
-    case 181:
-        return vkDevExt181;
-    case 182:
-        return vkDevExt182;
-    case 183:
-        return vkDevExt183;
-    case 184:
-        return vkDevExt184;
-    case 185:
-        return vkDevExt185;
-    case 186:
-        return vkDevExt186;
-    case 187:
-        return vkDevExt187;
-    case 188:
-        return vkDevExt188;
-    case 189:
-        return vkDevExt189;
-    case 190:
-        return vkDevExt190;
-    case 191:
-        return vkDevExt191;
-    case 192:
-        return vkDevExt192;
-    case 193:
-        return vkDevExt193;
-    case 194:
-        return vkDevExt194;
-    case 195:
-        return vkDevExt195;
-    case 196:
-        return vkDevExt196;
-    case 197:
-        return vkDevExt197;
-    case 198:
-        return vkDevExt198;
-    case 199:
-        return vkDevExt199;
-    case 200:
-        return vkDevExt200;
-    case 201:
-        return vkDevExt201;
-    case 202:
-        return vkDevExt202;
-    case 203:
-        return vkDevExt203;
-    case 204:
-        return vkDevExt204;
-    case 205:
-        return vkDevExt205;
-    case 206:
-        return vkDevExt206;
-    case 207:
-        return vkDevExt207;
-    case 208:
-        return vkDevExt208;
-    case 209:
-        return vkDevExt209;
-    case 210:
-        return vkDevExt210;
-    case 211:
-        return vkDevExt211;
-    case 212:
-        return vkDevExt212;
-    case 213:
-        return vkDevExt213;
-    case 214:
-        return vkDevExt214;
-    case 215:
-        return vkDevExt215;
-    case 216:
-        return vkDevExt216;
-    case 217:
-        return vkDevExt217;
-    case 218:
-        return vkDevExt218;
-    case 219:
-        return vkDevExt219;
-    case 220:
-        return vkDevExt220;
-    case 221:
-        return vkDevExt221;
-    case 222:
-        return vkDevExt222;
-    case 223:
-        return vkDevExt223;
-    case 224:
-        return vkDevExt224;
-    case 225:
-        return vkDevExt225;
-    case 226:
-        return vkDevExt226;
-    case 227:
-        return vkDevExt227;
-    case 228:
-        return vkDevExt228;
-    case 229:
-        return vkDevExt229;
-    case 230:
-        return vkDevExt230;
-    case 231:
-        return vkDevExt231;
-    case 232:
-        return vkDevExt232;
-    case 233:
-        return vkDevExt233;
-    case 234:
-        return vkDevExt234;
-    case 235:
-        return vkDevExt235;
-    case 236:
-        return vkDevExt236;
-    case 237:
-        return vkDevExt237;
-    case 238:
-        return vkDevExt238;
-    case 239:
-        return vkDevExt239;
-    case 240:
-        return vkDevExt240;
-    case 241:
-        return vkDevExt241;
-    case 242:
-        return vkDevExt242;
-    case 243:
-        return vkDevExt243;
-    case 244:
-        return vkDevExt244;
-    case 245:
-        return vkDevExt245;
-    case 246:
-        return vkDevExt246;
-    case 247:
-        return vkDevExt247;
-    case 248:
-        return vkDevExt248;
-    case 249:
-        return vkDevExt249;
-    }
-    return NULL;
+VKAPI_ATTR void VKAPI_CALL vkDevExt250(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[250](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt251(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[251](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt252(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[252](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt253(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[253](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt254(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[254](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt255(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[255](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt256(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[256](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt257(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[257](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt258(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[258](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt259(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[259](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt260(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[260](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt261(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[261](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt262(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[262](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt263(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[263](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt264(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[264](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt265(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[265](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt266(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[266](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt267(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[267](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt268(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[268](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt269(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[269](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt270(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[270](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt271(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[271](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt272(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[272](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt273(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[273](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt274(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[274](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt275(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[275](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt276(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[276](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt277(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[277](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt278(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[278](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt279(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[279](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt280(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[280](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt281(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[281](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt282(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[282](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt283(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[283](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt284(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[284](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt285(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[285](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt286(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[286](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt287(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[287](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt288(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[288](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt289(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[289](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt290(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[290](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt291(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[291](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt292(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[292](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt293(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[293](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt294(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[294](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt295(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[295](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt296(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[296](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt297(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[297](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt298(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[298](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt299(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[299](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt300(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[300](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt301(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[301](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt302(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[302](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt303(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[303](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt304(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[304](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt305(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[305](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt306(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[306](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt307(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[307](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt308(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[308](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt309(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[309](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt310(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[310](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt311(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[311](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt312(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[312](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt313(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[313](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt314(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[314](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt315(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[315](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt316(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[316](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt317(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[317](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt318(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[318](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt319(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[319](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt320(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[320](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt321(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[321](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt322(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[322](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt323(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[323](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt324(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[324](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt325(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[325](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt326(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[326](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt327(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[327](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt328(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[328](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt329(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[329](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt330(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[330](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt331(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[331](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt332(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[332](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt333(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[333](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt334(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[334](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt335(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[335](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt336(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[336](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt337(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[337](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt338(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[338](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt339(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[339](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt340(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[340](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt341(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[341](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt342(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[342](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt343(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[343](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt344(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[344](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt345(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[345](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt346(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[346](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt347(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[347](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt348(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[348](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt349(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[349](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt350(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[350](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt351(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[351](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt352(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[352](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt353(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[353](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt354(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[354](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt355(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[355](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt356(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[356](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt357(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[357](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt358(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[358](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt359(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[359](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt360(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[360](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt361(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[361](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt362(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[362](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt363(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[363](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt364(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[364](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt365(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[365](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt366(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[366](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt367(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[367](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt368(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[368](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt369(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[369](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt370(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[370](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt371(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[371](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt372(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[372](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt373(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[373](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt374(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[374](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt375(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[375](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt376(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[376](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt377(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[377](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt378(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[378](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt379(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[379](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt380(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[380](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt381(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[381](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt382(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[382](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt383(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[383](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt384(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[384](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt385(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[385](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt386(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[386](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt387(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[387](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt388(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[388](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt389(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[389](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt390(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[390](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt391(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[391](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt392(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[392](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt393(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[393](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt394(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[394](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt395(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[395](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt396(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[396](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt397(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[397](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt398(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[398](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt399(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[399](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt400(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[400](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt401(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[401](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt402(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[402](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt403(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[403](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt404(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[404](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt405(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[405](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt406(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[406](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt407(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[407](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt408(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[408](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt409(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[409](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt410(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[410](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt411(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[411](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt412(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[412](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt413(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[413](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt414(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[414](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt415(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[415](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt416(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[416](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt417(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[417](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt418(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[418](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt419(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[419](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt420(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[420](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt421(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[421](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt422(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[422](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt423(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[423](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt424(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[424](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt425(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[425](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt426(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[426](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt427(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[427](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt428(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[428](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt429(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[429](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt430(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[430](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt431(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[431](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt432(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[432](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt433(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[433](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt434(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[434](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt435(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[435](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt436(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[436](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt437(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[437](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt438(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[438](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt439(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[439](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt440(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[440](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt441(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[441](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt442(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[442](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt443(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[443](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt444(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[444](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt445(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[445](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt446(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[446](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt447(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[447](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt448(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[448](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt449(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[449](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt450(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[450](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt451(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[451](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt452(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[452](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt453(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[453](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt454(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[454](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt455(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[455](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt456(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[456](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt457(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[457](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt458(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[458](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt459(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[459](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt460(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[460](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt461(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[461](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt462(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[462](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt463(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[463](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt464(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[464](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt465(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[465](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt466(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[466](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt467(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[467](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt468(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[468](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt469(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[469](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt470(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[470](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt471(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[471](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt472(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[472](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt473(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[473](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt474(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[474](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt475(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[475](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt476(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[476](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt477(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[477](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt478(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[478](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt479(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[479](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt480(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[480](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt481(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[481](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt482(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[482](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt483(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[483](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt484(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[484](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt485(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[485](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt486(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[486](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt487(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[487](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt488(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[488](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt489(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[489](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt490(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[490](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt491(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[491](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt492(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[492](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt493(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[493](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt494(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[494](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt495(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[495](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt496(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[496](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt497(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[497](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt498(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[498](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt499(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[499](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt500(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[500](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt501(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[501](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt502(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[502](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt503(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[503](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt504(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[504](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt505(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[505](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt506(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[506](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt507(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[507](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt508(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[508](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt509(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[509](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt510(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[510](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt511(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[511](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt512(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[512](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt513(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[513](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt514(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[514](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt515(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[515](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt516(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[516](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt517(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[517](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt518(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[518](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt519(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[519](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt520(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[520](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt521(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[521](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt522(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[522](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt523(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[523](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt524(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[524](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt525(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[525](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt526(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[526](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt527(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[527](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt528(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[528](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt529(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[529](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt530(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[530](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt531(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[531](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt532(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[532](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt533(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[533](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt534(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[534](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt535(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[535](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt536(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[536](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt537(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[537](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt538(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[538](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt539(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[539](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt540(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[540](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt541(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[541](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt542(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[542](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt543(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[543](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt544(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[544](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt545(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[545](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt546(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[546](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt547(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[547](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt548(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[548](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt549(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[549](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt550(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[550](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt551(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[551](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt552(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[552](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt553(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[553](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt554(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[554](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt555(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[555](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt556(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[556](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt557(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[557](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt558(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[558](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt559(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[559](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt560(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[560](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt561(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[561](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt562(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[562](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt563(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[563](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt564(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[564](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt565(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[565](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt566(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[566](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt567(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[567](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt568(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[568](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt569(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[569](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt570(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[570](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt571(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[571](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt572(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[572](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt573(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[573](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt574(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[574](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt575(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[575](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt576(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[576](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt577(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[577](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt578(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[578](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt579(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[579](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt580(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[580](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt581(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[581](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt582(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[582](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt583(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[583](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt584(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[584](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt585(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[585](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt586(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[586](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt587(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[587](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt588(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[588](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt589(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[589](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt590(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[590](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt591(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[591](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt592(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[592](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt593(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[593](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt594(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[594](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt595(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[595](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt596(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[596](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt597(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[597](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt598(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[598](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt599(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[599](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt600(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[600](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt601(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[601](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt602(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[602](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt603(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[603](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt604(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[604](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt605(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[605](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt606(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[606](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt607(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[607](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt608(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[608](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt609(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[609](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt610(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[610](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt611(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[611](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt612(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[612](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt613(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[613](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt614(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[614](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt615(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[615](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt616(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[616](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt617(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[617](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt618(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[618](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt619(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[619](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt620(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[620](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt621(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[621](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt622(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[622](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt623(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[623](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt624(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[624](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt625(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[625](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt626(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[626](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt627(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[627](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt628(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[628](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt629(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[629](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt630(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[630](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt631(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[631](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt632(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[632](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt633(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[633](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt634(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[634](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt635(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[635](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt636(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[636](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt637(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[637](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt638(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[638](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt639(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[639](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt640(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[640](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt641(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[641](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt642(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[642](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt643(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[643](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt644(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[644](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt645(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[645](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt646(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[646](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt647(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[647](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt648(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[648](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt649(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[649](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt650(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[650](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt651(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[651](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt652(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[652](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt653(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[653](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt654(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[654](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt655(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[655](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt656(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[656](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt657(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[657](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt658(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[658](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt659(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[659](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt660(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[660](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt661(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[661](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt662(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[662](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt663(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[663](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt664(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[664](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt665(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[665](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt666(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[666](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt667(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[667](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt668(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[668](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt669(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[669](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt670(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[670](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt671(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[671](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt672(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[672](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt673(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[673](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt674(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[674](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt675(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[675](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt676(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[676](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt677(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[677](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt678(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[678](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt679(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[679](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt680(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[680](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt681(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[681](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt682(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[682](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt683(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[683](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt684(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[684](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt685(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[685](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt686(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[686](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt687(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[687](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt688(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[688](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt689(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[689](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt690(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[690](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt691(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[691](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt692(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[692](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt693(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[693](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt694(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[694](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt695(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[695](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt696(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[696](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt697(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[697](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt698(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[698](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt699(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[699](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt700(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[700](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt701(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[701](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt702(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[702](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt703(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[703](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt704(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[704](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt705(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[705](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt706(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[706](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt707(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[707](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt708(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[708](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt709(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[709](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt710(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[710](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt711(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[711](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt712(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[712](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt713(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[713](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt714(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[714](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt715(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[715](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt716(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[716](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt717(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[717](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt718(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[718](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt719(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[719](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt720(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[720](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt721(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[721](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt722(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[722](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt723(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[723](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt724(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[724](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt725(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[725](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt726(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[726](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt727(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[727](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt728(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[728](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt729(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[729](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt730(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[730](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt731(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[731](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt732(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[732](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt733(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[733](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt734(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[734](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt735(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[735](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt736(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[736](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt737(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[737](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt738(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[738](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt739(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[739](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt740(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[740](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt741(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[741](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt742(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[742](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt743(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[743](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt744(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[744](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt745(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[745](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt746(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[746](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt747(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[747](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt748(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[748](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt749(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[749](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt750(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[750](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt751(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[751](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt752(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[752](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt753(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[753](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt754(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[754](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt755(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[755](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt756(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[756](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt757(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[757](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt758(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[758](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt759(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[759](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt760(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[760](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt761(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[761](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt762(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[762](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt763(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[763](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt764(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[764](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt765(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[765](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt766(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[766](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt767(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[767](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt768(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[768](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt769(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[769](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt770(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[770](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt771(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[771](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt772(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[772](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt773(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[773](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt774(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[774](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt775(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[775](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt776(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[776](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt777(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[777](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt778(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[778](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt779(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[779](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt780(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[780](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt781(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[781](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt782(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[782](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt783(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[783](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt784(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[784](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt785(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[785](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt786(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[786](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt787(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[787](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt788(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[788](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt789(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[789](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt790(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[790](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt791(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[791](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt792(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[792](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt793(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[793](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt794(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[794](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt795(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[795](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt796(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[796](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt797(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[797](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt798(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[798](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt799(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[799](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt800(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[800](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt801(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[801](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt802(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[802](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt803(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[803](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt804(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[804](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt805(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[805](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt806(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[806](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt807(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[807](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt808(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[808](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt809(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[809](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt810(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[810](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt811(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[811](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt812(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[812](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt813(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[813](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt814(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[814](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt815(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[815](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt816(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[816](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt817(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[817](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt818(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[818](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt819(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[819](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt820(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[820](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt821(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[821](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt822(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[822](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt823(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[823](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt824(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[824](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt825(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[825](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt826(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[826](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt827(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[827](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt828(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[828](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt829(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[829](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt830(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[830](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt831(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[831](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt832(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[832](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt833(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[833](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt834(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[834](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt835(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[835](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt836(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[836](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt837(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[837](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt838(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[838](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt839(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[839](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt840(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[840](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt841(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[841](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt842(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[842](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt843(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[843](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt844(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[844](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt845(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[845](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt846(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[846](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt847(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[847](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt848(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[848](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt849(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[849](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt850(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[850](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt851(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[851](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt852(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[852](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt853(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[853](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt854(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[854](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt855(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[855](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt856(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[856](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt857(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[857](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt858(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[858](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt859(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[859](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt860(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[860](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt861(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[861](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt862(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[862](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt863(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[863](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt864(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[864](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt865(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[865](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt866(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[866](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt867(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[867](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt868(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[868](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt869(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[869](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt870(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[870](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt871(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[871](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt872(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[872](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt873(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[873](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt874(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[874](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt875(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[875](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt876(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[876](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt877(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[877](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt878(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[878](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt879(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[879](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt880(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[880](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt881(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[881](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt882(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[882](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt883(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[883](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt884(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[884](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt885(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[885](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt886(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[886](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt887(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[887](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt888(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[888](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt889(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[889](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt890(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[890](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt891(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[891](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt892(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[892](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt893(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[893](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt894(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[894](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt895(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[895](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt896(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[896](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt897(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[897](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt898(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[898](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt899(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[899](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt900(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[900](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt901(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[901](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt902(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[902](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt903(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[903](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt904(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[904](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt905(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[905](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt906(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[906](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt907(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[907](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt908(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[908](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt909(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[909](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt910(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[910](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt911(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[911](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt912(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[912](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt913(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[913](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt914(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[914](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt915(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[915](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt916(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[916](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt917(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[917](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt918(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[918](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt919(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[919](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt920(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[920](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt921(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[921](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt922(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[922](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt923(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[923](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt924(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[924](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt925(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[925](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt926(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[926](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt927(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[927](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt928(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[928](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt929(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[929](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt930(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[930](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt931(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[931](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt932(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[932](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt933(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[933](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt934(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[934](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt935(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[935](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt936(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[936](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt937(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[937](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt938(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[938](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt939(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[939](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt940(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[940](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt941(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[941](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt942(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[942](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt943(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[943](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt944(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[944](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt945(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[945](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt946(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[946](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt947(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[947](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt948(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[948](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt949(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[949](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt950(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[950](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt951(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[951](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt952(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[952](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt953(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[953](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt954(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[954](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt955(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[955](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt956(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[956](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt957(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[957](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt958(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[958](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt959(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[959](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt960(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[960](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt961(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[961](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt962(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[962](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt963(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[963](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt964(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[964](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt965(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[965](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt966(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[966](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt967(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[967](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt968(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[968](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt969(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[969](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt970(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[970](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt971(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[971](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt972(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[972](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt973(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[973](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt974(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[974](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt975(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[975](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt976(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[976](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt977(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[977](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt978(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[978](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt979(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[979](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt980(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[980](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt981(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[981](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt982(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[982](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt983(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[983](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt984(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[984](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt985(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[985](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt986(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[986](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt987(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[987](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt988(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[988](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt989(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[989](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt990(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[990](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt991(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[991](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt992(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[992](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt993(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[993](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt994(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[994](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt995(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[995](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt996(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[996](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt997(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[997](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt998(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[998](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt999(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[999](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1000(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1000](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1001(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1001](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1002(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1002](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1003(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1003](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1004(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1004](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1005(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1005](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1006(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1006](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1007(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1007](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1008(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1008](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1009(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1009](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1010(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1010](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1011(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1011](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1012(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1012](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1013(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1013](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1014(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1014](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1015(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1015](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1016(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1016](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1017(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1017](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1018(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1018](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1019(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1019](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1020(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1020](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1021(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1021](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1022(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1022](device);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDevExt1023(VkDevice device) {
+    const struct loader_dev_dispatch_table *disp;
+    disp = loader_get_dev_dispatch(device);
+    disp->ext_dispatch.DevExt[1023](device);
+}
+
+static const PFN_vkDevExt loader_dev_ext_trampolines[NUM_STATIC_DEV_EXTS] = {
+    vkDevExt0, vkDevExt1, vkDevExt2, vkDevExt3,
+    vkDevExt4, vkDevExt5, vkDevExt6, vkDevExt7,
+    vkDevExt8, vkDevExt9, vkDevExt10, vkDevExt11,
+    vkDevExt12, vkDevExt13, vkDevExt14, vkDevExt15,
+    vkDevExt16, vkDevExt17, vkDevExt18, vkDevExt19,
+    vkDevExt20, vkDevExt21, vkDevExt22, vkDevExt23,
+    vkDevExt24, vkDevExt25, vkDevExt26, vkDevExt27,
+    vkDevExt28, vkDevExt29, vkDevExt30, vkDevExt31,
+    vkDevExt32, vkDevExt33, vkDevExt34, vkDevExt35,
+    vkDevExt36, vkDevExt37, vkDevExt38, vkDevExt39,
+    vkDevExt40, vkDevExt41, vkDevExt42, vkDevExt43,
+    vkDevExt44, vkDevExt45, vkDevExt46, vkDevExt47,
+    vkDevExt48, vkDevExt49, vkDevExt50, vkDevExt51,
+    vkDevExt52, vkDevExt53, vkDevExt54, vkDevExt55,
+    vkDevExt56, vkDevExt57, vkDevExt58, vkDevExt59,
+    vkDevExt60, vkDevExt61, vkDevExt62, vkDevExt63,
+    vkDevExt64, vkDevExt65, vkDevExt66, vkDevExt67,
+    vkDevExt68, vkDevExt69, vkDevExt70, vkDevExt71,
+    vkDevExt72, vkDevExt73, vkDevExt74, vkDevExt75,
+    vkDevExt76, vkDevExt77, vkDevExt78, vkDevExt79,
+    vkDevExt80, vkDevExt81, vkDevExt82, vkDevExt83,
+    vkDevExt84, vkDevExt85, vkDevExt86, vkDevExt87,
+    vkDevExt88, vkDevExt89, vkDevExt90, vkDevExt91,
+    vkDevExt92, vkDevExt93, vkDevExt94, vkDevExt95,
+    vkDevExt96, vkDevExt97, vkDevExt98, vkDevExt99,
+    vkDevExt100, vkDevExt101, vkDevExt102, vkDevExt103,
+    vkDevExt104, vkDevExt105, vkDevExt106, vkDevExt107,
+    vkDevExt108, vkDevExt109, vkDevExt110, vkDevExt111,
+    vkDevExt112, vkDevExt113, vkDevExt114, vkDevExt115,
+    vkDevExt116, vkDevExt117, vkDevExt118, vkDevExt119,
+    vkDevExt120, vkDevExt121, vkDevExt122, vkDevExt123,
+    vkDevExt124, vkDevExt125, vkDevExt126, vkDevExt127,
+    vkDevExt128, vkDevExt129, vkDevExt130, vkDevExt131,
+    vkDevExt132, vkDevExt133, vkDevExt134, vkDevExt135,
+    vkDevExt136, vkDevExt137, vkDevExt138, vkDevExt139,
+    vkDevExt140, vkDevExt141, vkDevExt142, vkDevExt143,
+    vkDevExt144, vkDevExt145, vkDevExt146, vkDevExt147,
+    vkDevExt148, vkDevExt149, vkDevExt150, vkDevExt151,
+    vkDevExt152, vkDevExt153, vkDevExt154, vkDevExt155,
+    vkDevExt156, vkDevExt157, vkDevExt158, vkDevExt159,
+    vkDevExt160, vkDevExt161, vkDevExt162, vkDevExt163,
+    vkDevExt164, vkDevExt165, vkDevExt166, vkDevExt167,
+    vkDevExt168, vkDevExt169, vkDevExt170, vkDevExt171,
+    vkDevExt172, vkDevExt173, vkDevExt174, vkDevExt175,
+    vkDevExt176, vkDevExt177, vkDevExt178, vkDevExt179,
+    vkDevExt180, vkDevExt181, vkDevExt182, vkDevExt183,
+    vkDevExt184, vkDevExt185, vkDevExt186, vkDevExt187,
+    vkDevExt188, vkDevExt189, vkDevExt190, vkDevExt191,
+    vkDevExt192, vkDevExt193, vkDevExt194, vkDevExt195,
+    vkDevExt196, vkDevExt197, vkDevExt198, vkDevExt199,
+    vkDevExt200, vkDevExt201, vkDevExt202, vkDevExt203,
+    vkDevExt204, vkDevExt205, vkDevExt206, vkDevExt207,
+    vkDevExt208, vkDevExt209, vkDevExt210, vkDevExt211,
+    vkDevExt212, vkDevExt213, vkDevExt214, vkDevExt215,
+    vkDevExt216, vkDevExt217, vkDevExt218, vkDevExt219,
+    vkDevExt220, vkDevExt221, vkDevExt222, vkDevExt223,
+    vkDevExt224, vkDevExt225, vkDevExt226, vkDevExt227,
+    vkDevExt228, vkDevExt229, vkDevExt230, vkDevExt231,
+    vkDevExt232, vkDevExt233, vkDevExt234, vkDevExt235,
+    vkDevExt236, vkDevExt237, vkDevExt238, vkDevExt239,
+    vkDevExt240, vkDevExt241, vkDevExt242, vkDevExt243,
+    vkDevExt244, vkDevExt245, vkDevExt246, vkDevExt247,
+    vkDevExt248, vkDevExt249, vkDevExt250, vkDevExt251,
+    vkDevExt252, vkDevExt253, vkDevExt254, vkDevExt255,
+    vkDevExt256, vkDevExt257, vkDevExt258, vkDevExt259,
+    vkDevExt260, vkDevExt261, vkDevExt262, vkDevExt263,
+    vkDevExt264, vkDevExt265, vkDevExt266, vkDevExt267,
+    vkDevExt268, vkDevExt269, vkDevExt270, vkDevExt271,
+    vkDevExt272, vkDevExt273, vkDevExt274, vkDevExt275,
+    vkDevExt276, vkDevExt277, vkDevExt278, vkDevExt279,
+    vkDevExt280, vkDevExt281, vkDevExt282, vkDevExt283,
+    vkDevExt284, vkDevExt285, vkDevExt286, vkDevExt287,
+    vkDevExt288, vkDevExt289, vkDevExt290, vkDevExt291,
+    vkDevExt292, vkDevExt293, vkDevExt294, vkDevExt295,
+    vkDevExt296, vkDevExt297, vkDevExt298, vkDevExt299,
+    vkDevExt300, vkDevExt301, vkDevExt302, vkDevExt303,
+    vkDevExt304, vkDevExt305, vkDevExt306, vkDevExt307,
+    vkDevExt308, vkDevExt309, vkDevExt310, vkDevExt311,
+    vkDevExt312, vkDevExt313, vkDevExt314, vkDevExt315,
+    vkDevExt316, vkDevExt317, vkDevExt318, vkDevExt319,
+    vkDevExt320, vkDevExt321, vkDevExt322, vkDevExt323,
+    vkDevExt324, vkDevExt325, vkDevExt326, vkDevExt327,
+    vkDevExt328, vkDevExt329, vkDevExt330, vkDevExt331,
+    vkDevExt332, vkDevExt333, vkDevExt334, vkDevExt335,
+    vkDevExt336, vkDevExt337, vkDevExt338, vkDevExt339,
+    vkDevExt340, vkDevExt341, vkDevExt342, vkDevExt343,
+    vkDevExt344, vkDevExt345, vkDevExt346, vkDevExt347,
+    vkDevExt348, vkDevExt349, vkDevExt350, vkDevExt351,
+    vkDevExt352, vkDevExt353, vkDevExt354, vkDevExt355,
+    vkDevExt356, vkDevExt357, vkDevExt358, vkDevExt359,
+    vkDevExt360, vkDevExt361, vkDevExt362, vkDevExt363,
+    vkDevExt364, vkDevExt365, vkDevExt366, vkDevExt367,
+    vkDevExt368, vkDevExt369, vkDevExt370, vkDevExt371,
+    vkDevExt372, vkDevExt373, vkDevExt374, vkDevExt375,
+    vkDevExt376, vkDevExt377, vkDevExt378, vkDevExt379,
+    vkDevExt380, vkDevExt381, vkDevExt382, vkDevExt383,
+    vkDevExt384, vkDevExt385, vkDevExt386, vkDevExt387,
+    vkDevExt388, vkDevExt389, vkDevExt390, vkDevExt391,
+    vkDevExt392, vkDevExt393, vkDevExt394, vkDevExt395,
+    vkDevExt396, vkDevExt397, vkDevExt398, vkDevExt399,
+    vkDevExt400, vkDevExt401, vkDevExt402, vkDevExt403,
+    vkDevExt404, vkDevExt405, vkDevExt406, vkDevExt407,
+    vkDevExt408, vkDevExt409, vkDevExt410, vkDevExt411,
+    vkDevExt412, vkDevExt413, vkDevExt414, vkDevExt415,
+    vkDevExt416, vkDevExt417, vkDevExt418, vkDevExt419,
+    vkDevExt420, vkDevExt421, vkDevExt422, vkDevExt423,
+    vkDevExt424, vkDevExt425, vkDevExt426, vkDevExt427,
+    vkDevExt428, vkDevExt429, vkDevExt430, vkDevExt431,
+    vkDevExt432, vkDevExt433, vkDevExt434, vkDevExt435,
+    vkDevExt436, vkDevExt437, vkDevExt438, vkDevExt439,
+    vkDevExt440, vkDevExt441, vkDevExt442, vkDevExt443,
+    vkDevExt444, vkDevExt445, vkDevExt446, vkDevExt447,
+    vkDevExt448, vkDevExt449, vkDevExt450, vkDevExt451,
+    vkDevExt452, vkDevExt453, vkDevExt454, vkDevExt455,
+    vkDevExt456, vkDevExt457, vkDevExt458, vkDevExt459,
+    vkDevExt460, vkDevExt461, vkDevExt462, vkDevExt463,
+    vkDevExt464, vkDevExt465, vkDevExt466, vkDevExt467,
+    vkDevExt468, vkDevExt469, vkDevExt470, vkDevExt471,
+    vkDevExt472, vkDevExt473, vkDevExt474, vkDevExt475,
+    vkDevExt476, vkDevExt477, vkDevExt478, vkDevExt479,
+    vkDevExt480, vkDevExt481, vkDevExt482, vkDevExt483,
+    vkDevExt484, vkDevExt485, vkDevExt486, vkDevExt487,
+    vkDevExt488, vkDevExt489, vkDevExt490, vkDevExt491,
+    vkDevExt492, vkDevExt493, vkDevExt494, vkDevExt495,
+    vkDevExt496, vkDevExt497, vkDevExt498, vkDevExt499,
+    vkDevExt500, vkDevExt501, vkDevExt502, vkDevExt503,
+    vkDevExt504, vkDevExt505, vkDevExt506, vkDevExt507,
+    vkDevExt508, vkDevExt509, vkDevExt510, vkDevExt511,
+    vkDevExt512, vkDevExt513, vkDevExt514, vkDevExt515,
+    vkDevExt516, vkDevExt517, vkDevExt518, vkDevExt519,
+    vkDevExt520, vkDevExt521, vkDevExt522, vkDevExt523,
+    vkDevExt524, vkDevExt525, vkDevExt526, vkDevExt527,
+    vkDevExt528, vkDevExt529, vkDevExt530, vkDevExt531,
+    vkDevExt532, vkDevExt533, vkDevExt534, vkDevExt535,
+    vkDevExt536, vkDevExt537, vkDevExt538, vkDevExt539,
+    vkDevExt540, vkDevExt541, vkDevExt542, vkDevExt543,
+    vkDevExt544, vkDevExt545, vkDevExt546, vkDevExt547,
+    vkDevExt548, vkDevExt549, vkDevExt550, vkDevExt551,
+    vkDevExt552, vkDevExt553, vkDevExt554, vkDevExt555,
+    vkDevExt556, vkDevExt557, vkDevExt558, vkDevExt559,
+    vkDevExt560, vkDevExt561, vkDevExt562, vkDevExt563,
+    vkDevExt564, vkDevExt565, vkDevExt566, vkDevExt567,
+    vkDevExt568, vkDevExt569, vkDevExt570, vkDevExt571,
+    vkDevExt572, vkDevExt573, vkDevExt574, vkDevExt575,
+    vkDevExt576, vkDevExt577, vkDevExt578, vkDevExt579,
+    vkDevExt580, vkDevExt581, vkDevExt582, vkDevExt583,
+    vkDevExt584, vkDevExt585, vkDevExt586, vkDevExt587,
+    vkDevExt588, vkDevExt589, vkDevExt590, vkDevExt591,
+    vkDevExt592, vkDevExt593, vkDevExt594, vkDevExt595,
+    vkDevExt596, vkDevExt597, vkDevExt598, vkDevExt599,
+    vkDevExt600, vkDevExt601, vkDevExt602, vkDevExt603,
+    vkDevExt604, vkDevExt605, vkDevExt606, vkDevExt607,
+    vkDevExt608, vkDevExt609, vkDevExt610, vkDevExt611,
+    vkDevExt612, vkDevExt613, vkDevExt614, vkDevExt615,
+    vkDevExt616, vkDevExt617, vkDevExt618, vkDevExt619,
+    vkDevExt620, vkDevExt621, vkDevExt622, vkDevExt623,
+    vkDevExt624, vkDevExt625, vkDevExt626, vkDevExt627,
+    vkDevExt628, vkDevExt629, vkDevExt630, vkDevExt631,
+    vkDevExt632, vkDevExt633, vkDevExt634, vkDevExt635,
+    vkDevExt636, vkDevExt637, vkDevExt638, vkDevExt639,
+    vkDevExt640, vkDevExt641, vkDevExt642, vkDevExt643,
+    vkDevExt644, vkDevExt645, vkDevExt646, vkDevExt647,
+    vkDevExt648, vkDevExt649, vkDevExt650, vkDevExt651,
+    vkDevExt652, vkDevExt653, vkDevExt654, vkDevExt655,
+    vkDevExt656, vkDevExt657, vkDevExt658, vkDevExt659,
+    vkDevExt660, vkDevExt661, vkDevExt662, vkDevExt663,
+    vkDevExt664, vkDevExt665, vkDevExt666, vkDevExt667,
+    vkDevExt668, vkDevExt669, vkDevExt670, vkDevExt671,
+    vkDevExt672, vkDevExt673, vkDevExt674, vkDevExt675,
+    vkDevExt676, vkDevExt677, vkDevExt678, vkDevExt679,
+    vkDevExt680, vkDevExt681, vkDevExt682, vkDevExt683,
+    vkDevExt684, vkDevExt685, vkDevExt686, vkDevExt687,
+    vkDevExt688, vkDevExt689, vkDevExt690, vkDevExt691,
+    vkDevExt692, vkDevExt693, vkDevExt694, vkDevExt695,
+    vkDevExt696, vkDevExt697, vkDevExt698, vkDevExt699,
+    vkDevExt700, vkDevExt701, vkDevExt702, vkDevExt703,
+    vkDevExt704, vkDevExt705, vkDevExt706, vkDevExt707,
+    vkDevExt708, vkDevExt709, vkDevExt710, vkDevExt711,
+    vkDevExt712, vkDevExt713, vkDevExt714, vkDevExt715,
+    vkDevExt716, vkDevExt717, vkDevExt718, vkDevExt719,
+    vkDevExt720, vkDevExt721, vkDevExt722, vkDevExt723,
+    vkDevExt724, vkDevExt725, vkDevExt726, vkDevExt727,
+    vkDevExt728, vkDevExt729, vkDevExt730, vkDevExt731,
+    vkDevExt732, vkDevExt733, vkDevExt734, vkDevExt735,
+    vkDevExt736, vkDevExt737, vkDevExt738, vkDevExt739,
+    vkDevExt740, vkDevExt741, vkDevExt742, vkDevExt743,
+    vkDevExt744, vkDevExt745, vkDevExt746, vkDevExt747,
+    vkDevExt748, vkDevExt749, vkDevExt750, vkDevExt751,
+    vkDevExt752, vkDevExt753, vkDevExt754, vkDevExt755,
+    vkDevExt756, vkDevExt757, vkDevExt758, vkDevExt759,
+    vkDevExt760, vkDevExt761, vkDevExt762, vkDevExt763,
+    vkDevExt764, vkDevExt765, vkDevExt766, vkDevExt767,
+    vkDevExt768, vkDevExt769, vkDevExt770, vkDevExt771,
+    vkDevExt772, vkDevExt773, vkDevExt774, vkDevExt775,
+    vkDevExt776, vkDevExt777, vkDevExt778, vkDevExt779,
+    vkDevExt780, vkDevExt781, vkDevExt782, vkDevExt783,
+    vkDevExt784, vkDevExt785, vkDevExt786, vkDevExt787,
+    vkDevExt788, vkDevExt789, vkDevExt790, vkDevExt791,
+    vkDevExt792, vkDevExt793, vkDevExt794, vkDevExt795,
+    vkDevExt796, vkDevExt797, vkDevExt798, vkDevExt799,
+    vkDevExt800, vkDevExt801, vkDevExt802, vkDevExt803,
+    vkDevExt804, vkDevExt805, vkDevExt806, vkDevExt807,
+    vkDevExt808, vkDevExt809, vkDevExt810, vkDevExt811,
+    vkDevExt812, vkDevExt813, vkDevExt814, vkDevExt815,
+    vkDevExt816, vkDevExt817, vkDevExt818, vkDevExt819,
+    vkDevExt820, vkDevExt821, vkDevExt822, vkDevExt823,
+    vkDevExt824, vkDevExt825, vkDevExt826, vkDevExt827,
+    vkDevExt828, vkDevExt829, vkDevExt830, vkDevExt831,
+    vkDevExt832, vkDevExt833, vkDevExt834, vkDevExt835,
+    vkDevExt836, vkDevExt837, vkDevExt838, vkDevExt839,
+    vkDevExt840, vkDevExt841, vkDevExt842, vkDevExt843,
+    vkDevExt844, vkDevExt845, vkDevExt846, vkDevExt847,
+    vkDevExt848, vkDevExt849, vkDevExt850, vkDevExt851,
+    vkDevExt852, vkDevExt853, vkDevExt854, vkDevExt855,
+    vkDevExt856, vkDevExt857, vkDevExt858, vkDevExt859,
+    vkDevExt860, vkDevExt861, vkDevExt862, vkDevExt863,
+    vkDevExt864, vkDevExt865, vkDevExt866, vkDevExt867,
+    vkDevExt868, vkDevExt869, vkDevExt870, vkDevExt871,
+    vkDevExt872, vkDevExt873, vkDevExt874, vkDevExt875,
+    vkDevExt876, vkDevExt877, vkDevExt878, vkDevExt879,
+    vkDevExt880, vkDevExt881, vkDevExt882, vkDevExt883,
+    vkDevExt884, vkDevExt885, vkDevExt886, vkDevExt887,
+    vkDevExt888, vkDevExt889, vkDevExt890, vkDevExt891,
+    vkDevExt892, vkDevExt893, vkDevExt894, vkDevExt895,
+    vkDevExt896, vkDevExt897, vkDevExt898, vkDevExt899,
+    vkDevExt900, vkDevExt901, vkDevExt902, vkDevExt903,
+    vkDevExt904, vkDevExt905, vkDevExt906, vkDevExt907,
+    vkDevExt908, vkDevExt909, vkDevExt910, vkDevExt911,
+    vkDevExt912, vkDevExt913, vkDevExt914, vkDevExt915,
+    vkDevExt916, vkDevExt917, vkDevExt918, vkDevExt919,
+    vkDevExt920, vkDevExt921, vkDevExt922, vkDevExt923,
+    vkDevExt924, vkDevExt925, vkDevExt926, vkDevExt927,
+    vkDevExt928, vkDevExt929, vkDevExt930, vkDevExt931,
+    vkDevExt932, vkDevExt933, vkDevExt934, vkDevExt935,
+    vkDevExt936, vkDevExt937, vkDevExt938, vkDevExt939,
+    vkDevExt940, vkDevExt941, vkDevExt942, vkDevExt943,
+    vkDevExt944, vkDevExt945, vkDevExt946, vkDevExt947,
+    vkDevExt948, vkDevExt949, vkDevExt950, vkDevExt951,
+    vkDevExt952, vkDevExt953, vkDevExt954, vkDevExt955,
+    vkDevExt956, vkDevExt957, vkDevExt958, vkDevExt959,
+    vkDevExt960, vkDevExt961, vkDevExt962, vkDevExt963,
+    vkDevExt964, vkDevExt965, vkDevExt966, vkDevExt967,
+    vkDevExt968, vkDevExt969, vkDevExt970, vkDevExt971,
+    vkDevExt972, vkDevExt973, vkDevExt974, vkDevExt975,
+    vkDevExt976, vkDevExt977, vkDevExt978, vkDevExt979,
+    vkDevExt980, vkDevExt981, vkDevExt982, vkDevExt983,
+    vkDevExt984, vkDevExt985, vkDevExt986, vkDevExt987,
+    vkDevExt988, vkDevExt989, vkDevExt990, vkDevExt991,
+    vkDevExt992, vkDevExt993, vkDevExt994, vkDevExt995,
+    vkDevExt996, vkDevExt997, vkDevExt998, vkDevExt999,
+    vkDevExt1000, vkDevExt1001, vkDevExt1002, vkDevExt1003,
+    vkDevExt1004, vkDevExt1005, vkDevExt1006, vkDevExt1007,
+    vkDevExt1008, vkDevExt1009, vkDevExt1010, vkDevExt1011,
+    vkDevExt1012, vkDevExt1013, vkDevExt1014, vkDevExt1015,
+    vkDevExt1016, vkDevExt1017, vkDevExt1018, vkDevExt1019,
+    vkDevExt1020, vkDevExt1021, vkDevExt1022, vkDevExt1023,
+};
+
+void *loader_get_static_dev_ext_trampoline(uint32_t index) {
+    if (index >= NUM_STATIC_DEV_EXTS)
+        return NULL;
+    return (void *)loader_dev_ext_trampolines[index];
 }
@@ -0,0 +1,423 @@
+/* THIS FILE IS GENERATED.  DO NOT EDIT. */
+
+/*
+ * Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DISPATCH_LOOKUP_H
+#define DISPATCH_LOOKUP_H
+
+#include <stddef.h>
+#include <string.h>
+#include <vulkan/vulkan.h>
+#include <vulkan/vk_layer.h>
+
+// Entry point names without their "vk" prefix, each sorted by name for
+// loader_find_name()
+struct loader_dispatch_name {
+    const char *name;
+    // Of the entry point in its dispatch table
+    size_t offset;
+};
+
+struct loader_trampoline_name {
+    const char *name;
+    PFN_vkVoidFunction addr;
+};
+
+#define LOADER_DEVICE_ENTRY(func)                                              \
+    { #func, offsetof(VkLayerDispatchTable, func) }
+#define LOADER_INSTANCE_ENTRY(func)                                            \
+    { #func, offsetof(VkLayerInstanceDispatchTable, func) }
+#define LOADER_TRAMPOLINE_ENTRY(func)                                          \
+    { #func, (PFN_vkVoidFunction)vk##func }
+
+static inline const struct loader_dispatch_name *
+loader_device_names(size_t *count) {
+    static const struct loader_dispatch_name names[] = {
+        LOADER_DEVICE_ENTRY(AcquireNextImageKHR),
+        LOADER_DEVICE_ENTRY(AllocateCommandBuffers),
+        LOADER_DEVICE_ENTRY(AllocateDescriptorSets),
+        LOADER_DEVICE_ENTRY(AllocateMemory),
+        LOADER_DEVICE_ENTRY(BeginCommandBuffer),
+        LOADER_DEVICE_ENTRY(BindBufferMemory),
+        LOADER_DEVICE_ENTRY(BindImageMemory),
+        LOADER_DEVICE_ENTRY(CmdBeginQuery),
+        LOADER_DEVICE_ENTRY(CmdBeginRenderPass),
+        LOADER_DEVICE_ENTRY(CmdBindDescriptorSets),
+        LOADER_DEVICE_ENTRY(CmdBindIndexBuffer),
+        LOADER_DEVICE_ENTRY(CmdBindPipeline),
+        LOADER_DEVICE_ENTRY(CmdBindVertexBuffers),
+        LOADER_DEVICE_ENTRY(CmdBlitImage),
+        LOADER_DEVICE_ENTRY(CmdClearAttachments),
+        LOADER_DEVICE_ENTRY(CmdClearColorImage),
+        LOADER_DEVICE_ENTRY(CmdClearDepthStencilImage),
+        LOADER_DEVICE_ENTRY(CmdCopyBuffer),
+        LOADER_DEVICE_ENTRY(CmdCopyBufferToImage),
+        LOADER_DEVICE_ENTRY(CmdCopyImage),
+        LOADER_DEVICE_ENTRY(CmdCopyImageToBuffer),
+        LOADER_DEVICE_ENTRY(CmdCopyQueryPoolResults),
+        LOADER_DEVICE_ENTRY(CmdDispatch),
+        LOADER_DEVICE_ENTRY(CmdDispatchIndirect),
+        LOADER_DEVICE_ENTRY(CmdDraw),
+        LOADER_DEVICE_ENTRY(CmdDrawIndexed),
+        LOADER_DEVICE_ENTRY(CmdDrawIndexedIndirect),
+        LOADER_DEVICE_ENTRY(CmdDrawIndirect),
+        LOADER_DEVICE_ENTRY(CmdEndQuery),
+        LOADER_DEVICE_ENTRY(CmdEndRenderPass),
+        LOADER_DEVICE_ENTRY(CmdExecuteCommands),
+        LOADER_DEVICE_ENTRY(CmdFillBuffer),
+        LOADER_DEVICE_ENTRY(CmdNextSubpass),
+        LOADER_DEVICE_ENTRY(CmdPipelineBarrier),
+        LOADER_DEVICE_ENTRY(CmdPushConstants),
+        LOADER_DEVICE_ENTRY(CmdResetEvent),
+        LOADER_DEVICE_ENTRY(CmdResetQueryPool),
+        LOADER_DEVICE_ENTRY(CmdResolveImage),
+        LOADER_DEVICE_ENTRY(CmdSetBlendConstants),
+        LOADER_DEVICE_ENTRY(CmdSetDepthBias),
+        LOADER_DEVICE_ENTRY(CmdSetDepthBounds),
+        LOADER_DEVICE_ENTRY(CmdSetEvent),
+        LOADER_DEVICE_ENTRY(CmdSetLineWidth),
+        LOADER_DEVICE_ENTRY(CmdSetScissor),
+        LOADER_DEVICE_ENTRY(CmdSetStencilCompareMask),
+        LOADER_DEVICE_ENTRY(CmdSetStencilReference),
+        LOADER_DEVICE_ENTRY(CmdSetStencilWriteMask),
+        LOADER_DEVICE_ENTRY(CmdSetViewport),
+        LOADER_DEVICE_ENTRY(CmdUpdateBuffer),
+        LOADER_DEVICE_ENTRY(CmdWaitEvents),
+        LOADER_DEVICE_ENTRY(CmdWriteTimestamp),
+        LOADER_DEVICE_ENTRY(CreateBuffer),
+        LOADER_DEVICE_ENTRY(CreateBufferView),
+        LOADER_DEVICE_ENTRY(CreateCommandPool),
+        LOADER_DEVICE_ENTRY(CreateComputePipelines),
+        LOADER_DEVICE_ENTRY(CreateDescriptorPool),
+        LOADER_DEVICE_ENTRY(CreateDescriptorSetLayout),
+        LOADER_DEVICE_ENTRY(CreateEvent),
+        LOADER_DEVICE_ENTRY(CreateFence),
+        LOADER_DEVICE_ENTRY(CreateFramebuffer),
+        LOADER_DEVICE_ENTRY(CreateGraphicsPipelines),
+        LOADER_DEVICE_ENTRY(CreateImage),
+        LOADER_DEVICE_ENTRY(CreateImageView),
+        LOADER_DEVICE_ENTRY(CreatePipelineCache),
+        LOADER_DEVICE_ENTRY(CreatePipelineLayout),
+        LOADER_DEVICE_ENTRY(CreateQueryPool),
+        LOADER_DEVICE_ENTRY(CreateRenderPass),
+        LOADER_DEVICE_ENTRY(CreateSampler),
+        LOADER_DEVICE_ENTRY(CreateSemaphore),
+        LOADER_DEVICE_ENTRY(CreateShaderModule),
+        LOADER_DEVICE_ENTRY(CreateSwapchainKHR),
+        LOADER_DEVICE_ENTRY(DestroyBuffer),
+        LOADER_DEVICE_ENTRY(DestroyBufferView),
+        LOADER_DEVICE_ENTRY(DestroyCommandPool),
+        LOADER_DEVICE_ENTRY(DestroyDescriptorPool),
+        LOADER_DEVICE_ENTRY(DestroyDescriptorSetLayout),
+        LOADER_DEVICE_ENTRY(DestroyDevice),
+        LOADER_DEVICE_ENTRY(DestroyEvent),
+        LOADER_DEVICE_ENTRY(DestroyFence),
+        LOADER_DEVICE_ENTRY(DestroyFramebuffer),
+        LOADER_DEVICE_ENTRY(DestroyImage),
+        LOADER_DEVICE_ENTRY(DestroyImageView),
+        LOADER_DEVICE_ENTRY(DestroyPipeline),
+        LOADER_DEVICE_ENTRY(DestroyPipelineCache),
+        LOADER_DEVICE_ENTRY(DestroyPipelineLayout),
+        LOADER_DEVICE_ENTRY(DestroyQueryPool),
+        LOADER_DEVICE_ENTRY(DestroyRenderPass),
+        LOADER_DEVICE_ENTRY(DestroySampler),
+        LOADER_DEVICE_ENTRY(DestroySemaphore),
+        LOADER_DEVICE_ENTRY(DestroyShaderModule),
+        LOADER_DEVICE_ENTRY(DestroySwapchainKHR),
+        LOADER_DEVICE_ENTRY(DeviceWaitIdle),
+        LOADER_DEVICE_ENTRY(EndCommandBuffer),
+        LOADER_DEVICE_ENTRY(FlushMappedMemoryRanges),
+        LOADER_DEVICE_ENTRY(FreeCommandBuffers),
+        LOADER_DEVICE_ENTRY(FreeDescriptorSets),
+        LOADER_DEVICE_ENTRY(FreeMemory),
+        LOADER_DEVICE_ENTRY(GetBufferMemoryRequirements),
+        LOADER_DEVICE_ENTRY(GetDeviceMemoryCommitment),
+        LOADER_DEVICE_ENTRY(GetDeviceProcAddr),
+        LOADER_DEVICE_ENTRY(GetDeviceQueue),
+        LOADER_DEVICE_ENTRY(GetEventStatus),
+        LOADER_DEVICE_ENTRY(GetFenceStatus),
+        LOADER_DEVICE_ENTRY(GetImageMemoryRequirements),
+        LOADER_DEVICE_ENTRY(GetImageSparseMemoryRequirements),
+        LOADER_DEVICE_ENTRY(GetImageSubresourceLayout),
+        LOADER_DEVICE_ENTRY(GetPipelineCacheData),
+        LOADER_DEVICE_ENTRY(GetQueryPoolResults),
+        LOADER_DEVICE_ENTRY(GetRenderAreaGranularity),
+        LOADER_DEVICE_ENTRY(GetSwapchainImagesKHR),
+        LOADER_DEVICE_ENTRY(InvalidateMappedMemoryRanges),
+        LOADER_DEVICE_ENTRY(MapMemory),
+        LOADER_DEVICE_ENTRY(MergePipelineCaches),
+        LOADER_DEVICE_ENTRY(QueueBindSparse),
+        LOADER_DEVICE_ENTRY(QueuePresentKHR),
+        LOADER_DEVICE_ENTRY(QueueSubmit),
+        LOADER_DEVICE_ENTRY(QueueWaitIdle),
+        LOADER_DEVICE_ENTRY(ResetCommandBuffer),
+        LOADER_DEVICE_ENTRY(ResetCommandPool),
+        LOADER_DEVICE_ENTRY(ResetDescriptorPool),
+        LOADER_DEVICE_ENTRY(ResetEvent),
+        LOADER_DEVICE_ENTRY(ResetFences),
+        LOADER_DEVICE_ENTRY(SetEvent),
+        LOADER_DEVICE_ENTRY(UnmapMemory),
+        LOADER_DEVICE_ENTRY(UpdateDescriptorSets),
+        LOADER_DEVICE_ENTRY(WaitForFences),
+    };
+    *count = sizeof(names) / sizeof(names[0]);
+    return names;
+}
+
+static inline const struct loader_dispatch_name *
+loader_instance_names(size_t *count) {
+    static const struct loader_dispatch_name names[] = {
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        LOADER_INSTANCE_ENTRY(CreateAndroidSurfaceKHR),
+#endif
+        LOADER_INSTANCE_ENTRY(CreateDebugReportCallbackEXT),
+        LOADER_INSTANCE_ENTRY(CreateDisplayModeKHR),
+        LOADER_INSTANCE_ENTRY(CreateDisplayPlaneSurfaceKHR),
+#ifdef VK_USE_PLATFORM_MIR_KHR
+        LOADER_INSTANCE_ENTRY(CreateMirSurfaceKHR),
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+        LOADER_INSTANCE_ENTRY(CreateWaylandSurfaceKHR),
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        LOADER_INSTANCE_ENTRY(CreateWin32SurfaceKHR),
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+        LOADER_INSTANCE_ENTRY(CreateXcbSurfaceKHR),
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+        LOADER_INSTANCE_ENTRY(CreateXlibSurfaceKHR),
+#endif
+        LOADER_INSTANCE_ENTRY(DebugReportMessageEXT),
+        LOADER_INSTANCE_ENTRY(DestroyDebugReportCallbackEXT),
+        LOADER_INSTANCE_ENTRY(DestroyInstance),
+        LOADER_INSTANCE_ENTRY(DestroySurfaceKHR),
+        LOADER_INSTANCE_ENTRY(EnumerateDeviceExtensionProperties),
+        LOADER_INSTANCE_ENTRY(EnumerateDeviceLayerProperties),
+        LOADER_INSTANCE_ENTRY(EnumeratePhysicalDevices),
+        LOADER_INSTANCE_ENTRY(GetDisplayModePropertiesKHR),
+        LOADER_INSTANCE_ENTRY(GetDisplayPlaneCapabilitiesKHR),
+        LOADER_INSTANCE_ENTRY(GetDisplayPlaneSupportedDisplaysKHR),
+        LOADER_INSTANCE_ENTRY(GetInstanceProcAddr),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceDisplayPlanePropertiesKHR),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceDisplayPropertiesKHR),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceFeatures),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceFormatProperties),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceImageFormatProperties),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceMemoryProperties),
+#ifdef VK_USE_PLATFORM_MIR_KHR
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceMirPresentationSupportKHR),
+#endif
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceProperties),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceQueueFamilyProperties),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceSparseImageFormatProperties),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceSurfaceCapabilitiesKHR),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceSurfaceFormatsKHR),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceSurfacePresentModesKHR),
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceSurfaceSupportKHR),
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceWaylandPresentationSupportKHR),
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceWin32PresentationSupportKHR),
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceXcbPresentationSupportKHR),
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+        LOADER_INSTANCE_ENTRY(GetPhysicalDeviceXlibPresentationSupportKHR),
+#endif
+    };
+    *count = sizeof(names) / sizeof(names[0]);
+    return names;
+}
+
+static inline const struct loader_trampoline_name *
+loader_trampoline_names(size_t *count) {
+    static const struct loader_trampoline_name names[] = {
+        LOADER_TRAMPOLINE_ENTRY(AllocateCommandBuffers),
+        LOADER_TRAMPOLINE_ENTRY(AllocateDescriptorSets),
+        LOADER_TRAMPOLINE_ENTRY(AllocateMemory),
+        LOADER_TRAMPOLINE_ENTRY(BeginCommandBuffer),
+        LOADER_TRAMPOLINE_ENTRY(BindBufferMemory),
+        LOADER_TRAMPOLINE_ENTRY(BindImageMemory),
+        LOADER_TRAMPOLINE_ENTRY(CmdBeginQuery),
+        LOADER_TRAMPOLINE_ENTRY(CmdBeginRenderPass),
+        LOADER_TRAMPOLINE_ENTRY(CmdBindDescriptorSets),
+        LOADER_TRAMPOLINE_ENTRY(CmdBindIndexBuffer),
+        LOADER_TRAMPOLINE_ENTRY(CmdBindPipeline),
+        LOADER_TRAMPOLINE_ENTRY(CmdBindVertexBuffers),
+        LOADER_TRAMPOLINE_ENTRY(CmdBlitImage),
+        LOADER_TRAMPOLINE_ENTRY(CmdClearAttachments),
+        LOADER_TRAMPOLINE_ENTRY(CmdClearColorImage),
+        LOADER_TRAMPOLINE_ENTRY(CmdClearDepthStencilImage),
+        LOADER_TRAMPOLINE_ENTRY(CmdCopyBuffer),
+        LOADER_TRAMPOLINE_ENTRY(CmdCopyBufferToImage),
+        LOADER_TRAMPOLINE_ENTRY(CmdCopyImage),
+        LOADER_TRAMPOLINE_ENTRY(CmdCopyImageToBuffer),
+        LOADER_TRAMPOLINE_ENTRY(CmdCopyQueryPoolResults),
+        LOADER_TRAMPOLINE_ENTRY(CmdDispatch),
+        LOADER_TRAMPOLINE_ENTRY(CmdDispatchIndirect),
+        LOADER_TRAMPOLINE_ENTRY(CmdDraw),
+        LOADER_TRAMPOLINE_ENTRY(CmdDrawIndexed),
+        LOADER_TRAMPOLINE_ENTRY(CmdDrawIndexedIndirect),
+        LOADER_TRAMPOLINE_ENTRY(CmdDrawIndirect),
+        LOADER_TRAMPOLINE_ENTRY(CmdEndQuery),
+        LOADER_TRAMPOLINE_ENTRY(CmdEndRenderPass),
+        LOADER_TRAMPOLINE_ENTRY(CmdExecuteCommands),
+        LOADER_TRAMPOLINE_ENTRY(CmdFillBuffer),
+        LOADER_TRAMPOLINE_ENTRY(CmdNextSubpass),
+        LOADER_TRAMPOLINE_ENTRY(CmdPipelineBarrier),
+        LOADER_TRAMPOLINE_ENTRY(CmdPushConstants),
+        LOADER_TRAMPOLINE_ENTRY(CmdResetEvent),
+        LOADER_TRAMPOLINE_ENTRY(CmdResetQueryPool),
+        LOADER_TRAMPOLINE_ENTRY(CmdResolveImage),
+        LOADER_TRAMPOLINE_ENTRY(CmdSetBlendConstants),
+        LOADER_TRAMPOLINE_ENTRY(CmdSetDepthBias),
+        LOADER_TRAMPOLINE_ENTRY(CmdSetDepthBounds),
+        LOADER_TRAMPOLINE_ENTRY(CmdSetEvent),
+        LOADER_TRAMPOLINE_ENTRY(CmdSetLineWidth),
+        LOADER_TRAMPOLINE_ENTRY(CmdSetScissor),
+        LOADER_TRAMPOLINE_ENTRY(CmdSetStencilCompareMask),
+        LOADER_TRAMPOLINE_ENTRY(CmdSetStencilReference),
+        LOADER_TRAMPOLINE_ENTRY(CmdSetStencilWriteMask),
+        LOADER_TRAMPOLINE_ENTRY(CmdSetViewport),
+        LOADER_TRAMPOLINE_ENTRY(CmdUpdateBuffer),
+        LOADER_TRAMPOLINE_ENTRY(CmdWaitEvents),
+        LOADER_TRAMPOLINE_ENTRY(CmdWriteTimestamp),
+        LOADER_TRAMPOLINE_ENTRY(CreateBuffer),
+        LOADER_TRAMPOLINE_ENTRY(CreateBufferView),
+        LOADER_TRAMPOLINE_ENTRY(CreateCommandPool),
+        LOADER_TRAMPOLINE_ENTRY(CreateComputePipelines),
+        LOADER_TRAMPOLINE_ENTRY(CreateDescriptorPool),
+        LOADER_TRAMPOLINE_ENTRY(CreateDescriptorSetLayout),
+        LOADER_TRAMPOLINE_ENTRY(CreateDevice),
+        LOADER_TRAMPOLINE_ENTRY(CreateEvent),
+        LOADER_TRAMPOLINE_ENTRY(CreateFence),
+        LOADER_TRAMPOLINE_ENTRY(CreateFramebuffer),
+        LOADER_TRAMPOLINE_ENTRY(CreateGraphicsPipelines),
+        LOADER_TRAMPOLINE_ENTRY(CreateImage),
+        LOADER_TRAMPOLINE_ENTRY(CreateImageView),
+        LOADER_TRAMPOLINE_ENTRY(CreatePipelineCache),
+        LOADER_TRAMPOLINE_ENTRY(CreatePipelineLayout),
+        LOADER_TRAMPOLINE_ENTRY(CreateQueryPool),
+        LOADER_TRAMPOLINE_ENTRY(CreateRenderPass),
+        LOADER_TRAMPOLINE_ENTRY(CreateSampler),
+        LOADER_TRAMPOLINE_ENTRY(CreateSemaphore),
+        LOADER_TRAMPOLINE_ENTRY(CreateShaderModule),
+        LOADER_TRAMPOLINE_ENTRY(DestroyBuffer),
+        LOADER_TRAMPOLINE_ENTRY(DestroyBufferView),
+        LOADER_TRAMPOLINE_ENTRY(DestroyCommandPool),
+        LOADER_TRAMPOLINE_ENTRY(DestroyDescriptorPool),
+        LOADER_TRAMPOLINE_ENTRY(DestroyDescriptorSetLayout),
+        LOADER_TRAMPOLINE_ENTRY(DestroyDevice),
+        LOADER_TRAMPOLINE_ENTRY(DestroyEvent),
+        LOADER_TRAMPOLINE_ENTRY(DestroyFence),
+        LOADER_TRAMPOLINE_ENTRY(DestroyFramebuffer),
+        LOADER_TRAMPOLINE_ENTRY(DestroyImage),
+        LOADER_TRAMPOLINE_ENTRY(DestroyImageView),
+        LOADER_TRAMPOLINE_ENTRY(DestroyInstance),
+        LOADER_TRAMPOLINE_ENTRY(DestroyPipeline),
+        LOADER_TRAMPOLINE_ENTRY(DestroyPipelineCache),
+        LOADER_TRAMPOLINE_ENTRY(DestroyPipelineLayout),
+        LOADER_TRAMPOLINE_ENTRY(DestroyQueryPool),
+        LOADER_TRAMPOLINE_ENTRY(DestroyRenderPass),
+        LOADER_TRAMPOLINE_ENTRY(DestroySampler),
+        LOADER_TRAMPOLINE_ENTRY(DestroySemaphore),
+        LOADER_TRAMPOLINE_ENTRY(DestroyShaderModule),
+        LOADER_TRAMPOLINE_ENTRY(DeviceWaitIdle),
+        LOADER_TRAMPOLINE_ENTRY(EndCommandBuffer),
+        LOADER_TRAMPOLINE_ENTRY(EnumerateDeviceExtensionProperties),
+        LOADER_TRAMPOLINE_ENTRY(EnumerateDeviceLayerProperties),
+        LOADER_TRAMPOLINE_ENTRY(EnumeratePhysicalDevices),
+        LOADER_TRAMPOLINE_ENTRY(FlushMappedMemoryRanges),
+        LOADER_TRAMPOLINE_ENTRY(FreeCommandBuffers),
+        LOADER_TRAMPOLINE_ENTRY(FreeDescriptorSets),
+        LOADER_TRAMPOLINE_ENTRY(FreeMemory),
+        LOADER_TRAMPOLINE_ENTRY(GetBufferMemoryRequirements),
+        LOADER_TRAMPOLINE_ENTRY(GetDeviceMemoryCommitment),
+        LOADER_TRAMPOLINE_ENTRY(GetDeviceProcAddr),
+        LOADER_TRAMPOLINE_ENTRY(GetDeviceQueue),
+        LOADER_TRAMPOLINE_ENTRY(GetEventStatus),
+        LOADER_TRAMPOLINE_ENTRY(GetFenceStatus),
+        LOADER_TRAMPOLINE_ENTRY(GetImageMemoryRequirements),
+        LOADER_TRAMPOLINE_ENTRY(GetImageSparseMemoryRequirements),
+        LOADER_TRAMPOLINE_ENTRY(GetImageSubresourceLayout),
+        LOADER_TRAMPOLINE_ENTRY(GetInstanceProcAddr),
+        LOADER_TRAMPOLINE_ENTRY(GetPhysicalDeviceFeatures),
+        LOADER_TRAMPOLINE_ENTRY(GetPhysicalDeviceFormatProperties),
+        LOADER_TRAMPOLINE_ENTRY(GetPhysicalDeviceImageFormatProperties),
+        LOADER_TRAMPOLINE_ENTRY(GetPhysicalDeviceMemoryProperties),
+        LOADER_TRAMPOLINE_ENTRY(GetPhysicalDeviceProperties),
+        LOADER_TRAMPOLINE_ENTRY(GetPhysicalDeviceQueueFamilyProperties),
+        LOADER_TRAMPOLINE_ENTRY(GetPhysicalDeviceSparseImageFormatProperties),
+        LOADER_TRAMPOLINE_ENTRY(GetPipelineCacheData),
+        LOADER_TRAMPOLINE_ENTRY(GetQueryPoolResults),
+        LOADER_TRAMPOLINE_ENTRY(GetRenderAreaGranularity),
+        LOADER_TRAMPOLINE_ENTRY(InvalidateMappedMemoryRanges),
+        LOADER_TRAMPOLINE_ENTRY(MapMemory),
+        LOADER_TRAMPOLINE_ENTRY(MergePipelineCaches),
+        LOADER_TRAMPOLINE_ENTRY(QueueBindSparse),
+        LOADER_TRAMPOLINE_ENTRY(QueueSubmit),
+        LOADER_TRAMPOLINE_ENTRY(QueueWaitIdle),
+        LOADER_TRAMPOLINE_ENTRY(ResetCommandBuffer),
+        LOADER_TRAMPOLINE_ENTRY(ResetCommandPool),
+        LOADER_TRAMPOLINE_ENTRY(ResetDescriptorPool),
+        LOADER_TRAMPOLINE_ENTRY(ResetEvent),
+        LOADER_TRAMPOLINE_ENTRY(ResetFences),
+        LOADER_TRAMPOLINE_ENTRY(SetEvent),
+        LOADER_TRAMPOLINE_ENTRY(UnmapMemory),
+        LOADER_TRAMPOLINE_ENTRY(UpdateDescriptorSets),
+        LOADER_TRAMPOLINE_ENTRY(WaitForFences),
+    };
+    *count = sizeof(names) / sizeof(names[0]);
+    return names;
+}
+
+#undef LOADER_DEVICE_ENTRY
+#undef LOADER_INSTANCE_ENTRY
+#undef LOADER_TRAMPOLINE_ENTRY
+
+/**
+ * Binary search count entries, stride bytes apart and each starting with a
+ * name, for name.
+ *
+ * \returns
+ * The index of the entry, or -1 if there is none.
+ */
+static inline int loader_find_name(const void *entries, size_t stride,
+                                   size_t count, const char *name) {
+    size_t low = 0;
+    size_t high = count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        const char *entry =
+            *(const char *const *)((const char *)entries + mid * stride);
+        int order = strcmp(name, entry);
+        if (order == 0)
+            return (int)mid;
+        if (order < 0)
+            high = mid;
+        else
+            low = mid + 1;
+    }
+    return -1;
+}
+
+#endif // DISPATCH_LOOKUP_H
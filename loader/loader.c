@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <string.h>
 
 #include <sys/types.h>
@@ -80,6 +81,8 @@ uint32_t g_loader_log_msgs = 0;
 // additionally CreateDevice and DestroyDevice needs to be locked
 loader_platform_thread_mutex loader_lock;
 loader_platform_thread_mutex loader_json_lock;
+// guards loader_dev_ext_code
+static loader_platform_thread_mutex loader_dev_ext_code_lock;
 
 const char *std_validation_str = "VK_LAYER_LUNARG_standard_validation";
 
@@ -159,9 +162,9 @@ const VkLayerInstanceDispatchTable instance_disp = {
 
 LOADER_PLATFORM_THREAD_ONCE_DECLARATION(once_init);
 
-void *loader_instance_heap_alloc(const struct loader_instance *instance,
-                                 size_t size,
-                                 VkSystemAllocationScope alloc_scope) {
+static void *loader_callback_alloc(const struct loader_instance *instance,
+                                   size_t size,
+                                   VkSystemAllocationScope alloc_scope) {
     void *pMemory = NULL;
 #if (DEBUG_DISABLE_APP_ALLOCATORS == 1)
     {
@@ -180,19 +183,155 @@ void *loader_instance_heap_alloc(const struct loader_instance *instance,
     return pMemory;
 }
 
-void loader_instance_heap_free(const struct loader_instance *instance,
-                               void *pMemory) {
-    if (pMemory != NULL) {
+static void loader_callback_free(const struct loader_instance *instance,
+                                 void *pMemory) {
 #if (DEBUG_DISABLE_APP_ALLOCATORS == 1)
-        {
+    {
 #else
-        if (instance && instance->alloc_callbacks.pfnFree) {
-            instance->alloc_callbacks.pfnFree(
-                instance->alloc_callbacks.pUserData, pMemory);
-        } else {
+    if (instance && instance->alloc_callbacks.pfnFree) {
+        instance->alloc_callbacks.pfnFree(instance->alloc_callbacks.pUserData,
+                                          pMemory);
+    } else {
 #endif
-            free(pMemory);
+        free(pMemory);
+    }
+}
+
+// Size of the blocks instance bookkeeping is carved out of.  Allocations of
+// more than a quarter of this get a block of their own.
+#define LOADER_ARENA_BLOCK_SIZE (64 * 1024)
+#define LOADER_ARENA_ALIGN(size) (((size) + 7) & ~(size_t)7)
+
+struct loader_arena_block {
+    struct loader_arena_block *next;
+    size_t size;
+    size_t used;
+};
+
+#define LOADER_ARENA_HEADER_SIZE                                              \
+    LOADER_ARENA_ALIGN(sizeof(struct loader_arena_block))
+
+static char *loader_arena_data(struct loader_arena_block *block) {
+    return (char *)block + LOADER_ARENA_HEADER_SIZE;
+}
+
+static bool loader_arena_owns(const struct loader_arena *arena,
+                              const void *pMemory) {
+    for (struct loader_arena_block *block = arena->blocks; block;
+         block = block->next) {
+        const char *data = loader_arena_data(block);
+        if ((const char *)pMemory >= data &&
+            (const char *)pMemory < data + block->size)
+            return true;
+    }
+    return false;
+}
+
+static void *loader_arena_alloc(const struct loader_instance *instance,
+                                size_t size) {
+    // The arena belongs to the instance being created, see struct loader_arena
+    struct loader_arena *arena = (struct loader_arena *)&instance->arena;
+    struct loader_arena_block *block = arena->blocks;
+    void *pMemory;
+
+    size = LOADER_ARENA_ALIGN(size ? size : 1);
+    if (!block || block->size - block->used < size) {
+        size_t data_size = LOADER_ARENA_BLOCK_SIZE;
+        if (size > LOADER_ARENA_BLOCK_SIZE / 4)
+            data_size = size;
+        block = loader_callback_alloc(instance,
+                                      LOADER_ARENA_HEADER_SIZE + data_size,
+                                      VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (!block)
+            return NULL;
+        block->size = data_size;
+        block->used = 0;
+        if (data_size == size && arena->blocks) {
+            // Keep carving from the current block
+            block->next = arena->blocks->next;
+            arena->blocks->next = block;
+        } else {
+            block->next = arena->blocks;
+            arena->blocks = block;
         }
+        arena->block_count++;
+        arena->block_bytes += data_size;
+    }
+
+    pMemory = loader_arena_data(block) + block->used;
+    block->used += size;
+    if (block == arena->blocks)
+        arena->last = pMemory;
+    arena->alloc_count++;
+    return pMemory;
+}
+
+// Grow pMemory, which must be the arena's last allocation, in place if it fits
+static bool loader_arena_grow(const struct loader_instance *instance,
+                              void *pMemory, size_t orig_size, size_t size) {
+    struct loader_arena *arena = (struct loader_arena *)&instance->arena;
+    struct loader_arena_block *block = arena->blocks;
+    size_t start = (char *)pMemory - loader_arena_data(block);
+    size_t end = start + LOADER_ARENA_ALIGN(size);
+
+    if (pMemory != arena->last || end > block->size ||
+        start + LOADER_ARENA_ALIGN(orig_size) != block->used)
+        return false;
+    block->used = end;
+    return true;
+}
+
+// Start carving instance scope allocations out of the arena
+void loader_instance_arena_begin(struct loader_instance *instance) {
+    instance->arena.enabled = true;
+}
+
+// Stop adding to the arena, once the instance is created
+void loader_instance_arena_end(struct loader_instance *instance) {
+    struct loader_arena *arena = &instance->arena;
+
+    arena->enabled = false;
+    if (arena->alloc_count > 0)
+        loader_log(instance, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, 0,
+                   "Instance bookkeeping took %u allocations, made from %u "
+                   "blocks of %lu bytes in all",
+                   arena->alloc_count, arena->block_count,
+                   (unsigned long)arena->block_bytes);
+}
+
+/**
+ * Free everything carved out of the instance's arena, which must be done
+ * after the last use of its bookkeeping and before freeing the instance
+ * itself.
+ */
+void loader_instance_arena_release(struct loader_instance *instance) {
+    struct loader_arena_block *block = instance->arena.blocks;
+
+    while (block) {
+        struct loader_arena_block *next = block->next;
+        loader_callback_free(instance, block);
+        block = next;
+    }
+    memset(&instance->arena, 0, sizeof(instance->arena));
+}
+
+void *loader_instance_heap_alloc(const struct loader_instance *instance,
+                                 size_t size,
+                                 VkSystemAllocationScope alloc_scope) {
+    if (instance && instance->arena.enabled &&
+        alloc_scope == VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE)
+        return loader_arena_alloc(instance, size);
+    return loader_callback_alloc(instance, size, alloc_scope);
+}
+
+void loader_instance_heap_free(const struct loader_instance *instance,
+                               void *pMemory) {
+    if (pMemory != NULL) {
+        // Arena memory goes when the instance does
+        if (instance && instance->arena.blocks &&
+            loader_arena_owns(&instance->arena, pMemory))
+            return;
+        loader_callback_free(instance, pMemory);
     }
 }
 
@@ -204,6 +343,15 @@ void *loader_instance_heap_realloc(const struct loader_instance *instance,
         pNewMem = loader_instance_heap_alloc(instance, size, alloc_scope);
     } else if (size == 0) {
         loader_instance_heap_free(instance, pMemory);
+    } else if (instance && instance->arena.blocks &&
+               loader_arena_owns(&instance->arena, pMemory)) {
+        if (instance->arena.enabled &&
+            loader_arena_grow(instance, pMemory, orig_size, size))
+            return pMemory;
+        // The old copy stays in the arena until the instance is destroyed
+        pNewMem = loader_instance_heap_alloc(instance, size, alloc_scope);
+        if (pNewMem)
+            memcpy(pNewMem, pMemory, orig_size < size ? orig_size : size);
 #if (DEBUG_DISABLE_APP_ALLOCATORS == 1)
 #else
     } else if (instance && instance->alloc_callbacks.pfnReallocation) {
@@ -229,6 +377,92 @@ void loader_instance_tls_heap_free(void *pMemory) {
     loader_instance_heap_free(tls_instance, pMemory);
 }
 
+// Most threads loader_parallel_for() starts.  What it spreads out is waiting
+// on the file system and the dynamic linker rather than computation, so a
+// few are enough.
+#define LOADER_PARALLEL_THREAD_COUNT 4
+// Starting a thread costs about as much as a few of those waits, so
+// loader_parallel_for() starts one per this many calls beyond the calling
+// thread's share, and none for fewer.
+#define LOADER_PARALLEL_CALLS_PER_THREAD 4
+
+struct loader_parallel_job {
+    void (*func)(void *context, uint32_t index);
+    void *context;
+    uint32_t count;
+    // Next index to hand out
+    uint32_t next;
+    loader_platform_thread_mutex lock;
+};
+
+static void loader_parallel_run(struct loader_parallel_job *job) {
+    while (true) {
+        loader_platform_thread_lock_mutex(&job->lock);
+        uint32_t index = job->next;
+        if (index < job->count) {
+            job->next++;
+        }
+        loader_platform_thread_unlock_mutex(&job->lock);
+        if (index >= job->count) {
+            return;
+        }
+        job->func(job->context, index);
+    }
+}
+
+static loader_platform_thread_result LOADER_PLATFORM_THREAD_CALL
+loader_parallel_worker(void *arg) {
+    loader_parallel_run(arg);
+    return 0;
+}
+
+/**
+ * Call func(context, i) once for every i in [0, count), in no particular order
+ * and spread over a few short lived threads as well as the calling one, and
+ * return once all calls have.  func must only change state belonging to its
+ * own index, and must not log: debug callbacks set up by the application
+ * expect to be called on the thread that called into the loader.  Only pass
+ * calls that wait on the file system or the dynamic linker, cheap ones such as
+ * cache hits are better made first on the calling thread.  If there are too
+ * few calls to be worth a thread, or threads can't be started, the calling
+ * thread makes all of them.
+ */
+static void loader_parallel_for(uint32_t count,
+                                void (*func)(void *context, uint32_t index),
+                                void *context) {
+    loader_platform_thread threads[LOADER_PARALLEL_THREAD_COUNT];
+    uint32_t thread_count = 0;
+    uint32_t wanted_threads =
+        count > 1 ? (count - 1) / LOADER_PARALLEL_CALLS_PER_THREAD : 0;
+    struct loader_parallel_job job;
+
+    if (wanted_threads == 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            func(context, i);
+        }
+        return;
+    }
+    if (wanted_threads > LOADER_PARALLEL_THREAD_COUNT) {
+        wanted_threads = LOADER_PARALLEL_THREAD_COUNT;
+    }
+    job.func = func;
+    job.context = context;
+    job.count = count;
+    job.next = 0;
+    loader_platform_thread_create_mutex(&job.lock);
+    // The calling thread takes one share of the work
+    while (thread_count < wanted_threads &&
+           loader_platform_thread_create(&threads[thread_count],
+                                         loader_parallel_worker, &job)) {
+        thread_count++;
+    }
+    loader_parallel_run(&job);
+    for (uint32_t i = 0; i < thread_count; i++) {
+        loader_platform_thread_join(threads[i]);
+    }
+    loader_platform_thread_delete_mutex(&job.lock);
+}
+
 void *loader_device_heap_alloc(const struct loader_device *device, size_t size,
                                VkSystemAllocationScope alloc_scope) {
     void *pMemory = NULL;
@@ -716,38 +950,159 @@ void loader_delete_layer_properties(const struct loader_instance *inst,
     }
 }
 
-static void loader_add_instance_extensions(
-    const struct loader_instance *inst,
-    const PFN_vkEnumerateInstanceExtensionProperties fp_get_props,
-    const char *lib_name, struct loader_extension_list *ext_list) {
-    uint32_t i, count = 0;
-    VkExtensionProperties *ext_props;
-    VkResult res;
+// The instance extensions of ICD libraries that have been asked for them,
+// kept for the life of the process so that listing instance extensions again
+// does not load the libraries again while their files are unchanged.  Only
+// libraries whose file identity is known are cached.  Guarded by
+// loader_json_lock.
+struct loader_icd_cache_entry {
+    char *lib_name;
+    struct loader_file_identity identity;
+    uint32_t extension_count;
+    VkExtensionProperties *extensions;
+};
+static struct loader_icd_cache_entry *loader_icd_cache;
+static uint32_t loader_icd_cache_count;
+static uint32_t loader_icd_cache_capacity;
 
-    if (!fp_get_props) {
-        /* No EnumerateInstanceExtensionProperties defined */
-        return;
+static struct loader_icd_cache_entry *
+loader_icd_cache_find(const struct loader_scanned_icds *icd_lib) {
+    if (!icd_lib->identity_known) {
+        return NULL;
     }
+    for (uint32_t i = 0; i < loader_icd_cache_count; i++) {
+        struct loader_icd_cache_entry *entry = &loader_icd_cache[i];
+        if (!strcmp(entry->lib_name, icd_lib->lib_name)) {
+            if (memcmp(&entry->identity, &icd_lib->identity,
+                       sizeof(entry->identity))) {
+                return NULL;
+            }
+            return entry;
+        }
+    }
+    return NULL;
+}
 
-    res = fp_get_props(NULL, &count, NULL);
-    if (res != VK_SUCCESS) {
-        loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
-                   "Error getting Instance extension count from %s", lib_name);
+/**
+ * Remember the instance extensions icd_lib reported, replacing anything
+ * stored for its library before.  Like the manifest cache, entries belong to
+ * no instance and failing to store one only costs loading the library again.
+ */
+static void loader_icd_cache_store(const struct loader_scanned_icds *icd_lib,
+                                   uint32_t count,
+                                   const VkExtensionProperties *ext_props) {
+    struct loader_icd_cache_entry *entry = NULL;
+    VkExtensionProperties *extensions = NULL;
+
+    if (!icd_lib->identity_known) {
         return;
     }
+    if (count > 0) {
+        extensions = loader_instance_heap_alloc(
+            NULL, sizeof(*extensions) * count,
+            VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == extensions) {
+            return;
+        }
+        memcpy(extensions, ext_props, sizeof(*extensions) * count);
+    }
+    for (uint32_t i = 0; i < loader_icd_cache_count; i++) {
+        if (!strcmp(loader_icd_cache[i].lib_name, icd_lib->lib_name)) {
+            entry = &loader_icd_cache[i];
+            loader_instance_heap_free(NULL, entry->extensions);
+            break;
+        }
+    }
+    if (NULL == entry) {
+        if (loader_icd_cache_count == loader_icd_cache_capacity) {
+            uint32_t capacity =
+                loader_icd_cache_capacity ? loader_icd_cache_capacity * 2 : 4;
+            struct loader_icd_cache_entry *grown =
+                loader_instance_heap_realloc(
+                    NULL, loader_icd_cache,
+                    sizeof(*loader_icd_cache) * loader_icd_cache_capacity,
+                    sizeof(*loader_icd_cache) * capacity,
+                    VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (NULL == grown) {
+                loader_instance_heap_free(NULL, extensions);
+                return;
+            }
+            loader_icd_cache = grown;
+            loader_icd_cache_capacity = capacity;
+        }
+        char *name = loader_instance_heap_alloc(
+            NULL, strlen(icd_lib->lib_name) + 1,
+            VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == name) {
+            loader_instance_heap_free(NULL, extensions);
+            return;
+        }
+        strcpy(name, icd_lib->lib_name);
+        entry = &loader_icd_cache[loader_icd_cache_count++];
+        entry->lib_name = name;
+    }
+    entry->identity = icd_lib->identity;
+    entry->extension_count = count;
+    entry->extensions = extensions;
+}
 
-    if (count == 0) {
-        /* No ExtensionProperties to report */
-        return;
+/**
+ * Add the instance extensions of an ICD to ext_list, taking them from the ICD
+ * cache when it has them and otherwise asking the ICD, whose library must be
+ * loaded then.
+ */
+static void
+loader_add_icd_instance_extensions(const struct loader_instance *inst,
+                                   const struct loader_scanned_icds *icd_lib,
+                                   struct loader_extension_list *ext_list) {
+    const char *lib_name = icd_lib->lib_name;
+    uint32_t i, count = 0;
+    VkExtensionProperties *ext_props = NULL;
+    struct loader_icd_cache_entry *entry;
+    VkResult res;
+
+    loader_platform_thread_lock_mutex(&loader_json_lock);
+    entry = loader_icd_cache_find(icd_lib);
+    if (NULL != entry && entry->extension_count > 0) {
+        count = entry->extension_count;
+        ext_props = loader_stack_alloc(count * sizeof(VkExtensionProperties));
+        memcpy(ext_props, entry->extensions,
+               count * sizeof(VkExtensionProperties));
     }
+    loader_platform_thread_unlock_mutex(&loader_json_lock);
 
-    ext_props = loader_stack_alloc(count * sizeof(VkExtensionProperties));
+    if (NULL == entry) {
+        PFN_vkEnumerateInstanceExtensionProperties fp_get_props =
+            icd_lib->EnumerateInstanceExtensionProperties;
+        if (!fp_get_props) {
+            /* No EnumerateInstanceExtensionProperties defined */
+            return;
+        }
 
-    res = fp_get_props(NULL, &count, ext_props);
-    if (res != VK_SUCCESS) {
-        loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
-                   "Error getting Instance extensions from %s", lib_name);
-        return;
+        res = fp_get_props(NULL, &count, NULL);
+        if (res != VK_SUCCESS) {
+            loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
+                       "Error getting Instance extension count from %s",
+                       lib_name);
+            return;
+        }
+
+        if (count > 0) {
+            ext_props =
+                loader_stack_alloc(count * sizeof(VkExtensionProperties));
+
+            res = fp_get_props(NULL, &count, ext_props);
+            if (res != VK_SUCCESS) {
+                loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
+                           "Error getting Instance extensions from %s",
+                           lib_name);
+                return;
+            }
+        }
+
+        loader_platform_thread_lock_mutex(&loader_json_lock);
+        loader_icd_cache_store(icd_lib, count, ext_props);
+        loader_platform_thread_unlock_mutex(&loader_json_lock);
     }
 
     for (i = 0; i < count; i++) {
@@ -766,8 +1121,6 @@ static void loader_add_instance_extensions(
             loader_add_to_ext_list(inst, ext_list, 1, &ext_props[i]);
         }
     }
-
-    return;
 }
 
 /*
@@ -965,8 +1318,7 @@ loader_add_to_dev_ext_list(const struct loader_instance *inst,
         ext_list->capacity *= 2;
     }
 
-    memcpy(&ext_list->list[idx].props, props,
-           sizeof(struct loader_dev_ext_props));
+    memcpy(&ext_list->list[idx].props, props, sizeof(*props));
     ext_list->list[idx].entrypoint_count = entry_count;
     ext_list->list[idx].entrypoints =
         loader_instance_heap_alloc(inst, sizeof(char *) * entry_count,
@@ -1208,9 +1560,8 @@ void loader_get_icd_loader_instance_extensions(
     for (uint32_t i = 0; i < icd_libs->count; i++) {
         loader_init_generic_list(inst, (struct loader_generic_list *)&icd_exts,
                                  sizeof(VkExtensionProperties));
-        loader_add_instance_extensions(
-            inst, icd_libs->list[i].EnumerateInstanceExtensionProperties,
-            icd_libs->list[i].lib_name, &icd_exts);
+        loader_add_icd_instance_extensions(inst, &icd_libs->list[i],
+                                           &icd_exts);
         loader_add_to_ext_list(inst, inst_exts, icd_exts.count, icd_exts.list);
         loader_destroy_generic_list(inst,
                                     (struct loader_generic_list *)&icd_exts);
@@ -1240,12 +1591,103 @@ struct loader_icd *loader_get_icd_and_device(const VkDevice device,
     return NULL;
 }
 
+/**
+ * \returns
+ * The DevExt dispatch entry for the trampoline at index, or NULL if table
+ * hasn't got that many entries reserved.
+ */
+static PFN_vkDevExt *
+loader_get_dev_ext_entry(struct loader_dev_ext_dispatch_table *table,
+                         uint32_t index) {
+    if (index < NUM_STATIC_DEV_EXTS)
+        return &table->DevExt[index];
+    index -= NUM_STATIC_DEV_EXTS;
+    if (table->more == NULL ||
+        index / DEV_EXT_BLOCK_SIZE >= table->more->count)
+        return NULL;
+    return &table->more->block[index / DEV_EXT_BLOCK_SIZE]
+                              [index % DEV_EXT_BLOCK_SIZE];
+}
+
+/**
+ * Make sure dev has DevExt dispatch entries for the first count trampolines,
+ * pointing any new ones at vkDevExtError.  Generated trampolines read them
+ * unchecked, so this must be done before a trampoline past the static ones
+ * is handed out or used with dev.
+ */
+static bool loader_reserve_dev_ext_entries(const struct loader_instance *inst,
+                                           struct loader_device *dev,
+                                           uint32_t count) {
+    struct loader_dev_ext_blocks *more = dev->loader_dispatch.ext_dispatch.more;
+    uint32_t old_count = more ? more->count : 0;
+    uint32_t new_count;
+    struct loader_dev_ext_blocks *grown;
+
+    if (count <= NUM_STATIC_DEV_EXTS)
+        return true;
+    new_count =
+        (count - NUM_STATIC_DEV_EXTS + DEV_EXT_BLOCK_SIZE - 1) /
+        DEV_EXT_BLOCK_SIZE;
+    if (new_count <= old_count)
+        return true;
+
+    grown = loader_device_heap_alloc(
+        dev, sizeof(*grown) + new_count * sizeof(grown->block[0]),
+        VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+    if (grown == NULL) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_reserve_dev_ext_entries() can't allocate memory "
+                   "for device extension dispatch entries");
+        return false;
+    }
+    grown->replaced = more;
+    grown->count = old_count;
+    if (old_count)
+        memcpy(grown->block, more->block, old_count * sizeof(grown->block[0]));
+    for (; grown->count < new_count; grown->count++) {
+        PFN_vkDevExt *block = loader_device_heap_alloc(
+            dev, DEV_EXT_BLOCK_SIZE * sizeof(*block),
+            VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+        if (block == NULL) {
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "loader_reserve_dev_ext_entries() can't allocate "
+                       "memory for device extension dispatch entries");
+            while (grown->count > old_count)
+                loader_device_heap_free(dev, grown->block[--grown->count]);
+            loader_device_heap_free(dev, grown);
+            return false;
+        }
+        for (uint32_t i = 0; i < DEV_EXT_BLOCK_SIZE; i++)
+            block[i] = (PFN_vkDevExt)vkDevExtError;
+        grown->block[grown->count] = block;
+    }
+
+    // Trampolines on other threads may still be reading the one replaced
+    dev->loader_dispatch.ext_dispatch.more = grown;
+    return true;
+}
+
+static void loader_free_dev_ext_entries(struct loader_device *dev) {
+    struct loader_dev_ext_blocks *more = dev->loader_dispatch.ext_dispatch.more;
+    if (more == NULL)
+        return;
+    for (uint32_t i = 0; i < more->count; i++)
+        loader_device_heap_free(dev, more->block[i]);
+    while (more) {
+        struct loader_dev_ext_blocks *replaced = more->replaced;
+        loader_device_heap_free(dev, more);
+        more = replaced;
+    }
+    dev->loader_dispatch.ext_dispatch.more = NULL;
+}
+
 void loader_destroy_logical_device(const struct loader_instance *inst,
                                    struct loader_device *dev,
                                    const VkAllocationCallbacks *pAllocator) {
     if (pAllocator) {
         dev->alloc_callbacks = *pAllocator;
     }
+    loader_free_dev_ext_entries(dev);
     if (NULL != dev->app_extension_props) {
         loader_device_heap_free(dev, dev->app_extension_props);
     }
@@ -1282,6 +1724,11 @@ loader_create_logical_device(const struct loader_instance *inst,
         new_dev->alloc_callbacks = *pAllocator;
     }
 
+    if (!loader_reserve_dev_ext_entries(inst, new_dev, inst->disp_hash.count)) {
+        loader_device_heap_free(new_dev, new_dev);
+        return NULL;
+    }
+
     return new_dev;
 }
 
@@ -1409,7 +1856,9 @@ void loader_scanned_icd_clear(const struct loader_instance *inst,
     if (icd_libs->capacity == 0)
         return;
     for (uint32_t i = 0; i < icd_libs->count; i++) {
-        loader_platform_close_library(icd_libs->list[i].handle);
+        if (NULL != icd_libs->list[i].handle) {
+            loader_platform_close_library(icd_libs->list[i].handle);
+        }
         loader_instance_heap_free(inst, icd_libs->list[i].lib_name);
     }
     loader_instance_heap_free(inst, icd_libs->list);
@@ -1433,23 +1882,48 @@ static VkResult loader_scanned_icd_init(const struct loader_instance *inst,
     return err;
 }
 
-static void loader_scanned_icd_add(const struct loader_instance *inst,
-                                   struct loader_icd_libs *icd_libs,
-                                   const char *filename, uint32_t api_version) {
+enum loader_icd_probe_result {
+    LOADER_ICD_PROBE_OK,
+    LOADER_ICD_PROBE_OPEN_FAILED,
+    LOADER_ICD_PROBE_BAD_INTERFACE_VERSION,
+    LOADER_ICD_PROBE_NO_GET_INSTANCE_PROC_ADDR,
+    LOADER_ICD_PROBE_NO_CREATE_INSTANCE,
+    LOADER_ICD_PROBE_NO_ENUMERATE_EXTENSIONS,
+};
+
+// A scanned ICD whose library loader_probe_icd() loads, the outcome is
+// reported by loader_report_icd_probe()
+struct loader_icd_probe {
+    struct loader_scanned_icds *icd;
+    enum loader_icd_probe_result result;
+    // True if the ICD only has the version 0 interface, which is looked up
+    // with dlsym/loadlibrary rather than vk_icdGetInstanceProcAddr
+    bool deprecated_interface;
+    // The platform's error message if loading or lookup failed
+    char error[MAX_STRING_SIZE];
+};
+
+/**
+ * Open an ICD library, settle on an interface version and look up the entry
+ * points the loader needs before creating an instance.  This logs nothing so
+ * that loader_scanned_icd_load() can probe all ICDs at once with
+ * loader_parallel_for().  The library stays open until
+ * loader_scanned_icd_clear() unless the probe fails.
+ */
+static void loader_probe_icd(struct loader_icd_probe *probe) {
     loader_platform_dl_handle handle;
-    PFN_vkCreateInstance fp_create_inst;
-    PFN_vkEnumerateInstanceExtensionProperties fp_get_inst_ext_props;
-    PFN_vkGetInstanceProcAddr fp_get_proc_addr;
     PFN_vkNegotiateLoaderICDInterfaceVersion fp_negotiate_icd_version;
-    struct loader_scanned_icds *new_node;
-    uint32_t interface_vers;
+    struct loader_scanned_icds *icd = probe->icd;
+    const char *filename = icd->lib_name;
+
+    probe->deprecated_interface = false;
+    probe->error[0] = '\0';
 
-    /* TODO implement smarter opening/closing of libraries. For now this
-     * function leaves libraries open and the scanned_icd_clear closes them */
     handle = loader_platform_open_library(filename);
     if (!handle) {
-        loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
-                   loader_platform_open_library_error(filename));
+        snprintf(probe->error, sizeof(probe->error), "%s",
+                 loader_platform_open_library_error(filename));
+        probe->result = LOADER_ICD_PROBE_OPEN_FAILED;
         return;
     }
 
@@ -1458,76 +1932,124 @@ static void loader_scanned_icd_add(const struct loader_instance *inst,
         handle, "vk_icdNegotiateLoaderICDInterfaceVersion");
 
     if (!loader_get_icd_interface_version(fp_negotiate_icd_version,
-                                          &interface_vers)) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                   "ICD (%s) doesn't support interface version compatible"
-                   "with loader, skip this ICD %s",
-                   filename);
-        return;
+                                          &icd->interface_version)) {
+        probe->result = LOADER_ICD_PROBE_BAD_INTERFACE_VERSION;
+        goto fail;
     }
 
-    fp_get_proc_addr =
+    icd->GetInstanceProcAddr =
         loader_platform_get_proc_address(handle, "vk_icdGetInstanceProcAddr");
-    if (!fp_get_proc_addr) {
-        assert(interface_vers == 0);
+    if (!icd->GetInstanceProcAddr) {
+        assert(icd->interface_version == 0);
         // Use deprecated interface from version 0
-        fp_get_proc_addr =
+        probe->deprecated_interface = true;
+        icd->GetInstanceProcAddr =
             loader_platform_get_proc_address(handle, "vkGetInstanceProcAddr");
-        if (!fp_get_proc_addr) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       loader_platform_get_proc_address_error(
-                           "vk_icdGetInstanceProcAddr"));
-            return;
-        } else {
-            loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
-                       "Using deprecated ICD interface of "
-                       "vkGetInstanceProcAddr instead of "
-                       "vk_icdGetInstanceProcAddr for ICD %s",
-                       filename);
+        if (!icd->GetInstanceProcAddr) {
+            snprintf(probe->error, sizeof(probe->error), "%s",
+                     loader_platform_get_proc_address_error(
+                         "vk_icdGetInstanceProcAddr"));
+            probe->result = LOADER_ICD_PROBE_NO_GET_INSTANCE_PROC_ADDR;
+            goto fail;
         }
-        fp_create_inst =
+        icd->CreateInstance =
             loader_platform_get_proc_address(handle, "vkCreateInstance");
-        if (!fp_create_inst) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "Couldn't get vkCreateInstance via dlsym/loadlibrary "
-                       "for ICD %s",
-                       filename);
-            return;
-        }
-        fp_get_inst_ext_props = loader_platform_get_proc_address(
-            handle, "vkEnumerateInstanceExtensionProperties");
-        if (!fp_get_inst_ext_props) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "Couldn't get vkEnumerateInstanceExtensionProperties "
-                       "via dlsym/loadlibrary for ICD %s",
-                       filename);
-            return;
-        }
+        icd->EnumerateInstanceExtensionProperties =
+            loader_platform_get_proc_address(
+                handle, "vkEnumerateInstanceExtensionProperties");
     } else {
         // Use newer interface version 1 or later
-        if (interface_vers == 0)
-            interface_vers = 1;
+        if (icd->interface_version == 0)
+            icd->interface_version = 1;
 
-        fp_create_inst =
-            (PFN_vkCreateInstance)fp_get_proc_addr(NULL, "vkCreateInstance");
-        if (!fp_create_inst) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "Couldn't get vkCreateInstance via "
-                       "vk_icdGetInstanceProcAddr for ICD %s",
-                       filename);
-            return;
-        }
-        fp_get_inst_ext_props =
-            (PFN_vkEnumerateInstanceExtensionProperties)fp_get_proc_addr(
-                NULL, "vkEnumerateInstanceExtensionProperties");
-        if (!fp_get_inst_ext_props) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "Couldn't get vkEnumerateInstanceExtensionProperties "
-                       "via vk_icdGetInstanceProcAddr for ICD %s",
-                       filename);
-            return;
-        }
+        icd->CreateInstance = (PFN_vkCreateInstance)icd->GetInstanceProcAddr(
+            NULL, "vkCreateInstance");
+        icd->EnumerateInstanceExtensionProperties =
+            (PFN_vkEnumerateInstanceExtensionProperties)
+                icd->GetInstanceProcAddr(
+                    NULL, "vkEnumerateInstanceExtensionProperties");
+    }
+    if (!icd->CreateInstance) {
+        probe->result = LOADER_ICD_PROBE_NO_CREATE_INSTANCE;
+        goto fail;
+    }
+    if (!icd->EnumerateInstanceExtensionProperties) {
+        probe->result = LOADER_ICD_PROBE_NO_ENUMERATE_EXTENSIONS;
+        goto fail;
+    }
+
+    icd->handle = handle;
+    probe->result = LOADER_ICD_PROBE_OK;
+    return;
+
+fail:
+    icd->GetInstanceProcAddr = NULL;
+    icd->CreateInstance = NULL;
+    icd->EnumerateInstanceExtensionProperties = NULL;
+    loader_platform_close_library(handle);
+}
+
+static void loader_probe_icd_job(void *context, uint32_t index) {
+    loader_probe_icd(&((struct loader_icd_probe *)context)[index]);
+}
+
+// Log the outcome of loader_probe_icd(), returns true if the ICD loaded
+static bool loader_report_icd_probe(const struct loader_instance *inst,
+                                    const struct loader_icd_probe *probe) {
+    const char *filename = probe->icd->lib_name;
+
+    if (probe->deprecated_interface &&
+        probe->result != LOADER_ICD_PROBE_NO_GET_INSTANCE_PROC_ADDR) {
+        loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
+                   "Using deprecated ICD interface of "
+                   "vkGetInstanceProcAddr instead of "
+                   "vk_icdGetInstanceProcAddr for ICD %s",
+                   filename);
+    }
+    switch (probe->result) {
+    case LOADER_ICD_PROBE_OK:
+        return true;
+    case LOADER_ICD_PROBE_OPEN_FAILED:
+        loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0, "%s",
+                   probe->error);
+        break;
+    case LOADER_ICD_PROBE_BAD_INTERFACE_VERSION:
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "ICD (%s) doesn't support interface version compatible "
+                   "with loader, skip this ICD",
+                   filename);
+        break;
+    case LOADER_ICD_PROBE_NO_GET_INSTANCE_PROC_ADDR:
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "%s",
+                   probe->error);
+        break;
+    case LOADER_ICD_PROBE_NO_CREATE_INSTANCE:
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "Couldn't get vkCreateInstance via %s for ICD %s",
+                   probe->deprecated_interface ? "dlsym/loadlibrary"
+                                               : "vk_icdGetInstanceProcAddr",
+                   filename);
+        break;
+    case LOADER_ICD_PROBE_NO_ENUMERATE_EXTENSIONS:
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "Couldn't get vkEnumerateInstanceExtensionProperties "
+                   "via %s for ICD %s",
+                   probe->deprecated_interface ? "dlsym/loadlibrary"
+                                               : "vk_icdGetInstanceProcAddr",
+                   filename);
+        break;
     }
+    return false;
+}
+
+/**
+ * Add the ICD library named filename to the scanned ICD list without loading
+ * it, see loader_scanned_icd_load().
+ */
+static void loader_scanned_icd_add(const struct loader_instance *inst,
+                                   struct loader_icd_libs *icd_libs,
+                                   const char *filename, uint32_t api_version) {
+    struct loader_scanned_icds *new_node;
 
     // check for enough capacity
     if ((icd_libs->count * sizeof(struct loader_scanned_icds)) >=
@@ -1545,13 +2067,10 @@ static void loader_scanned_icd_add(const struct loader_instance *inst,
         icd_libs->capacity *= 2;
     }
     new_node = &(icd_libs->list[icd_libs->count]);
-
-    new_node->handle = handle;
+    memset(new_node, 0, sizeof(*new_node));
     new_node->api_version = api_version;
-    new_node->GetInstanceProcAddr = fp_get_proc_addr;
-    new_node->EnumerateInstanceExtensionProperties = fp_get_inst_ext_props;
-    new_node->CreateInstance = fp_create_inst;
-    new_node->interface_version = interface_vers;
+    new_node->identity_known =
+        loader_platform_file_identity(filename, &new_node->identity);
 
     new_node->lib_name = (char *)loader_instance_heap_alloc(
         inst, strlen(filename) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
@@ -1564,6 +2083,63 @@ static void loader_scanned_icd_add(const struct loader_instance *inst,
     icd_libs->count++;
 }
 
+/**
+ * Load the libraries of scanned ICDs that are not loaded yet, dropping the
+ * ICDs that fail to load from the list.  Creating an instance needs every
+ * library (all_libraries true), while listing instance extensions only needs
+ * those whose extensions are not in the ICD cache.
+ *
+ * \returns
+ * VK_SUCCESS, or VK_ERROR_OUT_OF_HOST_MEMORY in which case nothing is loaded.
+ */
+VkResult loader_scanned_icd_load(const struct loader_instance *inst,
+                                 struct loader_icd_libs *icd_libs,
+                                 bool all_libraries) {
+    struct loader_icd_probe *probes;
+    uint32_t probe_count = 0;
+    uint32_t kept = 0;
+
+    if (icd_libs->count == 0) {
+        return VK_SUCCESS;
+    }
+    probes = loader_instance_heap_alloc(inst,
+                                        sizeof(*probes) * icd_libs->count,
+                                        VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == probes) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "Out of memory can't load ICDs");
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    loader_platform_thread_lock_mutex(&loader_json_lock);
+    for (uint32_t i = 0; i < icd_libs->count; i++) {
+        struct loader_scanned_icds *icd = &icd_libs->list[i];
+        if (NULL != icd->handle ||
+            (!all_libraries && NULL != loader_icd_cache_find(icd))) {
+            continue;
+        }
+        probes[probe_count++].icd = icd;
+    }
+    loader_platform_thread_unlock_mutex(&loader_json_lock);
+
+    // Load the libraries at once, then report them in ICD order
+    loader_parallel_for(probe_count, loader_probe_icd_job, probes);
+    for (uint32_t i = 0, p = 0; i < icd_libs->count; i++) {
+        struct loader_scanned_icds *icd = &icd_libs->list[i];
+        if (p < probe_count && probes[p].icd == icd) {
+            if (!loader_report_icd_probe(inst, &probes[p++])) {
+                loader_instance_heap_free(inst, icd->lib_name);
+                continue;
+            }
+        }
+        icd_libs->list[kept++] = *icd;
+    }
+    icd_libs->count = kept;
+
+    loader_instance_heap_free(inst, probes);
+    return VK_SUCCESS;
+}
+
 static bool loader_icd_init_entrys(struct loader_icd *icd, VkInstance inst,
                                    const PFN_vkGetInstanceProcAddr fp_gipa) {
 /* initialize entrypoint function pointers */
@@ -1678,6 +2254,7 @@ void loader_initialize(void) {
     // initialize mutexs
     loader_platform_thread_create_mutex(&loader_lock);
     loader_platform_thread_create_mutex(&loader_json_lock);
+    loader_platform_thread_create_mutex(&loader_dev_ext_code_lock);
 
     // initialize logging
     loader_debug_init();
@@ -1769,50 +2346,291 @@ static void loader_get_fullpath(const char *file, const char *dirs,
     snprintf(out_fullpath, out_size, "%s", file);
 }
 
+// Parse trees of the manifest files read so far, kept for the life of the
+// process so that scanning again only reads and parses files that have
+// changed since.  Guarded by loader_json_lock.
+struct loader_json_cache_entry {
+    char *filename;
+    bool identity_known;
+    struct loader_file_identity identity;
+    cJSON *json;
+};
+static struct loader_json_cache_entry *loader_json_cache;
+static uint32_t loader_json_cache_count;
+static uint32_t loader_json_cache_capacity;
+
+static struct loader_json_cache_entry *
+loader_json_cache_find(const char *filename) {
+    for (uint32_t i = 0; i < loader_json_cache_count; i++) {
+        if (!strcmp(loader_json_cache[i].filename, filename)) {
+            return &loader_json_cache[i];
+        }
+    }
+    return NULL;
+}
+
 /**
- * Read a JSON file into a buffer.
+ * Store json as the parse tree of filename, replacing any earlier one.
+ * Cache entries belong to no instance, so they are allocated, and json must
+ * have been parsed, without any instance's allocation callbacks.
  *
  * \returns
- * A pointer to a cJSON object representing the JSON parse tree.
- * This returned buffer should be freed by caller.
+ * false if there was no memory for the entry, json is not stored then.
  */
-static cJSON *loader_get_json(const struct loader_instance *inst,
-                              const char *filename) {
-    FILE *file;
-    char *json_buf;
+static bool loader_json_cache_store(const char *filename,
+                                    const struct loader_file_identity *identity,
+                                    cJSON *json) {
+    struct loader_json_cache_entry *entry = loader_json_cache_find(filename);
+    if (entry) {
+        cJSON_Delete(entry->json);
+    } else {
+        if (loader_json_cache_count == loader_json_cache_capacity) {
+            uint32_t capacity = loader_json_cache_capacity
+                                    ? loader_json_cache_capacity * 2
+                                    : 16;
+            struct loader_json_cache_entry *grown =
+                loader_instance_heap_realloc(
+                    NULL, loader_json_cache,
+                    sizeof(*loader_json_cache) * loader_json_cache_capacity,
+                    sizeof(*loader_json_cache) * capacity,
+                    VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (NULL == grown) {
+                return false;
+            }
+            loader_json_cache = grown;
+            loader_json_cache_capacity = capacity;
+        }
+        char *name = loader_instance_heap_alloc(
+            NULL, strlen(filename) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == name) {
+            return false;
+        }
+        strcpy(name, filename);
+        entry = &loader_json_cache[loader_json_cache_count++];
+        entry->filename = name;
+    }
+    entry->identity_known = (identity != NULL);
+    if (identity) {
+        entry->identity = *identity;
+    }
+    entry->json = json;
+    return true;
+}
+
+enum loader_manifest_read_result {
+    LOADER_MANIFEST_CACHED,
+    LOADER_MANIFEST_READ,
+    LOADER_MANIFEST_OPEN_FAILED,
+    LOADER_MANIFEST_READ_FAILED,
+    LOADER_MANIFEST_PARSE_FAILED,
+    LOADER_MANIFEST_OUT_OF_MEMORY,
+};
+
+// A manifest file as read by loader_read_manifest(), before it is parsed and
+// added to the manifest cache
+struct loader_manifest_read {
+    enum loader_manifest_read_result result;
+    bool identity_known;
+    struct loader_file_identity identity;
+    // For LOADER_MANIFEST_READ, the file's text on the system heap
+    char *text;
+    // For LOADER_MANIFEST_CACHED, the file's parse tree in the cache
     cJSON *json;
-    size_t len;
+};
+
+/**
+ * Take filename from the manifest cache if it has the file's current
+ * contents.
+ * \returns
+ * false, with the file's identity noted in read, if filename has to be read.
+ */
+static bool loader_read_cached_manifest(const char *filename,
+                                        struct loader_manifest_read *read) {
+    read->text = NULL;
+    read->identity_known =
+        loader_platform_file_identity(filename, &read->identity);
+    struct loader_json_cache_entry *entry = loader_json_cache_find(filename);
+    if (entry && read->identity_known && entry->identity_known &&
+        !memcmp(&entry->identity, &read->identity, sizeof(read->identity))) {
+        read->result = LOADER_MANIFEST_CACHED;
+        read->json = entry->json;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Read the text of filename, which loader_read_cached_manifest() didn't find
+ * in the cache.  This logs nothing and leaves the cache alone, so that scans
+ * can read many files at once with loader_parallel_for().  cJSON keeps its
+ * error position in a global, so the text is parsed later, on the calling
+ * thread, by loader_get_json().
+ */
+static void loader_read_uncached_manifest(const char *filename,
+                                          struct loader_manifest_read *read) {
+    FILE *file;
+    long len;
+
     file = fopen(filename, "rb");
     if (!file) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                   "Couldn't open JSON file %s", filename);
-        return NULL;
+        read->result = LOADER_MANIFEST_OPEN_FAILED;
+        return;
     }
     fseek(file, 0, SEEK_END);
     len = ftell(file);
     fseek(file, 0, SEEK_SET);
-    json_buf = (char *)loader_stack_alloc(len + 1);
-    if (json_buf == NULL) {
-        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                   "Out of memory can't get JSON file");
+    if (len < 0) {
+        read->result = LOADER_MANIFEST_READ_FAILED;
         fclose(file);
+        return;
+    }
+    read->text = loader_instance_heap_alloc(NULL, (size_t)len + 1,
+                                            VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == read->text) {
+        read->result = LOADER_MANIFEST_OUT_OF_MEMORY;
+    } else if (fread(read->text, sizeof(char), len, file) != (size_t)len) {
+        loader_instance_heap_free(NULL, read->text);
+        read->text = NULL;
+        read->result = LOADER_MANIFEST_READ_FAILED;
+    } else {
+        read->text[len] = '\0';
+        read->result = LOADER_MANIFEST_READ;
+    }
+    fclose(file);
+}
+
+// Read filename from the manifest cache, or from the file if it must
+static void loader_read_manifest(const char *filename,
+                                 struct loader_manifest_read *read) {
+    if (!loader_read_cached_manifest(filename, read))
+        loader_read_uncached_manifest(filename, read);
+}
+
+struct loader_read_manifests_job {
+    char **filenames;
+    struct loader_manifest_read *reads;
+    // Indices of the files the cache didn't have
+    uint32_t *uncached;
+};
+
+static void loader_read_manifest_job(void *context, uint32_t index) {
+    struct loader_read_manifests_job *job = context;
+    uint32_t file = job->uncached[index];
+    loader_read_uncached_manifest(job->filenames[file], &job->reads[file]);
+}
+
+/**
+ * Read count manifest files, taking what the manifest cache has on the
+ * calling thread and reading the rest at once.  Call with loader_json_lock
+ * held.  Pass each result to loader_get_json() in turn, and the array to
+ * loader_free_manifest_reads() when done.
+ *
+ * \returns
+ * The results, or NULL if there was no memory for them, in which case
+ * loader_get_json() reads each file itself.
+ */
+static struct loader_manifest_read *
+loader_read_manifests(const struct loader_instance *inst, char **filenames,
+                      uint32_t count) {
+    struct loader_read_manifests_job job;
+    uint32_t uncached_count = 0;
+    job.filenames = filenames;
+    job.reads = loader_instance_heap_alloc(
+        inst, (sizeof(*job.reads) + sizeof(*job.uncached)) * count,
+        VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == job.reads) {
         return NULL;
     }
-    if (fread(json_buf, sizeof(char), len, file) != len) {
+    job.uncached = (uint32_t *)(job.reads + count);
+    for (uint32_t i = 0; i < count; i++) {
+        if (NULL == filenames[i]) {
+            job.reads[i].result = LOADER_MANIFEST_OPEN_FAILED;
+            job.reads[i].text = NULL;
+        } else if (!loader_read_cached_manifest(filenames[i], &job.reads[i])) {
+            job.uncached[uncached_count++] = i;
+        }
+    }
+    loader_parallel_for(uncached_count, loader_read_manifest_job, &job);
+    return job.reads;
+}
+
+static void loader_free_manifest_reads(const struct loader_instance *inst,
+                                       struct loader_manifest_read *reads,
+                                       uint32_t count) {
+    if (NULL == reads) {
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (reads[i].result == LOADER_MANIFEST_READ) {
+            loader_instance_heap_free(NULL, reads[i].text);
+        }
+    }
+    loader_instance_heap_free(inst, reads);
+}
+
+/**
+ * Get the parse tree of a JSON manifest file, from read if it was read ahead
+ * by loader_read_manifests(), otherwise reading it now.
+ *
+ * \returns
+ * A pointer to a cJSON object representing the JSON parse tree.
+ * The tree is owned by the manifest cache and stays valid until the file is
+ * read again, callers must hold loader_json_lock while using it and must not
+ * free or modify it.
+ */
+static cJSON *loader_get_json(const struct loader_instance *inst,
+                              const char *filename,
+                              struct loader_manifest_read *read) {
+    struct loader_manifest_read read_now;
+    cJSON *json;
+    if (NULL == read) {
+        read = &read_now;
+        loader_read_manifest(filename, read);
+    }
+    switch (read->result) {
+    case LOADER_MANIFEST_CACHED:
+        return read->json;
+    case LOADER_MANIFEST_READ: {
+        // parse text from file, with the cJSON allocation hooks pointed away
+        // from the calling instance since the tree outlives it
+        struct loader_instance *calling_instance = tls_instance;
+        tls_instance = NULL;
+        json = cJSON_Parse(read->text);
+        tls_instance = calling_instance;
+        loader_instance_heap_free(NULL, read->text);
+        read->text = NULL;
+        if (json == NULL) {
+            read->result = LOADER_MANIFEST_PARSE_FAILED;
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "Can't parse JSON file %s", filename);
+            return NULL;
+        }
+        if (!loader_json_cache_store(
+                filename, read->identity_known ? &read->identity : NULL,
+                json)) {
+            read->result = LOADER_MANIFEST_OUT_OF_MEMORY;
+            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                       "Out of memory can't cache JSON file");
+            cJSON_Delete(json);
+            return NULL;
+        }
+        read->result = LOADER_MANIFEST_CACHED;
+        read->json = json;
+        return json;
+    }
+    case LOADER_MANIFEST_OPEN_FAILED:
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "Couldn't open JSON file %s", filename);
+        return NULL;
+    case LOADER_MANIFEST_READ_FAILED:
         loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
                    "fread failed can't get JSON file");
-        fclose(file);
         return NULL;
-    }
-    fclose(file);
-    json_buf[len] = '\0';
-
-    // parse text from file
-    json = cJSON_Parse(json_buf);
-    if (json == NULL)
+    default:
         loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                   "Can't parse JSON file %s", filename);
-    return json;
+                   "Out of memory can't get JSON file");
+        return NULL;
+    }
 }
 
 /**
@@ -2340,7 +3158,7 @@ static void loader_read_json_layer(
         GET_JSON_OBJECT(layer_node, enable_environment)
 
         // enable_environment is optional
-        if (enable_environment) {
+        if (enable_environment && enable_environment->child) {
             strncpy(props->enable_env_var.name,
                     enable_environment->child->string,
                     sizeof(props->enable_env_var.name));
@@ -2480,7 +3298,133 @@ loader_add_layer_properties(const struct loader_instance *inst,
             } while (layer_node != NULL);
         }
     }
-    return;
+    return;
+}
+
+/**
+ * Append name, a heap string which the list takes ownership of, to a list of
+ * manifest files.  *alloced_count is the list's capacity.
+ *
+ * \returns
+ * VK_ERROR_OUT_OF_HOST_MEMORY if the list can't grow, in which case name is
+ * freed.
+ */
+static VkResult
+loader_append_manifest_file(const struct loader_instance *inst,
+                            struct loader_manifest_files *files,
+                            size_t *alloced_count, char *name) {
+    if (files->filename_list == NULL || files->count == *alloced_count) {
+        size_t old_count = files->filename_list ? *alloced_count : 0;
+        size_t new_count = old_count ? old_count * 2 : 64;
+        char **list = loader_instance_heap_realloc(
+            inst, files->filename_list, old_count * sizeof(char *),
+            new_count * sizeof(char *), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (list == NULL) {
+            loader_instance_heap_free(inst, name);
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        files->filename_list = list;
+        *alloced_count = new_count;
+    }
+    files->filename_list[files->count++] = name;
+    return VK_SUCCESS;
+}
+
+// Append a copy of name to a list of manifest files
+static VkResult loader_add_manifest_file(const struct loader_instance *inst,
+                                         struct loader_manifest_files *files,
+                                         size_t *alloced_count,
+                                         const char *name) {
+    char *copy = loader_instance_heap_alloc(inst, strlen(name) + 1,
+                                            VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (copy == NULL) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    strcpy(copy, name);
+    return loader_append_manifest_file(inst, files, alloced_count, copy);
+}
+
+static bool loader_is_manifest_name(const char *name) {
+    size_t nlen = strlen(name);
+    return nlen > 5 && !strncmp(name + nlen - 5, ".json", 5);
+}
+
+// One of the locations loader_get_manifest_files() searches
+struct loader_manifest_search {
+    const char *path;
+    bool is_dir;
+    // Manifest files found in the directory, if the location is one.  The
+    // directory is listed on a loader thread, where the application's
+    // allocator must not be called, so these come from the system heap.
+    struct loader_manifest_files found;
+    size_t alloced_count;
+    VkResult res;
+};
+
+static size_t loader_count_paths(const char *paths) {
+    size_t count = 1;
+    for (; *paths; paths++) {
+        if (*paths == PATH_SEPERATOR) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Make room for the locations in paths after the first count searches
+static bool
+loader_grow_manifest_searches(const struct loader_instance *inst,
+                              struct loader_manifest_search **searches,
+                              size_t *capacity, size_t count,
+                              const char *paths) {
+    size_t needed = count + loader_count_paths(paths);
+    if (needed <= *capacity) {
+        return true;
+    }
+    struct loader_manifest_search *grown = loader_instance_heap_realloc(
+        inst, *searches, sizeof(**searches) * *capacity,
+        sizeof(**searches) * needed, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (grown == NULL) {
+        return false;
+    }
+    *searches = grown;
+    *capacity = needed;
+    return true;
+}
+
+/**
+ * List the manifest files in a directory being searched.  Reading large or
+ * remote directories is slow, so loader_get_manifest_files() reads them all
+ * at once with loader_parallel_for(), and this logs nothing.
+ */
+static void loader_find_manifests_in_dir(void *context, uint32_t index) {
+    struct loader_manifest_search *search =
+        &((struct loader_manifest_search *)context)[index];
+    char full_path[2048];
+    struct dirent *dent;
+    DIR *sysdir;
+
+    if (!search->is_dir) {
+        return;
+    }
+    sysdir = opendir(search->path);
+    if (sysdir == NULL) {
+        return;
+    }
+    while ((dent = readdir(sysdir)) != NULL) {
+        loader_get_fullpath(&(dent->d_name[0]), search->path,
+                            sizeof(full_path), full_path);
+        /* Look for files ending with ".json" suffix */
+        if (loader_is_manifest_name(full_path)) {
+            search->res = loader_add_manifest_file(NULL, &search->found,
+                                                   &search->alloced_count,
+                                                   full_path);
+            if (search->res != VK_SUCCESS) {
+                break;
+            }
+        }
+    }
+    closedir(sysdir);
 }
 
 /**
@@ -2517,12 +3461,11 @@ static VkResult loader_get_manifest_files(
     char * override = NULL;
     char *loc, *orig_loc = NULL;
     char *reg = NULL;
-    char *file, *next_file, *name;
-    size_t alloced_count = 64;
-    char full_path[2048];
-    DIR *sysdir = NULL;
+    char *file, *next_file;
+    size_t alloced_count = 0;
     bool list_is_dirs = false;
-    struct dirent *dent;
+    struct loader_manifest_search *searches = NULL;
+    size_t search_count = 0, search_capacity = 0;
     VkResult res = VK_SUCCESS;
 
     out_files->count = 0;
@@ -2613,26 +3556,30 @@ static VkResult loader_get_manifest_files(
     loader_log(inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0,
                "Searching the following paths for manifest files: %s\n", loc);
 
+    // Work out the locations to search in order, then list the directories
+    // among them at once
+    if (!loader_grow_manifest_searches(inst, &searches, &search_capacity,
+                                       search_count, loc)) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "Out of memory can't get manifest files");
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
     file = loc;
     while (*file) {
         next_file = loader_get_next_path(file);
+        struct loader_manifest_search *search = &searches[search_count++];
+        memset(search, 0, sizeof(*search));
+        search->is_dir = list_is_dirs;
         if (list_is_dirs) {
-            sysdir = opendir(file);
-            name = NULL;
-            if (sysdir) {
-                dent = readdir(sysdir);
-                if (dent == NULL)
-                    break;
-                name = &(dent->d_name[0]);
-                loader_get_fullpath(name, file, sizeof(full_path), full_path);
-                name = full_path;
-            }
+            search->path = file;
         } else {
 #if defined(_WIN32)
-            name = file;
+            search->path = file;
 #else
             // only Linux has relative paths
             char *dir;
+            char full_path[2048];
             // make a copy of location so it isn't modified
             dir = loader_stack_alloc(strlen(loc) + 1);
             if (dir == NULL) {
@@ -2644,76 +3591,22 @@ static VkResult loader_get_manifest_files(
 
             loader_get_fullpath(file, dir, sizeof(full_path), full_path);
 
-            name = full_path;
+            char *path = loader_stack_alloc(strlen(full_path) + 1);
+            strcpy(path, full_path);
+            search->path = path;
 #endif
         }
-        while (name) {
-            /* Look for files ending with ".json" suffix */
-            uint32_t nlen = (uint32_t)strlen(name);
-            const char *suf = name + nlen - 5;
-            if ((nlen > 5) && !strncmp(suf, ".json", 5)) {
-                if (out_files->count == 0) {
-                    out_files->filename_list = loader_instance_heap_alloc(
-                        inst, alloced_count * sizeof(char *),
-                        VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-                } else if (out_files->count == alloced_count) {
-                    out_files->filename_list = loader_instance_heap_realloc(
-                        inst, out_files->filename_list,
-                        alloced_count * sizeof(char *),
-                        alloced_count * sizeof(char *) * 2,
-                        VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-                    alloced_count *= 2;
-                }
-                if (out_files->filename_list == NULL) {
-                    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                               "Out of memory can't alloc manifest file list");
-                    res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    goto out;
-                }
-                out_files->filename_list[out_files->count] =
-                    loader_instance_heap_alloc(
-                        inst, strlen(name) + 1,
-                        VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-                if (out_files->filename_list[out_files->count] == NULL) {
-                    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                               "Out of memory can't get manifest files");
-                    res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    goto out;
-                }
-                strcpy(out_files->filename_list[out_files->count], name);
-                out_files->count++;
-            } else if (!list_is_dirs) {
-                loader_log(
-                    inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
-                    "Skipping manifest file %s, file name must end in .json",
-                    name);
-            }
-            if (list_is_dirs) {
-                dent = readdir(sysdir);
-                if (dent == NULL) {
-                    break;
-                }
-                name = &(dent->d_name[0]);
-                loader_get_fullpath(name, file, sizeof(full_path), full_path);
-                name = full_path;
-            } else {
-                break;
-            }
-        }
-        if (sysdir) {
-            closedir(sysdir);
-            sysdir = NULL;
-        }
         file = next_file;
 #if !defined(_WIN32)
         if (home_location != NULL &&
             (next_file == NULL || *next_file == '\0') && override == NULL) {
             char *xdgdatahome = secure_getenv("XDG_DATA_HOME");
+            char *home_loc = NULL;
             size_t len;
             if (xdgdatahome != NULL) {
 
-                char *home_loc = loader_stack_alloc(strlen(xdgdatahome) + 2 +
-                                                    strlen(home_location));
+                home_loc = loader_stack_alloc(strlen(xdgdatahome) + 2 +
+                                              strlen(home_location));
                 if (home_loc == NULL) {
                     loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
                                "Out of memory can't get manifest files");
@@ -2728,22 +3621,13 @@ static VkResult loader_get_manifest_files(
                     home_loc[len + 1] = '\0';
                 }
                 strcat(home_loc, home_location);
-                file = home_loc;
-                next_file = loader_get_next_path(file);
-                home_location = NULL;
-
-                loader_log(
-                    inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0,
-                    "Searching the following path for manifest files: %s\n",
-                    home_loc);
-                list_is_dirs = true;
 
             } else {
 
                 char *home = secure_getenv("HOME");
                 if (home != NULL) {
-                    char *home_loc = loader_stack_alloc(strlen(home) + 16 +
-                                                        strlen(home_location));
+                    home_loc = loader_stack_alloc(strlen(home) + 16 +
+                                                  strlen(home_location));
                     if (home_loc == NULL) {
                         loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
                                 "Out of memory can't get manifest files");
@@ -2765,23 +3649,71 @@ static VkResult loader_get_manifest_files(
                         home_loc[len + 1] = '\0';
                     }
                     strcat(home_loc, home_location);
-                    file = home_loc;
-                    next_file = loader_get_next_path(file);
-                    home_location = NULL;
-
-                    loader_log(
-                        inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0,
-                        "Searching the following path for manifest files: %s\n",
-                        home_loc);
-                    list_is_dirs = true;
                 } else {
                     // without knowing HOME, we just.. give up
                 }
             }
+            if (home_loc != NULL) {
+                if (!loader_grow_manifest_searches(inst, &searches,
+                                                   &search_capacity,
+                                                   search_count, home_loc)) {
+                    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                               "Out of memory can't get manifest files");
+                    res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                    goto out;
+                }
+                file = home_loc;
+                next_file = loader_get_next_path(file);
+                home_location = NULL;
+
+                loader_log(
+                    inst, VK_DEBUG_REPORT_DEBUG_BIT_EXT, 0,
+                    "Searching the following path for manifest files: %s\n",
+                    home_loc);
+                list_is_dirs = true;
+            }
         }
 #endif
     }
 
+    loader_parallel_for((uint32_t)search_count, loader_find_manifests_in_dir,
+                        searches);
+
+    // Gather what was found in search order
+    for (size_t i = 0; i < search_count; i++) {
+        struct loader_manifest_search *search = &searches[i];
+        if (search->is_dir) {
+            if (search->res != VK_SUCCESS) {
+                loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                           "Out of memory can't get manifest files");
+                res = search->res;
+                goto out;
+            }
+            for (uint32_t j = 0; j < search->found.count; j++) {
+                // Copied into instance memory now that the threads are done
+                res = loader_add_manifest_file(inst, out_files, &alloced_count,
+                                               search->found.filename_list[j]);
+                if (res != VK_SUCCESS) {
+                    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                               "Out of memory can't alloc manifest file list");
+                    goto out;
+                }
+            }
+        } else if (loader_is_manifest_name(search->path)) {
+            res = loader_add_manifest_file(inst, out_files, &alloced_count,
+                                           search->path);
+            if (res != VK_SUCCESS) {
+                loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                           "Out of memory can't get manifest files");
+                goto out;
+            }
+        } else {
+            loader_log(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, 0,
+                       "Skipping manifest file %s, file name must end in .json",
+                       search->path);
+        }
+    }
+
 out:
     if (VK_SUCCESS != res && NULL != out_files->filename_list) {
         for (uint32_t remove = 0; remove < out_files->count; remove++) {
@@ -2792,8 +3724,17 @@ out:
         out_files->filename_list = NULL;
     }
 
-    if (NULL != sysdir) {
-        closedir(sysdir);
+    for (size_t i = 0; i < search_count; i++) {
+        struct loader_manifest_files *found = &searches[i].found;
+        for (uint32_t j = 0; j < found->count; j++) {
+            loader_instance_heap_free(NULL, found->filename_list[j]);
+        }
+        if (NULL != found->filename_list) {
+            loader_instance_heap_free(NULL, found->filename_list);
+        }
+    }
+    if (NULL != searches) {
+        loader_instance_heap_free(inst, searches);
     }
 
     if (NULL != reg && reg != orig_loc) {
@@ -2811,7 +3752,8 @@ void loader_destroy_icd_lib_list() {}
  * This function scans the default system loader path(s) or path
  * specified by the \c VK_ICD_FILENAMES environment variable in
  * order to find loadable VK ICDs manifest files. From these
- * manifest files it finds the ICD libraries.
+ * manifest files it finds the ICD libraries, which are not loaded until
+ * loader_scanned_icd_load().
  *
  * \returns
  * Vulkan result
@@ -2828,6 +3770,7 @@ VkResult loader_icd_scan(const struct loader_instance *inst,
     VkResult res = VK_SUCCESS;
     bool lockedMutex = false;
     cJSON *json = NULL;
+    struct loader_manifest_read *reads = NULL;
 
     memset(&manifest_files, 0, sizeof(struct loader_manifest_files));
 
@@ -2845,13 +3788,16 @@ VkResult loader_icd_scan(const struct loader_instance *inst,
     }
     loader_platform_thread_lock_mutex(&loader_json_lock);
     lockedMutex = true;
+    // Read all the manifests at once, then go through them in order
+    reads = loader_read_manifests(inst, manifest_files.filename_list,
+                                  manifest_files.count);
     for (uint32_t i = 0; i < manifest_files.count; i++) {
         file_str = manifest_files.filename_list[i];
         if (file_str == NULL) {
             continue;
         }
 
-        json = loader_get_json(inst, file_str);
+        json = loader_get_json(inst, file_str, reads ? &reads[i] : NULL);
         if (!json) {
             continue;
         }
@@ -2900,8 +3846,6 @@ VkResult loader_icd_scan(const struct loader_instance *inst,
                                "%s, skipping",
                                file_str);
                     cJSON_Free(temp);
-                    cJSON_Delete(json);
-                    json = NULL;
                     continue;
                 }
                 // strip out extra quotes
@@ -2914,8 +3858,6 @@ VkResult loader_icd_scan(const struct loader_instance *inst,
                                "Can't find \"library_path\" in ICD JSON file "
                                "%s, skipping",
                                file_str);
-                    cJSON_Delete(json);
-                    json = NULL;
                     continue;
                 }
                 char fullpath[MAX_STRING_SIZE];
@@ -2940,16 +3882,8 @@ VkResult loader_icd_scan(const struct loader_instance *inst,
 
                 uint32_t vers = 0;
                 item = cJSON_GetObjectItem(itemICD, "api_version");
-                if (item != NULL) {
-                    temp = cJSON_Print(item);
-                    if (NULL == temp) {
-                        // Only reason the print can fail is if there was an
-                        // allocation issue
-                        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                        goto out;
-                    }
-                    vers = loader_make_version(temp);
-                    cJSON_Free(temp);
+                if (item != NULL && item->type == cJSON_String) {
+                    vers = loader_make_version(item->valuestring);
                 }
                 loader_scanned_icd_add(inst, icds, fullpath, vers);
             } else {
@@ -2964,15 +3898,10 @@ VkResult loader_icd_scan(const struct loader_instance *inst,
                 "Can't find \"ICD\" object in ICD JSON file %s, skipping",
                 file_str);
         }
-
-        cJSON_Delete(json);
-        json = NULL;
     }
 
 out:
-    if (NULL != json) {
-        cJSON_Delete(json);
-    }
+    loader_free_manifest_reads(inst, reads, manifest_files.count);
     if (NULL != manifest_files.filename_list) {
         for (uint32_t i = 0; i < manifest_files.count; i++) {
             if (NULL != manifest_files.filename_list[i]) {
@@ -2996,6 +3925,9 @@ void loader_layer_scan(const struct loader_instance *inst,
     cJSON *json;
     uint32_t implicit;
     bool lockedMutex = false;
+    char **all_files;
+    uint32_t all_count = 0;
+    struct loader_manifest_read *reads = NULL;
 
     memset(manifest_files, 0, sizeof(struct loader_manifest_files) * 2);
 
@@ -3026,21 +3958,32 @@ void loader_layer_scan(const struct loader_instance *inst,
 
     loader_platform_thread_lock_mutex(&loader_json_lock);
     lockedMutex = true;
+    // Read all the manifests at once, then go through them in order
+    all_count = manifest_files[0].count + manifest_files[1].count;
+    all_files = loader_stack_alloc(sizeof(char *) * all_count);
+    for (uint32_t i = 0; i < manifest_files[0].count; i++) {
+        all_files[i] = manifest_files[0].filename_list[i];
+    }
+    for (uint32_t i = 0; i < manifest_files[1].count; i++) {
+        all_files[manifest_files[0].count + i] =
+            manifest_files[1].filename_list[i];
+    }
+    reads = loader_read_manifests(inst, all_files, all_count);
     for (implicit = 0; implicit < 2; implicit++) {
         for (uint32_t i = 0; i < manifest_files[implicit].count; i++) {
             file_str = manifest_files[implicit].filename_list[i];
             if (file_str == NULL)
                 continue;
 
-            // parse file into JSON struct
-            json = loader_get_json(inst, file_str);
+            uint32_t read_index = implicit ? manifest_files[0].count + i : i;
+            json = loader_get_json(inst, file_str,
+                                   reads ? &reads[read_index] : NULL);
             if (!json) {
                 continue;
             }
 
             loader_add_layer_properties(inst, instance_layers, json,
                                         (implicit == 1), file_str);
-            cJSON_Delete(json);
         }
     }
 
@@ -3051,6 +3994,7 @@ void loader_layer_scan(const struct loader_instance *inst,
 
 out:
 
+    loader_free_manifest_reads(inst, reads, all_count);
     for (uint32_t manFile = 0; manFile < 2; manFile++) {
         if (NULL != manifest_files[manFile].filename_list) {
             for (uint32_t i = 0; i < manifest_files[manFile].count; i++) {
@@ -3073,6 +4017,7 @@ void loader_implicit_layer_scan(const struct loader_instance *inst,
     char *file_str;
     struct loader_manifest_files manifest_files;
     cJSON *json;
+    struct loader_manifest_read *reads;
     uint32_t i;
 
     // Pass NULL for environment variable override - implicit layers are not
@@ -3089,14 +4034,16 @@ void loader_implicit_layer_scan(const struct loader_instance *inst,
 
     loader_platform_thread_lock_mutex(&loader_json_lock);
 
+    // Read all the manifests at once, then go through them in order
+    reads = loader_read_manifests(inst, manifest_files.filename_list,
+                                  manifest_files.count);
     for (i = 0; i < manifest_files.count; i++) {
         file_str = manifest_files.filename_list[i];
         if (file_str == NULL) {
             continue;
         }
 
-        // parse file into JSON struct
-        json = loader_get_json(inst, file_str);
+        json = loader_get_json(inst, file_str, reads ? &reads[i] : NULL);
         if (!json) {
             continue;
         }
@@ -3105,8 +4052,8 @@ void loader_implicit_layer_scan(const struct loader_instance *inst,
                                     file_str);
 
         loader_instance_heap_free(inst, file_str);
-        cJSON_Delete(json);
     }
+    loader_free_manifest_reads(inst, reads, manifest_files.count);
     loader_instance_heap_free(inst, manifest_files.filename_list);
 
     // add a meta layer for validation if the validation layers are all present
@@ -3157,6 +4104,137 @@ loader_gpa_device_internal(VkDevice device, const char *pName) {
     return icd->GetDeviceProcAddr(device, pName);
 }
 
+// Trampolines past the static ones are generated where the loader knows the
+// machine code for them
+#if (defined(__x86_64__) && !defined(__ILP32__)) || defined(_M_X64)
+#define DEV_EXT_CODE_X64
+#elif defined(__i386__) || defined(_M_IX86)
+#define DEV_EXT_CODE_X86
+#endif
+
+#if defined(DEV_EXT_CODE_X64) || defined(DEV_EXT_CODE_X86)
+// Bytes of machine code for each generated trampoline
+#define DEV_EXT_CODE_SIZE 32
+
+// Trampolines past the static ones, generated a block at a time as instances
+// need them and shared by all of them.  Never freed, since applications may
+// hold on to their addresses for as long as they like.
+static struct {
+    uint32_t count;
+    uint32_t capacity;
+    char **blocks;
+} loader_dev_ext_code;
+
+static void loader_put_code_u32(uint8_t *code, uint32_t value) {
+    code[0] = (uint8_t)value;
+    code[1] = (uint8_t)(value >> 8);
+    code[2] = (uint8_t)(value >> 16);
+    code[3] = (uint8_t)(value >> 24);
+}
+
+/**
+ * Write the trampoline for entry slot of block to code.  It does what the ones
+ * in dev_ext_trampoline.c do, jumping through the device's DevExt dispatch
+ * entry with the arguments untouched:
+ *
+ *     mov  rax, [rdi]                  ; rcx on Windows, [esp + 4] on x86
+ *     mov  rax, [rax + offsetof(ext_dispatch.more)]
+ *     mov  rax, [rax + offsetof(block[block])]
+ *     jmp  [rax + slot * sizeof(PFN_vkDevExt)]
+ */
+static void loader_write_dev_ext_code(uint8_t *code, uint32_t block,
+                                      uint32_t slot) {
+    static const uint8_t load_device[] =
+#if defined(DEV_EXT_CODE_X64) && defined(_WIN32)
+        {0x48, 0x8b, 0x01};
+#elif defined(DEV_EXT_CODE_X64)
+        {0x48, 0x8b, 0x07};
+#else
+        {0x8b, 0x44, 0x24, 0x04, 0x8b, 0x00};
+#endif
+#if defined(DEV_EXT_CODE_X64)
+    static const uint8_t load[] = {0x48, 0x8b, 0x80};
+#else
+    static const uint8_t load[] = {0x8b, 0x80};
+#endif
+    static const uint8_t jump[] = {0xff, 0xa0};
+
+    memset(code, 0xcc, DEV_EXT_CODE_SIZE);
+    memcpy(code, load_device, sizeof(load_device));
+    code += sizeof(load_device);
+    memcpy(code, load, sizeof(load));
+    loader_put_code_u32(code + sizeof(load),
+                        offsetof(struct loader_dev_dispatch_table,
+                                 ext_dispatch.more));
+    code += sizeof(load) + 4;
+    memcpy(code, load, sizeof(load));
+    loader_put_code_u32(code + sizeof(load),
+                        offsetof(struct loader_dev_ext_blocks, block) +
+                            block * sizeof(PFN_vkDevExt *));
+    code += sizeof(load) + 4;
+    memcpy(code, jump, sizeof(jump));
+    loader_put_code_u32(code + sizeof(jump), slot * sizeof(PFN_vkDevExt));
+}
+
+// Generate the next block of trampolines, loader_dev_ext_code_lock held
+static bool loader_add_dev_ext_code_block(void) {
+    const size_t size = DEV_EXT_BLOCK_SIZE * DEV_EXT_CODE_SIZE;
+    const uint32_t block = loader_dev_ext_code.count;
+    uint8_t *code;
+    char *mapping;
+
+    if (block == loader_dev_ext_code.capacity) {
+        uint32_t capacity = block ? block * 2 : 4;
+        char **blocks = realloc(loader_dev_ext_code.blocks,
+                                capacity * sizeof(*blocks));
+        if (blocks == NULL)
+            return false;
+        loader_dev_ext_code.blocks = blocks;
+        loader_dev_ext_code.capacity = capacity;
+    }
+
+    code = malloc(size);
+    if (code == NULL)
+        return false;
+    for (uint32_t slot = 0; slot < DEV_EXT_BLOCK_SIZE; slot++)
+        loader_write_dev_ext_code(code + slot * DEV_EXT_CODE_SIZE, block,
+                                  slot);
+    mapping = loader_platform_map_code(code, size);
+    free(code);
+    if (mapping == NULL)
+        return false;
+
+    loader_dev_ext_code.blocks[loader_dev_ext_code.count++] = mapping;
+    return true;
+}
+#endif
+
+/**
+ * \returns
+ * The trampoline at index, generating it if it is past the static ones, or
+ * NULL if that isn't possible on this platform or fails.
+ */
+void *loader_get_dev_ext_trampoline(uint32_t index) {
+    void *trampoline = NULL;
+
+    if (index < NUM_STATIC_DEV_EXTS)
+        return loader_get_static_dev_ext_trampoline(index);
+    index -= NUM_STATIC_DEV_EXTS;
+
+#if defined(DEV_EXT_CODE_SIZE)
+    loader_platform_thread_lock_mutex(&loader_dev_ext_code_lock);
+    while (loader_dev_ext_code.count <= index / DEV_EXT_BLOCK_SIZE &&
+           loader_add_dev_ext_code_block())
+        ;
+    if (index / DEV_EXT_BLOCK_SIZE < loader_dev_ext_code.count)
+        trampoline =
+            loader_dev_ext_code.blocks[index / DEV_EXT_BLOCK_SIZE] +
+            (index % DEV_EXT_BLOCK_SIZE) * DEV_EXT_CODE_SIZE;
+    loader_platform_thread_unlock_mutex(&loader_dev_ext_code_lock);
+#endif
+    return trampoline;
+}
+
 /**
  * Initialize device_ext dispatch table entry as follows:
  * If dev == NULL find all logical devices created within this instance and
@@ -3173,12 +4251,14 @@ static void loader_init_dispatch_dev_ext_entry(struct loader_instance *inst,
 
 {
     void *gdpa_value;
+    PFN_vkDevExt *entry;
     if (dev != NULL) {
         gdpa_value = dev->loader_dispatch.core_dispatch.GetDeviceProcAddr(
             dev->device, funcName);
-        if (gdpa_value != NULL)
-            dev->loader_dispatch.ext_dispatch.DevExt[idx] =
-                (PFN_vkDevExt)gdpa_value;
+        entry = loader_get_dev_ext_entry(&dev->loader_dispatch.ext_dispatch,
+                                         idx);
+        if (gdpa_value != NULL && entry != NULL)
+            *entry = (PFN_vkDevExt)gdpa_value;
     } else {
         for (uint32_t i = 0; i < inst->total_icd_count; i++) {
             struct loader_icd *icd = &inst->icds[i];
@@ -3187,9 +4267,10 @@ static void loader_init_dispatch_dev_ext_entry(struct loader_instance *inst,
                 gdpa_value =
                     ldev->loader_dispatch.core_dispatch.GetDeviceProcAddr(
                         ldev->device, funcName);
-                if (gdpa_value != NULL)
-                    ldev->loader_dispatch.ext_dispatch.DevExt[idx] =
-                        (PFN_vkDevExt)gdpa_value;
+                entry = loader_get_dev_ext_entry(
+                    &ldev->loader_dispatch.ext_dispatch, idx);
+                if (gdpa_value != NULL && entry != NULL)
+                    *entry = (PFN_vkDevExt)gdpa_value;
                 ldev = ldev->next;
             }
         }
@@ -3203,10 +4284,12 @@ static void loader_init_dispatch_dev_ext_entry(struct loader_instance *inst,
  */
 void loader_init_dispatch_dev_ext(struct loader_instance *inst,
                                   struct loader_device *dev) {
-    for (uint32_t i = 0; i < MAX_NUM_DEV_EXTS; i++) {
-        if (inst->disp_hash[i].func_name != NULL)
-            loader_init_dispatch_dev_ext_entry(inst, dev, i,
-                                               inst->disp_hash[i].func_name);
+    for (uint32_t i = 0; i < inst->disp_hash.capacity; i++) {
+        const struct loader_dispatch_hash_entry *entry =
+            &inst->disp_hash.entries[i];
+        if (entry->func_name != NULL)
+            loader_init_dispatch_dev_ext_entry(inst, dev, entry->index,
+                                               entry->func_name);
     }
 }
 
@@ -3260,105 +4343,110 @@ loader_check_layers_for_address(const struct loader_instance *const inst,
 }
 
 static void loader_free_dev_ext_table(struct loader_instance *inst) {
-    for (uint32_t i = 0; i < MAX_NUM_DEV_EXTS; i++) {
-        loader_instance_heap_free(inst, inst->disp_hash[i].func_name);
-        loader_instance_heap_free(inst, inst->disp_hash[i].list.index);
+    for (uint32_t i = 0; i < inst->disp_hash.capacity; i++)
+        loader_instance_heap_free(inst, inst->disp_hash.entries[i].func_name);
+    loader_instance_heap_free(inst, inst->disp_hash.entries);
+    memset(&inst->disp_hash, 0, sizeof(inst->disp_hash));
+}
+
+/**
+ * Find funcName in the hash table, which must not be empty.
+ * \returns
+ * The entry holding funcName, or the unused entry it would be added at.
+ */
+static struct loader_dispatch_hash_entry *
+loader_find_dev_ext_entry(const struct loader_dispatch_hash *disp_hash,
+                          const char *funcName, uint32_t hash) {
+    const uint32_t mask = disp_hash->capacity - 1;
+    for (uint32_t i = hash & mask;; i = (i + 1) & mask) {
+        struct loader_dispatch_hash_entry *entry = &disp_hash->entries[i];
+        if (entry->func_name == NULL ||
+            (entry->hash == hash && !strcmp(entry->func_name, funcName)))
+            return entry;
     }
-    memset(inst->disp_hash, 0, sizeof(inst->disp_hash));
 }
 
-static bool loader_add_dev_ext_table(struct loader_instance *inst,
-                                     uint32_t *ptr_idx, const char *funcName) {
-    uint32_t i;
-    uint32_t idx = *ptr_idx;
-    struct loader_dispatch_hash_list *list = &inst->disp_hash[idx].list;
-
-    if (!inst->disp_hash[idx].func_name) {
-        // no entry here at this idx, so use it
-        assert(list->capacity == 0);
-        inst->disp_hash[idx].func_name = (char *)loader_instance_heap_alloc(
-            inst, strlen(funcName) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (inst->disp_hash[idx].func_name == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_dev_ext_table() can't allocate memory for "
-                       "func_name");
-            return false;
-        }
-        strncpy(inst->disp_hash[idx].func_name, funcName, strlen(funcName) + 1);
-        return true;
+// Move the entries into a table of capacity entries
+static bool loader_resize_dev_ext_table(struct loader_instance *inst,
+                                        uint32_t capacity) {
+    struct loader_dispatch_hash resized = {capacity, inst->disp_hash.count,
+                                           NULL};
+    resized.entries = loader_instance_heap_alloc(
+        inst, capacity * sizeof(*resized.entries),
+        VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (resized.entries == NULL) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_resize_dev_ext_table() can't allocate memory for "
+                   "hash table");
+        return false;
     }
+    memset(resized.entries, 0, capacity * sizeof(*resized.entries));
 
-    // check for enough capacity
-    if (list->capacity == 0) {
-        list->index = loader_instance_heap_alloc(inst, 8 * sizeof(*(list->index)),
-                                        VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                       "loader_add_dev_ext_table() can't allocate list memory");
-            return false;
-        }
-        list->capacity = 8 * sizeof(*(list->index));
-    } else if (list->capacity < (list->count + 1) * sizeof(*(list->index))) {
-        list->index = loader_instance_heap_realloc(inst, list->index, list->capacity,
-                                          list->capacity * 2,
-                                          VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (list->index == NULL) {
-            loader_log(
-                inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                "loader_add_dev_ext_table() can't reallocate list memory");
-            return false;
-        }
-        list->capacity *= 2;
-    }
-
-    // find an unused index in the hash table and use it
-    i = (idx + 1) % MAX_NUM_DEV_EXTS;
-    do {
-        if (!inst->disp_hash[i].func_name) {
-            assert(inst->disp_hash[i].list.capacity == 0);
-            inst->disp_hash[i].func_name =
-                (char *)loader_instance_heap_alloc(inst, strlen(funcName) + 1,
-                                          VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-            if (inst->disp_hash[i].func_name == NULL) {
-                loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-                           "loader_add_dev_ext_table() can't rallocate "
-                           "func_name memory");
-                return false;
-            }
-            strncpy(inst->disp_hash[i].func_name, funcName,
-                    strlen(funcName) + 1);
-            list->index[list->count] = i;
-            list->count++;
-            *ptr_idx = i;
-            return true;
-        }
-        i = (i + 1) % MAX_NUM_DEV_EXTS;
-    } while (i != idx);
+    for (uint32_t i = 0; i < inst->disp_hash.capacity; i++) {
+        const struct loader_dispatch_hash_entry *entry =
+            &inst->disp_hash.entries[i];
+        if (entry->func_name != NULL)
+            *loader_find_dev_ext_entry(&resized, entry->func_name,
+                                       entry->hash) = *entry;
+    }
 
-    loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
-               "loader_add_dev_ext_table() couldn't insert into hash table; is "
-               "it full?");
-    return false;
+    loader_instance_heap_free(inst, inst->disp_hash.entries);
+    inst->disp_hash = resized;
+    return true;
 }
 
-static bool loader_name_in_dev_ext_table(struct loader_instance *inst,
-                                         uint32_t *idx, const char *funcName) {
-    uint32_t alt_idx;
-    if (inst->disp_hash[*idx].func_name &&
-        !strcmp(inst->disp_hash[*idx].func_name, funcName))
-        return true;
+/**
+ * Give funcName, which is not in the hash table yet, the next trampoline.
+ * Trampoline indices are handed out in order and never move, unlike entries,
+ * so growing the table doesn't disturb addresses already returned.
+ * \returns
+ * The new entry, or NULL if no trampoline can be had or out of memory.
+ */
+static struct loader_dispatch_hash_entry *
+loader_add_dev_ext_table(struct loader_instance *inst, const char *funcName,
+                         uint32_t hash) {
+    struct loader_dispatch_hash *disp_hash = &inst->disp_hash;
+    struct loader_dispatch_hash_entry *entry;
 
-    // funcName wasn't at the primary spot in the hash table
-    // search the list of secondary locations (shallow search, not deep search)
-    for (uint32_t i = 0; i < inst->disp_hash[*idx].list.count; i++) {
-        alt_idx = inst->disp_hash[*idx].list.index[i];
-        if (!strcmp(inst->disp_hash[*idx].func_name, funcName)) {
-            *idx = alt_idx;
-            return true;
+    if (loader_get_dev_ext_trampoline(disp_hash->count) == NULL) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_add_dev_ext_table() can't add %s, all %d "
+                   "trampolines for device extension entry points are in use "
+                   "and no more can be generated",
+                   funcName, disp_hash->count);
+        return NULL;
+    }
+
+    // Existing devices need a dispatch entry behind the new trampoline
+    for (struct loader_icd *icd = inst->icds; icd; icd = icd->next) {
+        for (struct loader_device *dev = icd->logical_device_list; dev;
+             dev = dev->next) {
+            if (!loader_reserve_dev_ext_entries(inst, dev,
+                                                disp_hash->count + 1))
+                return NULL;
         }
     }
 
-    return false;
+    if ((disp_hash->count + 1) * 4 > disp_hash->capacity * 3) {
+        uint32_t capacity = disp_hash->capacity ? disp_hash->capacity * 2 : 64;
+        if (!loader_resize_dev_ext_table(inst, capacity))
+            return NULL;
+    }
+
+    entry = loader_find_dev_ext_entry(disp_hash, funcName, hash);
+    assert(entry->func_name == NULL);
+    entry->func_name = (char *)loader_instance_heap_alloc(
+        inst, strlen(funcName) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (entry->func_name == NULL) {
+        loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0,
+                   "loader_add_dev_ext_table() can't allocate memory for "
+                   "func_name");
+        return NULL;
+    }
+    strcpy(entry->func_name, funcName);
+    entry->hash = hash;
+    entry->index = disp_hash->count++;
+    return entry;
 }
 
 /**
@@ -3370,24 +4458,23 @@ static bool loader_name_in_dev_ext_table(struct loader_instance *inst,
  * (struct loader_dev_ext_dispatch_table).
  * \returns
  * For a given entry point string (funcName), if an existing mapping is found
- * the
- * trampoline address for that mapping is returned. Otherwise, this unknown
- * entry point
- * has not been seen yet. Next check if a layer or ICD supports it.  If so then
- * a
- * new entry in the hash table is initialized and that trampoline address for
- * the new entry is returned. Null is returned if the hash table is full or
- * if no discovered layer or ICD returns a non-NULL GetProcAddr for it.
+ * the trampoline address for that mapping is returned. Otherwise, this unknown
+ * entry point has not been seen yet. Next check if a layer or ICD supports it.
+ * If so then a new entry in the hash table is initialized and that trampoline
+ * address for the new entry is returned. Null is returned if all trampolines
+ * are in use or if no discovered layer or ICD returns a non-NULL GetProcAddr
+ * for it.
  */
 void *loader_dev_ext_gpa(struct loader_instance *inst, const char *funcName) {
-    uint32_t idx;
-    uint32_t seed = 0;
-
-    idx = murmurhash(funcName, strlen(funcName), seed) % MAX_NUM_DEV_EXTS;
+    const uint32_t hash = murmurhash(funcName, strlen(funcName), 0);
+    struct loader_dispatch_hash_entry *entry;
 
-    if (loader_name_in_dev_ext_table(inst, &idx, funcName))
-        // found funcName already in hash
-        return loader_get_dev_ext_trampoline(idx);
+    if (inst->disp_hash.count > 0) {
+        entry = loader_find_dev_ext_entry(&inst->disp_hash, funcName, hash);
+        if (entry->func_name != NULL)
+            // found funcName already in hash
+            return loader_get_dev_ext_trampoline(entry->index);
+    }
 
     // Check if funcName is supported in either ICDs or a layer library
     if (!loader_check_icds_for_address(inst, funcName) &&
@@ -3396,14 +4483,13 @@ void *loader_dev_ext_gpa(struct loader_instance *inst, const char *funcName) {
         return NULL;
     }
 
-    if (loader_add_dev_ext_table(inst, &idx, funcName)) {
-        // successfully added new table entry
-        // init any dev dispatch table entrys as needed
-        loader_init_dispatch_dev_ext_entry(inst, NULL, idx, funcName);
-        return loader_get_dev_ext_trampoline(idx);
-    }
+    entry = loader_add_dev_ext_table(inst, funcName, hash);
+    if (entry == NULL)
+        return NULL;
 
-    return NULL;
+    // init any dev dispatch table entrys as needed
+    loader_init_dispatch_dev_ext_entry(inst, NULL, entry->index, funcName);
+    return loader_get_dev_ext_trampoline(entry->index);
 }
 
 struct loader_instance *loader_get_instance(const VkInstance instance) {
@@ -3850,7 +4936,9 @@ loader_create_device_chain(const struct loader_physical_device_tramp *pd,
         return VK_ERROR_INITIALIZATION_FAILED;
     }
 
-    /* Initialize device dispatch table */
+    /* Initialize device dispatch table.  Each entry is looked up through the
+     * whole chain, and layers hand back the next layer's entry point for
+     * commands they do not intercept, so calls skip those layers. */
     loader_init_device_dispatch_table(&dev->loader_dispatch, nextGDPA,
                                       dev->device);
 
@@ -4043,10 +5131,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(
         loader_init_generic_list(ptr_instance,
                                  (struct loader_generic_list *)&icd_exts,
                                  sizeof(VkExtensionProperties));
-        loader_add_instance_extensions(
-            ptr_instance,
-            icd->this_icd_lib->EnumerateInstanceExtensionProperties,
-            icd->this_icd_lib->lib_name, &icd_exts);
+        loader_add_icd_instance_extensions(ptr_instance, icd->this_icd_lib,
+                                           &icd_exts);
 
         for (uint32_t j = 0; j < pCreateInfo->enabledExtensionCount; j++) {
             prop = get_extension_property(
@@ -4215,6 +5301,10 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(
                                            pAllocator, &dev->device);
 
     if (res != VK_SUCCESS) {
+        // A lost physical device may be gone from the next enumeration
+        if (res == VK_ERROR_DEVICE_LOST)
+            loader_invalidate_physical_devices(
+                (struct loader_instance *)phys_dev->this_icd->this_instance);
         goto out;
     }
 
@@ -4234,18 +5324,29 @@ out:
     return res;
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL
-terminator_EnumeratePhysicalDevices(VkInstance instance,
-                                    uint32_t *pPhysicalDeviceCount,
-                                    VkPhysicalDevice *pPhysicalDevices) {
-    uint32_t i;
-    struct loader_instance *inst = (struct loader_instance *)instance;
-    VkResult res = VK_SUCCESS;
+/**
+ * Make the next vkEnumeratePhysicalDevices ask the ICDs for their physical
+ * devices again rather than answering from the instance's cache, for when the
+ * set of devices may have changed.  Handles already given out stay valid as
+ * long as the ICDs report the same devices.
+ */
+void loader_invalidate_physical_devices(struct loader_instance *inst) {
+    inst->phys_devs_term_valid = false;
+}
+
+/**
+ * Ask every ICD for its physical devices, and wrap them in
+ * inst->phys_devs_term unless they are the ones already wrapped there.
+ */
+static VkResult
+loader_enumerate_icd_physical_devices(struct loader_instance *inst) {
+    uint32_t i, j, idx = 0;
+    uint32_t total_count = 0;
+    VkResult res;
 
     struct loader_icd *icd;
     struct loader_phys_dev_per_icd *phys_devs;
 
-    inst->total_gpu_count = 0;
     phys_devs = (struct loader_phys_dev_per_icd *)loader_stack_alloc(
         sizeof(struct loader_phys_dev_per_icd) * inst->total_icd_count);
     if (!phys_devs)
@@ -4271,58 +5372,82 @@ terminator_EnumeratePhysicalDevices(VkInstance instance,
         }
         res = icd->EnumeratePhysicalDevices(
             icd->instance, &(phys_devs[i].count), phys_devs[i].phys_devs);
-        if ((res == VK_SUCCESS)) {
-            inst->total_gpu_count += phys_devs[i].count;
-        } else {
+        if (res != VK_SUCCESS)
             return res;
-        }
+        total_count += phys_devs[i].count;
         phys_devs[i].this_icd = icd;
         icd = icd->next;
     }
 
-    *pPhysicalDeviceCount = inst->total_gpu_count;
-    if (!pPhysicalDevices) {
-        return res;
+    // Keep the wrappers, and so the handles the application has, if nothing
+    // changed
+    bool unchanged =
+        inst->phys_devs_term && total_count == inst->total_gpu_count;
+    for (i = 0; unchanged && i < inst->total_icd_count; i++) {
+        for (j = 0; unchanged && j < phys_devs[i].count; j++, idx++) {
+            unchanged = inst->phys_devs_term[idx].this_icd ==
+                            phys_devs[i].this_icd &&
+                        inst->phys_devs_term[idx].phys_dev ==
+                            phys_devs[i].phys_devs[j];
+        }
+    }
+    if (unchanged) {
+        inst->phys_devs_term_valid = true;
+        return VK_SUCCESS;
     }
 
-    /* Initialize the output pPhysicalDevices  with wrapped loader terminator
-     * physicalDevice objects; save this list of wrapped objects in instance
-     * struct for later cleanup and use by trampoline code */
-    uint32_t j, idx = 0;
-    uint32_t copy_count = 0;
-
-    copy_count = (inst->total_gpu_count < *pPhysicalDeviceCount)
-                     ? inst->total_gpu_count
-                     : *pPhysicalDeviceCount;
-
-    if (inst->phys_devs_term)
-        loader_instance_heap_free(inst, inst->phys_devs_term);
+    loader_instance_heap_free(inst, inst->phys_devs_term);
+    inst->total_gpu_count = 0;
     inst->phys_devs_term = loader_instance_heap_alloc(
-        inst, sizeof(struct loader_physical_device) * copy_count,
+        inst, sizeof(struct loader_physical_device) * total_count,
         VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
     if (!inst->phys_devs_term)
         return VK_ERROR_OUT_OF_HOST_MEMORY;
 
-    for (i = 0; idx < copy_count && i < inst->total_icd_count; i++) {
-
-        for (j = 0; j < phys_devs[i].count && idx < copy_count; j++) {
+    idx = 0;
+    for (i = 0; i < inst->total_icd_count; i++) {
+        for (j = 0; j < phys_devs[i].count; j++) {
             loader_set_dispatch((void *)&inst->phys_devs_term[idx], inst->disp);
             inst->phys_devs_term[idx].this_icd = phys_devs[i].this_icd;
             inst->phys_devs_term[idx].phys_dev = phys_devs[i].phys_devs[j];
-            pPhysicalDevices[idx] =
-                (VkPhysicalDevice)&inst->phys_devs_term[idx];
             idx++;
         }
     }
-    *pPhysicalDeviceCount = copy_count;
+    inst->total_gpu_count = total_count;
+    inst->phys_devs_term_valid = true;
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+terminator_EnumeratePhysicalDevices(VkInstance instance,
+                                    uint32_t *pPhysicalDeviceCount,
+                                    VkPhysicalDevice *pPhysicalDevices) {
+    struct loader_instance *inst = (struct loader_instance *)instance;
+    uint32_t copy_count;
 
-    // TODO: Is phys_devs being leaked?
+    // The ICDs are only asked the first time, after that the answer comes from
+    // the wrappers made then
+    if (!inst->phys_devs_term_valid) {
+        VkResult res = loader_enumerate_icd_physical_devices(inst);
+        if (res != VK_SUCCESS)
+            return res;
+    }
 
-    if (copy_count < inst->total_gpu_count) {
-        inst->total_gpu_count = copy_count;
-        return VK_INCOMPLETE;
+    if (!pPhysicalDevices) {
+        *pPhysicalDeviceCount = inst->total_gpu_count;
+        return VK_SUCCESS;
     }
-    return res;
+
+    copy_count = (inst->total_gpu_count < *pPhysicalDeviceCount)
+                     ? inst->total_gpu_count
+                     : *pPhysicalDeviceCount;
+    for (uint32_t i = 0; i < copy_count; i++)
+        pPhysicalDevices[i] = (VkPhysicalDevice)&inst->phys_devs_term[i];
+    *pPhysicalDeviceCount = copy_count;
+
+    if (copy_count < inst->total_gpu_count)
+        return VK_INCOMPLETE;
+    return VK_SUCCESS;
 }
 
 VKAPI_ATTR void VKAPI_CALL terminator_GetPhysicalDeviceProperties(
@@ -137,25 +137,44 @@ struct loader_layer_list {
     struct loader_layer_properties *list;
 };
 
-struct loader_dispatch_hash_list {
-    size_t capacity;
-    uint32_t count;
-    uint32_t *index; // index into the dev_ext dispatch table
+// Number of trampolines in dev_ext_trampoline.c.  Past those, distinct
+// unknown device entry points get trampolines generated at run time,
+// DEV_EXT_BLOCK_SIZE at a time, where the platform allows it.  Each
+// trampoline has a one to one correspondence with a DevExt dispatch entry.
+#define NUM_STATIC_DEV_EXTS 1024
+#define DEV_EXT_BLOCK_SIZE 1024
+
+// An unknown device entry point and the trampoline / DevExt dispatch entry it
+// was given
+struct loader_dispatch_hash_entry {
+    char *func_name; // NULL for an unused entry
+    uint32_t hash;
+    uint32_t index; // of its trampoline and DevExt dispatch entry
 };
 
-#define MAX_NUM_DEV_EXTS 250
-// loader_dispatch_hash_entry and loader_dev_ext_dispatch_table.DevExt have one
-// to one
-// correspondence; one loader_dispatch_hash_entry for one DevExt dispatch entry.
-// Also have a one to one correspondence with functions in dev_ext_trampoline.c
-struct loader_dispatch_hash_entry {
-    char *func_name;
-    struct loader_dispatch_hash_list list; // to handle hashing collisions
+// Open addressed with linear probing, and grown before it gets three quarters
+// full.  capacity is zero or a power of two.
+struct loader_dispatch_hash {
+    uint32_t capacity;
+    uint32_t count;
+    struct loader_dispatch_hash_entry *entries;
 };
 
 typedef void(VKAPI_PTR *PFN_vkDevExt)(VkDevice device);
+
+// DevExt dispatch entries past the static ones, DEV_EXT_BLOCK_SIZE to a block.
+// Generated trampolines read this while another thread may be adding entry
+// points, so it is replaced rather than grown in place, and the one it
+// replaced is kept until the device is destroyed.
+struct loader_dev_ext_blocks {
+    struct loader_dev_ext_blocks *replaced;
+    uint32_t count;
+    PFN_vkDevExt *block[];
+};
+
 struct loader_dev_ext_dispatch_table {
-    PFN_vkDevExt DevExt[MAX_NUM_DEV_EXTS];
+    PFN_vkDevExt DevExt[NUM_STATIC_DEV_EXTS];
+    struct loader_dev_ext_blocks *more; // NULL until more are needed
 };
 
 struct loader_dev_dispatch_table {
@@ -163,6 +182,30 @@ struct loader_dev_dispatch_table {
     struct loader_dev_ext_dispatch_table ext_dispatch;
 };
 
+struct loader_arena_block;
+
+/*
+ * Bump allocator for an instance's long lived bookkeeping: layer and
+ * extension lists, ICD and layer library lists, dispatch tables and so on.
+ * While enabled, which is only during vkCreateInstance on the thread creating
+ * the instance, instance scope allocations are carved out of a few large
+ * blocks, and freeing them does nothing.  The blocks are freed all at once
+ * when the instance is destroyed.  Once the instance is created no new blocks
+ * are added, so other threads may free into the arena without a lock.
+ */
+struct loader_arena {
+    bool enabled;
+    // The block being carved from comes first
+    struct loader_arena_block *blocks;
+    // Most recent allocation from that block, which realloc can grow in place
+    void *last;
+    // Allocations carved out of the blocks, which would each otherwise have
+    // been a call to the application's allocator, and the calls made instead
+    uint32_t alloc_count;
+    uint32_t block_count;
+    size_t block_bytes;
+};
+
 /* per CreateDevice structure */
 struct loader_device {
     struct loader_dev_dispatch_table loader_dispatch;
@@ -254,8 +297,12 @@ struct loader_icd_libs {
 struct loader_instance {
     VkLayerInstanceDispatchTable *disp; // must be first entry in structure
 
-    uint32_t total_gpu_count; // count of the next two arrays
+    uint32_t total_gpu_count; // count of phys_devs_term
+    // Every ICD's physical devices, kept from one vkEnumeratePhysicalDevices
+    // to the next while valid, see loader_invalidate_physical_devices()
     struct loader_physical_device *phys_devs_term;
+    bool phys_devs_term_valid;
+    uint32_t phys_dev_count_tramp; // count of phys_devs
     struct loader_physical_device_tramp *
         phys_devs; // tramp wrapped physDev obj list
     uint32_t total_icd_count;
@@ -264,7 +311,7 @@ struct loader_instance {
     struct loader_extension_list ext_list; // icds and loaders extensions
     struct loader_icd_libs icd_libs;
     struct loader_layer_list instance_layer_list;
-    struct loader_dispatch_hash_entry disp_hash[MAX_NUM_DEV_EXTS];
+    struct loader_dispatch_hash disp_hash;
 
     struct loader_msg_callback_map_entry *icd_msg_callback_map;
 
@@ -279,6 +326,7 @@ struct loader_instance {
     VkDebugReportCallbackEXT *tmp_callbacks;
 
     VkAllocationCallbacks alloc_callbacks;
+    struct loader_arena arena;
 
     bool wsi_surface_enabled;
 #ifdef VK_USE_PLATFORM_WIN32_KHR
@@ -335,6 +383,10 @@ struct loader_struct {
 
 struct loader_scanned_icds {
     char *lib_name;
+    // Whether the library file could be stat'ed, see loader_icd_cache
+    bool identity_known;
+    struct loader_file_identity identity;
+    // NULL, like the entry points below, until loader_scanned_icd_load()
     loader_platform_dl_handle handle;
     uint32_t api_version;
     uint32_t interface_version;
@@ -401,6 +453,9 @@ struct loader_msg_callback_map_entry {
 void *loader_instance_heap_alloc(const struct loader_instance *instance, size_t size, VkSystemAllocationScope allocationScope);
 void loader_instance_heap_free(const struct loader_instance *instance, void *pMemory);
 void *loader_instance_heap_realloc(const struct loader_instance *instance, void *pMemory, size_t orig_size, size_t size, VkSystemAllocationScope alloc_scope);
+void loader_instance_arena_begin(struct loader_instance *instance);
+void loader_instance_arena_end(struct loader_instance *instance);
+void loader_instance_arena_release(struct loader_instance *instance);
 void *loader_instance_tls_heap_alloc(size_t size);
 void loader_instance_tls_heap_free(void *pMemory);
 void *loader_device_heap_alloc(const struct loader_device *device, size_t size, VkSystemAllocationScope allocationScope);
@@ -485,6 +540,9 @@ void loader_scanned_icd_clear(const struct loader_instance *inst,
                               struct loader_icd_libs *icd_libs);
 VkResult loader_icd_scan(const struct loader_instance *inst,
                      struct loader_icd_libs *icds);
+VkResult loader_scanned_icd_load(const struct loader_instance *inst,
+                                 struct loader_icd_libs *icd_libs,
+                                 bool all_libraries);
 void loader_layer_scan(const struct loader_instance *inst,
                        struct loader_layer_list *instance_layers);
 void loader_implicit_layer_scan(const struct loader_instance *inst,
@@ -494,10 +552,12 @@ void loader_get_icd_loader_instance_extensions(
     struct loader_extension_list *inst_exts);
 struct loader_icd *loader_get_icd_and_device(const VkDevice device,
                                              struct loader_device **found_dev);
+void loader_invalidate_physical_devices(struct loader_instance *inst);
 void loader_init_dispatch_dev_ext(struct loader_instance *inst,
                                   struct loader_device *dev);
 void *loader_dev_ext_gpa(struct loader_instance *inst, const char *funcName);
 void *loader_get_dev_ext_trampoline(uint32_t index);
+void *loader_get_static_dev_ext_trampoline(uint32_t index);
 struct loader_instance *loader_get_instance(const VkInstance instance);
 void loader_deactivate_layers(const struct loader_instance *instance,
                               struct loader_device *device,
@@ -176,6 +176,12 @@ vkEnumerateInstanceExtensionProperties(const char *pLayerName,
         if (VK_SUCCESS != res) {
             goto out;
         }
+        /* only the ICDs whose extensions aren't cached need loading */
+        res = loader_scanned_icd_load(NULL, &icd_libs, false);
+        if (VK_SUCCESS != res) {
+            loader_scanned_icd_clear(NULL, &icd_libs);
+            goto out;
+        }
         /* get extensions from all ICD's, merge so no duplicates */
         loader_get_icd_loader_instance_extensions(NULL, &icd_libs,
                                                   &local_ext_list);
@@ -301,6 +307,7 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(
     if (pAllocator) {
         ptr_instance->alloc_callbacks = *pAllocator;
     }
+    loader_instance_arena_begin(ptr_instance);
 
     /*
      * Look for one or more debug report create info structures
@@ -364,6 +371,10 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(
     if (res != VK_SUCCESS) {
         goto out;
     }
+    res = loader_scanned_icd_load(ptr_instance, &ptr_instance->icd_libs, false);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
 
     /* get extensions from all ICD's, merge so no duplicates, then validate */
     loader_get_icd_loader_instance_extensions(
@@ -375,6 +386,12 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(
         goto out;
     }
 
+    /* every ICD gets an instance, so load the rest of their libraries */
+    res = loader_scanned_icd_load(ptr_instance, &ptr_instance->icd_libs, true);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
+
     ptr_instance->disp = loader_instance_heap_alloc(
         ptr_instance, sizeof(VkLayerInstanceDispatchTable),
         VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
@@ -445,8 +462,11 @@ out:
                 ptr_instance,
                 (struct loader_generic_list *)&ptr_instance->ext_list);
 
+            loader_instance_arena_release(ptr_instance);
             loader_instance_heap_free(ptr_instance, ptr_instance);
         } else {
+            loader_instance_arena_end(ptr_instance);
+
             /* Remove temporary debug_report callback */
             util_DestroyDebugReportCallbacks(ptr_instance, pAllocator,
                                              ptr_instance->num_tmp_callbacks,
@@ -509,6 +529,7 @@ LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(
                                         ptr_instance->tmp_callbacks);
     }
     loader_instance_heap_free(ptr_instance, ptr_instance->disp);
+    loader_instance_arena_release(ptr_instance);
     loader_instance_heap_free(ptr_instance, ptr_instance);
     loader_platform_thread_unlock_mutex(&loader_lock);
 }
@@ -546,16 +567,21 @@ vkEnumeratePhysicalDevices(VkInstance instance, uint32_t *pPhysicalDeviceCount,
                 ? inst->total_gpu_count
                 : *pPhysicalDeviceCount;
     *pPhysicalDeviceCount = count;
-    if (!inst->phys_devs) {
-        inst->phys_devs =
+    // The wrappers are kept for the life of the instance, so that the handles
+    // given out are the same every time
+    if (inst->phys_dev_count_tramp < count) {
+        struct loader_physical_device_tramp *phys_devs =
             (struct loader_physical_device_tramp *)loader_instance_heap_alloc(
                 inst, inst->total_gpu_count *
                           sizeof(struct loader_physical_device_tramp),
                 VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-    }
-    if (!inst->phys_devs) {
-        loader_platform_thread_unlock_mutex(&loader_lock);
-        return VK_ERROR_OUT_OF_HOST_MEMORY;
+        if (!phys_devs) {
+            loader_platform_thread_unlock_mutex(&loader_lock);
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        loader_instance_heap_free(inst, inst->phys_devs);
+        inst->phys_devs = phys_devs;
+        inst->phys_dev_count_tramp = inst->total_gpu_count;
     }
 
     for (i = 0; i < count; i++) {
@@ -115,34 +115,39 @@ class Subcommand(object):
     def generate_footer(self):
         pass
 
+# Must match NUM_STATIC_DEV_EXTS in loader.h
+DEV_EXT_TRAMPOLINE_COUNT = 1024
+
 class DevExtTrampolineSubcommand(Subcommand):
     def generate_header(self):
         lines = []
+        lines.append("#define _GNU_SOURCE")
         lines.append("#include \"vk_loader_platform.h\"")
         lines.append("#include \"loader.h\"")
         lines.append("#if defined(__linux__)")
-        lines.append("#pragma GCC optimize(3)  // force gcc to use tail-calls")
+        lines.append("#pragma GCC optimize(3) // force gcc to use tail-calls")
         lines.append("#endif")
         return "\n".join(lines)
 
     def generate_body(self):
         lines = []
-        for i in range(250):
-            lines.append('\nVKAPI_ATTR void VKAPI_CALL vkDevExt%s(VkDevice device)' % i)
-            lines.append('{')
+        for i in range(DEV_EXT_TRAMPOLINE_COUNT):
+            lines.append('\nVKAPI_ATTR void VKAPI_CALL vkDevExt%s(VkDevice device) {' % i)
             lines.append('    const struct loader_dev_dispatch_table *disp;')
             lines.append('    disp = loader_get_dev_dispatch(device);')
             lines.append('    disp->ext_dispatch.DevExt[%s](device);' % i)
             lines.append('}')
         lines.append('')
-        lines.append('void *loader_get_dev_ext_trampoline(uint32_t index)')
-        lines.append('{')
-        lines.append('    switch (index) {')
-        for i in range(250):
-            lines.append('        case %s:' % i)
-            lines.append('            return vkDevExt%s;' % i)
-        lines.append('    }')
-        lines.append('    return NULL;')
+        lines.append('static const PFN_vkDevExt loader_dev_ext_trampolines[NUM_STATIC_DEV_EXTS] = {')
+        for i in range(0, DEV_EXT_TRAMPOLINE_COUNT, 4):
+            names = ['vkDevExt%s' % j for j in range(i, min(i + 4, DEV_EXT_TRAMPOLINE_COUNT))]
+            lines.append('    ' + ', '.join(names) + ',')
+        lines.append('};')
+        lines.append('')
+        lines.append('void *loader_get_static_dev_ext_trampoline(uint32_t index) {')
+        lines.append('    if (index >= NUM_STATIC_DEV_EXTS)')
+        lines.append('        return NULL;')
+        lines.append('    return (void *)loader_dev_ext_trampolines[index];')
         lines.append('}')
         return "\n".join(lines)
 
@@ -431,6 +436,171 @@ class LoaderGetProcAddrSubcommand(Subcommand):
 
         return "\n".join(body)
 
+class DispatchLookupSubcommand(Subcommand):
+    # Functions with their own handling in the loader's GetProcAddr functions
+    global_functions = ["CreateInstance", "EnumerateInstanceExtensionProperties",
+                        "EnumerateInstanceLayerProperties"]
+
+    platform_guards = {
+            "VK_KHR_win32_surface": "VK_USE_PLATFORM_WIN32_KHR",
+            "VK_KHR_xcb_surface": "VK_USE_PLATFORM_XCB_KHR",
+            "VK_KHR_xlib_surface": "VK_USE_PLATFORM_XLIB_KHR",
+            "VK_KHR_wayland_surface": "VK_USE_PLATFORM_WAYLAND_KHR",
+            "VK_KHR_mir_surface": "VK_USE_PLATFORM_MIR_KHR",
+            "VK_KHR_android_surface": "VK_USE_PLATFORM_ANDROID_KHR",
+    }
+
+    def run(self):
+        # The tables cover every platform, guarded the way vk_layer.h guards
+        # the dispatch table members, so the output doesn't depend on <wsi>
+        self.extensions = [vulkan.core, vulkan.ext_khr_surface,
+                           vulkan.ext_khr_device_swapchain,
+                           vulkan.ext_khr_win32_surface,
+                           vulkan.ext_khr_xcb_surface,
+                           vulkan.ext_khr_xlib_surface,
+                           vulkan.ext_khr_wayland_surface,
+                           vulkan.ext_khr_mir_surface,
+                           vulkan.ext_khr_display,
+                           vulkan.ext_khr_android_surface,
+                           vulkan.lunarg_debug_report]
+        super().run()
+
+    def generate_copyright(self):
+        return """/* THIS FILE IS GENERATED.  DO NOT EDIT. */
+
+/*
+ * Copyright (c) 2015-2016 The Khronos Group Inc.
+ * Copyright (c) 2015-2016 Valve Corporation
+ * Copyright (c) 2015-2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */"""
+
+    def generate_header(self):
+        return "\n".join(["#ifndef DISPATCH_LOOKUP_H",
+                          "#define DISPATCH_LOOKUP_H",
+                          "",
+                          "#include <stddef.h>",
+                          "#include <string.h>",
+                          "#include <vulkan/vulkan.h>",
+                          "#include <vulkan/vk_layer.h>"])
+
+    def _table(self, func, type, macro, entries):
+        # entries are (name, guard) pairs, sorted by name the way strcmp
+        # orders them so the table can be binary searched.  The table is
+        # local to an inline function so including this header in a file that
+        # doesn't use it costs nothing.
+        lines = ["static inline const struct %s *" % type,
+                 "%s(size_t *count) {" % func]
+        lines.append("    static const struct %s names[] = {" % type)
+        guard = None
+        for name, entry_guard in sorted(entries):
+            if entry_guard != guard:
+                if guard:
+                    lines.append("#endif")
+                if entry_guard:
+                    lines.append("#ifdef %s" % entry_guard)
+                guard = entry_guard
+            lines.append("        %s(%s)," % (macro, name))
+        if guard:
+            lines.append("#endif")
+        lines.append("    };")
+        lines.append("    *count = sizeof(names) / sizeof(names[0]);")
+        lines.append("    return names;")
+        lines.append("}")
+        return "\n".join(lines)
+
+    def generate_body(self):
+        device = []
+        instance = []
+        trampoline = []
+        for ext in self.extensions:
+            guard = self.platform_guards.get(ext.name)
+            for proto in ext.protos:
+                if proto.name in self.global_functions:
+                    continue
+                first = proto.params[0].ty
+                if first in ["VkDevice", "VkQueue", "VkCommandBuffer"]:
+                    device.append((proto.name, guard))
+                elif first in ["VkInstance", "VkPhysicalDevice"] and \
+                        proto.name != "CreateDevice":
+                    instance.append((proto.name, guard))
+                if ext is vulkan.core:
+                    trampoline.append((proto.name, guard))
+
+        body = []
+        body.append("""// Entry point names without their "vk" prefix, each sorted by name for
+// loader_find_name()
+struct loader_dispatch_name {
+    const char *name;
+    // Of the entry point in its dispatch table
+    size_t offset;
+};
+
+struct loader_trampoline_name {
+    const char *name;
+    PFN_vkVoidFunction addr;
+};
+
+#define LOADER_DEVICE_ENTRY(func)                                              \\
+    { #func, offsetof(VkLayerDispatchTable, func) }
+#define LOADER_INSTANCE_ENTRY(func)                                            \\
+    { #func, offsetof(VkLayerInstanceDispatchTable, func) }
+#define LOADER_TRAMPOLINE_ENTRY(func)                                          \\
+    { #func, (PFN_vkVoidFunction)vk##func }""")
+        body.append(self._table("loader_device_names",
+                                "loader_dispatch_name",
+                                "LOADER_DEVICE_ENTRY", device))
+        body.append(self._table("loader_instance_names",
+                                "loader_dispatch_name",
+                                "LOADER_INSTANCE_ENTRY", instance))
+        body.append(self._table("loader_trampoline_names",
+                                "loader_trampoline_name",
+                                "LOADER_TRAMPOLINE_ENTRY", trampoline))
+        body.append("""#undef LOADER_DEVICE_ENTRY
+#undef LOADER_INSTANCE_ENTRY
+#undef LOADER_TRAMPOLINE_ENTRY
+
+/**
+ * Binary search count entries, stride bytes apart and each starting with a
+ * name, for name.
+ *
+ * \\returns
+ * The index of the entry, or -1 if there is none.
+ */
+static inline int loader_find_name(const void *entries, size_t stride,
+                                   size_t count, const char *name) {
+    size_t low = 0;
+    size_t high = count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        const char *entry =
+            *(const char *const *)((const char *)entries + mid * stride);
+        int order = strcmp(name, entry);
+        if (order == 0)
+            return (int)mid;
+        if (order < 0)
+            high = mid;
+        else
+            low = mid + 1;
+    }
+    return -1;
+}""")
+        return "\n\n".join(body)
+
+    def generate_footer(self):
+        return "#endif // DISPATCH_LOOKUP_H"
+
 def main():
 
     wsi = {
@@ -448,6 +618,7 @@ def main():
             "dispatch-table-ops": DispatchTableOpsSubcommand,
             "win-def-file": WinDefFileSubcommand,
             "loader-get-proc-addr": LoaderGetProcAddrSubcommand,
+            "dispatch-lookup": DispatchLookupSubcommand,
     }
 
     if len(sys.argv) < 3 or sys.argv[1] not in wsi or sys.argv[2] not in subcommands:
@@ -30,6 +30,16 @@
 #include "vulkan/vk_platform.h"
 #include "vulkan/vk_sdk_platform.h"
 
+// What loader_platform_file_identity() reports about a file, used to tell
+// whether a file read earlier may have changed since.
+struct loader_file_identity {
+    uint64_t size;
+    uint64_t modified;
+    uint64_t changed;
+    uint64_t file_id;
+    uint64_t volume;
+};
+
 #if defined(__linux__)
 /* Linux-specific common code: */
 
@@ -45,6 +55,8 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <libgen.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 // VK Library Filenames, Paths, etc.:
 #define PATH_SEPERATOR ':'
@@ -106,6 +118,38 @@ static inline bool loader_platform_file_exists(const char *path) {
         return true;
 }
 
+// Fill in *identity for the file at path, returns false if it can't be
+// stat'ed.  Rewriting or replacing the file changes its identity, except for a
+// rewrite to the same size within the same second of the last one.
+static inline bool
+loader_platform_file_identity(const char *path,
+                              struct loader_file_identity *identity) {
+    struct stat st;
+    if (stat(path, &st))
+        return false;
+    identity->size = (uint64_t)st.st_size;
+    identity->modified = (uint64_t)st.st_mtime;
+    identity->changed = (uint64_t)st.st_ctime;
+    identity->file_id = (uint64_t)st.st_ino;
+    identity->volume = (uint64_t)st.st_dev;
+    return true;
+}
+
+// Copy size bytes of machine code into pages of their own that can be run
+// but are never writable at the same time, returns NULL if that fails.
+static inline void *loader_platform_map_code(const void *code, size_t size) {
+    void *mapping = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+        return NULL;
+    memcpy(mapping, code, size);
+    if (mprotect(mapping, size, PROT_READ | PROT_EXEC)) {
+        munmap(mapping, size);
+        return NULL;
+    }
+    return mapping;
+}
+
 static inline bool loader_platform_is_path_absolute(const char *path) {
     if (path[0] == '/')
         return true;
@@ -155,6 +199,21 @@ static inline void loader_platform_thread_once(pthread_once_t *ctl,
     assert(ctl != NULL);
     pthread_once(ctl, func);
 }
+// Thread functions are declared as
+//   static loader_platform_thread_result LOADER_PLATFORM_THREAD_CALL
+//   func(void *arg)
+// and return 0
+typedef void *loader_platform_thread_result;
+#define LOADER_PLATFORM_THREAD_CALL
+static inline bool loader_platform_thread_create(
+    loader_platform_thread *thread,
+    loader_platform_thread_result(LOADER_PLATFORM_THREAD_CALL *func)(void *),
+    void *arg) {
+    return pthread_create(thread, NULL, func, arg) == 0;
+}
+static inline void loader_platform_thread_join(loader_platform_thread thread) {
+    pthread_join(thread, NULL);
+}
 
 // Thread IDs:
 typedef pthread_t loader_platform_thread_id;
@@ -248,6 +307,42 @@ static bool loader_platform_file_exists(const char *path) {
         return true;
 }
 
+// Fill in *identity for the file at path, returns false if it can't be
+// found.  Rewriting or replacing the file changes its identity.
+static bool
+loader_platform_file_identity(const char *path,
+                              struct loader_file_identity *identity) {
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExA(path, GetFileExInfoStandard, &data))
+        return false;
+    identity->size =
+        ((uint64_t)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+    identity->modified = ((uint64_t)data.ftLastWriteTime.dwHighDateTime << 32) |
+                         data.ftLastWriteTime.dwLowDateTime;
+    identity->changed = ((uint64_t)data.ftCreationTime.dwHighDateTime << 32) |
+                        data.ftCreationTime.dwLowDateTime;
+    identity->file_id = 0;
+    identity->volume = 0;
+    return true;
+}
+
+// Copy size bytes of machine code into pages of their own that can be run
+// but are never writable at the same time, returns NULL if that fails.
+static void *loader_platform_map_code(const void *code, size_t size) {
+    DWORD old_protect;
+    void *mapping =
+        VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (mapping == NULL)
+        return NULL;
+    memcpy(mapping, code, size);
+    if (!VirtualProtect(mapping, size, PAGE_EXECUTE_READ, &old_protect)) {
+        VirtualFree(mapping, 0, MEM_RELEASE);
+        return NULL;
+    }
+    FlushInstructionCache(GetCurrentProcess(), mapping, size);
+    return mapping;
+}
+
 static bool loader_platform_is_path_absolute(const char *path) {
     return !PathIsRelative(path);
 }
@@ -342,6 +437,19 @@ static void loader_platform_thread_once(void *ctl, void (*func)(void)) {
     assert(ctl != NULL);
     InitOnceExecuteOnce((PINIT_ONCE)ctl, InitFuncWrapper, func, NULL);
 }
+typedef DWORD loader_platform_thread_result;
+#define LOADER_PLATFORM_THREAD_CALL WINAPI
+static bool loader_platform_thread_create(
+    loader_platform_thread *thread,
+    loader_platform_thread_result(LOADER_PLATFORM_THREAD_CALL *func)(void *),
+    void *arg) {
+    *thread = CreateThread(NULL, 0, func, arg, 0, NULL);
+    return *thread != NULL;
+}
+static void loader_platform_thread_join(loader_platform_thread thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
 
 // Thread IDs:
 typedef DWORD loader_platform_thread_id;
@@ -0,0 +1,510 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// A driver that does nothing, for testing the loader without a GPU.
+//
+// It has one physical device unless a test asks for more, and supports any device entry point named
+// vkStubSupported<anything>, all of which resolve to the same function:
+//
+//     void vkStubSupported...(VkDevice device, uint32_t *calls)
+//
+// which increments *calls, so that a test can tell a call made it through the loader's trampolines to the driver.
+// Command pools and command buffers can be made and recorded into, for timing calls through layers, though the
+// vkCmd* commands it has do nothing.  So can events and the objects a draw needs, each of which is just a new handle,
+// and buffers can be bound to the one memory type it has.  Each device has one queue, which finishes whatever is
+// submitted to it at once.
+//
+// Tests that have the loader use it can find these in the library too, to see what the loader asked of it:
+//
+//     uint32_t stub_icdGetCallCount(const char *pName)
+//         How many times the entry point pName, which must be one of those counted below, has been called.
+//     void stub_icdSetPhysicalDeviceCount(uint32_t count)
+//         Report count physical devices from now on, up to max_physical_devices.
+
+#include <atomic>
+#include <string.h>
+
+#include "vulkan/vulkan.h"
+#include "vulkan/vk_icd.h"
+
+#if defined(_WIN32)
+#define STUB_ICD_EXPORT extern "C" __declspec(dllexport)
+#else
+#define STUB_ICD_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+namespace stub_icd {
+
+// Dispatchable objects must start with room for the loader's dispatch pointer
+struct DispatchableObject {
+    VK_LOADER_DATA loader_data;
+};
+
+// A device and its one queue
+struct Device : DispatchableObject {
+    DispatchableObject queue;
+};
+
+const uint32_t max_physical_devices = 8;
+DispatchableObject physical_devices[max_physical_devices];
+std::atomic<uint32_t> physical_device_count(1);
+
+// Calls counted for stub_icdGetCallCount()
+std::atomic<uint32_t> create_instance_calls(0);
+std::atomic<uint32_t> enumerate_physical_devices_calls(0);
+std::atomic<uint32_t> create_device_calls(0);
+
+const char synthetic_prefix[] = "vkStubSupported";
+
+VKAPI_ATTR void VKAPI_CALL SyntheticEntryPoint(VkDevice, uint32_t *calls) { ++*calls; }
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *, const VkAllocationCallbacks *,
+                                              VkInstance *pInstance) {
+    ++create_instance_calls;
+    DispatchableObject *instance = new DispatchableObject;
+    set_loader_magic_value(instance);
+    *pInstance = reinterpret_cast<VkInstance>(instance);
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocationCallbacks *) {
+    delete reinterpret_cast<DispatchableObject *>(instance);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceExtensionProperties(const char *, uint32_t *pPropertyCount,
+                                                                    VkExtensionProperties *) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(VkInstance, uint32_t *pPhysicalDeviceCount,
+                                                        VkPhysicalDevice *pPhysicalDevices) {
+    ++enumerate_physical_devices_calls;
+    const uint32_t count = physical_device_count;
+    if (!pPhysicalDevices) {
+        *pPhysicalDeviceCount = count;
+        return VK_SUCCESS;
+    }
+    const uint32_t copy_count = (*pPhysicalDeviceCount < count) ? *pPhysicalDeviceCount : count;
+    for (uint32_t i = 0; i < copy_count; i++) {
+        set_loader_magic_value(&physical_devices[i]);
+        pPhysicalDevices[i] = reinterpret_cast<VkPhysicalDevice>(&physical_devices[i]);
+    }
+    *pPhysicalDeviceCount = copy_count;
+    return (copy_count < count) ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures(VkPhysicalDevice, VkPhysicalDeviceFeatures *pFeatures) {
+    memset(pFeatures, 0, sizeof(*pFeatures));
+}
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties(VkPhysicalDevice, VkFormat,
+                                                             VkFormatProperties *pFormatProperties) {
+    memset(pFormatProperties, 0, sizeof(*pFormatProperties));
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties(VkPhysicalDevice, VkFormat, VkImageType,
+                                                                      VkImageTiling, VkImageUsageFlags,
+                                                                      VkImageCreateFlags, VkImageFormatProperties *) {
+    return VK_ERROR_FORMAT_NOT_SUPPORTED;
+}
+
+const VkDeviceSize buffer_alignment = 256;
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(VkPhysicalDevice, VkPhysicalDeviceProperties *pProperties) {
+    memset(pProperties, 0, sizeof(*pProperties));
+    pProperties->apiVersion = VK_MAKE_VERSION(1, 0, VK_HEADER_VERSION);
+    pProperties->deviceType = VK_PHYSICAL_DEVICE_TYPE_OTHER;
+    strncpy(pProperties->deviceName, "Stub ICD", VK_MAX_PHYSICAL_DEVICE_NAME_SIZE);
+    pProperties->limits.lineWidthRange[0] = 1.0f;
+    pProperties->limits.lineWidthRange[1] = 1.0f;
+    pProperties->limits.maxBoundDescriptorSets = 8;
+    pProperties->limits.maxPerStageDescriptorUniformBuffers = 256;
+    pProperties->limits.maxDescriptorSetUniformBuffers = 256;
+    pProperties->limits.maxFramebufferWidth = 4096;
+    pProperties->limits.maxFramebufferHeight = 4096;
+    pProperties->limits.maxFramebufferLayers = 256;
+    pProperties->limits.maxViewports = 1;
+    pProperties->limits.minUniformBufferOffsetAlignment = buffer_alignment;
+    pProperties->limits.minStorageBufferOffsetAlignment = buffer_alignment;
+    pProperties->limits.minTexelBufferOffsetAlignment = buffer_alignment;
+}
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice, uint32_t *pQueueFamilyPropertyCount,
+                                                                  VkQueueFamilyProperties *pQueueFamilyProperties) {
+    if (!pQueueFamilyProperties) {
+        *pQueueFamilyPropertyCount = 1;
+        return;
+    }
+    if (*pQueueFamilyPropertyCount < 1) {
+        return;
+    }
+    memset(pQueueFamilyProperties, 0, sizeof(*pQueueFamilyProperties));
+    pQueueFamilyProperties->queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+    pQueueFamilyProperties->queueCount = 1;
+    *pQueueFamilyPropertyCount = 1;
+}
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(VkPhysicalDevice,
+                                                             VkPhysicalDeviceMemoryProperties *pMemoryProperties) {
+    memset(pMemoryProperties, 0, sizeof(*pMemoryProperties));
+    pMemoryProperties->memoryTypeCount = 1;
+    pMemoryProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+                                                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    pMemoryProperties->memoryTypes[0].heapIndex = 0;
+    pMemoryProperties->memoryHeapCount = 1;
+    pMemoryProperties->memoryHeaps[0].size = 1ull << 30;
+    pMemoryProperties->memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+}
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice, VkFormat, VkImageType,
+                                                                        VkSampleCountFlagBits, VkImageUsageFlags,
+                                                                        VkImageTiling, uint32_t *pPropertyCount,
+                                                                        VkSparseImageFormatProperties *) {
+    *pPropertyCount = 0;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(VkPhysicalDevice, const char *,
+                                                                  uint32_t *pPropertyCount, VkExtensionProperties *) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice, const VkDeviceCreateInfo *, const VkAllocationCallbacks *,
+                                            VkDevice *pDevice) {
+    ++create_device_calls;
+    Device *device = new Device;
+    set_loader_magic_value(device);
+    set_loader_magic_value(&device->queue);
+    *pDevice = reinterpret_cast<VkDevice>(device);
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *) {
+    delete reinterpret_cast<Device *>(device);
+}
+
+VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t, uint32_t, VkQueue *pQueue) {
+    *pQueue = reinterpret_cast<VkQueue>(&reinterpret_cast<Device *>(device)->queue);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue, uint32_t, const VkSubmitInfo *, VkFence) { return VK_SUCCESS; }
+
+VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue) { return VK_SUCCESS; }
+
+VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice) { return VK_SUCCESS; }
+
+std::atomic<uint64_t> next_handle(1);
+
+// Non-dispatchable objects are only a handle, never the same one twice
+template <typename T> VkResult NewHandle(T *pHandle) {
+    uint64_t handle = next_handle++;
+    *pHandle = reinterpret_cast<T &>(handle);
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice, const VkCommandPoolCreateInfo *, const VkAllocationCallbacks *,
+                                                 VkCommandPool *pCommandPool) {
+    return NewHandle(pCommandPool);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice, VkCommandPool, const VkAllocationCallbacks *) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo *pAllocateInfo,
+                                                      VkCommandBuffer *pCommandBuffers) {
+    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++) {
+        DispatchableObject *command_buffer = new DispatchableObject;
+        set_loader_magic_value(command_buffer);
+        pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>(command_buffer);
+    }
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice, VkCommandPool, uint32_t commandBufferCount,
+                                              const VkCommandBuffer *pCommandBuffers) {
+    for (uint32_t i = 0; i < commandBufferCount; i++) {
+        delete reinterpret_cast<DispatchableObject *>(pCommandBuffers[i]);
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer, const VkCommandBufferBeginInfo *) { return VK_SUCCESS; }
+
+VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer) { return VK_SUCCESS; }
+
+VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer, float) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer, float, float, float) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer, const float[4]) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer, float, float) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(VkCommandBuffer, VkStencilFaceFlags, uint32_t) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer, uint32_t, uint32_t, const VkViewport *) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer, uint32_t, uint32_t, const VkRect2D *) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(VkDevice, const VkEventCreateInfo *, const VkAllocationCallbacks *,
+                                           VkEvent *pEvent) {
+    return NewHandle(pEvent);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice, VkEvent, const VkAllocationCallbacks *) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer, VkEvent, VkPipelineStageFlags) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice, const VkMemoryAllocateInfo *, const VkAllocationCallbacks *,
+                                              VkDeviceMemory *pMemory) {
+    return NewHandle(pMemory);
+}
+
+VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice, VkDeviceMemory, const VkAllocationCallbacks *) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice, const VkBufferCreateInfo *, const VkAllocationCallbacks *,
+                                            VkBuffer *pBuffer) {
+    return NewHandle(pBuffer);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice, VkBuffer, const VkAllocationCallbacks *) {}
+
+// Buffers aren't kept track of, so they all ask for the same memory whatever their size
+VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(VkDevice, VkBuffer, VkMemoryRequirements *pMemoryRequirements) {
+    pMemoryRequirements->size = 1024;
+    pMemoryRequirements->alignment = buffer_alignment;
+    pMemoryRequirements->memoryTypeBits = 1;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(VkDevice, VkBuffer, VkDeviceMemory, VkDeviceSize) { return VK_SUCCESS; }
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice, const VkShaderModuleCreateInfo *, const VkAllocationCallbacks *,
+                                                  VkShaderModule *pShaderModule) {
+    return NewHandle(pShaderModule);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(VkDevice, VkShaderModule, const VkAllocationCallbacks *) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(VkDevice, const VkDescriptorSetLayoutCreateInfo *,
+                                                         const VkAllocationCallbacks *, VkDescriptorSetLayout *pSetLayout) {
+    return NewHandle(pSetLayout);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(VkDevice, VkDescriptorSetLayout, const VkAllocationCallbacks *) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice, const VkPipelineLayoutCreateInfo *,
+                                                    const VkAllocationCallbacks *, VkPipelineLayout *pPipelineLayout) {
+    return NewHandle(pPipelineLayout);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice, VkPipelineLayout, const VkAllocationCallbacks *) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(VkDevice, const VkDescriptorPoolCreateInfo *,
+                                                    const VkAllocationCallbacks *, VkDescriptorPool *pDescriptorPool) {
+    return NewHandle(pDescriptorPool);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(VkDevice, VkDescriptorPool, const VkAllocationCallbacks *) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice, const VkDescriptorSetAllocateInfo *pAllocateInfo,
+                                                      VkDescriptorSet *pDescriptorSets) {
+    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++) {
+        NewHandle(&pDescriptorSets[i]);
+    }
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(VkDevice, VkDescriptorPool, uint32_t, const VkDescriptorSet *) {
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(VkDevice, uint32_t, const VkWriteDescriptorSet *, uint32_t,
+                                                const VkCopyDescriptorSet *) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice, const VkRenderPassCreateInfo *, const VkAllocationCallbacks *,
+                                                VkRenderPass *pRenderPass) {
+    return NewHandle(pRenderPass);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(VkDevice, VkRenderPass, const VkAllocationCallbacks *) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice, const VkFramebufferCreateInfo *, const VkAllocationCallbacks *,
+                                                 VkFramebuffer *pFramebuffer) {
+    return NewHandle(pFramebuffer);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(VkDevice, VkFramebuffer, const VkAllocationCallbacks *) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice, VkPipelineCache, uint32_t createInfoCount,
+                                                       const VkGraphicsPipelineCreateInfo *, const VkAllocationCallbacks *,
+                                                       VkPipeline *pPipelines) {
+    for (uint32_t i = 0; i < createInfoCount; i++) {
+        NewHandle(&pPipelines[i]);
+    }
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice, VkPipeline, const VkAllocationCallbacks *) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer, VkPipelineBindPoint, VkPipeline) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer, VkPipelineBindPoint, VkPipelineLayout, uint32_t, uint32_t,
+                                                 const VkDescriptorSet *, uint32_t, const uint32_t *) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer, const VkRenderPassBeginInfo *, VkSubpassContents) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer, uint32_t, uint32_t, uint32_t, uint32_t) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(VkCommandBuffer, VkBuffer, VkDeviceSize, VkDeviceSize, uint32_t) {}
+
+VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer, VkBuffer, VkBuffer, uint32_t, const VkBufferCopy *) {}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice, const char *pName);
+
+struct EntryPoint {
+    const char *name;
+    PFN_vkVoidFunction addr;
+};
+
+#define STUB_ENTRY_POINT(name) {"vk" #name, reinterpret_cast<PFN_vkVoidFunction>(name)}
+
+const EntryPoint instance_entry_points[] = {
+    STUB_ENTRY_POINT(CreateInstance),
+    STUB_ENTRY_POINT(DestroyInstance),
+    STUB_ENTRY_POINT(EnumerateInstanceExtensionProperties),
+    STUB_ENTRY_POINT(EnumeratePhysicalDevices),
+    STUB_ENTRY_POINT(GetPhysicalDeviceFeatures),
+    STUB_ENTRY_POINT(GetPhysicalDeviceFormatProperties),
+    STUB_ENTRY_POINT(GetPhysicalDeviceImageFormatProperties),
+    STUB_ENTRY_POINT(GetPhysicalDeviceProperties),
+    STUB_ENTRY_POINT(GetPhysicalDeviceQueueFamilyProperties),
+    STUB_ENTRY_POINT(GetPhysicalDeviceMemoryProperties),
+    STUB_ENTRY_POINT(GetPhysicalDeviceSparseImageFormatProperties),
+    STUB_ENTRY_POINT(EnumerateDeviceExtensionProperties),
+    STUB_ENTRY_POINT(CreateDevice),
+};
+
+const EntryPoint device_entry_points[] = {
+    STUB_ENTRY_POINT(GetDeviceProcAddr),
+    STUB_ENTRY_POINT(DestroyDevice),
+    STUB_ENTRY_POINT(GetDeviceQueue),
+    STUB_ENTRY_POINT(QueueSubmit),
+    STUB_ENTRY_POINT(QueueWaitIdle),
+    STUB_ENTRY_POINT(DeviceWaitIdle),
+    STUB_ENTRY_POINT(CreateCommandPool),
+    STUB_ENTRY_POINT(DestroyCommandPool),
+    STUB_ENTRY_POINT(AllocateCommandBuffers),
+    STUB_ENTRY_POINT(FreeCommandBuffers),
+    STUB_ENTRY_POINT(BeginCommandBuffer),
+    STUB_ENTRY_POINT(EndCommandBuffer),
+    STUB_ENTRY_POINT(CmdSetLineWidth),
+    STUB_ENTRY_POINT(CmdSetDepthBias),
+    STUB_ENTRY_POINT(CmdSetBlendConstants),
+    STUB_ENTRY_POINT(CmdSetDepthBounds),
+    STUB_ENTRY_POINT(CmdSetStencilReference),
+    STUB_ENTRY_POINT(CmdSetViewport),
+    STUB_ENTRY_POINT(CmdSetScissor),
+    STUB_ENTRY_POINT(CreateEvent),
+    STUB_ENTRY_POINT(DestroyEvent),
+    STUB_ENTRY_POINT(CmdSetEvent),
+    STUB_ENTRY_POINT(AllocateMemory),
+    STUB_ENTRY_POINT(FreeMemory),
+    STUB_ENTRY_POINT(CreateBuffer),
+    STUB_ENTRY_POINT(DestroyBuffer),
+    STUB_ENTRY_POINT(GetBufferMemoryRequirements),
+    STUB_ENTRY_POINT(BindBufferMemory),
+    STUB_ENTRY_POINT(CreateShaderModule),
+    STUB_ENTRY_POINT(DestroyShaderModule),
+    STUB_ENTRY_POINT(CreateDescriptorSetLayout),
+    STUB_ENTRY_POINT(DestroyDescriptorSetLayout),
+    STUB_ENTRY_POINT(CreatePipelineLayout),
+    STUB_ENTRY_POINT(DestroyPipelineLayout),
+    STUB_ENTRY_POINT(CreateDescriptorPool),
+    STUB_ENTRY_POINT(DestroyDescriptorPool),
+    STUB_ENTRY_POINT(AllocateDescriptorSets),
+    STUB_ENTRY_POINT(FreeDescriptorSets),
+    STUB_ENTRY_POINT(UpdateDescriptorSets),
+    STUB_ENTRY_POINT(CreateRenderPass),
+    STUB_ENTRY_POINT(DestroyRenderPass),
+    STUB_ENTRY_POINT(CreateFramebuffer),
+    STUB_ENTRY_POINT(DestroyFramebuffer),
+    STUB_ENTRY_POINT(CreateGraphicsPipelines),
+    STUB_ENTRY_POINT(DestroyPipeline),
+    STUB_ENTRY_POINT(CmdBindPipeline),
+    STUB_ENTRY_POINT(CmdBindDescriptorSets),
+    STUB_ENTRY_POINT(CmdBeginRenderPass),
+    STUB_ENTRY_POINT(CmdEndRenderPass),
+    STUB_ENTRY_POINT(CmdDraw),
+    STUB_ENTRY_POINT(CmdFillBuffer),
+    STUB_ENTRY_POINT(CmdCopyBuffer),
+};
+
+#undef STUB_ENTRY_POINT
+
+template <size_t N> PFN_vkVoidFunction FindEntryPoint(const EntryPoint (&entry_points)[N], const char *name) {
+    for (const EntryPoint &entry_point : entry_points) {
+        if (!strcmp(entry_point.name, name)) {
+            return entry_point.addr;
+        }
+    }
+    return nullptr;
+}
+
+PFN_vkVoidFunction FindDeviceEntryPoint(const char *name) {
+    if (!strncmp(name, synthetic_prefix, sizeof(synthetic_prefix) - 1)) {
+        return reinterpret_cast<PFN_vkVoidFunction>(SyntheticEntryPoint);
+    }
+    return FindEntryPoint(device_entry_points, name);
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice, const char *pName) {
+    return FindDeviceEntryPoint(pName);
+}
+
+} // namespace stub_icd
+
+STUB_ICD_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetInstanceProcAddr(VkInstance, const char *pName) {
+    PFN_vkVoidFunction addr = stub_icd::FindEntryPoint(stub_icd::instance_entry_points, pName);
+    return addr ? addr : stub_icd::FindDeviceEntryPoint(pName);
+}
+
+STUB_ICD_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vk_icdNegotiateLoaderICDInterfaceVersion(uint32_t *pSupportedVersion) {
+    if (*pSupportedVersion > CURRENT_LOADER_ICD_INTERFACE_VERSION) {
+        *pSupportedVersion = CURRENT_LOADER_ICD_INTERFACE_VERSION;
+    }
+    return VK_SUCCESS;
+}
+
+STUB_ICD_EXPORT uint32_t VKAPI_CALL stub_icdGetCallCount(const char *pName) {
+    if (!strcmp(pName, "vkCreateInstance")) {
+        return stub_icd::create_instance_calls;
+    }
+    if (!strcmp(pName, "vkEnumeratePhysicalDevices")) {
+        return stub_icd::enumerate_physical_devices_calls;
+    }
+    if (!strcmp(pName, "vkCreateDevice")) {
+        return stub_icd::create_device_calls;
+    }
+    return 0;
+}
+
+STUB_ICD_EXPORT void VKAPI_CALL stub_icdSetPhysicalDeviceCount(uint32_t count) {
+    stub_icd::physical_device_count = (count < stub_icd::max_physical_devices) ? count : stub_icd::max_physical_devices;
+}
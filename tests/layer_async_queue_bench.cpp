@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for handing records to a worker thread from several threads at once, comparing the async_record_queue
+// core_validation's async validation mode uses (layers/vk_layer_async_queue.h) with replaying each record on the
+// calling thread under one lock, as the synchronous mode does:
+//
+//     vk_layer_async_queue_bench [records] [max_threads] [capacity]
+//
+// For 1, 2, 4, ... up to max_threads threads, each thread pushes records records of 8 to 240 bytes through a queue with
+// a ring of capacity bytes, then flushes it.  It reports the average time per record for both ways as key/value lines,
+// and fails if any record is replayed out of its thread's order, torn, or not at all.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vk_layer_async_queue.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+const unsigned max_producers = 64;
+
+// What each thread's records must add up to, only ever touched by one replaying thread at a time
+struct replay_state {
+    uint32_t next_sequence[max_producers];
+    uint64_t replayed;
+    unsigned errors;
+};
+
+// A record is its producer, its sequence number, then the sequence number repeated to fill it out
+void replayRecord(void *context, const void *record, size_t size) {
+    replay_state *state = static_cast<replay_state *>(context);
+    const uint32_t *words = static_cast<const uint32_t *>(record);
+    bool intact = (size % sizeof(uint32_t) == 0) && words[0] < max_producers && words[1] == state->next_sequence[words[0]];
+    for (size_t i = 2; intact && i < size / sizeof(uint32_t); i++) {
+        intact = (words[i] == words[1]);
+    }
+    if (!intact) {
+        state->errors++;
+        return;
+    }
+    state->next_sequence[words[0]]++;
+    state->replayed++;
+}
+
+uint32_t recordWords(uint32_t producer, uint32_t sequence) { return 2 + (sequence * 7 + producer) % 59; }
+
+void writeRecord(uint32_t *out, uint32_t producer, uint32_t sequence, uint32_t words) {
+    out[0] = producer;
+    for (uint32_t w = 1; w < words; w++) {
+        out[w] = sequence;
+    }
+}
+
+class async_push {
+  public:
+    async_push(replay_state *state, size_t capacity) : queue_(replayRecord, state, capacity) {}
+    void push(uint32_t producer, uint32_t sequence) {
+        uint32_t words = recordWords(producer, sequence);
+        queue_.push(words * sizeof(uint32_t),
+                    [&](void *record) { writeRecord(static_cast<uint32_t *>(record), producer, sequence, words); });
+    }
+    void flush() { queue_.flush(); }
+
+  private:
+    async_record_queue queue_;
+};
+
+class locked_replay {
+  public:
+    explicit locked_replay(replay_state *state) : state_(state) {}
+    void push(uint32_t producer, uint32_t sequence) {
+        uint32_t record[64];
+        uint32_t words = recordWords(producer, sequence);
+        writeRecord(record, producer, sequence, words);
+        std::lock_guard<std::mutex> lock(lock_);
+        replayRecord(state_, record, words * sizeof(uint32_t));
+    }
+    void flush() {}
+
+  private:
+    replay_state *state_;
+    std::mutex lock_;
+};
+
+template <typename Queue> void pushMany(Queue *queue, uint32_t producer, unsigned records) {
+    for (unsigned i = 0; i < records; i++) {
+        queue->push(producer, i);
+    }
+    queue->flush();
+}
+
+template <typename Queue>
+double run(Queue *queue, const replay_state &state, unsigned records, unsigned thread_count, unsigned *errors) {
+    std::vector<std::thread> threads;
+    auto start = Clock::now();
+    for (unsigned t = 0; t < thread_count; t++) {
+        threads.push_back(std::thread(pushMany<Queue>, queue, t, records));
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    // Every thread flushed before it finished, so everything has been replayed by now
+    *errors += state.errors;
+    if (state.replayed != static_cast<uint64_t>(records) * thread_count) {
+        (*errors)++;
+    }
+    for (unsigned t = 0; t < thread_count; t++) {
+        if (state.next_sequence[t] != records) {
+            (*errors)++;
+        }
+    }
+    return records ? seconds * 1e9 / records : 0.0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned records = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 1000000;
+    unsigned max_threads = (argc > 2) ? static_cast<unsigned>(atoi(argv[2])) : 8;
+    size_t capacity = (argc > 3) ? static_cast<size_t>(atoi(argv[3])) : 1024 * 1024;
+    if (max_threads < 1) {
+        max_threads = 1;
+    }
+    if (max_threads > max_producers) {
+        max_threads = max_producers;
+    }
+
+    unsigned errors = 0;
+    printf("records %u\n", records);
+    printf("capacity %zu\n", capacity);
+    for (unsigned thread_count = 1; thread_count <= max_threads;
+         thread_count = (thread_count < max_threads && thread_count * 2 > max_threads) ? max_threads : thread_count * 2) {
+        {
+            replay_state state = {};
+            async_push queue(&state, capacity);
+            printf("threads_%u_async_record_queue_ns_per_record %.1f\n", thread_count,
+                   run(&queue, state, records, thread_count, &errors));
+        }
+        {
+            replay_state state = {};
+            locked_replay queue(&state);
+            printf("threads_%u_locked_replay_ns_per_record %.1f\n", thread_count,
+                   run(&queue, state, records, thread_count, &errors));
+        }
+    }
+
+    printf("errors %u\n", errors);
+
+    return errors ? 1 : 0;
+}
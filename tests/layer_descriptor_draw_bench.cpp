@@ -0,0 +1,463 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for what core_validation checks at every draw with many descriptors bound, run against the stub ICD in
+// icd/ so it needs no GPU:
+//
+//     VK_ICD_FILENAMES=icd/VkICD_stub.json VK_LAYER_PATH=../layers vk_layer_descriptor_draw_bench [draws] [sets] [bindings]
+//
+// It binds a pipeline whose fragment shader uses every one of bindings uniform buffers in each of sets descriptor
+// sets, then records draws draws with neither the pipeline nor the sets changing in between, and reports the average
+// time per draw as key/value lines.  It fails if core_validation reports any error or warning.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+namespace {
+
+unsigned reported_messages = 0;
+
+// Only counts what layers report, the loader complains about the stub ICD having no device extensions
+VKAPI_ATTR VkBool32 VKAPI_CALL countMessage(VkDebugReportFlagsEXT, VkDebugReportObjectTypeEXT, uint64_t, size_t, int32_t,
+                                            const char *pLayerPrefix, const char *pMessage, void *) {
+    if (!strcmp(pLayerPrefix, "loader")) {
+        return VK_FALSE;
+    }
+    fprintf(stderr, "%s: %s\n", pLayerPrefix, pMessage);
+    reported_messages++;
+    return VK_FALSE;
+}
+
+enum {
+    OpMemoryModel = 14,
+    OpEntryPoint = 15,
+    OpExecutionMode = 16,
+    OpCapability = 17,
+    OpTypeVoid = 19,
+    OpTypeInt = 21,
+    OpTypeFloat = 22,
+    OpTypeVector = 23,
+    OpTypeStruct = 30,
+    OpTypePointer = 32,
+    OpTypeFunction = 33,
+    OpConstant = 43,
+    OpFunction = 54,
+    OpFunctionEnd = 56,
+    OpVariable = 59,
+    OpLoad = 61,
+    OpAccessChain = 65,
+    OpDecorate = 71,
+    OpMemberDecorate = 72,
+    OpLabel = 248,
+    OpReturn = 253,
+};
+
+// Just enough of a SPIR-V assembler for the shaders below, there being no shader compiler to build them with
+class spirv_module {
+  public:
+    spirv_module() : words_({0x07230203, 0x00010000, 0, 0, 0}) {}
+
+    uint32_t id() { return next_id_++; }
+
+    void op(uint32_t opcode, std::vector<uint32_t> const &operands) {
+        words_.push_back(static_cast<uint32_t>(operands.size() + 1) << 16 | opcode);
+        words_.insert(words_.end(), operands.begin(), operands.end());
+    }
+
+    // OpEntryPoint with no interface, the shaders here have no inputs or outputs
+    void entry_point(uint32_t execution_model, uint32_t function) {
+        // "main" and its terminator in two words
+        op(OpEntryPoint, {execution_model, function, 0x6e69616d, 0});
+    }
+
+    std::vector<uint32_t> const &code() {
+        words_[3] = next_id_;
+        return words_;
+    }
+
+  private:
+    std::vector<uint32_t> words_;
+    uint32_t next_id_ = 1;
+};
+
+const uint32_t CapabilityShader = 1;
+const uint32_t AddressingModelLogical = 0;
+const uint32_t MemoryModelGLSL450 = 1;
+const uint32_t ExecutionModelVertex = 0;
+const uint32_t ExecutionModelFragment = 4;
+const uint32_t ExecutionModeOriginUpperLeft = 7;
+const uint32_t DecorationBlock = 2;
+const uint32_t DecorationOffset = 35;
+const uint32_t DecorationBinding = 33;
+const uint32_t DecorationDescriptorSet = 34;
+const uint32_t StorageClassUniform = 2;
+
+// A vertex shader that does nothing
+std::vector<uint32_t> vertexShader() {
+    spirv_module module;
+    uint32_t void_type = module.id(), function_type = module.id(), main = module.id(), label = module.id();
+    module.op(OpCapability, {CapabilityShader});
+    module.op(OpMemoryModel, {AddressingModelLogical, MemoryModelGLSL450});
+    module.entry_point(ExecutionModelVertex, main);
+    module.op(OpTypeVoid, {void_type});
+    module.op(OpTypeFunction, {function_type, void_type});
+    module.op(OpFunction, {void_type, main, 0, function_type});
+    module.op(OpLabel, {label});
+    module.op(OpReturn, {});
+    module.op(OpFunctionEnd, {});
+    return module.code();
+}
+
+// A fragment shader that reads a vec4 from the uniform buffer at every binding of every set
+std::vector<uint32_t> fragmentShader(uint32_t set_count, uint32_t binding_count) {
+    spirv_module module;
+    uint32_t void_type = module.id(), function_type = module.id(), float_type = module.id(), vec4_type = module.id(),
+             int_type = module.id(), zero = module.id(), block_type = module.id(), block_pointer = module.id(),
+             vec4_pointer = module.id(), main = module.id(), label = module.id();
+    std::vector<uint32_t> blocks(set_count * binding_count);
+    for (uint32_t &block : blocks) {
+        block = module.id();
+    }
+
+    module.op(OpCapability, {CapabilityShader});
+    module.op(OpMemoryModel, {AddressingModelLogical, MemoryModelGLSL450});
+    module.entry_point(ExecutionModelFragment, main);
+    module.op(OpExecutionMode, {main, ExecutionModeOriginUpperLeft});
+    module.op(OpDecorate, {block_type, DecorationBlock});
+    module.op(OpMemberDecorate, {block_type, 0, DecorationOffset, 0});
+    for (uint32_t i = 0; i < blocks.size(); i++) {
+        module.op(OpDecorate, {blocks[i], DecorationDescriptorSet, i / binding_count});
+        module.op(OpDecorate, {blocks[i], DecorationBinding, i % binding_count});
+    }
+    module.op(OpTypeVoid, {void_type});
+    module.op(OpTypeFunction, {function_type, void_type});
+    module.op(OpTypeFloat, {float_type, 32});
+    module.op(OpTypeVector, {vec4_type, float_type, 4});
+    module.op(OpTypeInt, {int_type, 32, 1});
+    module.op(OpConstant, {int_type, zero, 0});
+    module.op(OpTypeStruct, {block_type, vec4_type});
+    module.op(OpTypePointer, {block_pointer, StorageClassUniform, block_type});
+    module.op(OpTypePointer, {vec4_pointer, StorageClassUniform, vec4_type});
+    for (uint32_t block : blocks) {
+        module.op(OpVariable, {block_pointer, block, StorageClassUniform});
+    }
+    module.op(OpFunction, {void_type, main, 0, function_type});
+    module.op(OpLabel, {label});
+    for (uint32_t block : blocks) {
+        uint32_t member = module.id();
+        module.op(OpAccessChain, {vec4_pointer, member, block, zero});
+        module.op(OpLoad, {vec4_type, module.id(), member});
+    }
+    module.op(OpReturn, {});
+    module.op(OpFunctionEnd, {});
+    return module.code();
+}
+
+VkShaderModule createShaderModule(VkDevice device, std::vector<uint32_t> const &code) {
+    VkShaderModuleCreateInfo module_info = {};
+    module_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    module_info.codeSize = code.size() * sizeof(uint32_t);
+    module_info.pCode = code.data();
+    VkShaderModule module = VK_NULL_HANDLE;
+    vkCreateShaderModule(device, &module_info, nullptr, &module);
+    return module;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned draw_count = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 100000;
+    uint32_t set_count = (argc > 2) ? static_cast<uint32_t>(atoi(argv[2])) : 8;
+    uint32_t binding_count = (argc > 3) ? static_cast<uint32_t>(atoi(argv[3])) : 32;
+    const VkDeviceSize stride = 256;
+
+    const char *layers[] = {"VK_LAYER_LUNARG_core_validation"};
+    const char *extensions[] = {VK_EXT_DEBUG_REPORT_EXTENSION_NAME};
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_info.enabledLayerCount = 1;
+    instance_info.ppEnabledLayerNames = layers;
+    instance_info.enabledExtensionCount = 1;
+    instance_info.ppEnabledExtensionNames = extensions;
+    VkInstance instance;
+    if (vkCreateInstance(&instance_info, nullptr, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateInstance failed, is VK_ICD_FILENAMES set to the stub ICD and VK_LAYER_PATH to the "
+                        "layers?\n");
+        return 1;
+    }
+
+    VkDebugReportCallbackCreateInfoEXT callback_info = {};
+    callback_info.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
+    callback_info.flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT;
+    callback_info.pfnCallback = countMessage;
+    PFN_vkCreateDebugReportCallbackEXT create_callback = reinterpret_cast<PFN_vkCreateDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkCreateDebugReportCallbackEXT"));
+    PFN_vkDestroyDebugReportCallbackEXT destroy_callback = reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkDestroyDebugReportCallbackEXT"));
+    VkDebugReportCallbackEXT callback = VK_NULL_HANDLE;
+    if (!create_callback || create_callback(instance, &callback_info, nullptr, &callback) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDebugReportCallbackEXT failed\n");
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    // Going by the book, core_validation warns otherwise
+    uint32_t gpu_count = 0;
+    vkEnumeratePhysicalDevices(instance, &gpu_count, nullptr);
+    gpu_count = 1;
+    VkPhysicalDevice gpu;
+    VkResult result = vkEnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || gpu_count < 1) {
+        fprintf(stderr, "vkEnumeratePhysicalDevices found no physical device\n");
+        destroy_callback(instance, callback, nullptr);
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    uint32_t queue_family_count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu, &queue_family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu, &queue_family_count, queue_families.data());
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_info = {};
+    device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    VkDevice device;
+    if (vkCreateDevice(gpu, &device_info, nullptr, &device) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDevice failed\n");
+        destroy_callback(instance, callback, nullptr);
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    std::vector<VkDescriptorSetLayoutBinding> bindings(binding_count);
+    for (uint32_t b = 0; b < binding_count; b++) {
+        bindings[b] = {};
+        bindings[b].binding = b;
+        bindings[b].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        bindings[b].descriptorCount = 1;
+        bindings[b].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    }
+    VkDescriptorSetLayoutCreateInfo set_layout_info = {};
+    set_layout_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    set_layout_info.bindingCount = binding_count;
+    set_layout_info.pBindings = bindings.data();
+    VkDescriptorSetLayout set_layout;
+    vkCreateDescriptorSetLayout(device, &set_layout_info, nullptr, &set_layout);
+    std::vector<VkDescriptorSetLayout> set_layouts(set_count, set_layout);
+
+    VkDescriptorPoolSize pool_size = {};
+    pool_size.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    pool_size.descriptorCount = set_count * binding_count;
+    VkDescriptorPoolCreateInfo pool_info = {};
+    pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    pool_info.maxSets = set_count;
+    pool_info.poolSizeCount = 1;
+    pool_info.pPoolSizes = &pool_size;
+    VkDescriptorPool descriptor_pool;
+    vkCreateDescriptorPool(device, &pool_info, nullptr, &descriptor_pool);
+    std::vector<VkDescriptorSet> sets(set_count);
+    VkDescriptorSetAllocateInfo set_info = {};
+    set_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    set_info.descriptorPool = descriptor_pool;
+    set_info.descriptorSetCount = set_count;
+    set_info.pSetLayouts = set_layouts.data();
+    vkAllocateDescriptorSets(device, &set_info, sets.data());
+
+    VkPipelineLayoutCreateInfo pipeline_layout_info = {};
+    pipeline_layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipeline_layout_info.setLayoutCount = set_count;
+    pipeline_layout_info.pSetLayouts = set_layouts.data();
+    VkPipelineLayout pipeline_layout;
+    vkCreatePipelineLayout(device, &pipeline_layout_info, nullptr, &pipeline_layout);
+
+    // One buffer backs every descriptor, each at its own aligned offset
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = stride * set_count * binding_count;
+    buffer_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    VkBuffer buffer;
+    vkCreateBuffer(device, &buffer_info, nullptr, &buffer);
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device, buffer, &requirements);
+    VkMemoryAllocateInfo memory_info = {};
+    memory_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memory_info.allocationSize = (requirements.size > buffer_info.size) ? requirements.size : buffer_info.size;
+    for (memory_info.memoryTypeIndex = 0; !(requirements.memoryTypeBits & (1u << memory_info.memoryTypeIndex));
+         memory_info.memoryTypeIndex++) {
+    }
+    VkDeviceMemory memory;
+    vkAllocateMemory(device, &memory_info, nullptr, &memory);
+    vkBindBufferMemory(device, buffer, memory, 0);
+
+    std::vector<VkDescriptorBufferInfo> descriptors(set_count * binding_count);
+    std::vector<VkWriteDescriptorSet> writes(set_count * binding_count);
+    for (uint32_t i = 0; i < set_count * binding_count; i++) {
+        descriptors[i].buffer = buffer;
+        descriptors[i].offset = stride * i;
+        descriptors[i].range = 16;
+        writes[i] = {};
+        writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[i].dstSet = sets[i / binding_count];
+        writes[i].dstBinding = i % binding_count;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writes[i].pBufferInfo = &descriptors[i];
+    }
+    vkUpdateDescriptorSets(device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+
+    // Drawing needs a render pass, which needs no attachments when nothing is written
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    VkRenderPassCreateInfo render_pass_info = {};
+    render_pass_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    render_pass_info.subpassCount = 1;
+    render_pass_info.pSubpasses = &subpass;
+    VkRenderPass render_pass;
+    vkCreateRenderPass(device, &render_pass_info, nullptr, &render_pass);
+    VkFramebufferCreateInfo framebuffer_info = {};
+    framebuffer_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebuffer_info.renderPass = render_pass;
+    framebuffer_info.width = 64;
+    framebuffer_info.height = 64;
+    framebuffer_info.layers = 1;
+    VkFramebuffer framebuffer;
+    vkCreateFramebuffer(device, &framebuffer_info, nullptr, &framebuffer);
+
+    VkShaderModule vertex_module = createShaderModule(device, vertexShader());
+    VkShaderModule fragment_module = createShaderModule(device, fragmentShader(set_count, binding_count));
+    VkPipelineShaderStageCreateInfo stages[2] = {};
+    stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stages[0].module = vertex_module;
+    stages[0].pName = "main";
+    stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stages[1].module = fragment_module;
+    stages[1].pName = "main";
+    VkPipelineVertexInputStateCreateInfo vertex_input = {};
+    vertex_input.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    VkPipelineInputAssemblyStateCreateInfo input_assembly = {};
+    input_assembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    VkViewport viewport = {0.0f, 0.0f, 64.0f, 64.0f, 0.0f, 1.0f};
+    VkRect2D scissor = {{0, 0}, {64, 64}};
+    VkPipelineViewportStateCreateInfo viewport_state = {};
+    viewport_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport_state.viewportCount = 1;
+    viewport_state.pViewports = &viewport;
+    viewport_state.scissorCount = 1;
+    viewport_state.pScissors = &scissor;
+    VkPipelineRasterizationStateCreateInfo rasterization = {};
+    rasterization.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterization.cullMode = VK_CULL_MODE_NONE;
+    rasterization.frontFace = VK_FRONT_FACE_CLOCKWISE;
+    rasterization.lineWidth = 1.0f;
+    VkPipelineMultisampleStateCreateInfo multisample = {};
+    multisample.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    VkPipelineColorBlendStateCreateInfo color_blend = {};
+    color_blend.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    VkGraphicsPipelineCreateInfo pipeline_info = {};
+    pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipeline_info.stageCount = 2;
+    pipeline_info.pStages = stages;
+    pipeline_info.pVertexInputState = &vertex_input;
+    pipeline_info.pInputAssemblyState = &input_assembly;
+    pipeline_info.pViewportState = &viewport_state;
+    pipeline_info.pRasterizationState = &rasterization;
+    pipeline_info.pMultisampleState = &multisample;
+    pipeline_info.pColorBlendState = &color_blend;
+    pipeline_info.layout = pipeline_layout;
+    pipeline_info.renderPass = render_pass;
+    VkPipeline pipeline;
+    vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &pipeline);
+
+    VkCommandPool command_pool;
+    VkCommandPoolCreateInfo command_pool_info = {};
+    command_pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    vkCreateCommandPool(device, &command_pool_info, nullptr, &command_pool);
+    VkCommandBuffer command_buffer;
+    VkCommandBufferAllocateInfo allocate_info = {};
+    allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocate_info.commandPool = command_pool;
+    allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocate_info.commandBufferCount = 1;
+    vkAllocateCommandBuffers(device, &allocate_info, &command_buffer);
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    vkBeginCommandBuffer(command_buffer, &begin_info);
+    VkRenderPassBeginInfo render_pass_begin = {};
+    render_pass_begin.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    render_pass_begin.renderPass = render_pass;
+    render_pass_begin.framebuffer = framebuffer;
+    render_pass_begin.renderArea = scissor;
+    vkCmdBeginRenderPass(command_buffer, &render_pass_begin, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0, set_count, sets.data(), 0,
+                            nullptr);
+    unsigned setup_messages = reported_messages;
+
+    auto start = Clock::now();
+    for (unsigned i = 0; i < draw_count; i++) {
+        vkCmdDraw(command_buffer, 3, 1, 0, 0);
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    vkCmdEndRenderPass(command_buffer);
+    vkEndCommandBuffer(command_buffer);
+
+    printf("draws %u\n", draw_count);
+    printf("sets %u\n", set_count);
+    printf("bindings_per_set %u\n", binding_count);
+    printf("ns_per_draw %.1f\n", draw_count ? seconds * 1e9 / draw_count : 0.0);
+
+    vkFreeCommandBuffers(device, command_pool, 1, &command_buffer);
+    vkDestroyCommandPool(device, command_pool, nullptr);
+    vkDestroyPipeline(device, pipeline, nullptr);
+    vkDestroyShaderModule(device, fragment_module, nullptr);
+    vkDestroyShaderModule(device, vertex_module, nullptr);
+    vkDestroyFramebuffer(device, framebuffer, nullptr);
+    vkDestroyRenderPass(device, render_pass, nullptr);
+    vkDestroyPipelineLayout(device, pipeline_layout, nullptr);
+    vkDestroyDescriptorPool(device, descriptor_pool, nullptr);
+    vkDestroyDescriptorSetLayout(device, set_layout, nullptr);
+    vkDestroyBuffer(device, buffer, nullptr);
+    vkFreeMemory(device, memory, nullptr);
+    vkDestroyDevice(device, nullptr);
+    destroy_callback(instance, callback, nullptr);
+    vkDestroyInstance(instance, nullptr);
+
+    printf("setup_messages %u\n", setup_messages);
+    printf("draw_messages %u\n", reported_messages - setup_messages);
+    return reported_messages ? 1 : 0;
+}
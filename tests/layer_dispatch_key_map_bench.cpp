@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for the lookup every layer entry point starts with, from dispatch key to layer_data, comparing the
+// dispatch_key_map the validation layers use (layers/vk_layer_dispatch_key_map.h) with the unordered_map they used before:
+//
+//     vk_layer_dispatch_key_map_bench [iterations] [max_threads] [devices]
+//
+// devices dispatch keys are added up front.  Then for 1, 2, 4, ... up to max_threads threads, each thread looks up
+// iterations keys, first always its own device's key, as a thread recording into one device does, then cycling through
+// all of them.  It reports the average time per lookup for both maps as key/value lines.  Each thread of the
+// dispatch_key_map runs also adds and erases a key of its own every 1024 lookups, which the unordered_map could not
+// survive; the test fails if any lookup gives back the wrong entry or an erased key is still found.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "vk_layer_dispatch_key_map.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct layer_data {
+    void *key;
+};
+
+// Stands in for a dispatch key, the address of the loader's dispatch table for the object
+void *dispatch_key(size_t index) { return reinterpret_cast<void *>(0x10000 + index * 64); }
+
+class unordered_lookup {
+  public:
+    explicit unordered_lookup(std::unordered_map<void *, layer_data *> *map) : map_(map) {}
+    layer_data *get(void *key) const {
+        auto it = map_->find(key);
+        return it == map_->end() ? nullptr : it->second;
+    }
+    void churn(void *) {}
+
+  private:
+    std::unordered_map<void *, layer_data *> *map_;
+};
+
+class dispatch_key_lookup {
+  public:
+    explicit dispatch_key_lookup(dispatch_key_map<layer_data> *map) : map_(map) {}
+    layer_data *get(void *key) const { return map_->get(key); }
+    // Create and destroy a device of this thread's own while the others keep looking theirs up
+    void churn(void *key) {
+        layer_data *data = map_->get_or_create(key);
+        data->key = key;
+        if (map_->get(key) != data) {
+            errors_++;
+        }
+        map_->erase(key);
+        delete data;
+        if (map_->get(key)) {
+            errors_++;
+        }
+    }
+    unsigned errors() const { return errors_.load(); }
+
+  private:
+    dispatch_key_map<layer_data> *map_;
+    std::atomic<unsigned> errors_{0};
+};
+
+template <typename Lookup>
+void lookupMany(Lookup *lookup, unsigned iterations, size_t devices, size_t own, bool cycle, unsigned thread,
+                std::atomic<unsigned> *errors) {
+    size_t index = own;
+    for (unsigned i = 0; i < iterations; i++) {
+        layer_data *data = lookup->get(dispatch_key(index));
+        if (!data || data->key != dispatch_key(index)) {
+            (*errors)++;
+        }
+        if (cycle && ++index == devices) {
+            index = 0;
+        }
+        if ((i & 1023) == 1023) {
+            lookup->churn(dispatch_key(devices + thread));
+        }
+    }
+}
+
+template <typename Lookup>
+double run(Lookup *lookup, unsigned iterations, size_t devices, unsigned thread_count, bool cycle,
+           std::atomic<unsigned> *errors) {
+    std::vector<std::thread> threads;
+    auto start = Clock::now();
+    for (unsigned t = 0; t < thread_count; t++) {
+        threads.push_back(std::thread(lookupMany<Lookup>, lookup, iterations, devices, t % devices, cycle, t, errors));
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return iterations ? seconds * 1e9 / iterations : 0.0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned iterations = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 10000000;
+    unsigned max_threads = (argc > 2) ? static_cast<unsigned>(atoi(argv[2])) : 8;
+    size_t devices = (argc > 3) ? static_cast<size_t>(atoi(argv[3])) : 4;
+    if (max_threads < 1) {
+        max_threads = 1;
+    }
+    if (devices < 1) {
+        devices = 1;
+    }
+
+    std::unordered_map<void *, layer_data *> map;
+    dispatch_key_map<layer_data> key_map;
+    std::vector<layer_data> data(devices);
+    for (size_t i = 0; i < devices; i++) {
+        data[i].key = dispatch_key(i);
+        map[dispatch_key(i)] = &data[i];
+        key_map.get_or_create(dispatch_key(i))->key = dispatch_key(i);
+    }
+
+    unordered_lookup unordered(&map);
+    dispatch_key_lookup keyed(&key_map);
+    std::atomic<unsigned> errors(0);
+    printf("iterations %u\n", iterations);
+    printf("devices %zu\n", devices);
+    for (unsigned thread_count = 1; thread_count <= max_threads;
+         thread_count = (thread_count < max_threads && thread_count * 2 > max_threads) ? max_threads : thread_count * 2) {
+        printf("threads_%u_one_device_dispatch_key_map_ns_per_lookup %.2f\n", thread_count,
+               run(&keyed, iterations, devices, thread_count, false, &errors));
+        printf("threads_%u_one_device_unordered_map_ns_per_lookup %.2f\n", thread_count,
+               run(&unordered, iterations, devices, thread_count, false, &errors));
+        printf("threads_%u_all_devices_dispatch_key_map_ns_per_lookup %.2f\n", thread_count,
+               run(&keyed, iterations, devices, thread_count, true, &errors));
+        printf("threads_%u_all_devices_unordered_map_ns_per_lookup %.2f\n", thread_count,
+               run(&unordered, iterations, devices, thread_count, true, &errors));
+    }
+
+    // A key erased and added again gets its new entry, not the one this thread last saw
+    layer_data *old_entry = key_map.get(dispatch_key(0));
+    key_map.erase(dispatch_key(0));
+    if (key_map.get(dispatch_key(0))) {
+        errors++;
+    }
+    bool created = false;
+    layer_data *new_entry = key_map.get_or_create(dispatch_key(0), &created);
+    if (!created || key_map.get(dispatch_key(0)) != new_entry || key_map.get_or_create(dispatch_key(0), &created) != new_entry ||
+        created) {
+        errors++;
+    }
+    delete old_entry;
+    for (size_t i = 0; i < devices; i++) {
+        delete key_map.get(dispatch_key(i));
+        key_map.erase(dispatch_key(i));
+    }
+
+    errors += keyed.errors();
+    printf("errors %u\n", errors.load());
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for unwrapping handles from several threads at once, comparing the handle_table unique_objects uses
+// (layers/vk_layer_handle_table.h) with the mutex-guarded unordered_map it replaced:
+//
+//     vk_layer_handle_table_bench [iterations] [max_threads] [handles]
+//
+// handles handles are wrapped up front.  Then for 1, 2, 4, ... up to max_threads threads, each thread unwraps
+// iterations handles while one more thread keeps wrapping and erasing handles of its own, as an application creating
+// and destroying objects while others record would.  It reports the average time per unwrap for both tables as
+// key/value lines, and fails if any unwrap gives back the wrong handle or an erased handle unwraps to anything but 0.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "vk_layer_handle_table.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// What unique_objects did before, one global counter and map behind one lock
+class locked_map {
+  public:
+    locked_map() : next_id_(1) {}
+    uint64_t wrap(uint64_t handle) {
+        std::lock_guard<std::mutex> lock(lock_);
+        uint64_t unique_id = next_id_++;
+        map_[unique_id] = handle;
+        return unique_id;
+    }
+    uint64_t unwrap(uint64_t wrapped) {
+        std::lock_guard<std::mutex> lock(lock_);
+        return map_[wrapped];
+    }
+    uint64_t erase(uint64_t wrapped) {
+        std::lock_guard<std::mutex> lock(lock_);
+        uint64_t handle = map_[wrapped];
+        map_.erase(wrapped);
+        return handle;
+    }
+
+  private:
+    std::mutex lock_;
+    uint64_t next_id_;
+    std::unordered_map<uint64_t, uint64_t> map_;
+};
+
+// Driver handles are made up from the index so that every unwrap can be checked
+uint64_t driver_handle(size_t index) { return 0x1000 + index * 16; }
+
+template <typename Table>
+void unwrapMany(Table *table, const std::vector<uint64_t> *wrapped, unsigned iterations, unsigned seed,
+                std::atomic<unsigned> *errors) {
+    size_t count = wrapped->size();
+    size_t index = seed % count;
+    for (unsigned i = 0; i < iterations; i++) {
+        if (table->unwrap((*wrapped)[index]) != driver_handle(index)) {
+            (*errors)++;
+        }
+        // Step through the handles in an order that defeats the cache, as recording many draws would
+        index += 7919;
+        if (index >= count) {
+            index %= count;
+        }
+    }
+}
+
+template <typename Table> void churn(Table *table, const std::atomic<bool> *stop, std::atomic<unsigned> *errors) {
+    uint64_t handle = 0x10000000;
+    while (!stop->load()) {
+        uint64_t wrapped = table->wrap(handle);
+        if (table->unwrap(wrapped) != handle || table->erase(wrapped) != handle || table->unwrap(wrapped) != 0) {
+            (*errors)++;
+        }
+        handle += 16;
+    }
+}
+
+template <typename Table>
+double run(Table *table, const std::vector<uint64_t> &wrapped, unsigned iterations, unsigned thread_count,
+           std::atomic<unsigned> *errors) {
+    std::atomic<bool> stop(false);
+    std::thread churner(churn<Table>, table, &stop, errors);
+    std::vector<std::thread> threads;
+    auto start = Clock::now();
+    for (unsigned t = 0; t < thread_count; t++) {
+        threads.push_back(std::thread(unwrapMany<Table>, table, &wrapped, iterations, t * 104729u, errors));
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    stop.store(true);
+    churner.join();
+    return iterations ? seconds * 1e9 / iterations : 0.0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned iterations = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 1000000;
+    unsigned max_threads = (argc > 2) ? static_cast<unsigned>(atoi(argv[2])) : 8;
+    size_t handles = (argc > 3) ? static_cast<size_t>(atoi(argv[3])) : 100000;
+    if (max_threads < 1) {
+        max_threads = 1;
+    }
+    if (handles < 1) {
+        handles = 1;
+    }
+
+    handle_table table;
+    locked_map map;
+    std::vector<uint64_t> table_wrapped(handles), map_wrapped(handles);
+    for (size_t i = 0; i < handles; i++) {
+        table_wrapped[i] = table.wrap(driver_handle(i));
+        map_wrapped[i] = map.wrap(driver_handle(i));
+    }
+
+    std::atomic<unsigned> errors(0);
+    printf("iterations %u\n", iterations);
+    printf("handles %zu\n", handles);
+    for (unsigned thread_count = 1; thread_count <= max_threads;
+         thread_count = (thread_count < max_threads && thread_count * 2 > max_threads) ? max_threads : thread_count * 2) {
+        printf("threads_%u_handle_table_ns_per_unwrap %.1f\n", thread_count,
+               run(&table, table_wrapped, iterations, thread_count, &errors));
+        printf("threads_%u_locked_map_ns_per_unwrap %.1f\n", thread_count,
+               run(&map, map_wrapped, iterations, thread_count, &errors));
+    }
+
+    // Erased handles unwrap to 0, and reusing their slots does not bring them back
+    for (size_t i = 0; i < handles; i += 2) {
+        if (table.erase(table_wrapped[i]) != driver_handle(i)) {
+            errors++;
+        }
+    }
+    for (size_t i = 0; i < handles; i += 2) {
+        table.wrap(driver_handle(i) + 8);
+    }
+    for (size_t i = 0; i < handles; i++) {
+        if (table.unwrap(table_wrapped[i]) != ((i % 2) ? driver_handle(i) : 0)) {
+            errors++;
+        }
+    }
+    if (table.unwrap(0) != 0 || table.erase(0) != 0) {
+        errors++;
+    }
+
+    printf("errors %u\n", errors.load());
+
+    return errors ? 1 : 0;
+}
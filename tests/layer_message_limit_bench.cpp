@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for what a validation message repeated on every call costs, run through parameter_validation against the
+// stub ICD in icd/ so it needs no GPU:
+//
+//     VK_ICD_FILENAMES=icd/VkICD_stub.json VK_LAYER_PATH=../layers vk_layer_message_limit_bench [iterations] [limit]
+//
+// It records iterations vkCmdSetBlendConstants calls with valid arguments, then iterations more with blendConstants
+// NULL, each of which parameter_validation reports as an error, and reports the average time per call of both as
+// key/value lines.  Run it where a vk_layer_settings.txt sets lunarg_parameter_validation.message_limit to limit, and
+// it checks that only limit errors were reported and that vkDestroyDevice summarized the rest in one message.  Without
+// limit it checks that every error was reported.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "vulkan/vulkan.h"
+
+namespace {
+
+unsigned reported_messages = 0;
+unsigned summary_messages = 0;
+
+// Only counts what layers report, the loader complains about the stub ICD having no device extensions
+VKAPI_ATTR VkBool32 VKAPI_CALL countMessage(VkDebugReportFlagsEXT, VkDebugReportObjectTypeEXT, uint64_t, size_t, int32_t,
+                                            const char *pLayerPrefix, const char *pMessage, void *) {
+    if (!strcmp(pLayerPrefix, "loader")) {
+        return VK_FALSE;
+    }
+    if (!strncmp(pMessage, "Suppressed ", strlen("Suppressed "))) {
+        summary_messages++;
+    } else {
+        reported_messages++;
+    }
+    return VK_FALSE;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+double timeCalls(VkCommandBuffer command_buffer, const float *blend_constants, unsigned iterations) {
+    auto start = Clock::now();
+    for (unsigned i = 0; i < iterations; i++) {
+        vkCmdSetBlendConstants(command_buffer, blend_constants);
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return iterations ? seconds * 1e9 / iterations : 0.0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned iterations = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 1000000;
+    bool limited = argc > 2;
+    unsigned limit = limited ? static_cast<unsigned>(atoi(argv[2])) : 0;
+
+    const char *layers[] = {"VK_LAYER_LUNARG_parameter_validation"};
+    const char *extensions[] = {VK_EXT_DEBUG_REPORT_EXTENSION_NAME};
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_info.enabledLayerCount = 1;
+    instance_info.ppEnabledLayerNames = layers;
+    instance_info.enabledExtensionCount = 1;
+    instance_info.ppEnabledExtensionNames = extensions;
+    VkInstance instance;
+    if (vkCreateInstance(&instance_info, nullptr, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateInstance failed, is VK_ICD_FILENAMES set to the stub ICD and VK_LAYER_PATH to the "
+                        "layers?\n");
+        return 1;
+    }
+
+    VkDebugReportCallbackCreateInfoEXT callback_info = {};
+    callback_info.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
+    callback_info.flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT;
+    callback_info.pfnCallback = countMessage;
+    PFN_vkCreateDebugReportCallbackEXT create_callback = reinterpret_cast<PFN_vkCreateDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkCreateDebugReportCallbackEXT"));
+    PFN_vkDestroyDebugReportCallbackEXT destroy_callback = reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkDestroyDebugReportCallbackEXT"));
+    VkDebugReportCallbackEXT callback = VK_NULL_HANDLE;
+    if (!create_callback || create_callback(instance, &callback_info, nullptr, &callback) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDebugReportCallbackEXT failed\n");
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    uint32_t gpu_count = 1;
+    VkPhysicalDevice gpu;
+    VkResult result = vkEnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || gpu_count < 1) {
+        fprintf(stderr, "vkEnumeratePhysicalDevices found no physical device\n");
+        destroy_callback(instance, callback, nullptr);
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_info = {};
+    device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    VkDevice device;
+    if (vkCreateDevice(gpu, &device_info, nullptr, &device) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDevice failed\n");
+        destroy_callback(instance, callback, nullptr);
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    VkCommandPool pool;
+    VkCommandPoolCreateInfo pool_info = {};
+    pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    vkCreateCommandPool(device, &pool_info, nullptr, &pool);
+    VkCommandBuffer command_buffer;
+    VkCommandBufferAllocateInfo allocate_info = {};
+    allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocate_info.commandPool = pool;
+    allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocate_info.commandBufferCount = 1;
+    vkAllocateCommandBuffers(device, &allocate_info, &command_buffer);
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    vkBeginCommandBuffer(command_buffer, &begin_info);
+
+    const float blend_constants[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    printf("iterations %u\n", iterations);
+    printf("ns_per_clean_call %.1f\n", timeCalls(command_buffer, blend_constants, iterations));
+    unsigned clean_messages = reported_messages;
+    printf("ns_per_noisy_call %.1f\n", timeCalls(command_buffer, nullptr, iterations));
+    unsigned noisy_messages = reported_messages - clean_messages;
+
+    vkEndCommandBuffer(command_buffer);
+    vkFreeCommandBuffers(device, pool, 1, &command_buffer);
+    vkDestroyCommandPool(device, pool, nullptr);
+    vkDestroyDevice(device, nullptr);
+    destroy_callback(instance, callback, nullptr);
+    vkDestroyInstance(instance, nullptr);
+
+    printf("reported_messages %u\n", noisy_messages);
+    printf("summary_messages %u\n", summary_messages);
+
+    unsigned expected_messages = (limited && limit < iterations) ? limit : iterations;
+    unsigned expected_summaries = (limited && limit < iterations) ? 1 : 0;
+    if (clean_messages || noisy_messages != expected_messages || summary_messages != expected_summaries) {
+        fprintf(stderr, "expected %u errors and %u summaries, got %u errors, %u summaries and %u errors for valid calls\n",
+                expected_messages, expected_summaries, noisy_messages, summary_messages, clean_messages);
+        return 1;
+    }
+    return 0;
+}
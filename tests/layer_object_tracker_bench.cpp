@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for how the object tracker holds up when several threads allocate and free command buffers at once, run
+// against the stub ICD in icd/ so it needs no GPU:
+//
+//     VK_ICD_FILENAMES=icd/VkICD_stub.json VK_LAYER_PATH=../layers vk_layer_object_tracker_bench [iterations] [max_threads]
+//
+// For 1, 2, 4, ... up to max_threads threads, each thread takes iterations command buffers from its own command pool in
+// batches of BATCH_SIZE: it allocates a batch, records a vkCmdSetLineWidth call into each and frees the batch again, the
+// churn of an application that allocates command buffers per frame.  It reports the average time per command buffer
+// and the total command buffers per second for each thread count as key/value lines.  Any validation message fails it.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+namespace {
+
+const uint32_t BATCH_SIZE = 64;
+
+std::atomic<unsigned> validation_messages(0);
+
+// Only counts what layers report, the loader complains about the stub ICD having no device extensions
+VKAPI_ATTR VkBool32 VKAPI_CALL countMessage(VkDebugReportFlagsEXT, VkDebugReportObjectTypeEXT, uint64_t, size_t, int32_t,
+                                            const char *pLayerPrefix, const char *pMessage, void *) {
+    if (!strcmp(pLayerPrefix, "loader")) {
+        return VK_FALSE;
+    }
+    if (validation_messages++ == 0) {
+        fprintf(stderr, "%s: %s\n", pLayerPrefix, pMessage);
+    }
+    return VK_FALSE;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+void churn(VkDevice device, VkCommandPool pool, unsigned iterations, std::atomic<unsigned> *ready, unsigned thread_count) {
+    VkCommandBuffer command_buffers[BATCH_SIZE];
+    VkCommandBufferAllocateInfo allocate_info = {};
+    allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocate_info.commandPool = pool;
+    allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+
+    // Start together so the threads overlap for as much of the run as possible
+    ready->fetch_add(1);
+    while (ready->load() < thread_count) {
+        std::this_thread::yield();
+    }
+    for (unsigned done = 0; done < iterations; done += allocate_info.commandBufferCount) {
+        allocate_info.commandBufferCount = (iterations - done < BATCH_SIZE) ? iterations - done : BATCH_SIZE;
+        vkAllocateCommandBuffers(device, &allocate_info, command_buffers);
+        for (uint32_t i = 0; i < allocate_info.commandBufferCount; i++) {
+            vkBeginCommandBuffer(command_buffers[i], &begin_info);
+            vkCmdSetLineWidth(command_buffers[i], 1.0f);
+            vkEndCommandBuffer(command_buffers[i]);
+        }
+        vkFreeCommandBuffers(device, pool, allocate_info.commandBufferCount, command_buffers);
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned iterations = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 100000;
+    unsigned max_threads = (argc > 2) ? static_cast<unsigned>(atoi(argv[2])) : 8;
+    if (max_threads < 1) {
+        max_threads = 1;
+    }
+
+    const char *layers[] = {"VK_LAYER_LUNARG_object_tracker"};
+    const char *extensions[] = {VK_EXT_DEBUG_REPORT_EXTENSION_NAME};
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_info.enabledLayerCount = 1;
+    instance_info.ppEnabledLayerNames = layers;
+    instance_info.enabledExtensionCount = 1;
+    instance_info.ppEnabledExtensionNames = extensions;
+    VkInstance instance;
+    if (vkCreateInstance(&instance_info, nullptr, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateInstance failed, is VK_ICD_FILENAMES set to the stub ICD and VK_LAYER_PATH to the "
+                        "layers?\n");
+        return 1;
+    }
+
+    VkDebugReportCallbackCreateInfoEXT callback_info = {};
+    callback_info.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
+    callback_info.flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT;
+    callback_info.pfnCallback = countMessage;
+    PFN_vkCreateDebugReportCallbackEXT create_callback = reinterpret_cast<PFN_vkCreateDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkCreateDebugReportCallbackEXT"));
+    PFN_vkDestroyDebugReportCallbackEXT destroy_callback = reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkDestroyDebugReportCallbackEXT"));
+    VkDebugReportCallbackEXT callback = VK_NULL_HANDLE;
+    if (create_callback) {
+        create_callback(instance, &callback_info, nullptr, &callback);
+    }
+
+    uint32_t gpu_count = 1;
+    VkPhysicalDevice gpu;
+    VkResult result = vkEnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || gpu_count < 1) {
+        fprintf(stderr, "vkEnumeratePhysicalDevices found no physical device\n");
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_info = {};
+    device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    VkDevice device;
+    if (vkCreateDevice(gpu, &device_info, nullptr, &device) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDevice failed\n");
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    std::vector<VkCommandPool> pools(max_threads);
+    for (VkCommandPool &pool : pools) {
+        VkCommandPoolCreateInfo pool_info = {};
+        pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        vkCreateCommandPool(device, &pool_info, nullptr, &pool);
+    }
+
+    printf("iterations %u\n", iterations);
+    for (unsigned thread_count = 1; thread_count <= max_threads;
+         thread_count = (thread_count < max_threads && thread_count * 2 > max_threads) ? max_threads : thread_count * 2) {
+        std::atomic<unsigned> ready(0);
+        std::vector<std::thread> threads;
+        auto start = Clock::now();
+        for (unsigned t = 0; t < thread_count; t++) {
+            threads.push_back(std::thread(churn, device, pools[t], iterations, &ready, thread_count));
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        double command_buffers = static_cast<double>(iterations) * thread_count;
+        printf("threads_%u_ns_per_command_buffer %.1f\n", thread_count, iterations ? seconds * 1e9 / iterations : 0.0);
+        printf("threads_%u_command_buffers_per_second %.0f\n", thread_count,
+               seconds > 0.0 ? command_buffers / seconds : 0.0);
+    }
+
+    for (VkCommandPool pool : pools) {
+        vkDestroyCommandPool(device, pool, nullptr);
+    }
+    vkDestroyDevice(device, nullptr);
+    if (callback != VK_NULL_HANDLE) {
+        destroy_callback(instance, callback, nullptr);
+    }
+    vkDestroyInstance(instance, nullptr);
+
+    printf("validation_messages %u\n", validation_messages.load());
+
+    return validation_messages ? 1 : 0;
+}
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for how core_validation checks the pipelines of one vkCreateGraphicsPipelines call, run against the stub
+// ICD in icd/ so it needs no GPU:
+//
+//     VK_ICD_FILENAMES=icd/VkICD_stub.json VK_LAYER_PATH=../layers vk_layer_pipeline_batch_bench [batches] [pipelines]
+//
+// Each of batches calls creates pipelines pipelines, every third of which asks for a line width of its own that the
+// stub ICD doesn't support.  It fails unless every call reports exactly those errors, in pipeline order, on the calling
+// thread, which is what checking the pipelines one by one gives.  Running it again with
+// lunarg_core_validation.pipeline_validation_threads set checks that spreading a batch over worker threads does too.
+// Reports the average time per call as key/value lines.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+namespace {
+
+struct reported_messages {
+    std::thread::id caller;
+    std::vector<std::string> texts;
+    unsigned off_thread;
+};
+
+// Keeps what layers report, the loader complains about the stub ICD having no device extensions
+VKAPI_ATTR VkBool32 VKAPI_CALL keepMessage(VkDebugReportFlagsEXT, VkDebugReportObjectTypeEXT, uint64_t, size_t, int32_t,
+                                           const char *pLayerPrefix, const char *pMessage, void *pUserData) {
+    if (!strcmp(pLayerPrefix, "loader")) {
+        return VK_FALSE;
+    }
+    reported_messages *messages = static_cast<reported_messages *>(pUserData);
+    if (std::this_thread::get_id() != messages->caller) {
+        messages->off_thread++;
+    }
+    messages->texts.push_back(pMessage);
+    return VK_FALSE;
+}
+
+enum {
+    OpMemoryModel = 14,
+    OpEntryPoint = 15,
+    OpExecutionMode = 16,
+    OpCapability = 17,
+    OpTypeVoid = 19,
+    OpTypeFunction = 33,
+    OpFunction = 54,
+    OpFunctionEnd = 56,
+    OpLabel = 248,
+    OpReturn = 253,
+};
+
+const uint32_t CapabilityShader = 1;
+const uint32_t AddressingModelLogical = 0;
+const uint32_t MemoryModelGLSL450 = 1;
+const uint32_t ExecutionModelVertex = 0;
+const uint32_t ExecutionModelFragment = 4;
+const uint32_t ExecutionModeOriginUpperLeft = 7;
+
+// A shader for execution_model that does nothing, there being no shader compiler to build one with
+std::vector<uint32_t> emptyShader(uint32_t execution_model) {
+    const uint32_t void_type = 1, function_type = 2, main = 3, label = 4;
+    std::vector<uint32_t> words = {0x07230203, 0x00010000, 0, 5, 0};
+    words.insert(words.end(), {2 << 16 | OpCapability, CapabilityShader});
+    words.insert(words.end(), {3 << 16 | OpMemoryModel, AddressingModelLogical, MemoryModelGLSL450});
+    // "main" takes two words with its terminator
+    words.insert(words.end(), {5 << 16 | OpEntryPoint, execution_model, main, 0x6e69616d, 0});
+    if (execution_model == ExecutionModelFragment) {
+        words.insert(words.end(), {3 << 16 | OpExecutionMode, main, ExecutionModeOriginUpperLeft});
+    }
+    words.insert(words.end(), {2 << 16 | OpTypeVoid, void_type});
+    words.insert(words.end(), {3 << 16 | OpTypeFunction, function_type, void_type});
+    words.insert(words.end(), {5 << 16 | OpFunction, void_type, main, 0, function_type});
+    words.insert(words.end(), {2 << 16 | OpLabel, label});
+    words.insert(words.end(), {1 << 16 | OpReturn});
+    words.insert(words.end(), {1 << 16 | OpFunctionEnd});
+    return words;
+}
+
+VkShaderModule createShaderModule(VkDevice device, std::vector<uint32_t> const &code) {
+    VkShaderModuleCreateInfo module_info = {};
+    module_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    module_info.codeSize = code.size() * sizeof(uint32_t);
+    module_info.pCode = code.data();
+    VkShaderModule module = VK_NULL_HANDLE;
+    vkCreateShaderModule(device, &module_info, nullptr, &module);
+    return module;
+}
+
+// Pipelines whose index is a multiple of this get a line width of their own
+const uint32_t wide_line_every = 3;
+
+float lineWidth(uint32_t pipeline) { return (pipeline % wide_line_every) ? 1.0f : 2.0f + pipeline; }
+
+typedef std::chrono::steady_clock Clock;
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned batch_count = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 1000;
+    uint32_t pipeline_count = (argc > 2) ? static_cast<uint32_t>(atoi(argv[2])) : 64;
+
+    const char *layers[] = {"VK_LAYER_LUNARG_core_validation"};
+    const char *extensions[] = {VK_EXT_DEBUG_REPORT_EXTENSION_NAME};
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_info.enabledLayerCount = 1;
+    instance_info.ppEnabledLayerNames = layers;
+    instance_info.enabledExtensionCount = 1;
+    instance_info.ppEnabledExtensionNames = extensions;
+    VkInstance instance;
+    if (vkCreateInstance(&instance_info, nullptr, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateInstance failed, is VK_ICD_FILENAMES set to the stub ICD and VK_LAYER_PATH to the "
+                        "layers?\n");
+        return 1;
+    }
+
+    reported_messages messages;
+    messages.caller = std::this_thread::get_id();
+    messages.off_thread = 0;
+    VkDebugReportCallbackCreateInfoEXT callback_info = {};
+    callback_info.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
+    callback_info.flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT;
+    callback_info.pfnCallback = keepMessage;
+    callback_info.pUserData = &messages;
+    PFN_vkCreateDebugReportCallbackEXT create_callback = reinterpret_cast<PFN_vkCreateDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkCreateDebugReportCallbackEXT"));
+    PFN_vkDestroyDebugReportCallbackEXT destroy_callback = reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkDestroyDebugReportCallbackEXT"));
+    VkDebugReportCallbackEXT callback = VK_NULL_HANDLE;
+    if (!create_callback || create_callback(instance, &callback_info, nullptr, &callback) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDebugReportCallbackEXT failed\n");
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    // Going by the book, core_validation warns otherwise
+    uint32_t gpu_count = 0;
+    vkEnumeratePhysicalDevices(instance, &gpu_count, nullptr);
+    gpu_count = 1;
+    VkPhysicalDevice gpu;
+    VkResult result = vkEnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || gpu_count < 1) {
+        fprintf(stderr, "vkEnumeratePhysicalDevices found no physical device\n");
+        destroy_callback(instance, callback, nullptr);
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+    uint32_t queue_family_count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu, &queue_family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu, &queue_family_count, queue_families.data());
+
+    // No wideLines, so any line width but 1.0 is an error
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_info = {};
+    device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    VkDevice device;
+    if (vkCreateDevice(gpu, &device_info, nullptr, &device) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDevice failed\n");
+        destroy_callback(instance, callback, nullptr);
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    VkPipelineLayoutCreateInfo pipeline_layout_info = {};
+    pipeline_layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    VkPipelineLayout pipeline_layout;
+    vkCreatePipelineLayout(device, &pipeline_layout_info, nullptr, &pipeline_layout);
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    VkRenderPassCreateInfo render_pass_info = {};
+    render_pass_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    render_pass_info.subpassCount = 1;
+    render_pass_info.pSubpasses = &subpass;
+    VkRenderPass render_pass;
+    vkCreateRenderPass(device, &render_pass_info, nullptr, &render_pass);
+
+    VkShaderModule vertex_module = createShaderModule(device, emptyShader(ExecutionModelVertex));
+    VkShaderModule fragment_module = createShaderModule(device, emptyShader(ExecutionModelFragment));
+    VkPipelineShaderStageCreateInfo stages[2] = {};
+    stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stages[0].module = vertex_module;
+    stages[0].pName = "main";
+    stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stages[1].module = fragment_module;
+    stages[1].pName = "main";
+    VkPipelineVertexInputStateCreateInfo vertex_input = {};
+    vertex_input.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    VkPipelineInputAssemblyStateCreateInfo input_assembly = {};
+    input_assembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    VkViewport viewport = {0.0f, 0.0f, 64.0f, 64.0f, 0.0f, 1.0f};
+    VkRect2D scissor = {{0, 0}, {64, 64}};
+    VkPipelineViewportStateCreateInfo viewport_state = {};
+    viewport_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport_state.viewportCount = 1;
+    viewport_state.pViewports = &viewport;
+    viewport_state.scissorCount = 1;
+    viewport_state.pScissors = &scissor;
+    VkPipelineMultisampleStateCreateInfo multisample = {};
+    multisample.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    VkPipelineColorBlendStateCreateInfo color_blend = {};
+    color_blend.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+
+    std::vector<VkPipelineRasterizationStateCreateInfo> rasterization(pipeline_count);
+    std::vector<VkGraphicsPipelineCreateInfo> pipeline_infos(pipeline_count);
+    std::vector<std::string> expected;
+    for (uint32_t i = 0; i < pipeline_count; i++) {
+        rasterization[i] = {};
+        rasterization[i].sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+        rasterization[i].polygonMode = VK_POLYGON_MODE_FILL;
+        rasterization[i].cullMode = VK_CULL_MODE_NONE;
+        rasterization[i].frontFace = VK_FRONT_FACE_CLOCKWISE;
+        rasterization[i].lineWidth = lineWidth(i);
+        pipeline_infos[i] = {};
+        pipeline_infos[i].sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        pipeline_infos[i].stageCount = 2;
+        pipeline_infos[i].pStages = stages;
+        pipeline_infos[i].pVertexInputState = &vertex_input;
+        pipeline_infos[i].pInputAssemblyState = &input_assembly;
+        pipeline_infos[i].pViewportState = &viewport_state;
+        pipeline_infos[i].pRasterizationState = &rasterization[i];
+        pipeline_infos[i].pMultisampleState = &multisample;
+        pipeline_infos[i].pColorBlendState = &color_blend;
+        pipeline_infos[i].layout = pipeline_layout;
+        pipeline_infos[i].renderPass = render_pass;
+        if (rasterization[i].lineWidth != 1.0f) {
+            char width[64];
+            snprintf(width, sizeof(width), "lineWidth to %f ", rasterization[i].lineWidth);
+            expected.push_back(width);
+        }
+    }
+
+    unsigned failures = 0;
+    std::vector<VkPipeline> pipelines(pipeline_count);
+    double seconds = 0.0;
+    for (unsigned batch = 0; batch < batch_count; batch++) {
+        messages.texts.clear();
+        auto start = Clock::now();
+        result = vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, pipeline_count, pipeline_infos.data(), nullptr,
+                                           pipelines.data());
+        seconds += std::chrono::duration<double>(Clock::now() - start).count();
+
+        bool in_order = (messages.texts.size() == expected.size());
+        for (size_t m = 0; in_order && m < expected.size(); m++) {
+            in_order = (messages.texts[m].find(expected[m]) != std::string::npos);
+        }
+        if (!in_order) {
+            if (!failures) {
+                fprintf(stderr, "expected %zu line width errors in pipeline order, got:\n", expected.size());
+                for (auto &text : messages.texts) {
+                    fprintf(stderr, "    %s\n", text.c_str());
+                }
+            }
+            failures++;
+        }
+        // Any error skips the whole call, and there is one unless there are too few pipelines for it
+        if (result == VK_SUCCESS) {
+            for (VkPipeline pipeline : pipelines) {
+                vkDestroyPipeline(device, pipeline, nullptr);
+            }
+        }
+    }
+    if (messages.off_thread) {
+        fprintf(stderr, "%u messages were reported on another thread than the caller's\n", messages.off_thread);
+        failures++;
+    }
+
+    printf("batches %u\n", batch_count);
+    printf("pipelines_per_batch %u\n", pipeline_count);
+    printf("errors_per_batch %zu\n", expected.size());
+    printf("us_per_batch %.1f\n", batch_count ? seconds * 1e6 / batch_count : 0.0);
+    printf("failures %u\n", failures);
+
+    vkDestroyShaderModule(device, fragment_module, nullptr);
+    vkDestroyShaderModule(device, vertex_module, nullptr);
+    vkDestroyRenderPass(device, render_pass, nullptr);
+    vkDestroyPipelineLayout(device, pipeline_layout, nullptr);
+    vkDestroyDevice(device, nullptr);
+    destroy_callback(instance, callback, nullptr);
+    vkDestroyInstance(instance, nullptr);
+
+    return failures ? 1 : 0;
+}
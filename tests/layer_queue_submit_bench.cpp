@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for the checks core_validation defers from recording to vkQueueSubmit, run against the stub ICD in icd/
+// so it needs no GPU:
+//
+//     VK_ICD_FILENAMES=icd/VkICD_stub.json VK_LAYER_PATH=../layers vk_layer_queue_submit_bench [writes]
+//
+// It first submits a copy from a buffer whose memory was never written, which core_validation can only report at
+// submit, and checks that it reports exactly that one error.  Then it records writes fills of that buffer each followed
+// by a copy from it into one command buffer, and reports how long submitting it takes as key/value lines.  The memory
+// checks the copies leave behind replay in recording order, so that submit must report nothing.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+namespace {
+
+unsigned reported_messages = 0;
+
+// Only counts what layers report, the loader complains about the stub ICD having no device extensions
+VKAPI_ATTR VkBool32 VKAPI_CALL countMessage(VkDebugReportFlagsEXT, VkDebugReportObjectTypeEXT, uint64_t, size_t, int32_t,
+                                            const char *pLayerPrefix, const char *, void *) {
+    if (!strcmp(pLayerPrefix, "loader")) {
+        return VK_FALSE;
+    }
+    reported_messages++;
+    return VK_FALSE;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+VkBuffer createBuffer(VkDevice device, VkBufferUsageFlags usage, VkDeviceSize size, VkDeviceMemory *memory) {
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = size;
+    buffer_info.usage = usage;
+    VkBuffer buffer;
+    vkCreateBuffer(device, &buffer_info, nullptr, &buffer);
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device, buffer, &requirements);
+    VkMemoryAllocateInfo memory_info = {};
+    memory_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memory_info.allocationSize = (requirements.size > size) ? requirements.size : size;
+    for (memory_info.memoryTypeIndex = 0; !(requirements.memoryTypeBits & (1u << memory_info.memoryTypeIndex));
+         memory_info.memoryTypeIndex++) {
+    }
+    vkAllocateMemory(device, &memory_info, nullptr, memory);
+    vkBindBufferMemory(device, buffer, *memory, 0);
+    return buffer;
+}
+
+VkResult submit(VkQueue queue, VkCommandBuffer command_buffer) {
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &command_buffer;
+    return vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned write_count = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 10000;
+    const VkDeviceSize size = 256;
+
+    const char *layers[] = {"VK_LAYER_LUNARG_core_validation"};
+    const char *extensions[] = {VK_EXT_DEBUG_REPORT_EXTENSION_NAME};
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_info.enabledLayerCount = 1;
+    instance_info.ppEnabledLayerNames = layers;
+    instance_info.enabledExtensionCount = 1;
+    instance_info.ppEnabledExtensionNames = extensions;
+    VkInstance instance;
+    if (vkCreateInstance(&instance_info, nullptr, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateInstance failed, is VK_ICD_FILENAMES set to the stub ICD and VK_LAYER_PATH to the "
+                        "layers?\n");
+        return 1;
+    }
+
+    VkDebugReportCallbackCreateInfoEXT callback_info = {};
+    callback_info.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
+    callback_info.flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT;
+    callback_info.pfnCallback = countMessage;
+    PFN_vkCreateDebugReportCallbackEXT create_callback = reinterpret_cast<PFN_vkCreateDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkCreateDebugReportCallbackEXT"));
+    PFN_vkDestroyDebugReportCallbackEXT destroy_callback = reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkDestroyDebugReportCallbackEXT"));
+    VkDebugReportCallbackEXT callback = VK_NULL_HANDLE;
+    if (!create_callback || create_callback(instance, &callback_info, nullptr, &callback) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDebugReportCallbackEXT failed\n");
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    // Going by the book, core_validation warns otherwise
+    uint32_t gpu_count = 0;
+    vkEnumeratePhysicalDevices(instance, &gpu_count, nullptr);
+    gpu_count = 1;
+    VkPhysicalDevice gpu;
+    VkResult result = vkEnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || gpu_count < 1) {
+        fprintf(stderr, "vkEnumeratePhysicalDevices found no physical device\n");
+        destroy_callback(instance, callback, nullptr);
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+    uint32_t queue_family_count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu, &queue_family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+    vkGetPhysicalDeviceQueueFamilyProperties(gpu, &queue_family_count, queue_families.data());
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_info = {};
+    device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    VkDevice device;
+    if (vkCreateDevice(gpu, &device_info, nullptr, &device) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDevice failed\n");
+        destroy_callback(instance, callback, nullptr);
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+    VkQueue queue;
+    vkGetDeviceQueue(device, 0, 0, &queue);
+
+    VkDeviceMemory src_memory, dst_memory;
+    VkBuffer src = createBuffer(device, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, size,
+                                &src_memory);
+    VkBuffer dst = createBuffer(device, VK_BUFFER_USAGE_TRANSFER_DST_BIT, size, &dst_memory);
+    VkBufferCopy region = {};
+    region.size = size;
+
+    VkCommandPool pool;
+    VkCommandPoolCreateInfo pool_info = {};
+    pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    vkCreateCommandPool(device, &pool_info, nullptr, &pool);
+    VkCommandBuffer command_buffers[2];
+    VkCommandBufferAllocateInfo allocate_info = {};
+    allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocate_info.commandPool = pool;
+    allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocate_info.commandBufferCount = 2;
+    vkAllocateCommandBuffers(device, &allocate_info, command_buffers);
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+
+    // Reading memory nothing wrote is only found out at submit
+    vkBeginCommandBuffer(command_buffers[0], &begin_info);
+    vkCmdCopyBuffer(command_buffers[0], src, dst, 1, &region);
+    vkEndCommandBuffer(command_buffers[0]);
+    unsigned recording_messages = reported_messages;
+    submit(queue, command_buffers[0]);
+    vkQueueWaitIdle(queue);
+    unsigned unwritten_messages = reported_messages - recording_messages;
+
+    vkBeginCommandBuffer(command_buffers[1], &begin_info);
+    for (unsigned i = 0; i < write_count; i++) {
+        vkCmdFillBuffer(command_buffers[1], src, 0, size, i);
+        vkCmdCopyBuffer(command_buffers[1], src, dst, 1, &region);
+    }
+    vkEndCommandBuffer(command_buffers[1]);
+    recording_messages = reported_messages - unwritten_messages;
+
+    auto start = Clock::now();
+    result = submit(queue, command_buffers[1]);
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    vkQueueWaitIdle(queue);
+    unsigned written_messages = reported_messages - unwritten_messages - recording_messages;
+
+    printf("writes %u\n", write_count);
+    printf("us_per_submit %.1f\n", seconds * 1e6);
+    printf("unwritten_read_messages %u\n", unwritten_messages);
+    printf("written_read_messages %u\n", written_messages);
+
+    vkFreeCommandBuffers(device, pool, 2, command_buffers);
+    vkDestroyCommandPool(device, pool, nullptr);
+    vkDestroyBuffer(device, dst, nullptr);
+    vkDestroyBuffer(device, src, nullptr);
+    vkFreeMemory(device, dst_memory, nullptr);
+    vkFreeMemory(device, src_memory, nullptr);
+    vkDestroyDevice(device, nullptr);
+    destroy_callback(instance, callback, nullptr);
+    vkDestroyInstance(instance, nullptr);
+
+    if (recording_messages || unwritten_messages != 1 || written_messages || result != VK_SUCCESS) {
+        fprintf(stderr, "expected one error submitting the unwritten read and none otherwise, got %u recording, %u for the "
+                        "unwritten read and %u for the written ones\n",
+                recording_messages, unwritten_messages, written_messages);
+        return 1;
+    }
+    return 0;
+}
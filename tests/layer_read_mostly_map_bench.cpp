@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for looking up per-handle state from several threads at once, comparing the read_mostly_map behind the
+// layers' dispatch_key_map (layers/vk_layer_read_mostly_map.h) with a mutex-guarded unordered_map:
+//
+//     vk_layer_read_mostly_map_bench [iterations] [max_threads] [keys]
+//
+// keys handles are inserted up front.  Then for 1, 2, 4, ... up to max_threads threads, each thread looks up iterations
+// of them while one more thread keeps inserting and erasing handles of its own, as an application creating and
+// destroying objects while others record would.  It reports the average time per lookup for both maps as key/value
+// lines, and fails if any lookup gives back the wrong value or an erased handle is still found.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "vk_layer_read_mostly_map.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// Handles are made up from the index so that every lookup can be checked, non-zero and aligned like real ones
+uint64_t handle(size_t index) { return 0x1000 + index * 64; }
+
+class locked_lookup {
+  public:
+    uint64_t get(uint64_t key) {
+        std::lock_guard<std::mutex> lock(lock_);
+        auto it = map_.find(key);
+        return it == map_.end() ? 0 : it->second;
+    }
+    void insert(uint64_t key, uint64_t value) {
+        std::lock_guard<std::mutex> lock(lock_);
+        map_[key] = value;
+    }
+    void erase(uint64_t key) {
+        std::lock_guard<std::mutex> lock(lock_);
+        map_.erase(key);
+    }
+
+  private:
+    std::mutex lock_;
+    std::unordered_map<uint64_t, uint64_t> map_;
+};
+
+// There is only ever one writer here, so unlike dispatch_key_map it needs no lock at all
+class read_mostly_lookup {
+  public:
+    uint64_t get(uint64_t key) const {
+        const uint64_t *value = map_.get(key);
+        return value ? *value : 0;
+    }
+    void insert(uint64_t key, uint64_t value) { map_[key] = value; }
+    void erase(uint64_t key) { map_.erase(key); }
+    void reclaim() { map_.reclaim(); }
+
+  private:
+    read_mostly_map<uint64_t, uint64_t> map_;
+};
+
+template <typename Lookup>
+void lookupMany(Lookup *lookup, size_t keys, unsigned iterations, unsigned seed, std::atomic<unsigned> *errors) {
+    size_t index = seed % keys;
+    for (unsigned i = 0; i < iterations; i++) {
+        if (lookup->get(handle(index)) != index + 1) {
+            (*errors)++;
+        }
+        // Step through the handles in an order that defeats the cache, as recording many draws would
+        index += 7919;
+        if (index >= keys) {
+            index %= keys;
+        }
+    }
+}
+
+// Cycles through a few handles of its own, so the read_mostly_map reuses their slots instead of growing
+template <typename Lookup>
+void churn(Lookup *lookup, size_t keys, const std::atomic<bool> *stop, std::atomic<unsigned> *errors) {
+    for (size_t i = 0; !stop->load(); i++) {
+        size_t index = keys + (i & 63);
+        lookup->insert(handle(index), index + 1);
+        if (lookup->get(handle(index)) != index + 1) {
+            (*errors)++;
+        }
+        lookup->erase(handle(index));
+        if (lookup->get(handle(index))) {
+            (*errors)++;
+        }
+    }
+}
+
+template <typename Lookup>
+double run(Lookup *lookup, size_t keys, unsigned iterations, unsigned thread_count, std::atomic<unsigned> *errors) {
+    std::atomic<bool> stop(false);
+    std::thread churner(churn<Lookup>, lookup, keys, &stop, errors);
+    std::vector<std::thread> threads;
+    auto start = Clock::now();
+    for (unsigned t = 0; t < thread_count; t++) {
+        threads.push_back(std::thread(lookupMany<Lookup>, lookup, keys, iterations, t * 104729u, errors));
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    stop.store(true);
+    churner.join();
+    return iterations ? seconds * 1e9 / iterations : 0.0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned iterations = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 1000000;
+    unsigned max_threads = (argc > 2) ? static_cast<unsigned>(atoi(argv[2])) : 8;
+    size_t keys = (argc > 3) ? static_cast<size_t>(atoi(argv[3])) : 4096;
+    if (max_threads < 1) {
+        max_threads = 1;
+    }
+    if (keys < 1) {
+        keys = 1;
+    }
+
+    locked_lookup locked;
+    read_mostly_lookup read_mostly;
+    for (size_t i = 0; i < keys; i++) {
+        locked.insert(handle(i), i + 1);
+        read_mostly.insert(handle(i), i + 1);
+    }
+
+    std::atomic<unsigned> errors(0);
+    printf("iterations %u\n", iterations);
+    printf("keys %zu\n", keys);
+    for (unsigned thread_count = 1; thread_count <= max_threads;
+         thread_count = (thread_count < max_threads && thread_count * 2 > max_threads) ? max_threads : thread_count * 2) {
+        printf("threads_%u_read_mostly_map_ns_per_lookup %.1f\n", thread_count,
+               run(&read_mostly, keys, iterations, thread_count, &errors));
+        printf("threads_%u_locked_map_ns_per_lookup %.1f\n", thread_count,
+               run(&locked, keys, iterations, thread_count, &errors));
+        // Nothing is looking anything up between runs
+        read_mostly.reclaim();
+    }
+
+    printf("errors %u\n", errors.load());
+
+    return errors ? 1 : 0;
+}
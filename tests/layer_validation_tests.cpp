@@ -3159,6 +3159,49 @@ TEST_F(VkLayerTest, InvalidUsageBits)
                            1, &region);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(VkLayerTest, QueueSubmitDeferredMemoryChecks) {
+    TEST_DESCRIPTION("Copy from a buffer whose memory was never written and "
+                     "check the error is still reported at vkQueueSubmit, "
+                     "then fill the buffer before copying from it and check "
+                     "nothing is. vk_layer_queue_submit_bench times the "
+                     "submit of many such writes.");
+
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkMemoryPropertyFlags reqs = 0;
+    vk_testing::Buffer src_buffer;
+    src_buffer.init_as_src_and_dst(*m_device, 256, reqs);
+    vk_testing::Buffer dst_buffer;
+    dst_buffer.init_as_dst(*m_device, 256, reqs);
+
+    VkBufferCopy region = {};
+    region.size = 256;
+
+    // Whether the source was written is only known at submit
+    m_errorMonitor->ExpectSuccess();
+    VkCommandBufferObj copy(m_device, m_commandPool);
+    copy.BeginCommandBuffer();
+    vkCmdCopyBuffer(copy.GetBufferHandle(), src_buffer.handle(),
+                    dst_buffer.handle(), 1, &region);
+    copy.EndCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         "Cannot read invalid memory");
+    copy.QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->ExpectSuccess();
+    VkCommandBufferObj fill_and_copy(m_device, m_commandPool);
+    fill_and_copy.BeginCommandBuffer();
+    fill_and_copy.FillBuffer(src_buffer.handle(), 0, 256, 0);
+    vkCmdCopyBuffer(fill_and_copy.GetBufferHandle(), src_buffer.handle(),
+                    dst_buffer.handle(), 1, &region);
+    fill_and_copy.EndCommandBuffer();
+    fill_and_copy.QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+}
 #endif // MEM_TRACKER_TESTS
 
 #if OBJ_TRACKER_TESTS
@@ -7621,6 +7664,273 @@ TEST_F(VkLayerTest, InvalidDynamicOffsetCases) {
     vkDestroyDescriptorPool(m_device->device(), ds_pool, NULL);
 }
 
+TEST_F(VkLayerTest, DrawTimeDescriptorValidationManyBindings) {
+    TEST_DESCRIPTION("Record several draws with a pipeline using 8 sets of 32 "
+                     "uniform buffer bindings each, with the sets and the "
+                     "pipeline unchanged between draws, and check none of "
+                     "them reports an error. vk_layer_descriptor_draw_bench "
+                     "times the same draws.");
+
+    const uint32_t set_count = 8;
+    const uint32_t binding_count = 32;
+    const uint32_t draw_count = 16;
+    const VkDeviceSize stride = 256;
+
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    auto const &limits = m_device->props.limits;
+    if (limits.maxBoundDescriptorSets < set_count ||
+        limits.maxPerStageDescriptorUniformBuffers < set_count * binding_count ||
+        limits.maxDescriptorSetUniformBuffers < set_count * binding_count ||
+        limits.minUniformBufferOffsetAlignment > stride) {
+        printf("Device does not support %u uniform buffers in one stage; skipped.\n", set_count * binding_count);
+        return;
+    }
+
+    VkDescriptorSetLayoutBinding dsl_bindings[binding_count];
+    for (uint32_t b = 0; b < binding_count; b++) {
+        dsl_bindings[b] = {};
+        dsl_bindings[b].binding = b;
+        dsl_bindings[b].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        dsl_bindings[b].descriptorCount = 1;
+        dsl_bindings[b].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    }
+    VkDescriptorSetLayoutCreateInfo ds_layout_ci = {};
+    ds_layout_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    ds_layout_ci.bindingCount = binding_count;
+    ds_layout_ci.pBindings = dsl_bindings;
+    VkDescriptorSetLayout ds_layout;
+    VkResult err = vkCreateDescriptorSetLayout(m_device->device(), &ds_layout_ci, NULL, &ds_layout);
+    ASSERT_VK_SUCCESS(err);
+
+    VkDescriptorPoolSize ds_type_count = {};
+    ds_type_count.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    ds_type_count.descriptorCount = set_count * binding_count;
+    VkDescriptorPoolCreateInfo ds_pool_ci = {};
+    ds_pool_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    ds_pool_ci.maxSets = set_count;
+    ds_pool_ci.poolSizeCount = 1;
+    ds_pool_ci.pPoolSizes = &ds_type_count;
+    VkDescriptorPool ds_pool;
+    err = vkCreateDescriptorPool(m_device->device(), &ds_pool_ci, NULL, &ds_pool);
+    ASSERT_VK_SUCCESS(err);
+
+    VkDescriptorSetLayout set_layouts[set_count];
+    for (uint32_t i = 0; i < set_count; i++) {
+        set_layouts[i] = ds_layout;
+    }
+    VkDescriptorSet descriptor_sets[set_count];
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorPool = ds_pool;
+    alloc_info.descriptorSetCount = set_count;
+    alloc_info.pSetLayouts = set_layouts;
+    err = vkAllocateDescriptorSets(m_device->device(), &alloc_info, descriptor_sets);
+    ASSERT_VK_SUCCESS(err);
+
+    VkPipelineLayoutCreateInfo pipeline_layout_ci = {};
+    pipeline_layout_ci.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipeline_layout_ci.setLayoutCount = set_count;
+    pipeline_layout_ci.pSetLayouts = set_layouts;
+    VkPipelineLayout pipeline_layout;
+    err = vkCreatePipelineLayout(m_device->device(), &pipeline_layout_ci, NULL, &pipeline_layout);
+    ASSERT_VK_SUCCESS(err);
+
+    // One buffer backs every descriptor, each at its own aligned offset
+    vk_testing::Buffer buffer;
+    buffer.init(*m_device, vk_testing::Buffer::create_info(stride * set_count * binding_count,
+                                                           VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT));
+    std::vector<VkDescriptorBufferInfo> buffer_infos(set_count * binding_count);
+    std::vector<VkWriteDescriptorSet> writes(set_count * binding_count);
+    for (uint32_t i = 0; i < set_count * binding_count; i++) {
+        buffer_infos[i].buffer = buffer.handle();
+        buffer_infos[i].offset = stride * i;
+        buffer_infos[i].range = 16;
+        writes[i] = {};
+        writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[i].dstSet = descriptor_sets[i / binding_count];
+        writes[i].dstBinding = i % binding_count;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writes[i].pBufferInfo = &buffer_infos[i];
+    }
+    vkUpdateDescriptorSets(m_device->device(), static_cast<uint32_t>(writes.size()), writes.data(), 0, NULL);
+
+    char const *vsSource =
+        "#version 450\n"
+        "\n"
+        "out gl_PerVertex {\n"
+        "    vec4 gl_Position;\n"
+        "};\n"
+        "void main(){\n"
+        "   gl_Position = vec4(1);\n"
+        "}\n";
+    // Every binding of every set is used
+    std::string fsSource = "#version 450\n\nlayout(location=0) out vec4 x;\n";
+    std::string fsBody = "void main(){\n   x = vec4(0);\n";
+    for (uint32_t set = 0; set < set_count; set++) {
+        for (uint32_t b = 0; b < binding_count; b++) {
+            std::string name = std::to_string(set) + "_" + std::to_string(b);
+            fsSource += "layout(set=" + std::to_string(set) + ", binding=" + std::to_string(b) + ") uniform ub" + name +
+                        " { vec4 v; } u" + name + ";\n";
+            fsBody += "   x += u" + name + ".v;\n";
+        }
+    }
+    fsSource += fsBody + "}\n";
+
+    VkShaderObj vs(m_device, vsSource, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource.c_str(), VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddColorAttachment();
+    pipe.SetViewport(m_viewports);
+    pipe.SetScissor(m_scissors);
+    pipe.CreateVKPipeline(pipeline_layout, renderPass());
+
+    m_errorMonitor->ExpectSuccess();
+
+    BeginCommandBuffer();
+    vkCmdBindPipeline(m_commandBuffer->GetBufferHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+    vkCmdBindDescriptorSets(m_commandBuffer->GetBufferHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0,
+                            set_count, descriptor_sets, 0, NULL);
+    for (uint32_t i = 0; i < draw_count; i++) {
+        Draw(3, 1, 0, 0);
+    }
+    EndCommandBuffer();
+
+    m_errorMonitor->VerifyNotFound();
+
+    vkDestroyPipelineLayout(m_device->device(), pipeline_layout, NULL);
+    vkDestroyDescriptorPool(m_device->device(), ds_pool, NULL);
+    vkDestroyDescriptorSetLayout(m_device->device(), ds_layout, NULL);
+}
+
+TEST_F(VkLayerTest, DescriptorSetRebindBetweenDraws) {
+    TEST_DESCRIPTION("Draw with an updated descriptor set bound, then bind a "
+                     "set that was never updated in its place and draw again. "
+                     "The second draw must be validated even though the "
+                     "pipeline has not changed since the first one passed.");
+    VkResult err;
+
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    VkDescriptorPoolSize ds_type_count = {};
+    ds_type_count.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    ds_type_count.descriptorCount = 2;
+
+    VkDescriptorPoolCreateInfo ds_pool_ci = {};
+    ds_pool_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    ds_pool_ci.maxSets = 2;
+    ds_pool_ci.poolSizeCount = 1;
+    ds_pool_ci.pPoolSizes = &ds_type_count;
+    VkDescriptorPool ds_pool;
+    err = vkCreateDescriptorPool(m_device->device(), &ds_pool_ci, NULL, &ds_pool);
+    ASSERT_VK_SUCCESS(err);
+
+    VkDescriptorSetLayoutBinding dsl_binding = {};
+    dsl_binding.binding = 0;
+    dsl_binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    dsl_binding.descriptorCount = 1;
+    dsl_binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    VkDescriptorSetLayoutCreateInfo ds_layout_ci = {};
+    ds_layout_ci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    ds_layout_ci.bindingCount = 1;
+    ds_layout_ci.pBindings = &dsl_binding;
+    VkDescriptorSetLayout ds_layout;
+    err = vkCreateDescriptorSetLayout(m_device->device(), &ds_layout_ci, NULL, &ds_layout);
+    ASSERT_VK_SUCCESS(err);
+
+    VkDescriptorSetLayout set_layouts[2] = {ds_layout, ds_layout};
+    VkDescriptorSet descriptor_sets[2];
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorPool = ds_pool;
+    alloc_info.descriptorSetCount = 2;
+    alloc_info.pSetLayouts = set_layouts;
+    err = vkAllocateDescriptorSets(m_device->device(), &alloc_info, descriptor_sets);
+    ASSERT_VK_SUCCESS(err);
+
+    VkPipelineLayoutCreateInfo pipeline_layout_ci = {};
+    pipeline_layout_ci.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipeline_layout_ci.setLayoutCount = 1;
+    pipeline_layout_ci.pSetLayouts = &ds_layout;
+    VkPipelineLayout pipeline_layout;
+    err = vkCreatePipelineLayout(m_device->device(), &pipeline_layout_ci, NULL, &pipeline_layout);
+    ASSERT_VK_SUCCESS(err);
+
+    // Only the first set is updated
+    vk_testing::Buffer buffer;
+    buffer.init(*m_device, vk_testing::Buffer::create_info(256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT));
+    VkDescriptorBufferInfo buffer_info = {};
+    buffer_info.buffer = buffer.handle();
+    buffer_info.offset = 0;
+    buffer_info.range = 16;
+    VkWriteDescriptorSet descriptor_write = {};
+    descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptor_write.dstSet = descriptor_sets[0];
+    descriptor_write.dstBinding = 0;
+    descriptor_write.descriptorCount = 1;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    descriptor_write.pBufferInfo = &buffer_info;
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+
+    char const *vsSource =
+        "#version 450\n"
+        "\n"
+        "out gl_PerVertex {\n"
+        "    vec4 gl_Position;\n"
+        "};\n"
+        "void main(){\n"
+        "   gl_Position = vec4(1);\n"
+        "}\n";
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out vec4 x;\n"
+        "layout(set=0, binding=0) uniform foo { vec4 v; } bar;\n"
+        "void main(){\n"
+        "   x = bar.v;\n"
+        "}\n";
+    VkShaderObj vs(m_device, vsSource, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddColorAttachment();
+    pipe.SetViewport(m_viewports);
+    pipe.SetScissor(m_scissors);
+    pipe.CreateVKPipeline(pipeline_layout, renderPass());
+
+    BeginCommandBuffer();
+    vkCmdBindPipeline(m_commandBuffer->GetBufferHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+
+    m_errorMonitor->ExpectSuccess();
+    vkCmdBindDescriptorSets(m_commandBuffer->GetBufferHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0, 1,
+                            &descriptor_sets[0], 0, NULL);
+    Draw(3, 1, 0, 0);
+    Draw(3, 1, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         " bound but it was never updated. It is now being used to draw");
+    vkCmdBindDescriptorSets(m_commandBuffer->GetBufferHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0, 1,
+                            &descriptor_sets[1], 0, NULL);
+    Draw(3, 1, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    EndCommandBuffer();
+
+    vkDestroyPipelineLayout(m_device->device(), pipeline_layout, NULL);
+    vkDestroyDescriptorSetLayout(m_device->device(), ds_layout, NULL);
+    vkDestroyDescriptorPool(m_device->device(), ds_pool, NULL);
+}
+
 TEST_F(VkLayerTest, DescriptorBufferUpdateNoMemoryBound) {
     TEST_DESCRIPTION("Attempt to update a descriptor with a non-sparse buffer "
                      "that doesn't have memory bound");
@@ -12322,6 +12632,97 @@ TEST_F(VkLayerTest, InvalidImageLayout) {
     vkDestroyImage(m_device->device(), dst_image, NULL);
 }
 
+TEST_F(VkLayerTest, ImageLayoutSubresourceRanges) {
+    TEST_DESCRIPTION("Transition overlapping ranges of mip levels and array "
+                     "layers of one image and verify that layout tracking "
+                     "still reports mismatches for individual subresources.");
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkImageCreateInfo image_create_info = {};
+    image_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    image_create_info.imageType = VK_IMAGE_TYPE_2D;
+    image_create_info.format = VK_FORMAT_B8G8R8A8_UNORM;
+    image_create_info.extent.width = 64;
+    image_create_info.extent.height = 64;
+    image_create_info.extent.depth = 1;
+    image_create_info.mipLevels = 7;
+    image_create_info.arrayLayers = 16;
+    image_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_create_info.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    VkImage image;
+    VkResult err = vkCreateImage(m_device->device(), &image_create_info, NULL, &image);
+    ASSERT_VK_SUCCESS(err);
+
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+
+    BeginCommandBuffer();
+    m_errorMonitor->ExpectSuccess();
+    // Whole image, then a block of layers in one level and a run of whole levels
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+    vkCmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                         NULL, 0, NULL, 1, &barrier);
+    barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    barrier.subresourceRange.baseMipLevel = 3;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.baseArrayLayer = 4;
+    barrier.subresourceRange.layerCount = 5;
+    vkCmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                         NULL, 0, NULL, 1, &barrier);
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = 3;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 16;
+    vkCmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                         NULL, 0, NULL, 1, &barrier);
+    m_errorMonitor->VerifyNotFound();
+
+    // A single layer inside the block moved out of GENERAL
+    barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    barrier.dstAccessMask = 0;
+    barrier.subresourceRange.baseMipLevel = 3;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.baseArrayLayer = 6;
+    barrier.subresourceRange.layerCount = 1;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "You cannot transition the layout from "
+                                                                        "VK_IMAGE_LAYOUT_GENERAL when current layout is "
+                                                                        "VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL.");
+    vkCmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                         NULL, 0, NULL, 1, &barrier);
+    m_errorMonitor->VerifyFound();
+
+    // Levels past the ones moved to TRANSFER_DST are still GENERAL
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.subresourceRange.baseMipLevel = 2;
+    barrier.subresourceRange.levelCount = 2;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 4;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "You cannot transition the layout from "
+                                                                        "VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL when current layout is "
+                                                                        "VK_IMAGE_LAYOUT_GENERAL.");
+    vkCmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                         NULL, 0, NULL, 1, &barrier);
+    m_errorMonitor->VerifyFound();
+    EndCommandBuffer();
+
+    vkDestroyImage(m_device->device(), image, NULL);
+}
+
 TEST_F(VkLayerTest, ValidRenderPassAttachmentLayoutWithLoadOp) {
     TEST_DESCRIPTION("Positive test where we create a renderpass with an "
                      "attachment that uses LOAD_OP_CLEAR, the first subpass "
@@ -12667,6 +13068,109 @@ TEST_F(VkLayerTest, ThreadCommandBufferCollision) {
 
     vkDestroyEvent(device(), event, NULL);
 }
+
+struct record_thread_data_struct {
+    VkCommandBuffer commandBuffer;
+    VkEvent event;
+    uint32_t iterations;
+};
+
+extern "C" void *RecordCommandBuffer(void *arg) {
+    struct record_thread_data_struct *data = (struct record_thread_data_struct *)arg;
+    VkViewport viewport = {0.0f, 0.0f, 64.0f, 64.0f, 0.0f, 1.0f};
+    VkRect2D scissor = {{0, 0}, {64, 64}};
+
+    for (uint32_t i = 0; i < data->iterations; i++) {
+        vkCmdSetViewport(data->commandBuffer, 0, 1, &viewport);
+        vkCmdSetScissor(data->commandBuffer, 0, 1, &scissor);
+        vkCmdSetLineWidth(data->commandBuffer, 1.0f);
+        vkCmdSetEvent(data->commandBuffer, data->event,
+                      VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    }
+    return NULL;
+}
+
+TEST_F(VkLayerTest, ThreadRecordingSeparateCommandBuffers) {
+    TEST_DESCRIPTION("Record into one command buffer per thread from 4 "
+                     "threads at once and check nothing is reported, then "
+                     "that each command buffer ends and submits cleanly. "
+                     "vk_layer_core_recording_bench times how recording "
+                     "scales with the thread count.");
+
+    const uint32_t thread_count = 4;
+
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkEventCreateInfo event_info;
+    VkEvent event;
+    VkResult err;
+
+    memset(&event_info, 0, sizeof(event_info));
+    event_info.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+
+    err = vkCreateEvent(device(), &event_info, NULL, &event);
+    ASSERT_VK_SUCCESS(err);
+
+    // Command pools are externally synchronized, so each thread gets its own
+    VkCommandPool pools[thread_count];
+    VkCommandBuffer command_buffers[thread_count];
+    test_platform_thread threads[thread_count];
+    struct record_thread_data_struct data[thread_count];
+    for (uint32_t i = 0; i < thread_count; i++) {
+        VkCommandPoolCreateInfo pool_create_info{};
+        pool_create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        pool_create_info.queueFamilyIndex = m_device->graphics_queue_node_index_;
+        err = vkCreateCommandPool(m_device->device(), &pool_create_info, nullptr, &pools[i]);
+        ASSERT_VK_SUCCESS(err);
+
+        VkCommandBufferAllocateInfo command_buffer_allocate_info{};
+        command_buffer_allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        command_buffer_allocate_info.commandPool = pools[i];
+        command_buffer_allocate_info.commandBufferCount = 1;
+        command_buffer_allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        err = vkAllocateCommandBuffers(m_device->device(), &command_buffer_allocate_info, &command_buffers[i]);
+        ASSERT_VK_SUCCESS(err);
+    }
+
+    VkCommandBufferBeginInfo begin_info{};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+
+    m_errorMonitor->ExpectSuccess();
+
+    for (uint32_t i = 0; i < thread_count; i++) {
+        vkBeginCommandBuffer(command_buffers[i], &begin_info);
+        data[i].commandBuffer = command_buffers[i];
+        data[i].event = event;
+        data[i].iterations = 1000;
+    }
+    for (uint32_t i = 0; i < thread_count; i++) {
+        test_platform_thread_create(&threads[i], RecordCommandBuffer, (void *)&data[i]);
+    }
+    for (uint32_t i = 0; i < thread_count; i++) {
+        test_platform_thread_join(threads[i], NULL);
+    }
+    for (uint32_t i = 0; i < thread_count; i++) {
+        err = vkEndCommandBuffer(command_buffers[i]);
+        ASSERT_VK_SUCCESS(err);
+    }
+
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = thread_count;
+    submit_info.pCommandBuffers = command_buffers;
+    err = vkQueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    ASSERT_VK_SUCCESS(err);
+    vkQueueWaitIdle(m_device->m_queue);
+
+    m_errorMonitor->VerifyNotFound();
+
+    for (uint32_t i = 0; i < thread_count; i++) {
+        vkFreeCommandBuffers(m_device->device(), pools[i], 1, &command_buffers[i]);
+        vkDestroyCommandPool(m_device->device(), pools[i], NULL);
+    }
+    vkDestroyEvent(device(), event, NULL);
+}
+
 #endif // GTEST_IS_THREADSAFE
 #endif // THREADING_TESTS
 
@@ -12801,6 +13305,57 @@ TEST_F(VkLayerTest, CreatePipelineVertexOutputNotConsumed) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, CreatePipelineIdenticalShaderModules) {
+    TEST_DESCRIPTION("Test that shader modules created from identical SPIR-V, "
+                     "including after the first one is destroyed, are each "
+                     "validated the same way");
+
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    char const *vsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out float x;\n"
+        "out gl_PerVertex {\n"
+        "    vec4 gl_Position;\n"
+        "};\n"
+        "void main(){\n"
+        "   gl_Position = vec4(1);\n"
+        "   x = 0;\n"
+        "}\n";
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out vec4 color;\n"
+        "void main(){\n"
+        "   color = vec4(1);\n"
+        "}\n";
+
+    VkDescriptorSetObj descriptorSet(m_device);
+    descriptorSet.AppendDummy();
+    descriptorSet.CreateVKDescriptorSet(m_commandBuffer);
+
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    for (int i = 0; i < 3; i++) {
+        m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT,
+                                             "not consumed by fragment shader");
+
+        // Two live modules with the same code, after the previous pass destroyed its own
+        VkShaderObj vs(m_device, vsSource, VK_SHADER_STAGE_VERTEX_BIT, this);
+        VkShaderObj vs2(m_device, vsSource, VK_SHADER_STAGE_VERTEX_BIT, this);
+
+        VkPipelineObj pipe(m_device);
+        pipe.AddColorAttachment();
+        pipe.AddShader(i == 1 ? &vs2 : &vs);
+        pipe.AddShader(&fs);
+        pipe.CreateVKPipeline(descriptorSet.GetPipelineLayout(), renderPass());
+
+        m_errorMonitor->VerifyFound();
+    }
+}
+
 TEST_F(VkLayerTest, CreatePipelineFragmentInputNotProvided) {
     TEST_DESCRIPTION("Test that an error is produced for a fragment shader input "
                      "which is not present in the outputs of the previous stage");
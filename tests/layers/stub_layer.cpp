@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// A layer that does nothing, for measuring what the loader costs per layer, see loader_startup_bench.cpp.
+//
+// It only handles the commands it needs to take its place in the chain, and answers every other vkGetInstanceProcAddr
+// and vkGetDeviceProcAddr query with whatever the next element of the chain returns.  A library can only appear in a
+// chain once, since its state is keyed by dispatchable object, so to stack several of them a benchmark loads a copy of
+// the library per layer.
+
+#include <mutex>
+#include <string.h>
+#include <unordered_map>
+
+#include "vulkan/vk_layer.h"
+#include "vk_layer_table.h"
+
+namespace stub_layer {
+
+static const VkLayerProperties global_layer = {
+    "VK_LAYER_LUNARG_stub", VK_MAKE_VERSION(1, 0, VK_HEADER_VERSION), 1, "LunarG Stub Layer",
+};
+
+struct InstanceData {
+    PFN_vkGetInstanceProcAddr next_get_instance_proc_addr;
+    PFN_vkDestroyInstance next_destroy_instance;
+};
+
+struct DeviceData {
+    PFN_vkGetDeviceProcAddr next_get_device_proc_addr;
+    PFN_vkDestroyDevice next_destroy_device;
+};
+
+static std::mutex global_lock;
+static std::unordered_map<dispatch_key, InstanceData> instance_data_map;
+static std::unordered_map<dispatch_key, DeviceData> device_data_map;
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator,
+                                              VkInstance *pInstance) {
+    VkLayerInstanceCreateInfo *chain_info = get_chain_info(pCreateInfo, VK_LAYER_LINK_INFO);
+    PFN_vkGetInstanceProcAddr fpGetInstanceProcAddr = chain_info->u.pLayerInfo->pfnNextGetInstanceProcAddr;
+    PFN_vkCreateInstance fpCreateInstance = (PFN_vkCreateInstance)fpGetInstanceProcAddr(NULL, "vkCreateInstance");
+    if (fpCreateInstance == NULL) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    // Advance the link info for the next element on the chain
+    chain_info->u.pLayerInfo = chain_info->u.pLayerInfo->pNext;
+    VkResult result = fpCreateInstance(pCreateInfo, pAllocator, pInstance);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+
+    InstanceData data;
+    data.next_get_instance_proc_addr = fpGetInstanceProcAddr;
+    data.next_destroy_instance = (PFN_vkDestroyInstance)fpGetInstanceProcAddr(*pInstance, "vkDestroyInstance");
+    std::lock_guard<std::mutex> lock(global_lock);
+    instance_data_map[get_dispatch_key(*pInstance)] = data;
+    return result;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator) {
+    dispatch_key key = get_dispatch_key(instance);
+    PFN_vkDestroyInstance next_destroy_instance;
+    {
+        std::lock_guard<std::mutex> lock(global_lock);
+        next_destroy_instance = instance_data_map[key].next_destroy_instance;
+        instance_data_map.erase(key);
+    }
+    next_destroy_instance(instance, pAllocator);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo,
+                                            const VkAllocationCallbacks *pAllocator, VkDevice *pDevice) {
+    VkLayerDeviceCreateInfo *chain_info = get_chain_info(pCreateInfo, VK_LAYER_LINK_INFO);
+    PFN_vkGetInstanceProcAddr fpGetInstanceProcAddr = chain_info->u.pLayerInfo->pfnNextGetInstanceProcAddr;
+    PFN_vkGetDeviceProcAddr fpGetDeviceProcAddr = chain_info->u.pLayerInfo->pfnNextGetDeviceProcAddr;
+    PFN_vkCreateDevice fpCreateDevice = (PFN_vkCreateDevice)fpGetInstanceProcAddr(NULL, "vkCreateDevice");
+    if (fpCreateDevice == NULL) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    // Advance the link info for the next element on the chain
+    chain_info->u.pLayerInfo = chain_info->u.pLayerInfo->pNext;
+    VkResult result = fpCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+
+    DeviceData data;
+    data.next_get_device_proc_addr = fpGetDeviceProcAddr;
+    data.next_destroy_device = (PFN_vkDestroyDevice)fpGetDeviceProcAddr(*pDevice, "vkDestroyDevice");
+    std::lock_guard<std::mutex> lock(global_lock);
+    device_data_map[get_dispatch_key(*pDevice)] = data;
+    return result;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    dispatch_key key = get_dispatch_key(device);
+    PFN_vkDestroyDevice next_destroy_device;
+    {
+        std::lock_guard<std::mutex> lock(global_lock);
+        next_destroy_device = device_data_map[key].next_destroy_device;
+        device_data_map.erase(key);
+    }
+    next_destroy_device(device, pAllocator);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceLayerProperties(uint32_t *pCount, VkLayerProperties *pProperties) {
+    if (!pProperties) {
+        *pCount = 1;
+        return VK_SUCCESS;
+    }
+    if (*pCount < 1) {
+        return VK_INCOMPLETE;
+    }
+    *pProperties = global_layer;
+    *pCount = 1;
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceExtensionProperties(const char *pLayerName, uint32_t *pCount,
+                                                                    VkExtensionProperties *) {
+    if (pLayerName && !strcmp(pLayerName, global_layer.layerName)) {
+        *pCount = 0;
+        return VK_SUCCESS;
+    }
+    return VK_ERROR_LAYER_NOT_PRESENT;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *funcName) {
+    if (!strcmp(funcName, "vkGetDeviceProcAddr"))
+        return (PFN_vkVoidFunction)GetDeviceProcAddr;
+    if (!strcmp(funcName, "vkDestroyDevice"))
+        return (PFN_vkVoidFunction)DestroyDevice;
+
+    PFN_vkGetDeviceProcAddr next_get_device_proc_addr = NULL;
+    {
+        std::lock_guard<std::mutex> lock(global_lock);
+        auto it = device_data_map.find(get_dispatch_key(device));
+        if (it != device_data_map.end())
+            next_get_device_proc_addr = it->second.next_get_device_proc_addr;
+    }
+    if (next_get_device_proc_addr == NULL)
+        return NULL;
+    return next_get_device_proc_addr(device, funcName);
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *funcName) {
+    if (!strcmp(funcName, "vkGetInstanceProcAddr"))
+        return (PFN_vkVoidFunction)GetInstanceProcAddr;
+    if (!strcmp(funcName, "vkCreateInstance"))
+        return (PFN_vkVoidFunction)CreateInstance;
+    if (!strcmp(funcName, "vkDestroyInstance"))
+        return (PFN_vkVoidFunction)DestroyInstance;
+    if (!strcmp(funcName, "vkCreateDevice"))
+        return (PFN_vkVoidFunction)CreateDevice;
+    if (!strcmp(funcName, "vkEnumerateInstanceLayerProperties"))
+        return (PFN_vkVoidFunction)EnumerateInstanceLayerProperties;
+    if (!strcmp(funcName, "vkEnumerateInstanceExtensionProperties"))
+        return (PFN_vkVoidFunction)EnumerateInstanceExtensionProperties;
+
+    if (!strcmp(funcName, "vkGetDeviceProcAddr"))
+        return (PFN_vkVoidFunction)GetDeviceProcAddr;
+    if (!strcmp(funcName, "vkDestroyDevice"))
+        return (PFN_vkVoidFunction)DestroyDevice;
+
+    if (instance == VK_NULL_HANDLE)
+        return NULL;
+
+    PFN_vkGetInstanceProcAddr next_get_instance_proc_addr = NULL;
+    {
+        std::lock_guard<std::mutex> lock(global_lock);
+        auto it = instance_data_map.find(get_dispatch_key(instance));
+        if (it != instance_data_map.end())
+            next_get_instance_proc_addr = it->second.next_get_instance_proc_addr;
+    }
+    if (next_get_instance_proc_addr == NULL)
+        return NULL;
+    return next_get_instance_proc_addr(instance, funcName);
+}
+
+} // namespace stub_layer
+
+VK_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char *funcName) {
+    return stub_layer::GetInstanceProcAddr(instance, funcName);
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char *funcName) {
+    return stub_layer::GetDeviceProcAddr(device, funcName);
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties(uint32_t *pCount,
+                                                                                  VkLayerProperties *pProperties) {
+    return stub_layer::EnumerateInstanceLayerProperties(pCount, pProperties);
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char *pLayerName, uint32_t *pCount,
+                                                                                      VkExtensionProperties *pProperties) {
+    return stub_layer::EnumerateInstanceExtensionProperties(pLayerName, pCount, pProperties);
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for what a vkCmd* call costs going through the loader and a chain of layers, run against the stub ICD in
+// icd/ so it needs no GPU:
+//
+//     VK_ICD_FILENAMES=icd/VkICD_stub.json VK_LAYER_PATH=../layers vk_loader_call_bench [iterations] [layer...]
+//
+// With no layers named it enables threading, parameter_validation, object_tracker, core_validation and unique_objects;
+// name "none" to time the loader alone.  It records each command iterations times into one command buffer and reports
+// the average per call as key/value lines.  Every command is given valid arguments, so any validation message fails it.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+namespace {
+
+const char *const default_layers[] = {
+    "VK_LAYER_GOOGLE_threading", "VK_LAYER_LUNARG_parameter_validation", "VK_LAYER_LUNARG_object_tracker",
+    "VK_LAYER_LUNARG_core_validation", "VK_LAYER_GOOGLE_unique_objects",
+};
+
+unsigned validation_messages = 0;
+
+// Only counts what layers report, the loader complains about the stub ICD having no device extensions
+VKAPI_ATTR VkBool32 VKAPI_CALL countMessage(VkDebugReportFlagsEXT, VkDebugReportObjectTypeEXT, uint64_t, size_t, int32_t,
+                                            const char *pLayerPrefix, const char *pMessage, void *) {
+    if (!strcmp(pLayerPrefix, "loader")) {
+        return VK_FALSE;
+    }
+    if (validation_messages++ == 0) {
+        fprintf(stderr, "%s: %s\n", pLayerPrefix, pMessage);
+    }
+    return VK_FALSE;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+double nanoseconds(Clock::duration elapsed, unsigned iterations) {
+    return iterations ? std::chrono::duration<double, std::nano>(elapsed).count() / iterations : 0.0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned iterations = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 100000;
+    std::vector<const char *> layers;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "none")) {
+            layers.push_back(argv[i]);
+        }
+    }
+    if (argc <= 2) {
+        layers.assign(default_layers, default_layers + sizeof(default_layers) / sizeof(default_layers[0]));
+    }
+
+    const char *extensions[] = {VK_EXT_DEBUG_REPORT_EXTENSION_NAME};
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_info.enabledLayerCount = static_cast<uint32_t>(layers.size());
+    instance_info.ppEnabledLayerNames = layers.data();
+    instance_info.enabledExtensionCount = 1;
+    instance_info.ppEnabledExtensionNames = extensions;
+    VkInstance instance;
+    if (vkCreateInstance(&instance_info, nullptr, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateInstance failed, is VK_ICD_FILENAMES set to the stub ICD and VK_LAYER_PATH to the "
+                        "layers?\n");
+        return 1;
+    }
+
+    VkDebugReportCallbackCreateInfoEXT callback_info = {};
+    callback_info.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
+    callback_info.flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT |
+                          VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT;
+    callback_info.pfnCallback = countMessage;
+    PFN_vkCreateDebugReportCallbackEXT create_callback = reinterpret_cast<PFN_vkCreateDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkCreateDebugReportCallbackEXT"));
+    PFN_vkDestroyDebugReportCallbackEXT destroy_callback = reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(instance, "vkDestroyDebugReportCallbackEXT"));
+    VkDebugReportCallbackEXT callback = VK_NULL_HANDLE;
+    if (create_callback) {
+        create_callback(instance, &callback_info, nullptr, &callback);
+    }
+
+    uint32_t gpu_count = 0;
+    vkEnumeratePhysicalDevices(instance, &gpu_count, nullptr);
+    std::vector<VkPhysicalDevice> gpus(gpu_count);
+    VkResult result = vkEnumeratePhysicalDevices(instance, &gpu_count, gpus.data());
+    if (result != VK_SUCCESS || gpu_count < 1) {
+        fprintf(stderr, "vkEnumeratePhysicalDevices found no physical device\n");
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    uint32_t queue_family_count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(gpus[0], &queue_family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+    vkGetPhysicalDeviceQueueFamilyProperties(gpus[0], &queue_family_count, queue_families.data());
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_info = {};
+    device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    VkDevice device;
+    if (vkCreateDevice(gpus[0], &device_info, nullptr, &device) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDevice failed\n");
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    VkCommandPoolCreateInfo pool_info = {};
+    pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    VkCommandPool pool;
+    vkCreateCommandPool(device, &pool_info, nullptr, &pool);
+    VkCommandBufferAllocateInfo allocate_info = {};
+    allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocate_info.commandPool = pool;
+    allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocate_info.commandBufferCount = 1;
+    VkCommandBuffer command_buffer;
+    vkAllocateCommandBuffers(device, &allocate_info, &command_buffer);
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    vkBeginCommandBuffer(command_buffer, &begin_info);
+
+    const float blend_constants[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    Clock::duration line_width, depth_bias, blend, depth_bounds, stencil_reference;
+    auto start = Clock::now();
+    for (unsigned i = 0; i < iterations; i++) {
+        vkCmdSetLineWidth(command_buffer, 1.0f);
+    }
+    line_width = Clock::now() - start;
+    start = Clock::now();
+    for (unsigned i = 0; i < iterations; i++) {
+        vkCmdSetDepthBias(command_buffer, 0.0f, 0.0f, 0.0f);
+    }
+    depth_bias = Clock::now() - start;
+    start = Clock::now();
+    for (unsigned i = 0; i < iterations; i++) {
+        vkCmdSetBlendConstants(command_buffer, blend_constants);
+    }
+    blend = Clock::now() - start;
+    start = Clock::now();
+    for (unsigned i = 0; i < iterations; i++) {
+        vkCmdSetDepthBounds(command_buffer, 0.0f, 1.0f);
+    }
+    depth_bounds = Clock::now() - start;
+    start = Clock::now();
+    for (unsigned i = 0; i < iterations; i++) {
+        vkCmdSetStencilReference(command_buffer, VK_STENCIL_FRONT_AND_BACK, 0);
+    }
+    stencil_reference = Clock::now() - start;
+
+    vkEndCommandBuffer(command_buffer);
+    vkFreeCommandBuffers(device, pool, 1, &command_buffer);
+    vkDestroyCommandPool(device, pool, nullptr);
+    vkDestroyDevice(device, nullptr);
+    if (callback != VK_NULL_HANDLE) {
+        destroy_callback(instance, callback, nullptr);
+    }
+    vkDestroyInstance(instance, nullptr);
+
+    printf("layers %zu\n", layers.size());
+    printf("iterations %u\n", iterations);
+    printf("ns_per_vkCmdSetLineWidth %.1f\n", nanoseconds(line_width, iterations));
+    printf("ns_per_vkCmdSetDepthBias %.1f\n", nanoseconds(depth_bias, iterations));
+    printf("ns_per_vkCmdSetBlendConstants %.1f\n", nanoseconds(blend, iterations));
+    printf("ns_per_vkCmdSetDepthBounds %.1f\n", nanoseconds(depth_bounds, iterations));
+    printf("ns_per_vkCmdSetStencilReference %.1f\n", nanoseconds(stencil_reference, iterations));
+    printf("validation_messages %u\n", validation_messages);
+
+    return validation_messages ? 1 : 0;
+}
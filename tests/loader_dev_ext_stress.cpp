@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Stress test for the trampolines the loader hands out from vkGetInstanceProcAddr for device entry points it doesn't
+// know, run against the stub ICD in icd/:
+//
+//     VK_ICD_FILENAMES=icd/VkICD_stub.json vk_loader_dev_ext_stress [names] [supported_every]
+//
+// Looks up names synthetic entry points, one in every supported_every of which the stub ICD supports.  Half are looked
+// up before creating a device and half after, so both ways of filling in a device's dispatch entries are covered.  It
+// checks that supported names get a trampoline of their own, that the rest get NULL, that looking a name up again
+// gives the same trampoline, and that calling every trampoline reaches the ICD.  Then reports timing as key/value lines.
+// By default 2500 names are supported, more than the loader has static trampolines for, so the ones it generates past
+// those are called too, both for names looked up before the device was created and after.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+namespace {
+
+typedef void(VKAPI_PTR *PFN_SyntheticEntryPoint)(VkDevice device, uint32_t *calls);
+
+std::string syntheticName(unsigned i, unsigned supported_every) {
+    return (i % supported_every == 0 ? "vkStubSupported" : "vkStubUnsupported") + std::to_string(i);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned name_count = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 10000;
+    unsigned supported_every = (argc > 2) ? static_cast<unsigned>(atoi(argv[2])) : 4;
+    if (supported_every == 0) {
+        supported_every = 1;
+    }
+
+    std::vector<std::string> names;
+    for (unsigned i = 0; i < name_count; i++) {
+        names.push_back(syntheticName(i, supported_every));
+    }
+
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    VkInstance instance;
+    if (vkCreateInstance(&instance_info, nullptr, &instance) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateInstance failed, is VK_ICD_FILENAMES set to the stub ICD?\n");
+        return 1;
+    }
+
+    uint32_t gpu_count = 1;
+    VkPhysicalDevice gpu;
+    VkResult result = vkEnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || gpu_count < 1) {
+        fprintf(stderr, "vkEnumeratePhysicalDevices found no physical device\n");
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_info = {};
+    device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+
+    unsigned failures = 0;
+    std::vector<PFN_vkVoidFunction> trampolines(name_count);
+    VkDevice device = VK_NULL_HANDLE;
+
+    typedef std::chrono::steady_clock clock;
+    auto first_start = clock::now();
+    for (unsigned i = 0; i < name_count; i++) {
+        if (i == name_count / 2 && vkCreateDevice(gpu, &device_info, nullptr, &device) != VK_SUCCESS) {
+            fprintf(stderr, "vkCreateDevice failed\n");
+            vkDestroyInstance(instance, nullptr);
+            return 1;
+        }
+        trampolines[i] = vkGetInstanceProcAddr(instance, names[i].c_str());
+    }
+    auto first_elapsed = clock::now() - first_start;
+    if (device == VK_NULL_HANDLE && vkCreateDevice(gpu, &device_info, nullptr, &device) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDevice failed\n");
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+
+    std::set<PFN_vkVoidFunction> distinct;
+    unsigned supported = 0;
+    uint32_t calls = 0;
+    for (unsigned i = 0; i < name_count; i++) {
+        if (i % supported_every != 0) {
+            if (trampolines[i]) {
+                fprintf(stderr, "%s isn't supported by any ICD but has a trampoline\n", names[i].c_str());
+                failures++;
+            }
+            continue;
+        }
+        supported++;
+        if (!trampolines[i]) {
+            fprintf(stderr, "%s got no trampoline\n", names[i].c_str());
+            failures++;
+            continue;
+        }
+        if (!distinct.insert(trampolines[i]).second) {
+            fprintf(stderr, "%s shares its trampoline with another name\n", names[i].c_str());
+            failures++;
+        }
+        uint32_t before = calls;
+        reinterpret_cast<PFN_SyntheticEntryPoint>(trampolines[i])(device, &calls);
+        if (calls != before + 1) {
+            fprintf(stderr, "Calling %s through its trampoline didn't reach the ICD\n", names[i].c_str());
+            failures++;
+        }
+    }
+
+    auto second_start = clock::now();
+    for (unsigned i = 0; i < name_count; i++) {
+        if (vkGetInstanceProcAddr(instance, names[i].c_str()) != trampolines[i]) {
+            fprintf(stderr, "Looking %s up again gave a different answer\n", names[i].c_str());
+            failures++;
+        }
+    }
+    auto second_elapsed = clock::now() - second_start;
+
+    vkDestroyDevice(device, nullptr);
+    vkDestroyInstance(instance, nullptr);
+
+    typedef std::chrono::duration<double, std::nano> nanoseconds;
+    printf("names %u\n", name_count);
+    printf("supported %u\n", supported);
+    printf("trampolines %zu\n", distinct.size());
+    printf("calls %u\n", calls);
+    printf("failures %u\n", failures);
+    printf("ns_per_first_lookup %.1f\n", name_count ? nanoseconds(first_elapsed).count() / name_count : 0.0);
+    printf("ns_per_repeat_lookup %.1f\n", name_count ? nanoseconds(second_elapsed).count() / name_count : 0.0);
+
+    return failures ? 1 : 0;
+}
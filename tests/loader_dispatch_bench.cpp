@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for filling a whole device dispatch table through the loader's vkGetDeviceProcAddr, the way layers and
+// engines that keep their own dispatch tables do.
+//
+// No ICD is needed: the device is a stand-in whose dispatch pointer leads to a table of made-up entry points, which is
+// all vkGetDeviceProcAddr reads for the names the loader resolves itself.  The benchmark first checks that every entry
+// point comes back from that table, so that a name missing from the loader's lookup (which would then go down the
+// chain to the stand-in's GetDeviceProcAddr and come back NULL) fails it, then times filling the table.
+//
+// Usage: vk_loader_dispatch_bench [iterations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "vk_dispatch_table_helper.h"
+
+namespace {
+
+// Only what vkGetDeviceProcAddr looks at: the dispatch pointer every dispatchable object starts with
+struct StandInDevice {
+    const VkLayerDispatchTable *dispatch;
+};
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL StandInGetDeviceProcAddr(VkDevice, const char *) { return nullptr; }
+
+unsigned lookups = 0;
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL CountingGetDeviceProcAddr(VkDevice device, const char *name) {
+    ++lookups;
+    return vkGetDeviceProcAddr(device, name);
+}
+
+// Entry points vkGetDeviceProcAddr answers with the loader's own functions rather than the dispatch table's
+bool isLoaderEntryPoint(const VkLayerDispatchTable &table, const PFN_vkVoidFunction *slot) {
+    const PFN_vkVoidFunction *first = reinterpret_cast<const PFN_vkVoidFunction *>(&table);
+    const PFN_vkVoidFunction *own[] = {
+        first + offsetof(VkLayerDispatchTable, GetDeviceProcAddr) / sizeof(PFN_vkVoidFunction),
+        first + offsetof(VkLayerDispatchTable, DestroyDevice) / sizeof(PFN_vkVoidFunction),
+        first + offsetof(VkLayerDispatchTable, GetDeviceQueue) / sizeof(PFN_vkVoidFunction),
+        first + offsetof(VkLayerDispatchTable, AllocateCommandBuffers) / sizeof(PFN_vkVoidFunction),
+    };
+    for (const PFN_vkVoidFunction *entry : own) {
+        if (slot == entry) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned iterations = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 100000;
+
+    // Every slot gets a distinct made-up address, so a name resolved to the wrong slot shows up too
+    const size_t slot_count = sizeof(VkLayerDispatchTable) / sizeof(PFN_vkVoidFunction);
+    VkLayerDispatchTable source;
+    PFN_vkVoidFunction *source_slots = reinterpret_cast<PFN_vkVoidFunction *>(&source);
+    for (size_t i = 0; i < slot_count; i++) {
+        source_slots[i] = reinterpret_cast<PFN_vkVoidFunction>(static_cast<uintptr_t>(0x1000 + 0x10 * i));
+    }
+    source.GetDeviceProcAddr = StandInGetDeviceProcAddr;
+
+    StandInDevice stand_in = {&source};
+    VkDevice device = reinterpret_cast<VkDevice>(&stand_in);
+
+    VkLayerDispatchTable table;
+    layer_init_device_dispatch_table(device, &table, CountingGetDeviceProcAddr);
+
+    const PFN_vkVoidFunction *slots = reinterpret_cast<const PFN_vkVoidFunction *>(&table);
+    unsigned mismatches = 0;
+    for (size_t i = 0; i < slot_count; i++) {
+        if (isLoaderEntryPoint(table, &slots[i])) {
+            if (!slots[i]) {
+                fprintf(stderr, "Dispatch table slot %zu has no loader entry point\n", i);
+                mismatches++;
+            }
+        } else if (slots[i] != source_slots[i]) {
+            fprintf(stderr, "Dispatch table slot %zu wasn't resolved from the device's dispatch table\n", i);
+            mismatches++;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; i++) {
+        layer_init_device_dispatch_table(device, &table, vkGetDeviceProcAddr);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    typedef std::chrono::duration<double, std::nano> nanoseconds;
+    double table_ns = iterations ? nanoseconds(elapsed).count() / iterations : 0.0;
+    printf("entry_points %u\n", lookups);
+    printf("mismatches %u\n", mismatches);
+    printf("iterations %u\n", iterations);
+    printf("ns_per_table %.1f\n", table_ns);
+    printf("ns_per_entry_point %.2f\n", lookups ? table_ns / lookups : 0.0);
+
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2016 The Khronos Group Inc.
+ * Copyright (c) 2016 Valve Corporation
+ * Copyright (c) 2016 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for the loader's startup work, run against the stub ICD in icd/ and the stub layer in layers/, so it needs
+// no GPU:
+//
+//     VK_ICD_FILENAMES=icd/VkICD_stub.json vk_loader_startup_bench [iterations] [stub_layer_library]
+//
+// For each configuration it writes manifests for a number of explicit layers, all of which are enabled, and of
+// implicit layers into a scratch directory, pointing each at its own copy of the stub layer library, and points the
+// loader at them through VK_LAYER_PATH and XDG_DATA_HOME.  It then times vkEnumerateInstanceLayerProperties, creating
+// and destroying an instance and a device, and filling a device dispatch table through vkGetDeviceProcAddr, and reports
+// the averages as key/value lines, with keys prefixed by the configuration.
+//
+// Implicit layers installed on the machine are still found, so run it where there are none for comparable results.
+// Windows only finds implicit layers through the registry, so configurations with implicit layers are skipped there.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <direct.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+#include "vk_dispatch_table_helper.h"
+
+namespace {
+
+struct Configuration {
+    unsigned explicit_layers;
+    unsigned implicit_layers;
+};
+
+const Configuration configurations[] = {
+    {0, 0}, {1, 0}, {8, 0}, {32, 0}, {0, 1}, {0, 8}, {8, 8},
+};
+
+#if defined(_WIN32)
+const char default_layer_library[] = "layers\\VkLayer_stub.dll";
+const char library_suffix[] = ".dll";
+#else
+const char default_layer_library[] = "layers/libVkLayer_stub.so";
+const char library_suffix[] = ".so";
+#endif
+
+// Files and directories the benchmark made, removed in reverse order at exit
+std::vector<std::pair<std::string, bool>> created_paths;
+
+std::string absolutePath(const std::string &path) {
+#if defined(_WIN32)
+    char full_path[_MAX_PATH];
+    return _fullpath(full_path, path.c_str(), sizeof(full_path)) ? std::string(full_path) : path;
+#else
+    char *full_path = realpath(path.c_str(), nullptr);
+    if (!full_path) {
+        return path;
+    }
+    std::string result(full_path);
+    free(full_path);
+    return result;
+#endif
+}
+
+bool makeDirectory(const std::string &path) {
+#if defined(_WIN32)
+    bool made = _mkdir(path.c_str()) == 0;
+#else
+    bool made = mkdir(path.c_str(), 0755) == 0;
+#endif
+    if (made) {
+        created_paths.push_back(std::make_pair(path, true));
+    }
+    return made;
+}
+
+std::string makeScratchDirectory() {
+#if defined(_WIN32)
+    const char *temp = getenv("TEMP");
+    std::string path = std::string(temp ? temp : ".") + "\\vk_loader_startup_bench." + std::to_string(_getpid());
+    return makeDirectory(path) ? path : std::string();
+#else
+    const char *temp = getenv("TMPDIR");
+    std::string pattern = std::string(temp ? temp : "/tmp") + "/vk_loader_startup_bench.XXXXXX";
+    std::vector<char> path(pattern.begin(), pattern.end());
+    path.push_back('\0');
+    if (!mkdtemp(path.data())) {
+        return std::string();
+    }
+    created_paths.push_back(std::make_pair(std::string(path.data()), true));
+    return std::string(path.data());
+#endif
+}
+
+void removeCreatedPaths() {
+    for (auto it = created_paths.rbegin(); it != created_paths.rend(); ++it) {
+#if defined(_WIN32)
+        it->second ? _rmdir(it->first.c_str()) : remove(it->first.c_str());
+#else
+        it->second ? rmdir(it->first.c_str()) : remove(it->first.c_str());
+#endif
+    }
+    created_paths.clear();
+}
+
+bool writeFile(const std::string &path, const std::string &contents) {
+    std::ofstream file(path.c_str(), std::ios::binary);
+    file << contents;
+    if (!file) {
+        return false;
+    }
+    created_paths.push_back(std::make_pair(path, false));
+    return true;
+}
+
+bool copyFile(const std::string &from, const std::string &to) {
+    std::ifstream source(from.c_str(), std::ios::binary);
+    std::ofstream destination(to.c_str(), std::ios::binary);
+    if (!source || !destination) {
+        return false;
+    }
+    destination << source.rdbuf();
+    if (!destination) {
+        return false;
+    }
+    created_paths.push_back(std::make_pair(to, false));
+    return true;
+}
+
+void setEnvironment(const char *name, const std::string &value) {
+#if defined(_WIN32)
+    _putenv_s(name, value.c_str());
+#else
+    setenv(name, value.c_str(), 1);
+#endif
+}
+
+std::string jsonString(const std::string &value) {
+    std::string quoted = "\"";
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+std::string layerName(bool implicit, unsigned index) {
+    return std::string(implicit ? "VK_LAYER_BENCH_implicit_" : "VK_LAYER_BENCH_explicit_") + std::to_string(index);
+}
+
+std::string layerManifest(bool implicit, unsigned index, const std::string &library) {
+    std::string name = layerName(implicit, index);
+    std::string manifest;
+    manifest += "{\n";
+    manifest += "    \"file_format_version\" : \"1.0.0\",\n";
+    manifest += "    \"layer\" : {\n";
+    manifest += "        \"name\": " + jsonString(name) + ",\n";
+    manifest += "        \"type\": \"GLOBAL\",\n";
+    manifest += "        \"library_path\": " + jsonString(library) + ",\n";
+    manifest += "        \"api_version\": \"1.0." + std::to_string(VK_HEADER_VERSION) + "\",\n";
+    manifest += "        \"implementation_version\": \"1\",\n";
+    manifest += "        \"description\": \"Stub layer for benchmarking\"";
+    if (implicit) {
+        manifest += ",\n        \"disable_environment\": { " + jsonString("DISABLE_" + name) + ": \"1\" }";
+    }
+    manifest += "\n    }\n}\n";
+    return manifest;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+double microseconds(Clock::duration elapsed, unsigned iterations) {
+    return iterations ? std::chrono::duration<double, std::micro>(elapsed).count() / iterations : 0.0;
+}
+
+struct Timings {
+    Clock::duration enumerate_layers = Clock::duration::zero();
+    Clock::duration create_instance = Clock::duration::zero();
+    Clock::duration destroy_instance = Clock::duration::zero();
+    Clock::duration create_device = Clock::duration::zero();
+    Clock::duration destroy_device = Clock::duration::zero();
+    Clock::duration device_table = Clock::duration::zero();
+};
+
+// Goes through startup once, adding what each step took to timings.  Returns false and says why if a step fails.
+bool runOnce(const std::vector<const char *> &enabled_layers, uint32_t expected_layers, Timings &timings) {
+    auto start = Clock::now();
+    uint32_t layer_count = 0;
+    vkEnumerateInstanceLayerProperties(&layer_count, nullptr);
+    std::vector<VkLayerProperties> layers(layer_count);
+    VkResult result = vkEnumerateInstanceLayerProperties(&layer_count, layers.data());
+    timings.enumerate_layers += Clock::now() - start;
+    if (result != VK_SUCCESS || layer_count < expected_layers) {
+        fprintf(stderr, "vkEnumerateInstanceLayerProperties found %u layers, expected at least %u\n", layer_count,
+                expected_layers);
+        return false;
+    }
+
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_info.enabledLayerCount = static_cast<uint32_t>(enabled_layers.size());
+    instance_info.ppEnabledLayerNames = enabled_layers.data();
+    VkInstance instance;
+    start = Clock::now();
+    result = vkCreateInstance(&instance_info, nullptr, &instance);
+    timings.create_instance += Clock::now() - start;
+    if (result != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateInstance failed, is VK_ICD_FILENAMES set to the stub ICD?\n");
+        return false;
+    }
+
+    uint32_t gpu_count = 1;
+    VkPhysicalDevice gpu;
+    result = vkEnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || gpu_count < 1) {
+        fprintf(stderr, "vkEnumeratePhysicalDevices found no physical device\n");
+        vkDestroyInstance(instance, nullptr);
+        return false;
+    }
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_info = {};
+    device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    device_info.enabledLayerCount = static_cast<uint32_t>(enabled_layers.size());
+    device_info.ppEnabledLayerNames = enabled_layers.data();
+    VkDevice device;
+    start = Clock::now();
+    result = vkCreateDevice(gpu, &device_info, nullptr, &device);
+    timings.create_device += Clock::now() - start;
+    if (result != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDevice failed\n");
+        vkDestroyInstance(instance, nullptr);
+        return false;
+    }
+
+    VkLayerDispatchTable table;
+    start = Clock::now();
+    layer_init_device_dispatch_table(device, &table, vkGetDeviceProcAddr);
+    timings.device_table += Clock::now() - start;
+
+    start = Clock::now();
+    vkDestroyDevice(device, nullptr);
+    timings.destroy_device += Clock::now() - start;
+
+    start = Clock::now();
+    vkDestroyInstance(instance, nullptr);
+    timings.destroy_instance += Clock::now() - start;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    unsigned iterations = (argc > 1) ? static_cast<unsigned>(atoi(argv[1])) : 20;
+    std::string layer_library = absolutePath((argc > 2) ? argv[2] : default_layer_library);
+
+    std::vector<Configuration> runs;
+    unsigned max_explicit = 0, max_implicit = 0;
+    for (const Configuration &configuration : configurations) {
+#if defined(_WIN32)
+        if (configuration.implicit_layers) {
+            continue;
+        }
+#endif
+        runs.push_back(configuration);
+        max_explicit = std::max(max_explicit, configuration.explicit_layers);
+        max_implicit = std::max(max_implicit, configuration.implicit_layers);
+    }
+
+    std::string scratch = makeScratchDirectory();
+    if (scratch.empty()) {
+        fprintf(stderr, "Couldn't make a scratch directory\n");
+        return 1;
+    }
+
+    // A copy of the library per layer, since a library only gets loaded once however many manifests name it
+    std::string library_dir = scratch + "/lib";
+    std::vector<std::string> explicit_libraries, implicit_libraries;
+    bool ready = makeDirectory(library_dir);
+    for (unsigned i = 0; ready && i < max_explicit + max_implicit; i++) {
+        std::string copy = library_dir + "/VkLayer_stub_" + std::to_string(i) + library_suffix;
+        ready = copyFile(layer_library, copy);
+        (i < max_explicit ? explicit_libraries : implicit_libraries).push_back(copy);
+    }
+    if (!ready) {
+        fprintf(stderr, "Couldn't copy %s, pass the path of the stub layer library\n", layer_library.c_str());
+        removeCreatedPaths();
+        return 1;
+    }
+
+    printf("iterations %u\n", iterations);
+    unsigned failures = 0;
+    for (const Configuration &configuration : runs) {
+        std::string prefix = "explicit" + std::to_string(configuration.explicit_layers) + "_implicit" +
+                             std::to_string(configuration.implicit_layers);
+
+        std::string explicit_dir = scratch + "/" + prefix + "_explicit";
+        std::string data_dir = scratch + "/" + prefix + "_data";
+        std::string implicit_dir = data_dir + "/vulkan/implicit_layer.d";
+        ready = makeDirectory(explicit_dir) && makeDirectory(data_dir) && makeDirectory(data_dir + "/vulkan") &&
+                makeDirectory(implicit_dir);
+        std::vector<std::string> names;
+        for (unsigned i = 0; ready && i < configuration.explicit_layers; i++) {
+            names.push_back(layerName(false, i));
+            ready = writeFile(explicit_dir + "/" + names.back() + ".json",
+                              layerManifest(false, i, explicit_libraries[i]));
+        }
+        for (unsigned i = 0; ready && i < configuration.implicit_layers; i++) {
+            ready = writeFile(implicit_dir + "/" + layerName(true, i) + ".json",
+                              layerManifest(true, i, implicit_libraries[i]));
+        }
+        if (!ready) {
+            fprintf(stderr, "Couldn't write layer manifests under %s\n", scratch.c_str());
+            failures++;
+            break;
+        }
+        setEnvironment("VK_LAYER_PATH", explicit_dir);
+        setEnvironment("XDG_DATA_HOME", data_dir);
+
+        std::vector<const char *> enabled_layers;
+        for (const std::string &name : names) {
+            enabled_layers.push_back(name.c_str());
+        }
+        uint32_t expected_layers = configuration.explicit_layers + configuration.implicit_layers;
+
+        // The first time through loads libraries and fills the loader's manifest cache, so it isn't counted
+        Timings timings;
+        if (!runOnce(enabled_layers, expected_layers, timings)) {
+            failures++;
+            continue;
+        }
+        timings = Timings();
+        for (unsigned i = 0; i < iterations; i++) {
+            if (!runOnce(enabled_layers, expected_layers, timings)) {
+                failures++;
+                break;
+            }
+        }
+
+        printf("%s_us_per_enumerate_layers %.1f\n", prefix.c_str(), microseconds(timings.enumerate_layers, iterations));
+        printf("%s_us_per_create_instance %.1f\n", prefix.c_str(), microseconds(timings.create_instance, iterations));
+        printf("%s_us_per_destroy_instance %.1f\n", prefix.c_str(), microseconds(timings.destroy_instance, iterations));
+        printf("%s_us_per_create_device %.1f\n", prefix.c_str(), microseconds(timings.create_device, iterations));
+        printf("%s_us_per_destroy_device %.1f\n", prefix.c_str(), microseconds(timings.destroy_device, iterations));
+        printf("%s_us_per_device_table %.1f\n", prefix.c_str(), microseconds(timings.device_table, iterations));
+    }
+    printf("failures %u\n", failures);
+
+    removeCreatedPaths();
+    return failures ? 1 : 0;
+}
@@ -26,14 +26,59 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <vulkan/vulkan.h>
 #include "test_common.h"
 
+#if defined(__linux__)
+#include <cstdio>
+#include <cstring>
+#include <dlfcn.h>
+#include <unistd.h>
+
+// Count the manifest files the loader opens by interposing fopen, which the
+// executable's definition takes precedence for over the one in libc.  The
+// loader reads manifests on several threads.
+static std::atomic<unsigned> manifestOpenCount(0u);
+
+extern "C" FILE* fopen(char const* path, char const* mode)
+{
+    typedef FILE* (*PFN_fopen)(char const*, char const*);
+    static PFN_fopen const next = reinterpret_cast<PFN_fopen>(dlsym(RTLD_NEXT, "fopen"));
+
+    size_t const length = strlen(path);
+    if(length > 5 && strcmp(path + length - 5, ".json") == 0)
+    {
+        ++manifestOpenCount;
+    }
+
+    return next(path, mode);
+}
+
+// Count the libraries the loader opens the same way.
+static std::atomic<unsigned> libraryOpenCount(0u);
+
+extern "C" void* dlopen(char const* path, int flags)
+{
+    typedef void* (*PFN_dlopen)(char const*, int);
+    static PFN_dlopen const next = reinterpret_cast<PFN_dlopen>(dlsym(RTLD_NEXT, "dlopen"));
+
+    if(path)
+    {
+        ++libraryOpenCount;
+    }
+
+    return next(path, flags);
+}
+#endif
+
 namespace VK
 {
 
@@ -397,6 +442,209 @@ TEST(CreateInstance, LayerPresent)
     vkDestroyInstance(instance, nullptr);
 }
 
+// Allocator that counts the memory it has handed out and not had back.
+struct CountingAllocator
+{
+    CountingAllocator() :
+        outstanding(0u),
+        callbacks
+        {
+            this, // pUserData
+            allocate, // pfnAllocation
+            reallocate, // pfnReallocation
+            release, // pfnFree
+            nullptr, // pfnInternalAllocation
+            nullptr // pfnInternalFree
+        }
+    {
+    }
+
+    static VKAPI_ATTR void* VKAPI_CALL allocate(void* pUserData, size_t size, size_t, VkSystemAllocationScope)
+    {
+        void* const memory = malloc(size);
+        if(memory)
+        {
+            ++static_cast<CountingAllocator*>(pUserData)->outstanding;
+        }
+
+        return memory;
+    }
+
+    static VKAPI_ATTR void* VKAPI_CALL reallocate(void* pUserData, void* pOriginal, size_t size, size_t alignment,
+        VkSystemAllocationScope scope)
+    {
+        if(!pOriginal)
+        {
+            return allocate(pUserData, size, alignment, scope);
+        }
+
+        return realloc(pOriginal, size);
+    }
+
+    static VKAPI_ATTR void VKAPI_CALL release(void* pUserData, void* pMemory)
+    {
+        if(pMemory)
+        {
+            --static_cast<CountingAllocator*>(pUserData)->outstanding;
+            free(pMemory);
+        }
+    }
+
+    std::atomic<int> outstanding;
+    VkAllocationCallbacks callbacks;
+};
+
+// The loader carves the instance's bookkeeping out of a few blocks and frees them all when the instance goes away.
+TEST(CreateInstance, AllocationsReleased)
+{
+    CountingAllocator allocator;
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), &allocator.callbacks, &instance);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    uint32_t physicalCount = 0;
+    result = vkEnumeratePhysicalDevices(instance, &physicalCount, nullptr);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    vkDestroyInstance(instance, &allocator.callbacks);
+    ASSERT_EQ(allocator.outstanding.load(), 0);
+
+    // Including when creating the instance fails part way.
+    char const*const names[] = {"NotPresent"}; // Temporary required due to MSVC bug.
+    auto const info = VK::InstanceCreateInfo().
+        enabledLayerCount(1).
+        ppEnabledLayerNames(names);
+
+    result = vkCreateInstance(info, &allocator.callbacks, &instance);
+    ASSERT_EQ(result, VK_ERROR_LAYER_NOT_PRESENT);
+    ASSERT_EQ(allocator.outstanding.load(), 0);
+}
+
+#if defined(__linux__)
+// Allocator that counts the calls made to it from threads other than the one that created it.
+struct ThreadCheckingAllocator
+{
+    ThreadCheckingAllocator() :
+        owner(std::this_thread::get_id()),
+        foreignCalls(0u),
+        callbacks
+        {
+            this, // pUserData
+            allocate, // pfnAllocation
+            reallocate, // pfnReallocation
+            release, // pfnFree
+            nullptr, // pfnInternalAllocation
+            nullptr // pfnInternalFree
+        }
+    {
+    }
+
+    static void check(void* pUserData)
+    {
+        ThreadCheckingAllocator* const allocator = static_cast<ThreadCheckingAllocator*>(pUserData);
+        if(std::this_thread::get_id() != allocator->owner)
+        {
+            ++allocator->foreignCalls;
+        }
+    }
+
+    static VKAPI_ATTR void* VKAPI_CALL allocate(void* pUserData, size_t size, size_t, VkSystemAllocationScope)
+    {
+        check(pUserData);
+        return malloc(size);
+    }
+
+    static VKAPI_ATTR void* VKAPI_CALL reallocate(void* pUserData, void* pOriginal, size_t size, size_t,
+        VkSystemAllocationScope)
+    {
+        check(pUserData);
+        return realloc(pOriginal, size);
+    }
+
+    static VKAPI_ATTR void VKAPI_CALL release(void* pUserData, void* pMemory)
+    {
+        check(pUserData);
+        free(pMemory);
+    }
+
+    std::thread::id const owner;
+    std::atomic<unsigned> foreignCalls;
+    VkAllocationCallbacks callbacks;
+};
+
+// The loader searches manifest directories on threads of its own, but must only call the application's allocator on
+// the thread that called vkCreateInstance.
+TEST(CreateInstance, AllocationsOnCallingThread)
+{
+    // Enough layer directories, each with a few manifests in it, that the loader's threads get some of them.
+    std::vector<std::string> directories;
+    char const*const layerPath = getenv("VK_LAYER_PATH");
+    std::string const originalPath = layerPath ? layerPath : "";
+    std::string path = originalPath;
+    for(int i = 0; i < 16; ++i)
+    {
+        char directory[] = "/tmp/vk_loader_test_XXXXXX";
+        ASSERT_NE(mkdtemp(directory), nullptr);
+        directories.push_back(directory);
+        for(int j = 0; j < 4; ++j)
+        {
+            std::string const manifest = std::string(directory) + "/layer" + std::to_string(j) + ".json";
+            FILE* const file = fopen(manifest.c_str(), "w");
+            ASSERT_NE(file, nullptr);
+            fputs("{ \"file_format_version\" : \"1.0.0\" }\n", file);
+            fclose(file);
+        }
+        if(!path.empty())
+        {
+            path += ":";
+        }
+        path += directory;
+    }
+    setenv("VK_LAYER_PATH", path.c_str(), 1);
+
+    ThreadCheckingAllocator allocator;
+    char const*const names[] = {"NotPresent"}; // Temporary required due to MSVC bug.
+    auto const info = VK::InstanceCreateInfo().
+        enabledLayerCount(1).
+        ppEnabledLayerNames(names);
+
+    for(int pass = 0; pass < 10; ++pass)
+    {
+        VkInstance instance = VK_NULL_HANDLE;
+        VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), &allocator.callbacks, &instance);
+        EXPECT_EQ(result, VK_SUCCESS);
+        if(result == VK_SUCCESS)
+        {
+            vkDestroyInstance(instance, &allocator.callbacks);
+        }
+
+        // Failing to find a layer searches the directories too.
+        result = vkCreateInstance(info, &allocator.callbacks, &instance);
+        EXPECT_EQ(result, VK_ERROR_LAYER_NOT_PRESENT);
+    }
+
+    if(layerPath)
+    {
+        setenv("VK_LAYER_PATH", originalPath.c_str(), 1);
+    }
+    else
+    {
+        unsetenv("VK_LAYER_PATH");
+    }
+    for(auto const& directory : directories)
+    {
+        for(int j = 0; j < 4; ++j)
+        {
+            unlink((directory + "/layer" + std::to_string(j) + ".json").c_str());
+        }
+        rmdir(directory.c_str());
+    }
+
+    ASSERT_EQ(allocator.foreignCalls.load(), 0u);
+}
+#endif
+
 TEST(CreateDevice, ExtensionNotPresent)
 {
     VkInstance instance = VK_NULL_HANDLE;
@@ -542,6 +790,79 @@ TEST_F(EnumerateInstanceLayerProperties, PropertyCountLessThanAvailable)
     ASSERT_EQ(result, VK_INCOMPLETE);
 }
 
+#if defined(__linux__)
+// Look up a test hook in the stub ICD in icd/, which is only there when the loader is using it.
+template<typename Hook>
+Hook stubIcdHook(char const* name)
+{
+    void* const library = dlopen("libVkICD_stub.so", RTLD_NOW | RTLD_NOLOAD);
+    if(!library)
+    {
+        return nullptr;
+    }
+
+    void* const hook = dlsym(library, name);
+    dlclose(library);
+
+    return reinterpret_cast<Hook>(hook);
+}
+
+// The ICDs are asked for their physical devices once, after which the loader answers from the wrappers it made then.
+// Needs the stub ICD, as run_loader_tests.sh does: VK_ICD_FILENAMES=./icd/VkICD_stub.json
+TEST(EnumeratePhysicalDevices, AnsweredFromCache)
+{
+    VkInstance instance = VK_NULL_HANDLE;
+    VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    typedef uint32_t (VKAPI_PTR *PFN_stub_icdGetCallCount)(char const* pName);
+    typedef void (VKAPI_PTR *PFN_stub_icdSetPhysicalDeviceCount)(uint32_t count);
+    auto const getCallCount = stubIcdHook<PFN_stub_icdGetCallCount>("stub_icdGetCallCount");
+    auto const setPhysicalDeviceCount =
+        stubIcdHook<PFN_stub_icdSetPhysicalDeviceCount>("stub_icdSetPhysicalDeviceCount");
+    if(!getCallCount || !setPhysicalDeviceCount)
+    {
+        std::cout << "Skipped, the stub ICD isn't in use.\n";
+        vkDestroyInstance(instance, nullptr);
+        return;
+    }
+    setPhysicalDeviceCount(3u);
+
+    uint32_t count = 0u;
+    result = vkEnumeratePhysicalDevices(instance, &count, nullptr);
+    ASSERT_EQ(result, VK_SUCCESS);
+    ASSERT_EQ(count, 3u);
+
+    uint32_t const asked = getCallCount("vkEnumeratePhysicalDevices");
+
+    std::vector<VkPhysicalDevice> first(count);
+    result = vkEnumeratePhysicalDevices(instance, &count, first.data());
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    for(int pass = 0; pass < 100; ++pass)
+    {
+        uint32_t fewer = 2u;
+        std::vector<VkPhysicalDevice> physical(count);
+        result = vkEnumeratePhysicalDevices(instance, &fewer, physical.data());
+        ASSERT_EQ(result, VK_INCOMPLETE);
+        ASSERT_EQ(fewer, 2u);
+
+        uint32_t again = 0u;
+        result = vkEnumeratePhysicalDevices(instance, &again, nullptr);
+        ASSERT_EQ(result, VK_SUCCESS);
+        ASSERT_EQ(again, count);
+
+        result = vkEnumeratePhysicalDevices(instance, &again, physical.data());
+        ASSERT_EQ(result, VK_SUCCESS);
+        ASSERT_EQ(physical, first);
+    }
+
+    ASSERT_EQ(getCallCount("vkEnumeratePhysicalDevices"), asked);
+
+    vkDestroyInstance(instance, nullptr);
+}
+#endif
+
 TEST(EnumerateDeviceLayerProperties, PropertyCountLessThanAvailable)
 {
     VkInstance instance = VK_NULL_HANDLE;
@@ -641,6 +962,63 @@ TEST_F(EnumerateInstanceLayerProperties, TwoPass)
     }
 }
 
+#if defined(__linux__)
+// Manifests that have not changed since the last scan should not be read again.
+TEST_F(EnumerateInstanceLayerProperties, ManifestsReadOnce)
+{
+    uint32_t count = 0u;
+    VkResult result = vkEnumerateInstanceLayerProperties(&count, nullptr);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    // The extension query also reads the ICD manifests.
+    uint32_t extensionCount = 0u;
+    result = vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, nullptr);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    unsigned const opened = manifestOpenCount;
+
+    for(int pass = 0; pass < 10; ++pass)
+    {
+        uint32_t layerCount = 0u;
+        result = vkEnumerateInstanceLayerProperties(&layerCount, nullptr);
+        ASSERT_EQ(result, VK_SUCCESS);
+        ASSERT_EQ(layerCount, count);
+
+        extensionCount = 0u;
+        result = vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, nullptr);
+        ASSERT_EQ(result, VK_SUCCESS);
+    }
+
+    ASSERT_EQ(manifestOpenCount.load(), opened);
+}
+#endif
+
+// Manifests are found and read on several threads, which must not change the order layers are listed in.
+TEST_F(EnumerateInstanceLayerProperties, OrderIsStable)
+{
+    uint32_t count = 0u;
+    VkResult result = vkEnumerateInstanceLayerProperties(&count, nullptr);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    std::unique_ptr<VkLayerProperties[]> first(new VkLayerProperties[count]);
+    result = vkEnumerateInstanceLayerProperties(&count, first.get());
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    for(int pass = 0; pass < 20; ++pass)
+    {
+        uint32_t again = count;
+        std::unique_ptr<VkLayerProperties[]> properties(new VkLayerProperties[count]);
+        result = vkEnumerateInstanceLayerProperties(&again, properties.get());
+        ASSERT_EQ(result, VK_SUCCESS);
+        ASSERT_EQ(again, count);
+
+        for(uint32_t i = 0u; i < count; ++i)
+        {
+            ASSERT_STREQ(properties[i].layerName, first[i].layerName);
+        }
+    }
+}
+
 TEST_F(EnumerateInstanceExtensionProperties, PropertyCountLessThanAvailable)
 {
     uint32_t count = 0u;
@@ -696,6 +1074,38 @@ TEST(EnumerateDeviceExtensionProperties, PropertyCountLessThanAvailable)
     vkDestroyInstance(instance, nullptr);
 }
 
+#if defined(__linux__)
+// ICD extensions are remembered after the first query, so listing them again should not load any ICD library.
+TEST_F(EnumerateInstanceExtensionProperties, LibrariesLoadedOnce)
+{
+    uint32_t count = 0u;
+    VkResult result = vkEnumerateInstanceExtensionProperties(nullptr, &count, nullptr);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    std::unique_ptr<VkExtensionProperties[]> first(new VkExtensionProperties[count]);
+    result = vkEnumerateInstanceExtensionProperties(nullptr, &count, first.get());
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    unsigned const opened = libraryOpenCount;
+
+    for(int pass = 0; pass < 10; ++pass)
+    {
+        uint32_t again = count;
+        std::unique_ptr<VkExtensionProperties[]> properties(new VkExtensionProperties[count]);
+        result = vkEnumerateInstanceExtensionProperties(nullptr, &again, properties.get());
+        ASSERT_EQ(result, VK_SUCCESS);
+        ASSERT_EQ(again, count);
+
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            ASSERT_STREQ(properties[i].extensionName, first[i].extensionName);
+        }
+    }
+
+    ASSERT_EQ(libraryOpenCount.load(), opened);
+}
+#endif
+
 TEST_F(EnumerateInstanceExtensionProperties, Count)
 {
     uint32_t count = 0u;
@@ -78,10 +78,82 @@ RunEnumerateInstanceExtensionPropertiesTest()
 
 ./vk_loader_validation_tests
 
+# Tests that need the stub ICD, to see what the loader asks of the driver.
+VK_ICD_FILENAMES=./icd/VkICD_stub.json \
+    GTEST_FILTER=EnumeratePhysicalDevices.* \
+    ./vk_loader_validation_tests || exit 1
+
 RunCreateInstanceTest
 RunEnumerateInstanceLayerPropertiesTest
 RunEnumerateInstanceExtensionPropertiesTest
 
+# Check that vkGetDeviceProcAddr resolves every device entry point itself.
+./vk_loader_dispatch_bench 1000 > /dev/null || exit 1
+echo "Device dispatch lookup test PASSED"
+
+# Check the trampolines for unknown device entry points, using the stub ICD.
+VK_ICD_FILENAMES=./icd/VkICD_stub.json ./vk_loader_dev_ext_stress > /dev/null || exit 1
+echo "Device extension trampoline test PASSED"
+
+# Go through loader startup with synthetic layers, using the stub ICD and layer.
+VK_ICD_FILENAMES=./icd/VkICD_stub.json ./vk_loader_startup_bench 2 > /dev/null || exit 1
+echo "Loader startup benchmark PASSED"
+
+# Record commands through the validation layers, using the stub ICD.
+VK_ICD_FILENAMES=./icd/VkICD_stub.json VK_LAYER_PATH=../layers ./vk_loader_call_bench 100 > /dev/null || exit 1
+echo "Layer call benchmark PASSED"
+
+# Record from several threads through the threading layer, using the stub ICD.
+VK_ICD_FILENAMES=./icd/VkICD_stub.json VK_LAYER_PATH=../layers ./vk_layer_threading_bench 1000 4 > /dev/null || exit 1
+echo "Threading layer benchmark PASSED"
+
+# Record from several threads through core_validation, using the stub ICD.
+VK_ICD_FILENAMES=./icd/VkICD_stub.json VK_LAYER_PATH=../layers ./vk_layer_core_recording_bench 1000 4 > /dev/null || exit 1
+echo "Core validation recording benchmark PASSED"
+
+# Allocate and free command buffers from several threads through the object tracker, using the stub ICD.
+VK_ICD_FILENAMES=./icd/VkICD_stub.json VK_LAYER_PATH=../layers ./vk_layer_object_tracker_bench 1000 4 > /dev/null || exit 1
+echo "Object tracker benchmark PASSED"
+
+# Repeat one validation error on every call, then again with a message limit set, using the stub ICD.
+VK_ICD_FILENAMES=./icd/VkICD_stub.json VK_LAYER_PATH=../layers ./vk_layer_message_limit_bench 10000 > /dev/null || exit 1
+mkdir -p message_limit
+echo "lunarg_parameter_validation.message_limit = 10" > message_limit/vk_layer_settings.txt
+(cd message_limit && VK_ICD_FILENAMES=../icd/VkICD_stub.json VK_LAYER_PATH=../../layers ../vk_layer_message_limit_bench 10000 10) > /dev/null || exit 1
+echo "Message limit benchmark PASSED"
+
+# Draw with many descriptors bound through core_validation, using the stub ICD.
+VK_ICD_FILENAMES=./icd/VkICD_stub.json VK_LAYER_PATH=../layers ./vk_layer_descriptor_draw_bench 1000 > /dev/null || exit 1
+echo "Descriptor draw benchmark PASSED"
+
+# Create batches of pipelines with errors through core_validation, checking them one by one and then on worker
+# threads, using the stub ICD.
+VK_ICD_FILENAMES=./icd/VkICD_stub.json VK_LAYER_PATH=../layers ./vk_layer_pipeline_batch_bench 100 > /dev/null || exit 1
+mkdir -p pipeline_batch
+echo "lunarg_core_validation.pipeline_validation_threads = 3" > pipeline_batch/vk_layer_settings.txt
+(cd pipeline_batch && VK_ICD_FILENAMES=../icd/VkICD_stub.json VK_LAYER_PATH=../../layers ../vk_layer_pipeline_batch_bench 100) > /dev/null || exit 1
+echo "Pipeline batch benchmark PASSED"
+
+# Submit reads of unwritten and written memory through core_validation, using the stub ICD.
+VK_ICD_FILENAMES=./icd/VkICD_stub.json VK_LAYER_PATH=../layers ./vk_layer_queue_submit_bench 1000 > /dev/null || exit 1
+echo "Queue submit benchmark PASSED"
+
+# Check the unique objects handle table while several threads use it.
+./vk_layer_handle_table_bench 10000 4 1000 > /dev/null || exit 1
+echo "Handle table test PASSED"
+
+# Check the read mostly map behind the dispatch key map while several threads use it.
+./vk_layer_read_mostly_map_bench 10000 4 1000 > /dev/null || exit 1
+echo "Read mostly map test PASSED"
+
+# Check the core validation async record queue while several threads push to it.
+./vk_layer_async_queue_bench 10000 4 4096 > /dev/null || exit 1
+echo "Async record queue test PASSED"
+
+# Check the dispatch key map while several threads use it.
+./vk_layer_dispatch_key_map_bench 100000 4 8 > /dev/null || exit 1
+echo "Dispatch key map test PASSED"
+
 # Test the wrap objects layer.
 ./run_wrap_objects_tests.sh
 